@@ -0,0 +1,35 @@
+#!/bin/sh
+# Convert one Material Symbols SVG into an LVGL C image per size.
+#
+# The first size keeps the icon name, further sizes are suffixed with the
+# size, eg. './convert.sh camera.svg 64 24' writes icon_camera.c (64px) and
+# icon_camera_24.c (24px).
+#
+# Requires inkscape and LVGLImage.py (lvgl/scripts) on the PATH.
+set -e
+
+if [ $# -lt 2 ]; then
+  echo "usage: $0 <icon.svg> <size> [size...]" >&2
+  exit 1
+fi
+
+svg="$1"
+shift
+name="icon_$(basename "$svg" .svg)"
+dir="$(dirname "$0")"
+tmp="$(mktemp -d)"
+trap 'rm -rf "$tmp"' EXIT
+
+first=1
+for size in "$@"; do
+  if [ "$first" -eq 1 ]; then
+    out="$name"
+    first=0
+  else
+    out="${name}_${size}"
+  fi
+
+  inkscape -w "$size" -h "$size" "$svg" -o "$tmp/$out.png"
+  # alpha only, the theme recolours every image
+  LVGLImage.py --ofmt C --cf A8 --compress LZ4 -o "$dir" "$tmp/$out.png"
+done
@@ -20,87 +20,39 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_ADD_A_PHOTO uint8_t
     icon_add_a_photo_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0xab, 0x04, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0xff, 0x59, 0x6f, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0x71, 0x01, 0x47, 0x0f, 0x60,
-        0x00, 0xdf, 0x02, 0xf2, 0x00, 0x0f, 0x02, 0x00, 0x01, 0x08, 0x66, 0x01, 0x0f, 0x20, 0x00,
-        0x01, 0x0a, 0x22, 0x00, 0x0f, 0x02, 0x00, 0x03, 0x2f, 0x04, 0x21, 0x3a, 0x00, 0x03, 0x0c,
-        0x3e, 0x00, 0x02, 0x12, 0x00, 0x0c, 0x02, 0x00, 0x0f, 0x54, 0x00, 0x03, 0x06, 0x02, 0x00,
-        0x0f, 0x5e, 0x00, 0x09, 0x0a, 0x3e, 0x00, 0x0c, 0x5a, 0x00, 0x02, 0x02, 0x00, 0x06, 0x4a,
-        0x00, 0x0f, 0x02, 0x00, 0x01, 0x11, 0xc3, 0x6c, 0x02, 0x02, 0x02, 0x00, 0x0f, 0x20, 0x00,
-        0x01, 0x0f, 0x02, 0x00, 0x01, 0x0f, 0x2e, 0x00, 0x09, 0x02, 0x1c, 0x00, 0x0f, 0x02, 0x00,
-        0x01, 0x0f, 0x4a, 0x00, 0x01, 0x0f, 0x02, 0x00, 0x03, 0x02, 0x3e, 0x00, 0x0f, 0x1c, 0x00,
-        0x01, 0x02, 0x1a, 0x00, 0x0e, 0x02, 0x00, 0x2f, 0x04, 0x21, 0x2e, 0x00, 0x01, 0x0f, 0x02,
-        0x00, 0x05, 0x02, 0x40, 0x00, 0x0f, 0x1e, 0x00, 0x01, 0x02, 0x1a, 0x00, 0x0e, 0x02, 0x00,
-        0x0f, 0x2c, 0x00, 0x01, 0x0f, 0x02, 0x00, 0x07, 0x02, 0x40, 0x00, 0x0f, 0x20, 0x00, 0x01,
-        0x02, 0x1a, 0x00, 0x0f, 0x1c, 0x00, 0x03, 0x0f, 0x02, 0x00, 0x31, 0x02, 0x60, 0x00, 0x0f,
-        0x4a, 0x00, 0x31, 0x0f, 0x02, 0x00, 0x03, 0x0f, 0x60, 0x00, 0x6f, 0x22, 0x04, 0x21, 0x02,
-        0x00, 0x0f, 0xa0, 0x00, 0x03, 0x0f, 0x02, 0x00, 0x0d, 0x0f, 0xc0, 0x00, 0x09, 0x02, 0x1c,
-        0x00, 0x0a, 0x02, 0x00, 0x0f, 0x50, 0x00, 0x0d, 0x0c, 0x02, 0x00, 0x02, 0x3e, 0x00, 0x0c,
-        0x16, 0x00, 0x00, 0x3c, 0x07, 0x02, 0x1a, 0x00, 0x0e, 0x02, 0x00, 0x02, 0x1e, 0x00, 0x0f,
-        0x02, 0x00, 0x15, 0x02, 0x40, 0x00, 0x0e, 0x2e, 0x00, 0x02, 0x18, 0x00, 0x0f, 0x02, 0x00,
-        0x03, 0x0e, 0x2e, 0x00, 0x0f, 0x42, 0x01, 0x07, 0x02, 0x42, 0x00, 0x0c, 0x32, 0x00, 0x02,
-        0x16, 0x00, 0x02, 0x02, 0x00, 0x02, 0x7a, 0x01, 0x0a, 0x94, 0x04, 0x0f, 0x30, 0x00, 0x03,
-        0x0c, 0x16, 0x00, 0x06, 0x06, 0x01, 0x02, 0x0c, 0x00, 0x06, 0x02, 0x00, 0x02, 0x5a, 0x00,
-        0x0c, 0x18, 0x03, 0x02, 0x12, 0x00, 0x0c, 0x16, 0x00, 0x0f, 0x46, 0x00, 0x07, 0x0f, 0x1a,
-        0x00, 0x07, 0x02, 0x46, 0x00, 0x0f, 0x78, 0x00, 0x07, 0x02, 0x3c, 0x00, 0x06, 0x02, 0x00,
-        0x02, 0x30, 0x00, 0x06, 0x10, 0x00, 0x06, 0x02, 0x00, 0x0f, 0x1a, 0x00, 0x01, 0x04, 0x0c,
-        0x01, 0x02, 0x1a, 0x01, 0x08, 0x02, 0x00, 0x02, 0x2e, 0x00, 0x3b, 0xe3, 0x18, 0x24, 0x9e,
-        0x04, 0x02, 0x18, 0x00, 0x08, 0x2a, 0x00, 0x04, 0x02, 0x00, 0x0f, 0x1a, 0x00, 0x01, 0x02,
-        0x14, 0x00, 0x0f, 0x30, 0x00, 0x09, 0x0c, 0x7a, 0x00, 0x02, 0x32, 0x00, 0x04, 0x54, 0x00,
-        0x08, 0x02, 0x00, 0x0f, 0x1a, 0x00, 0x01, 0x04, 0xc0, 0x00, 0x08, 0x28, 0x00, 0x04, 0x02,
-        0x00, 0x02, 0x30, 0x00, 0x0f, 0x60, 0x00, 0x33, 0x0c, 0x46, 0x00, 0x04, 0x5e, 0x00, 0x0f,
-        0x20, 0x01, 0x2d, 0x06, 0x48, 0x00, 0x04, 0xb6, 0x00, 0x04, 0x02, 0x00, 0x02, 0xbe, 0x00,
-        0x0f, 0x18, 0x00, 0x05, 0x04, 0x26, 0x00, 0x08, 0x02, 0x00, 0x02, 0x32, 0x00, 0x08, 0x12,
-        0x00, 0x08, 0x60, 0x00, 0x0a, 0x1a, 0x00, 0x02, 0x2c, 0x00, 0x0c, 0x16, 0x00, 0x06, 0x30,
-        0x00, 0x02, 0x0c, 0x00, 0x0a, 0x02, 0x00, 0x0f, 0x30, 0x00, 0x09, 0x04, 0x02, 0x00, 0x06,
-        0x42, 0x00, 0x02, 0x02, 0x00, 0x0f, 0x38, 0x01, 0x05, 0x0a, 0x5a, 0x00, 0x02, 0x02, 0x00,
-        0x02, 0x32, 0x00, 0x02, 0x0c, 0x00, 0x08, 0x02, 0x00, 0x02, 0x18, 0x00, 0x02, 0x02, 0x00,
-        0x24, 0x04, 0x21, 0xf2, 0x01, 0x02, 0x02, 0x00, 0x08, 0x28, 0x00, 0x02, 0x02, 0x00, 0x0f,
-        0x18, 0x00, 0x05, 0x0f, 0x1a, 0x00, 0x0f, 0x0e, 0x02, 0x00, 0x02, 0x52, 0x00, 0x0a, 0x02,
-        0x00, 0x02, 0x26, 0x00, 0x0a, 0x14, 0x00, 0x02, 0x02, 0x00, 0x0f, 0x1a, 0x00, 0x07, 0x04,
-        0x1c, 0x00, 0x08, 0x02, 0x00, 0x0e, 0x1a, 0x01, 0x02, 0x02, 0x00, 0x02, 0x24, 0x00, 0x02,
-        0x0c, 0x00, 0x0a, 0x02, 0x00, 0x0f, 0x1a, 0x00, 0x07, 0x04, 0x02, 0x00, 0x11, 0x24, 0x60,
-        0x06, 0x0c, 0xb2, 0x03, 0x0a, 0x02, 0x00, 0x0f, 0x46, 0x00, 0x07, 0x0f, 0x1a, 0x00, 0x07,
-        0x0f, 0x02, 0x00, 0x19, 0x0f, 0x46, 0x00, 0x07, 0x0f, 0x1a, 0x00, 0x07, 0x0f, 0x02, 0x00,
-        0x19, 0x0f, 0x46, 0x00, 0x07, 0x02, 0x1a, 0x00, 0x0f, 0x3c, 0x01, 0x03, 0x0f, 0x02, 0x00,
-        0x15, 0x0f, 0x44, 0x00, 0x09, 0x04, 0x1c, 0x00, 0x0f, 0x02, 0x00, 0x31, 0x0f, 0x90, 0x00,
-        0x01, 0x0f, 0x58, 0x00, 0x31, 0x04, 0x02, 0x00, 0x0f, 0x60, 0x00, 0x01, 0x0f, 0x62, 0x00,
-        0x37, 0x0f, 0x5e, 0x00, 0x03, 0x0f, 0x02, 0x00, 0xff, 0xff, 0x89, 0x1f, 0x00, 0x01, 0x00,
-        0xa2, 0x0f, 0xb9, 0x00, 0x1d, 0x0f, 0x30, 0x00, 0x66, 0x26, 0x23, 0xe6, 0xfb, 0x03, 0x12,
-        0x9d, 0x6b, 0x01, 0x06, 0x11, 0x00, 0x12, 0xff, 0x11, 0x00, 0x07, 0x02, 0x00, 0x27, 0x16,
-        0xd9, 0x1e, 0x00, 0x0f, 0x30, 0x00, 0x0f, 0x27, 0x0f, 0xcf, 0x2f, 0x00, 0x0f, 0x30, 0x00,
-        0x0f, 0x67, 0x0a, 0xc3, 0xff, 0xff, 0xfa, 0x4a, 0x6f, 0x00, 0x05, 0x02, 0x00, 0x0a, 0x8c,
-        0x00, 0x34, 0x42, 0xc7, 0xf6, 0x58, 0x00, 0x25, 0xfe, 0x5c, 0x24, 0x00, 0x08, 0x02, 0x00,
-        0x09, 0x30, 0x00, 0x24, 0x42, 0xfd, 0x2e, 0x00, 0x38, 0xff, 0xff, 0x70, 0x26, 0x00, 0x06,
-        0x02, 0x00, 0x09, 0x30, 0x00, 0x16, 0xc7, 0x2f, 0x00, 0x16, 0x85, 0x23, 0x00, 0x09, 0x02,
-        0x00, 0x09, 0x30, 0x00, 0x49, 0xf6, 0xff, 0xff, 0x1b, 0x1e, 0x00, 0x0f, 0x02, 0x00, 0x0c,
-        0x09, 0x3d, 0x00, 0x0f, 0x02, 0x00, 0x10, 0x0f, 0x30, 0x00, 0x2e, 0x4f, 0x17, 0x2e, 0x2e,
-        0x16, 0x68, 0x00, 0x08, 0x0a, 0x60, 0x00, 0x30, 0x09, 0x75, 0xd5, 0x74, 0x15, 0x3f, 0xd5,
-        0x75, 0x09, 0x33, 0x00, 0x05, 0x09, 0x30, 0x00, 0x24, 0x2c, 0xdd, 0x2e, 0x01, 0x2f, 0xdd,
-        0x2b, 0x31, 0x00, 0x04, 0x08, 0x30, 0x00, 0xd6, 0x2c, 0xf0, 0xff, 0xff, 0xff, 0xf4, 0xd1,
-        0xd1, 0xf5, 0xff, 0xff, 0xff, 0xf0, 0x31, 0x00, 0x36, 0x99, 0x99, 0x99, 0x3d, 0x00, 0x07,
-        0x30, 0x00, 0xf5, 0x00, 0x09, 0xde, 0xff, 0xff, 0xef, 0x63, 0x08, 0x00, 0x00, 0x08, 0x64,
-        0xef, 0xff, 0xff, 0xdc, 0x93, 0x00, 0x07, 0x23, 0x00, 0x09, 0x0d, 0x00, 0x43, 0x75, 0xff,
-        0xff, 0xef, 0x56, 0x00, 0x54, 0x2b, 0xef, 0xff, 0xff, 0x74, 0x55, 0x00, 0x0f, 0x30, 0x00,
-        0x05, 0x44, 0xd5, 0xff, 0xff, 0x63, 0x24, 0x00, 0x44, 0x65, 0xff, 0xff, 0xd4, 0x0c, 0x00,
-        0x0f, 0x30, 0x00, 0x04, 0x54, 0x17, 0xff, 0xff, 0xf4, 0x08, 0x24, 0x00, 0x53, 0x09, 0xf5,
-        0xff, 0xff, 0x15, 0x0d, 0x00, 0x0f, 0x30, 0x00, 0x04, 0x43, 0x31, 0xff, 0xff, 0xcf, 0x22,
-        0x00, 0x71, 0x00, 0x00, 0x00, 0xd0, 0xff, 0xff, 0x2f, 0x09, 0x00, 0x0f, 0x30, 0x00, 0x06,
-        0x43, 0x30, 0xff, 0xff, 0xd0, 0x22, 0x00, 0x71, 0x00, 0x00, 0x00, 0xd1, 0xff, 0xff, 0x2e,
-        0x09, 0x00, 0x0f, 0x30, 0x00, 0x06, 0x46, 0x16, 0xff, 0xff, 0xf5, 0x90, 0x00, 0x1f, 0xf6,
-        0x90, 0x00, 0x0e, 0x53, 0x00, 0xd5, 0xff, 0xff, 0x64, 0x53, 0x00, 0x54, 0x00, 0x66, 0xff,
-        0xff, 0xd3, 0x0c, 0x00, 0x0f, 0xc0, 0x00, 0x04, 0x0c, 0x50, 0x01, 0x1f, 0x73, 0x30, 0x00,
-        0x0d, 0xf5, 0x00, 0x09, 0xdd, 0xff, 0xff, 0xef, 0x65, 0x09, 0x00, 0x00, 0x09, 0x66, 0xf0,
-        0xff, 0xff, 0xdb, 0x9c, 0x00, 0x0f, 0x60, 0x00, 0x05, 0xaa, 0x00, 0x2b, 0xf0, 0xff, 0xff,
-        0xff, 0xf5, 0xd2, 0xd2, 0xf6, 0x10, 0x02, 0x0f, 0x30, 0x00, 0x06, 0x34, 0x00, 0x2b, 0xdc,
-        0x70, 0x02, 0x13, 0xdb, 0xe9, 0x01, 0x0f, 0x30, 0x00, 0x0b, 0x40, 0x00, 0x09, 0x74, 0xd4,
-        0x44, 0x18, 0x25, 0xd3, 0x73, 0x8d, 0x00, 0x0f, 0x30, 0x00, 0x0b, 0x64, 0x00, 0x00, 0x00,
-        0x15, 0x2e, 0x2e, 0xd9, 0x01, 0x03, 0x02, 0x00, 0x0f, 0x90, 0x00, 0x07, 0x0f, 0x02, 0x00,
-        0x03, 0x0f, 0x30, 0x00, 0x2a, 0x0f, 0x50, 0x04, 0x0f, 0x46, 0x1b, 0xff, 0xff, 0xf6, 0x79,
-        0x00, 0x07, 0xb0, 0x04, 0x0f, 0x02, 0x00, 0x07, 0x16, 0xc6, 0x30, 0x00, 0x17, 0x41, 0x10,
-        0x05, 0x0f, 0x02, 0x00, 0x05, 0x26, 0xfd, 0x41, 0x30, 0x00, 0x4f, 0x00, 0x42, 0xc6, 0xf6,
-        0x28, 0x00, 0x05, 0x02, 0x02, 0x00, 0x28, 0xf6, 0xc6, 0x2f, 0x00, 0x0f, 0x02, 0x00, 0xff,
-        0x36, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0xd8, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0xa2, 0x3f, 0xff, 0xff, 0xff, 0x26, 0x00, 0x10, 0x06, 0x01, 0x00, 0x0f, 0x30, 0x00,
+        0x66, 0x35, 0x23, 0xe6, 0xff, 0x01, 0x00, 0x15, 0x9d, 0x2c, 0x00, 0x04, 0x01, 0x00, 0x0d,
+        0x2f, 0x00, 0x27, 0x16, 0xd9, 0x1e, 0x00, 0x0f, 0x30, 0x00, 0x0f, 0x27, 0x0f, 0xcf, 0x1d,
+        0x00, 0x0f, 0x30, 0x00, 0x0f, 0x6c, 0x0a, 0xc3, 0xff, 0xff, 0xfa, 0x4a, 0x45, 0x00, 0x03,
+        0x34, 0x00, 0x07, 0x0e, 0x00, 0x34, 0x42, 0xc7, 0xf6, 0x42, 0x00, 0x2f, 0xfe, 0x5c, 0x2f,
+        0x00, 0x01, 0x0a, 0x30, 0x00, 0x26, 0x42, 0xfd, 0x72, 0x00, 0x1f, 0x70, 0x2f, 0x00, 0x02,
+        0x0a, 0x30, 0x00, 0x16, 0xc7, 0x2f, 0x00, 0x1f, 0x85, 0x2f, 0x00, 0x03, 0x0a, 0x30, 0x00,
+        0x4f, 0xf6, 0xff, 0xff, 0x1b, 0x28, 0x00, 0x04, 0x0f, 0x01, 0x00, 0x02, 0x0f, 0xed, 0x01,
+        0x5e, 0x4f, 0x17, 0x2e, 0x2e, 0x16, 0x2d, 0x00, 0x05, 0x0d, 0x30, 0x00, 0x30, 0x09, 0x75,
+        0xd5, 0xfa, 0x00, 0x3f, 0xd5, 0x75, 0x09, 0x30, 0x00, 0x12, 0x24, 0x2c, 0xdd, 0x2c, 0x01,
+        0x2f, 0xdd, 0x2b, 0x30, 0x00, 0x10, 0xd6, 0x2c, 0xf0, 0xff, 0xff, 0xff, 0xf4, 0xd1, 0xd1,
+        0xf5, 0xff, 0xff, 0xff, 0xf0, 0x31, 0x00, 0x3f, 0x99, 0x99, 0x99, 0x30, 0x00, 0x02, 0xf5,
+        0x00, 0x09, 0xde, 0xff, 0xff, 0xef, 0x63, 0x08, 0x00, 0x00, 0x08, 0x64, 0xef, 0xff, 0xff,
+        0xdc, 0x93, 0x00, 0x09, 0x83, 0x00, 0x07, 0x0d, 0x00, 0x43, 0x75, 0xff, 0xff, 0xef, 0x56,
+        0x00, 0x5f, 0x2b, 0xef, 0xff, 0xff, 0x74, 0x30, 0x00, 0x0d, 0x44, 0xd5, 0xff, 0xff, 0x63,
+        0x0c, 0x00, 0x4f, 0x65, 0xff, 0xff, 0xd4, 0x30, 0x00, 0x0c, 0x54, 0x17, 0xff, 0xff, 0xf4,
+        0x08, 0x17, 0x00, 0x5f, 0x09, 0xf5, 0xff, 0xff, 0x15, 0x30, 0x00, 0x0b, 0x46, 0x31, 0xff,
+        0xff, 0xcf, 0x18, 0x00, 0x4f, 0xd0, 0xff, 0xff, 0x2f, 0x30, 0x00, 0x0b, 0x46, 0x30, 0xff,
+        0xff, 0xd0, 0x18, 0x00, 0x4f, 0xd1, 0xff, 0xff, 0x2e, 0x30, 0x00, 0x0b, 0x46, 0x16, 0xff,
+        0xff, 0xf5, 0x90, 0x00, 0x1f, 0xf6, 0x90, 0x00, 0x0e, 0x00, 0xf0, 0x00, 0x14, 0x64, 0x0c,
+        0x00, 0x4f, 0x66, 0xff, 0xff, 0xd3, 0x23, 0x00, 0x00, 0x0f, 0x50, 0x01, 0x09, 0x1f, 0x73,
+        0x30, 0x00, 0x0d, 0xf5, 0x00, 0x09, 0xdd, 0xff, 0xff, 0xef, 0x65, 0x09, 0x00, 0x00, 0x09,
+        0x66, 0xf0, 0xff, 0xff, 0xdb, 0x9c, 0x00, 0x0f, 0x30, 0x00, 0x05, 0x20, 0x00, 0x2b, 0x10,
+        0x02, 0x30, 0xf5, 0xd2, 0xd2, 0xd1, 0x03, 0x07, 0x10, 0x02, 0x0f, 0x30, 0x00, 0x06, 0x34,
+        0x00, 0x2b, 0xdc, 0x70, 0x02, 0x17, 0xdb, 0x70, 0x02, 0x0f, 0x30, 0x00, 0x07, 0x40, 0x00,
+        0x09, 0x74, 0xd4, 0x2e, 0x00, 0x25, 0xd3, 0x73, 0x8d, 0x00, 0x0f, 0x30, 0x00, 0x0b, 0x64,
+        0x00, 0x00, 0x00, 0x15, 0x2e, 0x2e, 0x49, 0x01, 0x0f, 0x30, 0x00, 0x12, 0x0e, 0x01, 0x00,
+        0x0f, 0x30, 0x00, 0x2a, 0x0f, 0x50, 0x04, 0x0f, 0x46, 0x1b, 0xff, 0xff, 0xf6, 0x0e, 0x00,
+        0x07, 0xb0, 0x04, 0x0f, 0x01, 0x00, 0x07, 0x16, 0xc6, 0x30, 0x00, 0x17, 0x41, 0x10, 0x05,
+        0x0f, 0x01, 0x00, 0x05, 0x27, 0xfd, 0x41, 0x6f, 0x00, 0x25, 0x42, 0xc6, 0x70, 0x05, 0x0f,
+        0x01, 0x00, 0x03, 0x28, 0xf6, 0xc6, 0x2f, 0x00, 0x0f, 0x01, 0x00, 0xff, 0x36, 0x50, 0x00,
+        0x00, 0x00, 0x00, 0x00,
 
 };
 
@@ -108,11 +60,11 @@ const lv_image_dsc_t icon_add_a_photo = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 48,
                  .h = 48,
-                 .stride = 96,
+                 .stride = 48,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_add_a_photo_map),
@@ -20,40 +20,22 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_ADD_A_PHOTO_24
     uint8_t icon_add_a_photo_24_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0xea, 0x01, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0x42, 0x4f, 0xe3, 0x18, 0xe3, 0x18, 0x59, 0x00, 0x19, 0x4f, 0xe3, 0x18, 0x04, 0x21,
-        0x30, 0x00, 0x01, 0x26, 0xe3, 0x18, 0x02, 0x00, 0x04, 0x22, 0x00, 0x06, 0x12, 0x00, 0x0c,
-        0x64, 0x00, 0x28, 0x00, 0x00, 0x1c, 0x00, 0x04, 0x1e, 0x00, 0x06, 0x14, 0x00, 0x0f, 0x42,
-        0x00, 0x01, 0x04, 0x14, 0x00, 0x0a, 0x02, 0x00, 0x08, 0x18, 0x00, 0x06, 0x40, 0x00, 0x06,
-        0x54, 0x00, 0x0c, 0x02, 0x00, 0x0c, 0x30, 0x00, 0x1f, 0x24, 0xce, 0x00, 0x02, 0x0f, 0x02,
-        0x00, 0x03, 0x24, 0x04, 0x21, 0xaa, 0x00, 0x04, 0x02, 0x00, 0x0f, 0x68, 0x00, 0x07, 0x00,
-        0xae, 0x01, 0x0a, 0x30, 0x00, 0x02, 0x96, 0x00, 0x02, 0x02, 0x00, 0x02, 0x20, 0x00, 0x0c,
-        0x02, 0x00, 0x08, 0x30, 0x00, 0x02, 0x28, 0x00, 0x42, 0x04, 0x21, 0x04, 0x21, 0x0a, 0x00,
-        0x04, 0x2c, 0x00, 0x08, 0x72, 0x00, 0x0c, 0x30, 0x00, 0x20, 0xa2, 0x10, 0x24, 0x02, 0x28,
-        0xa2, 0x10, 0x24, 0x00, 0x08, 0xf0, 0x00, 0x06, 0x30, 0x00, 0x28, 0xe3, 0x18, 0x18, 0x00,
-        0x08, 0x62, 0x00, 0x08, 0x18, 0x00, 0x0f, 0x30, 0x00, 0x27, 0x02, 0x54, 0x00, 0x0f, 0x90,
-        0x00, 0x17, 0x02, 0x30, 0x00, 0x0f, 0xf0, 0x00, 0x03, 0x06, 0xf8, 0x01, 0x06, 0x90, 0x00,
-        0x06, 0x32, 0x00, 0x02, 0x02, 0x00, 0x02, 0x12, 0x00, 0x02, 0x16, 0x00, 0x0f, 0x30, 0x00,
-        0x05, 0x02, 0x1e, 0x00, 0x08, 0x2c, 0x00, 0x02, 0x12, 0x00, 0x06, 0x30, 0x00, 0x0f, 0x10,
-        0x02, 0x0f, 0x11, 0x24, 0x8e, 0x01, 0x02, 0x3a, 0x00, 0x02, 0x30, 0x00, 0x0f, 0x02, 0x00,
-        0x11, 0x04, 0x30, 0x00, 0x02, 0x32, 0x00, 0x2f, 0x04, 0x21, 0x02, 0x00, 0x07, 0x0f, 0x8e,
-        0x03, 0x1d, 0x0f, 0x02, 0x00, 0x59, 0x1f, 0x00, 0x01, 0x00, 0x17, 0x2f, 0x77, 0x3c, 0x2c,
-        0x00, 0x03, 0x26, 0xff, 0x80, 0x18, 0x00, 0xe5, 0x09, 0x73, 0x77, 0x77, 0x77, 0x77, 0x60,
-        0x00, 0x00, 0x00, 0x77, 0x77, 0xff, 0xbb, 0x32, 0x00, 0x21, 0x03, 0xad, 0xd4, 0x00, 0x41,
-        0xce, 0x00, 0x00, 0x00, 0x09, 0x00, 0xb6, 0x80, 0x00, 0x00, 0x00, 0x43, 0x77, 0x77, 0x77,
-        0xb0, 0xff, 0x69, 0x3c, 0x00, 0x02, 0x48, 0x00, 0x11, 0x43, 0x21, 0x00, 0x16, 0x7d, 0x17,
-        0x00, 0x03, 0x18, 0x00, 0x37, 0x7d, 0xff, 0x07, 0x14, 0x00, 0x06, 0x02, 0x00, 0x23, 0x80,
-        0xff, 0x0c, 0x00, 0x23, 0x12, 0x12, 0x09, 0x00, 0x02, 0x02, 0x00, 0x03, 0x18, 0x00, 0x62,
-        0x45, 0xd3, 0xff, 0xff, 0xd3, 0x44, 0x13, 0x00, 0x01, 0x02, 0x00, 0x02, 0x18, 0x00, 0x71,
-        0x45, 0xfb, 0xda, 0x78, 0x79, 0xda, 0xfb, 0x19, 0x00, 0x26, 0xcc, 0x66, 0x18, 0x00, 0x86,
-        0xd3, 0xd9, 0x0c, 0x00, 0x00, 0x0c, 0xda, 0xd1, 0x78, 0x00, 0x01, 0x30, 0x00, 0xaf, 0x12,
-        0xff, 0x79, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xff, 0x11, 0x18, 0x00, 0x13, 0x3f, 0x00, 0xd3,
-        0xda, 0x48, 0x00, 0x02, 0x9b, 0x00, 0x44, 0xfb, 0xda, 0x79, 0x79, 0xdb, 0xfb, 0x43, 0x60,
-        0x00, 0x71, 0x00, 0x00, 0x44, 0xd1, 0xff, 0xff, 0xd1, 0x17, 0x00, 0x03, 0xf0, 0x00, 0x01,
-        0x78, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x12, 0x11, 0x08, 0x00, 0x03, 0x18, 0x00, 0x0d,
-        0x08, 0x01, 0x12, 0x07, 0x2d, 0x01, 0x02, 0x38, 0x01, 0x09, 0x02, 0x00, 0x11, 0x42, 0x39,
-        0x00, 0x39, 0x42, 0x83, 0x88, 0x01, 0x00, 0x21, 0x83, 0x41, 0x17, 0x00, 0x0f, 0x02, 0x00,
-        0x2f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0xda, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0x17, 0x2f, 0x77, 0x3c, 0x18, 0x00, 0x03, 0x26, 0xff, 0x80, 0x0c, 0x00, 0x70, 0x09,
+        0x73, 0x77, 0x77, 0x77, 0x77, 0x60, 0x2e, 0x00, 0x35, 0x77, 0xff, 0xbb, 0x32, 0x00, 0x30,
+        0x03, 0xad, 0xff, 0x01, 0x00, 0x10, 0xce, 0x2e, 0x00, 0x00, 0x01, 0x00, 0x00, 0x32, 0x00,
+        0x7c, 0x43, 0x77, 0x77, 0x77, 0xb0, 0xff, 0x69, 0x48, 0x00, 0x11, 0x43, 0x21, 0x00, 0x1d,
+        0x7d, 0x60, 0x00, 0x37, 0x7d, 0xff, 0x07, 0x14, 0x00, 0x06, 0x01, 0x00, 0x23, 0x80, 0xff,
+        0x09, 0x00, 0x2f, 0x12, 0x12, 0x18, 0x00, 0x01, 0x6d, 0x45, 0xd3, 0xff, 0xff, 0xd3, 0x44,
+        0x18, 0x00, 0x71, 0x45, 0xfb, 0xda, 0x78, 0x79, 0xda, 0xfb, 0x19, 0x00, 0x26, 0xcc, 0x66,
+        0x18, 0x00, 0x80, 0xd3, 0xd9, 0x0c, 0x00, 0x00, 0x0c, 0xda, 0xd1, 0x0c, 0x00, 0x02, 0x78,
+        0x00, 0x01, 0x18, 0x00, 0x30, 0x12, 0xff, 0x79, 0x0c, 0x00, 0x3f, 0x7a, 0xff, 0x11, 0x18,
+        0x00, 0x13, 0x3f, 0x00, 0xd3, 0xda, 0x48, 0x00, 0x02, 0x9c, 0x00, 0x44, 0xfb, 0xda, 0x79,
+        0x79, 0xdb, 0xfb, 0x43, 0x18, 0x00, 0x61, 0x00, 0x44, 0xd1, 0xff, 0xff, 0xd1, 0x17, 0x00,
+        0x0a, 0x18, 0x00, 0x30, 0x00, 0x00, 0x12, 0x5c, 0x00, 0x06, 0x18, 0x00, 0x0d, 0x08, 0x01,
+        0x12, 0x07, 0x2d, 0x01, 0x02, 0x38, 0x01, 0x09, 0x01, 0x00, 0x11, 0x42, 0x20, 0x00, 0x39,
+        0x42, 0x83, 0x88, 0x01, 0x00, 0x2a, 0x83, 0x41, 0x40, 0x00, 0x0f, 0x01, 0x00, 0x26, 0x50,
+        0x00, 0x00, 0x00, 0x00, 0x00,
 
 };
 
@@ -61,11 +43,11 @@ const lv_image_dsc_t icon_add_a_photo_24 = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 24,
                  .h = 24,
-                 .stride = 48,
+                 .stride = 24,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_add_a_photo_24_map),
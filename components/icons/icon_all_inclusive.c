@@ -20,41 +20,23 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_ALL_INCLUSIVE uint8_t
     icon_all_inclusive_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0xf7, 0x01, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0xff, 0x15, 0x6f, 0xe3, 0x18, 0xe3, 0x18, 0x04, 0x21, 0x2d, 0x01, 0x01, 0x68, 0x04,
-        0x21, 0xe3, 0x18, 0xe3, 0x18, 0x1a, 0x00, 0x26, 0xe3, 0x18, 0x02, 0x00, 0x0a, 0x34, 0x00,
-        0x02, 0x2c, 0x00, 0x04, 0x02, 0x00, 0x02, 0x34, 0x00, 0x02, 0x0e, 0x00, 0x08, 0x1a, 0x00,
-        0x02, 0x18, 0x00, 0x04, 0x1a, 0x00, 0x02, 0x7a, 0x00, 0x02, 0x08, 0x00, 0x04, 0x14, 0x00,
-        0x22, 0xa2, 0x10, 0x24, 0x00, 0x44, 0x04, 0x21, 0x04, 0x21, 0x64, 0x00, 0x02, 0x24, 0x00,
-        0x04, 0x70, 0x00, 0x22, 0xa2, 0x10, 0x32, 0x00, 0x02, 0x3e, 0x00, 0x02, 0x2e, 0x00, 0x00,
-        0xec, 0x01, 0x64, 0xa2, 0x10, 0xe3, 0x18, 0x00, 0x00, 0x48, 0x00, 0x17, 0x24, 0xd2, 0x00,
-        0x02, 0x40, 0x00, 0x0c, 0xcc, 0x00, 0x00, 0x20, 0x02, 0x22, 0x00, 0x00, 0x18, 0x00, 0x08,
-        0x48, 0x00, 0x08, 0xa0, 0x00, 0x02, 0x0e, 0x00, 0x04, 0x02, 0x00, 0x22, 0x45, 0x29, 0x2e,
-        0x00, 0x24, 0x00, 0x00, 0x12, 0x00, 0x04, 0x02, 0x00, 0x04, 0xe6, 0x00, 0x08, 0x48, 0x00,
-        0x11, 0x24, 0x3e, 0x01, 0x84, 0xe3, 0x18, 0xff, 0xff, 0x00, 0x00, 0x04, 0x21, 0xd8, 0x00,
-        0x00, 0x96, 0x02, 0x06, 0x90, 0x00, 0x08, 0xf0, 0x00, 0x06, 0xd0, 0x00, 0x02, 0x0a, 0x00,
-        0x04, 0x4c, 0x00, 0x04, 0xf0, 0x00, 0x02, 0x18, 0x00, 0x04, 0x6a, 0x00, 0x02, 0x02, 0x00,
-        0x02, 0x50, 0x00, 0x04, 0x1a, 0x00, 0x08, 0x1e, 0x00, 0x02, 0x1a, 0x00, 0x02, 0x14, 0x00,
-        0x02, 0x02, 0x00, 0x04, 0x50, 0x00, 0x02, 0x02, 0x00, 0x02, 0x70, 0x00, 0x04, 0x02, 0x00,
-        0x02, 0x14, 0x00, 0x02, 0x02, 0x00, 0x02, 0x46, 0x00, 0x02, 0x0c, 0x00, 0x0a, 0x02, 0x00,
-        0x02, 0x34, 0x00, 0x0a, 0x14, 0x00, 0x0f, 0x02, 0x00, 0xff, 0x08, 0x1f, 0x00, 0x01, 0x00,
-        0x80, 0x36, 0x25, 0x39, 0x1f, 0x96, 0x00, 0x32, 0x20, 0x3a, 0x24, 0x0d, 0x00, 0x72, 0x4e,
-        0xda, 0xff, 0xff, 0xff, 0xbd, 0x28, 0x0d, 0x00, 0xf2, 0x2c, 0x30, 0xc9, 0xff, 0xff, 0xff,
-        0xd9, 0x4d, 0x00, 0x00, 0x00, 0x66, 0xfe, 0xdb, 0x70, 0x4c, 0x77, 0xea, 0xf5, 0x4d, 0x00,
-        0x00, 0x00, 0x00, 0x4a, 0xf4, 0xea, 0x77, 0x4c, 0x70, 0xdc, 0xfe, 0x65, 0x00, 0x24, 0xfa,
-        0xbf, 0x0b, 0x00, 0x00, 0x00, 0x17, 0xca, 0xfc, 0x40, 0x00, 0x00, 0x5f, 0xfa, 0xcc, 0x17,
-        0x00, 0x00, 0x00, 0x0b, 0xbf, 0xf9, 0x23, 0x86, 0xfd, 0x5c, 0x00, 0x81, 0x0b, 0x66, 0x01,
-        0x00, 0x77, 0xfe, 0xbb, 0x0d, 0x4f, 0x00, 0x51, 0x1f, 0xfd, 0x85, 0xb5, 0xd7, 0x0a, 0x00,
-        0x81, 0x00, 0x00, 0x00, 0x01, 0x8a, 0xff, 0xad, 0x08, 0x0a, 0x00, 0x63, 0x00, 0x00, 0xd8,
-        0xb3, 0xb4, 0xd8, 0x0b, 0x00, 0x53, 0x06, 0xa6, 0xff, 0x92, 0x02, 0x0c, 0x00, 0x43, 0x00,
-        0xd9, 0xb2, 0x85, 0x48, 0x00, 0x81, 0x0d, 0xbb, 0xfe, 0x77, 0x00, 0x01, 0x68, 0x0b, 0x1a,
-        0x00, 0x52, 0x20, 0xfd, 0x84, 0x23, 0xf9, 0x78, 0x00, 0x83, 0xcc, 0xfa, 0x5f, 0x00, 0x00,
-        0x3d, 0xfb, 0xca, 0x78, 0x00, 0xf1, 0x13, 0x22, 0x00, 0x65, 0xfe, 0xdc, 0x71, 0x4c, 0x77,
-        0xea, 0xf4, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xf4, 0xea, 0x76, 0x4c, 0x71, 0xdc, 0xfe,
-        0x64, 0x00, 0x00, 0x00, 0x4d, 0xd8, 0xff, 0xff, 0xff, 0xc8, 0x30, 0x41, 0x00, 0x82, 0x00,
-        0x28, 0xbb, 0xff, 0xff, 0xff, 0xd7, 0x4b, 0x0d, 0x00, 0x32, 0x23, 0x39, 0x20, 0x09, 0x00,
-        0x72, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x39, 0x23, 0x09, 0x00, 0x0f, 0x02, 0x00, 0x76, 0x50,
-        0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0x80, 0x36, 0x25, 0x39, 0x1f, 0x0d, 0x00, 0x32, 0x20, 0x3a, 0x24, 0x09, 0x00, 0x72,
+        0x4e, 0xda, 0xff, 0xff, 0xff, 0xbd, 0x28, 0x0d, 0x00, 0xf0, 0x03, 0x30, 0xc9, 0xff, 0xff,
+        0xff, 0xd9, 0x4d, 0x00, 0x00, 0x00, 0x66, 0xfe, 0xdb, 0x70, 0x4c, 0x77, 0xea, 0xf5, 0x0c,
+        0x00, 0xf2, 0x16, 0x00, 0x4a, 0xf4, 0xea, 0x77, 0x4c, 0x70, 0xdc, 0xfe, 0x65, 0x00, 0x24,
+        0xfa, 0xbf, 0x0b, 0x00, 0x00, 0x00, 0x17, 0xca, 0xfc, 0x40, 0x00, 0x00, 0x5f, 0xfa, 0xcc,
+        0x17, 0x00, 0x00, 0x00, 0x0b, 0xbf, 0xf9, 0x23, 0x86, 0xfd, 0x5c, 0x00, 0x81, 0x0b, 0x66,
+        0x01, 0x00, 0x77, 0xfe, 0xbb, 0x0d, 0x0d, 0x00, 0x54, 0x1f, 0xfd, 0x85, 0xb5, 0xd7, 0x71,
+        0x00, 0x53, 0x01, 0x8a, 0xff, 0xad, 0x08, 0x0c, 0x00, 0x43, 0xd8, 0xb3, 0xb4, 0xd8, 0x0b,
+        0x00, 0x54, 0x06, 0xa6, 0xff, 0x92, 0x02, 0x24, 0x00, 0x33, 0xd9, 0xb2, 0x85, 0x48, 0x00,
+        0x70, 0x0d, 0xbb, 0xfe, 0x77, 0x00, 0x01, 0x68, 0x6c, 0x00, 0x72, 0x00, 0x00, 0x20, 0xfd,
+        0x84, 0x23, 0xf9, 0x78, 0x00, 0x83, 0xcc, 0xfa, 0x5f, 0x00, 0x00, 0x3d, 0xfb, 0xca, 0x78,
+        0x00, 0xb0, 0x22, 0x00, 0x65, 0xfe, 0xdc, 0x71, 0x4c, 0x77, 0xea, 0xf4, 0x4a, 0x29, 0x00,
+        0xf2, 0x04, 0x4c, 0xf4, 0xea, 0x76, 0x4c, 0x71, 0xdc, 0xfe, 0x64, 0x00, 0x00, 0x00, 0x4d,
+        0xd8, 0xff, 0xff, 0xff, 0xc8, 0x30, 0x59, 0x00, 0x72, 0x28, 0xbb, 0xff, 0xff, 0xff, 0xd7,
+        0x4b, 0x0d, 0x00, 0x34, 0x23, 0x39, 0x20, 0x71, 0x00, 0x56, 0x00, 0x00, 0x1e, 0x39, 0x23,
+        0x0d, 0x00, 0x0f, 0x01, 0x00, 0x72, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
 
 };
 
@@ -62,11 +44,11 @@ const lv_image_dsc_t icon_all_inclusive = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 24,
                  .h = 24,
-                 .stride = 48,
+                 .stride = 24,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_all_inclusive_map),
@@ -20,18 +20,12 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_ARROW_BACK_24 uint8_t
     icon_arrow_back_24_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0xc2, 0x4f, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x00, 0x17, 0x13, 0x00, 0x01, 0x00, 0x0f,
-        0x32, 0x00, 0x13, 0x03, 0x2d, 0x00, 0x0f, 0x60, 0x00, 0x14, 0x0f, 0x2e, 0x00, 0xad, 0x0f,
-        0x02, 0x00, 0x05, 0x0c, 0x2c, 0x01, 0x0f, 0x28, 0x00, 0x05, 0x04, 0x02, 0x00, 0x0c, 0x30,
-        0x00, 0x06, 0x32, 0x00, 0x0e, 0x1a, 0x00, 0x0f, 0x02, 0x00, 0x05, 0x0f, 0x4c, 0x00, 0x07,
-        0x0f, 0x02, 0x00, 0x05, 0x0f, 0x32, 0x00, 0xb9, 0x0f, 0xe4, 0x00, 0x05, 0x0f, 0x02, 0x00,
-        0xab, 0x04, 0xa2, 0x01, 0x0f, 0x02, 0x00, 0x50, 0x2f, 0x20, 0x20, 0x65, 0x00, 0x02, 0x4f,
-        0x20, 0xdf, 0xcf, 0x01, 0x19, 0x00, 0x00, 0x4f, 0x1e, 0xdd, 0xef, 0x35, 0x17, 0x00, 0x31,
-        0x1f, 0x34, 0x45, 0x00, 0x03, 0x0f, 0x17, 0x00, 0x01, 0x56, 0x20, 0xdf, 0xff, 0xdc, 0xbb,
-        0x01, 0x00, 0x14, 0x5e, 0x3a, 0x00, 0x0f, 0x18, 0x00, 0x05, 0x0f, 0xa4, 0x00, 0x05, 0x0f,
-        0xbd, 0x00, 0x06, 0x0f, 0x19, 0x00, 0x3a, 0x0f, 0x38, 0x01, 0x04, 0x0f, 0x68, 0x01, 0x06,
-        0x0f, 0x02, 0x00, 0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0x57, 0x2f, 0x20, 0x20, 0x17, 0x00, 0x03, 0x3f, 0xdf, 0xcf, 0x01, 0x17, 0x00, 0x00,
+        0x4f, 0x1e, 0xdd, 0xef, 0x35, 0x17, 0x00, 0x31, 0x1f, 0x34, 0x17, 0x00, 0x17, 0x56, 0x20,
+        0xdf, 0xff, 0xdc, 0xbb, 0x01, 0x00, 0x1f, 0x5e, 0x18, 0x00, 0x0d, 0x0f, 0x76, 0x00, 0x05,
+        0x0f, 0x19, 0x00, 0x53, 0x0f, 0x38, 0x01, 0x04, 0x0f, 0x68, 0x01, 0x06, 0x0f, 0x01, 0x00,
+        0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
 
 };
 
@@ -39,11 +33,11 @@ const lv_image_dsc_t icon_arrow_back_24 = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 24,
                  .h = 24,
-                 .stride = 48,
+                 .stride = 24,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_arrow_back_24_map),
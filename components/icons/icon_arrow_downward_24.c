@@ -20,26 +20,15 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_ARROW_DOWNWARD_24
     uint8_t icon_arrow_downward_24_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0x17, 0x01, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0xc2, 0x4f, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x00, 0x19, 0x0f, 0x30, 0x00, 0xd1, 0x08,
-        0x12, 0x01, 0x0a, 0xf0, 0x00, 0x08, 0x1a, 0x00, 0x04, 0x02, 0x00, 0x11, 0x00, 0x01, 0x00,
-        0x08, 0x0e, 0x00, 0x08, 0x0c, 0x00, 0x06, 0x0e, 0x00, 0x04, 0x02, 0x00, 0x01, 0x2f, 0x00,
-        0x05, 0x76, 0x01, 0x06, 0x22, 0x00, 0x01, 0x15, 0x00, 0x05, 0x18, 0x00, 0x08, 0x02, 0x00,
-        0x01, 0x17, 0x00, 0x03, 0x1a, 0x00, 0x04, 0x30, 0x00, 0x01, 0x11, 0x00, 0x03, 0x14, 0x00,
-        0x0e, 0x02, 0x00, 0x01, 0x1b, 0x00, 0x01, 0x1e, 0x00, 0x02, 0x30, 0x00, 0x01, 0x0d, 0x00,
-        0x01, 0x10, 0x00, 0x0f, 0x02, 0x00, 0x05, 0x01, 0x1f, 0x00, 0x0b, 0x02, 0x00, 0x0f, 0x2c,
-        0x00, 0x05, 0x02, 0x02, 0x00, 0x0b, 0x2d, 0x00, 0x0f, 0x46, 0x02, 0x10, 0x08, 0x32, 0x00,
-        0x02, 0x44, 0x00, 0x0f, 0x02, 0x00, 0x0d, 0x04, 0x32, 0x00, 0x0f, 0x28, 0x00, 0x0d, 0x06,
-        0x02, 0x00, 0x02, 0xf0, 0x00, 0x0f, 0x02, 0x00, 0xc1, 0x04, 0x0c, 0x01, 0x0f, 0x02, 0x00,
-        0x50, 0x2f, 0x59, 0x59, 0x65, 0x00, 0x03, 0x2f, 0xbf, 0xbf, 0x18, 0x00, 0x5d, 0x11, 0x01,
-        0x71, 0x00, 0x03, 0x78, 0x00, 0x02, 0x0d, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xce,
-        0x35, 0x18, 0x00, 0x32, 0x30, 0xcf, 0x22, 0x16, 0x00, 0x64, 0x00, 0x00, 0x1e, 0xdd, 0xef,
-        0x35, 0x18, 0x00, 0x35, 0x30, 0xec, 0xe1, 0x18, 0x00, 0x03, 0x19, 0x00, 0x2b, 0xbf, 0xbf,
-        0x17, 0x00, 0x03, 0x32, 0x00, 0x2a, 0xbf, 0xbf, 0x2e, 0x00, 0x04, 0x19, 0x00, 0x2d, 0xbf,
-        0xbf, 0x17, 0x00, 0xa2, 0x00, 0x00, 0x20, 0xdf, 0xed, 0xdf, 0xdf, 0xed, 0xdf, 0x20, 0x27,
-        0x00, 0x07, 0x02, 0x00, 0x47, 0x1e, 0xdd, 0xff, 0xff, 0x73, 0x00, 0x06, 0x02, 0x00, 0x2f,
-        0x1e, 0xdd, 0x17, 0x00, 0x02, 0x3e, 0x00, 0x00, 0x20, 0x45, 0x00, 0x0f, 0x02, 0x00, 0x42,
-        0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0x57, 0x2f, 0x59, 0x59, 0x18, 0x00, 0x03, 0x2f, 0xbf, 0xbf, 0x18, 0x00, 0x5d, 0x18,
+        0x01, 0x18, 0x00, 0x02, 0x0d, 0x00, 0x00, 0x01, 0x00, 0x36, 0x1e, 0xce, 0x35, 0x18, 0x00,
+        0x35, 0x30, 0xcf, 0x22, 0x18, 0x00, 0x20, 0xdd, 0xef, 0x19, 0x00, 0x01, 0x18, 0x00, 0x35,
+        0x30, 0xec, 0xe1, 0x18, 0x00, 0x03, 0x19, 0x00, 0x00, 0x18, 0x00, 0x09, 0x17, 0x00, 0x03,
+        0x19, 0x00, 0x2c, 0xbf, 0xbf, 0x17, 0x00, 0x02, 0x19, 0x00, 0x2d, 0xbf, 0xbf, 0x17, 0x00,
+        0xab, 0x00, 0x00, 0x20, 0xdf, 0xed, 0xdf, 0xdf, 0xed, 0xdf, 0x20, 0x17, 0x00, 0x00, 0x32,
+        0x00, 0x2d, 0xff, 0xff, 0x2e, 0x00, 0x02, 0x19, 0x00, 0x0f, 0x17, 0x00, 0x02, 0x3e, 0x00,
+        0x00, 0x20, 0x45, 0x00, 0x0f, 0x01, 0x00, 0x42, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
 
 };
 
@@ -47,11 +36,11 @@ const lv_image_dsc_t icon_arrow_downward_24 = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 24,
                  .h = 24,
-                 .stride = 48,
+                 .stride = 24,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_arrow_downward_24_map),
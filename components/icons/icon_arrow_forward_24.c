@@ -20,17 +20,12 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_ARROW_FORWARD_24
     uint8_t icon_arrow_forward_24_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x1f, 0xff,
-        0x01, 0x00, 0xc2, 0x4f, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x00, 0x17, 0x13, 0x00, 0x01,
-        0x00, 0x0f, 0x32, 0x00, 0xf9, 0x03, 0x13, 0x01, 0x0f, 0x02, 0x00, 0x06, 0x0c, 0x2c,
-        0x01, 0x0f, 0x29, 0x00, 0x06, 0x03, 0x02, 0x00, 0x0c, 0x30, 0x00, 0x0f, 0x02, 0x00,
-        0x03, 0x03, 0x2d, 0x00, 0x0f, 0xbc, 0x01, 0x14, 0x0f, 0x2e, 0x00, 0xd3, 0x00, 0xa2,
-        0x03, 0x0f, 0xd0, 0x02, 0x1b, 0x0f, 0x02, 0x00, 0x99, 0x04, 0xc4, 0x01, 0x0f, 0x02,
-        0x00, 0x50, 0x2f, 0x20, 0x20, 0x65, 0x00, 0x02, 0x3f, 0x01, 0xcf, 0xdf, 0x19, 0x00,
-        0x03, 0x4f, 0x30, 0xec, 0xe1, 0x22, 0x32, 0x00, 0x02, 0x0f, 0x19, 0x00, 0x45, 0x26,
-        0x5e, 0xbb, 0x01, 0x00, 0x26, 0xdc, 0xff, 0x96, 0x00, 0x0f, 0x18, 0x00, 0x05, 0x07,
-        0x02, 0x00, 0x0f, 0x93, 0x00, 0x04, 0x0f, 0x17, 0x00, 0x49, 0x0f, 0x38, 0x01, 0x06,
-        0x0f, 0x68, 0x01, 0x04, 0x0f, 0x02, 0x00, 0x3e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0x57, 0x2f, 0x20, 0x20, 0x17, 0x00, 0x02, 0x3f, 0x01, 0xcf, 0xdf, 0x19, 0x00, 0x03,
+        0x4f, 0x30, 0xec, 0xe1, 0x22, 0x19, 0x00, 0x5a, 0x26, 0x5e, 0xbb, 0x01, 0x00, 0x26, 0xdc,
+        0xff, 0x96, 0x00, 0x0f, 0x18, 0x00, 0x05, 0x0f, 0x48, 0x00, 0x05, 0x0f, 0x17, 0x00, 0x53,
+        0x0f, 0x38, 0x01, 0x06, 0x0f, 0x68, 0x01, 0x04, 0x0f, 0x01, 0x00, 0x3e, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x00,
 
 };
 
@@ -38,11 +33,11 @@ const lv_image_dsc_t icon_arrow_forward_24 = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 24,
                  .h = 24,
-                 .stride = 48,
+                 .stride = 24,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_arrow_forward_24_map),
@@ -20,26 +20,16 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_ARROW_UPWARD_24
     uint8_t icon_arrow_upward_24_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0x16, 0x01, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0xc2, 0x4f, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x00, 0x17, 0x13, 0x00, 0x01, 0x00, 0x0f,
-        0x32, 0x00, 0x13, 0x03, 0x2d, 0x00, 0x01, 0x02, 0x00, 0x0f, 0x32, 0x00, 0x0f, 0x01, 0x27,
-        0x00, 0x07, 0x02, 0x00, 0x0f, 0x32, 0x00, 0x0b, 0x07, 0x29, 0x00, 0x05, 0x02, 0x00, 0x0f,
-        0x32, 0x00, 0x07, 0x04, 0x23, 0x00, 0x02, 0x0a, 0x00, 0x02, 0x06, 0x00, 0x0f, 0xfa, 0x00,
-        0x07, 0x02, 0x1c, 0x00, 0x02, 0x50, 0x00, 0x08, 0x08, 0x00, 0x04, 0x0c, 0x00, 0x0a, 0x02,
-        0x00, 0x02, 0x18, 0x00, 0x02, 0x2e, 0x00, 0x02, 0x0e, 0x00, 0x02, 0x20, 0x00, 0x0a, 0x18,
-        0x00, 0x06, 0x02, 0x00, 0x02, 0x18, 0x00, 0x04, 0x10, 0x00, 0x06, 0x3a, 0x00, 0x02, 0x0c,
-        0x00, 0x06, 0x1a, 0x00, 0x06, 0x02, 0x00, 0x08, 0x14, 0x00, 0x0a, 0x22, 0x00, 0x08, 0x1a,
-        0x00, 0x0f, 0x02, 0x00, 0x03, 0x0a, 0x30, 0x00, 0x0f, 0x02, 0x00, 0x0f, 0x0f, 0x30, 0x00,
-        0xdd, 0x0f, 0x02, 0x00, 0x97, 0x02, 0x38, 0x02, 0x0f, 0x02, 0x00, 0x52, 0x2f, 0x20, 0x20,
-        0x67, 0x00, 0x02, 0x4f, 0x1e, 0xdd, 0xe1, 0x22, 0x19, 0x00, 0x00, 0x4f, 0x1e, 0xdd, 0xff,
-        0xff, 0x19, 0x00, 0x00, 0x7c, 0x20, 0xdf, 0xed, 0xdf, 0xdf, 0xed, 0xdf, 0x4b, 0x00, 0x8b,
-        0x1e, 0xdd, 0xef, 0x34, 0xbf, 0xbf, 0x30, 0xec, 0x32, 0x00, 0x8b, 0x1e, 0xdd, 0xef, 0x34,
-        0x00, 0xbf, 0xbf, 0x00, 0x19, 0x00, 0x01, 0x17, 0x00, 0x4a, 0x00, 0xbf, 0xbf, 0x00, 0x19,
-        0x00, 0x52, 0x1e, 0xdd, 0xef, 0x35, 0x00, 0x18, 0x00, 0x09, 0x19, 0x00, 0x44, 0x1e, 0xce,
-        0x35, 0x00, 0x18, 0x00, 0x36, 0x00, 0x30, 0xcf, 0xae, 0x00, 0x11, 0x01, 0xb8, 0x00, 0x21,
-        0xbf, 0xbf, 0x07, 0x00, 0x02, 0x0d, 0x00, 0x07, 0x02, 0x00, 0x03, 0x18, 0x00, 0x0d, 0x02,
-        0x00, 0x0f, 0x18, 0x00, 0x4d, 0x2d, 0x66, 0x66, 0x73, 0x00, 0x0f, 0x02, 0x00, 0x42, 0x50,
-        0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0x57, 0x2f, 0x20, 0x20, 0x17, 0x00, 0x02, 0x4f, 0x1e, 0xdd, 0xe1, 0x22, 0x17, 0x00,
+        0x02, 0x2f, 0xff, 0xff, 0x19, 0x00, 0x00, 0x7c, 0x20, 0xdf, 0xed, 0xdf, 0xdf, 0xed, 0xdf,
+        0x4b, 0x00, 0x8b, 0x1e, 0xdd, 0xef, 0x34, 0xbf, 0xbf, 0x30, 0xec, 0x32, 0x00, 0x00, 0x17,
+        0x00, 0x4b, 0x00, 0xbf, 0xbf, 0x00, 0x19, 0x00, 0x01, 0x17, 0x00, 0x00, 0x18, 0x00, 0x0a,
+        0x19, 0x00, 0x52, 0x1e, 0xdd, 0xef, 0x35, 0x00, 0x18, 0x00, 0x09, 0x19, 0x00, 0x20, 0x1e,
+        0xce, 0x17, 0x00, 0x02, 0x18, 0x00, 0x36, 0x00, 0x30, 0xcf, 0x31, 0x00, 0x11, 0x01, 0x06,
+        0x00, 0x02, 0x18, 0x00, 0x03, 0x0d, 0x00, 0x07, 0x01, 0x00, 0x03, 0x18, 0x00, 0x0d, 0x01,
+        0x00, 0x0f, 0x18, 0x00, 0x4d, 0x2f, 0x66, 0x66, 0x18, 0x00, 0x03, 0x0f, 0x01, 0x00, 0x3d,
+        0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
 
 };
 
@@ -47,11 +37,11 @@ const lv_image_dsc_t icon_arrow_upward_24 = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 24,
                  .h = 24,
-                 .stride = 48,
+                 .stride = 24,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_arrow_upward_24_map),
@@ -20,26 +20,16 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST
     LV_ATTRIBUTE_ICON_BATTERY_ANDROID_FRAME_4 uint8_t icon_battery_android_frame_4_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0xff, 0x11, 0x4f, 0x04, 0x21, 0xe3, 0x18, 0x02, 0x00, 0x0b, 0x08, 0x45, 0x01, 0x0f,
-        0x2e, 0x00, 0x0f, 0x0a, 0x32, 0x00, 0x68, 0xe3, 0x18, 0xe3, 0x18, 0x04, 0x21, 0x42, 0x00,
-        0x0a, 0x02, 0x00, 0x2a, 0x45, 0x29, 0x22, 0x00, 0x62, 0xe3, 0x18, 0xe3, 0x18, 0x00, 0x00,
-        0x46, 0x00, 0x06, 0x02, 0x00, 0x08, 0x34, 0x00, 0xa0, 0x04, 0x21, 0xe3, 0x18, 0x04, 0x21,
-        0xe3, 0x18, 0x45, 0x29, 0xde, 0x01, 0x42, 0x04, 0x21, 0xe3, 0x18, 0x36, 0x00, 0x08, 0x02,
-        0x00, 0x0c, 0x30, 0x00, 0x02, 0x02, 0x00, 0x0f, 0x30, 0x00, 0x1b, 0x02, 0xb6, 0x00, 0x0f,
-        0x60, 0x00, 0x17, 0x0f, 0x30, 0x00, 0x1d, 0x02, 0x90, 0x00, 0x0f, 0xf0, 0x00, 0x1d, 0x06,
-        0xca, 0x00, 0x0f, 0x02, 0x00, 0x03, 0x0c, 0x50, 0x01, 0x1f, 0x24, 0xde, 0x01, 0x0e, 0x0a,
-        0xb0, 0x01, 0x04, 0x32, 0x00, 0x2f, 0x04, 0x21, 0x02, 0x00, 0x03, 0x0c, 0x2e, 0x00, 0x0f,
-        0x02, 0x00, 0xff, 0x0c, 0x1f, 0x00, 0x01, 0x00, 0x7e, 0x38, 0x08, 0x5e, 0x77, 0x01, 0x00,
-        0x22, 0x75, 0x43, 0xa2, 0x00, 0x2c, 0x08, 0xcc, 0xc9, 0x01, 0x11, 0x84, 0x19, 0x00, 0x31,
-        0x5e, 0xff, 0x50, 0x08, 0x00, 0x04, 0x02, 0x00, 0xd1, 0x06, 0x9a, 0xfd, 0x10, 0x00, 0x00,
-        0x00, 0x00, 0x7f, 0xff, 0x01, 0xa5, 0xcc, 0x01, 0x00, 0x12, 0x8d, 0x1b, 0x00, 0xb2, 0x50,
-        0xff, 0x30, 0x31, 0x06, 0x00, 0x00, 0x80, 0xff, 0x00, 0xce, 0x4a, 0x00, 0x12, 0xb0, 0x18,
-        0x00, 0x5f, 0x4f, 0xff, 0x31, 0xce, 0x6c, 0x18, 0x00, 0x04, 0x1f, 0x80, 0x18, 0x00, 0x1c,
-        0x1f, 0x6d, 0x78, 0x00, 0x03, 0x72, 0x3a, 0x06, 0x00, 0x00, 0x5d, 0xff, 0x51, 0x70, 0x00,
-        0x03, 0x02, 0x00, 0x31, 0x06, 0x9b, 0xfc, 0xa8, 0x00, 0x1f, 0x07, 0xd8, 0x00, 0x04, 0x57,
-        0x00, 0x07, 0x5d, 0x85, 0x88, 0x01, 0x00, 0x23, 0x7d, 0x41, 0x39, 0x00, 0x0f, 0x02, 0x00,
-        0x76, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0x7e, 0x38, 0x08, 0x5e, 0x77, 0x01, 0x00, 0x23, 0x75, 0x43, 0x17, 0x00, 0x2b, 0xcc,
+        0xff, 0x01, 0x00, 0x11, 0x84, 0x18, 0x00, 0x39, 0x5e, 0xff, 0x50, 0x3f, 0x00, 0x40, 0x06,
+        0x9a, 0xfd, 0x10, 0x08, 0x00, 0x51, 0x7f, 0xff, 0x01, 0xa5, 0xcc, 0x01, 0x00, 0x12, 0x8d,
+        0x19, 0x00, 0xb2, 0x50, 0xff, 0x30, 0x31, 0x06, 0x00, 0x00, 0x80, 0xff, 0x00, 0xce, 0x40,
+        0x00, 0x12, 0xb0, 0x18, 0x00, 0x5f, 0x4f, 0xff, 0x31, 0xce, 0x6c, 0x18, 0x00, 0x04, 0x1f,
+        0x80, 0x18, 0x00, 0x1c, 0x1f, 0x6d, 0x78, 0x00, 0x03, 0x7a, 0x3a, 0x06, 0x00, 0x00, 0x5d,
+        0xff, 0x51, 0xa8, 0x00, 0x21, 0x9b, 0xfc, 0xa8, 0x00, 0x1f, 0x07, 0xd8, 0x00, 0x04, 0x57,
+        0x00, 0x07, 0x5d, 0x85, 0x88, 0x01, 0x00, 0x29, 0x7d, 0x41, 0x3f, 0x00, 0x0f, 0x01, 0x00,
+        0x70, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
 
 };
 
@@ -47,11 +37,11 @@ const lv_image_dsc_t icon_battery_android_frame_4 = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 24,
                  .h = 24,
-                 .stride = 48,
+                 .stride = 24,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_battery_android_frame_4_map),
@@ -20,198 +20,99 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_CAMERA uint8_t
     icon_camera_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0x2f, 0x0b, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0xff, 0xff, 0xff, 0x27, 0xff, 0x01, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0x04, 0x21,
-        0x04, 0x21, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0x47, 0x03, 0x55, 0x02, 0x78, 0x00, 0x0f,
-        0x02, 0x00, 0x01, 0x02, 0x8c, 0x00, 0x0f, 0x88, 0x00, 0x47, 0x0f, 0x74, 0x00, 0x01, 0x0f,
-        0x02, 0x00, 0x05, 0x0f, 0x86, 0x00, 0x3d, 0x11, 0xc3, 0x6e, 0x01, 0x0f, 0x02, 0x00, 0x17,
-        0x2f, 0x04, 0x21, 0x92, 0x01, 0x37, 0x2f, 0x00, 0x00, 0x78, 0x00, 0x17, 0x0a, 0x02, 0x00,
-        0x2f, 0x00, 0x00, 0x08, 0x01, 0x2f, 0x02, 0x60, 0x02, 0x0c, 0x02, 0x00, 0x28, 0x04, 0x21,
-        0x5c, 0x00, 0x0f, 0x24, 0x00, 0x03, 0x02, 0xa0, 0x02, 0x0f, 0x82, 0x00, 0x2b, 0x0e, 0x5a,
-        0x00, 0x0f, 0x52, 0x00, 0x01, 0x06, 0x6c, 0x00, 0x02, 0x0a, 0x00, 0x08, 0x02, 0x00, 0x0f,
-        0x30, 0x00, 0x01, 0x0f, 0x02, 0x00, 0x15, 0x0a, 0x7e, 0x00, 0x4f, 0x04, 0x21, 0xa2, 0x10,
-        0x3a, 0x00, 0x01, 0x04, 0x6e, 0x00, 0x04, 0x1c, 0x00, 0x24, 0x86, 0x31, 0x12, 0x00, 0x02,
-        0x02, 0x00, 0x0f, 0x82, 0x00, 0x25, 0x0a, 0x7e, 0x00, 0x06, 0x60, 0x00, 0x0a, 0x02, 0x00,
-        0x04, 0x1e, 0x02, 0x28, 0x24, 0x21, 0x18, 0x00, 0x02, 0x7a, 0x00, 0x04, 0x02, 0x00, 0x0f,
-        0x82, 0x00, 0x21, 0x0a, 0x7e, 0x00, 0x08, 0xee, 0x01, 0x0a, 0x02, 0x00, 0x02, 0x64, 0x00,
-        0x0e, 0x62, 0x00, 0x04, 0x98, 0x00, 0x02, 0x02, 0x00, 0x0e, 0x20, 0x00, 0x0f, 0x02, 0x00,
-        0x0b, 0x08, 0x7e, 0x00, 0x0f, 0x3c, 0x00, 0x09, 0x22, 0xa2, 0x10, 0x66, 0x02, 0x0f, 0xa0,
-        0x00, 0x03, 0x0f, 0x46, 0x00, 0x15, 0x0c, 0x02, 0x00, 0x28, 0x00, 0x00, 0x3a, 0x00, 0x0f,
-        0x7a, 0x01, 0x05, 0x00, 0xba, 0x08, 0x0f, 0xde, 0x00, 0x0d, 0x02, 0x20, 0x00, 0x02, 0x02,
-        0x00, 0x0f, 0xa4, 0x00, 0x03, 0x0f, 0x02, 0x00, 0x01, 0x02, 0x30, 0x00, 0x06, 0x02, 0x00,
-        0x0f, 0x02, 0x01, 0x05, 0x02, 0x22, 0x00, 0x0f, 0x1e, 0x00, 0x05, 0x02, 0x02, 0x00, 0x02,
-        0x24, 0x00, 0x02, 0x02, 0x00, 0x02, 0x12, 0x00, 0x0f, 0x02, 0x00, 0x0d, 0x06, 0xec, 0x04,
-        0x06, 0x06, 0x01, 0x0f, 0x34, 0x00, 0x03, 0x02, 0x56, 0x00, 0x0f, 0x1e, 0x00, 0x05, 0x02,
-        0x02, 0x00, 0x0a, 0x4c, 0x01, 0x02, 0x14, 0x00, 0x0f, 0x02, 0x00, 0x0b, 0x06, 0x76, 0x00,
-        0x2f, 0xe3, 0x18, 0x64, 0x00, 0x09, 0x0f, 0x7e, 0x00, 0x11, 0x00, 0x5e, 0x0a, 0x0a, 0x50,
-        0x00, 0x0f, 0x02, 0x00, 0x0d, 0x06, 0xfe, 0x00, 0x02, 0xae, 0x00, 0x11, 0x24, 0x60, 0x07,
-        0x02, 0x0c, 0x00, 0x08, 0x02, 0x00, 0x04, 0xe0, 0x02, 0x0a, 0x78, 0x03, 0x0f, 0x02, 0x00,
-        0x03, 0x04, 0xaa, 0x00, 0x0f, 0x48, 0x00, 0x01, 0x0c, 0x02, 0x00, 0x02, 0x26, 0x00, 0x02,
-        0xd6, 0x02, 0x02, 0x1c, 0x00, 0x02, 0x0e, 0x00, 0x0c, 0x82, 0x00, 0x0f, 0x16, 0x00, 0x03,
-        0x0f, 0x02, 0x00, 0x03, 0x04, 0xc4, 0x00, 0x0e, 0x46, 0x00, 0x0e, 0x02, 0x00, 0x02, 0x26,
-        0x00, 0x08, 0x56, 0x02, 0x04, 0xc2, 0x01, 0x08, 0xd2, 0x06, 0x02, 0x26, 0x00, 0x04, 0xa2,
-        0x00, 0x0f, 0x02, 0x00, 0x0f, 0x02, 0x30, 0x00, 0x0f, 0x80, 0x00, 0x0f, 0x02, 0x24, 0x00,
-        0x02, 0x02, 0x00, 0x06, 0x56, 0x00, 0x02, 0x10, 0x00, 0x0f, 0x12, 0x00, 0x01, 0x2f, 0x04,
-        0x21, 0x02, 0x00, 0x13, 0x04, 0x42, 0x00, 0x0a, 0x46, 0x00, 0x0e, 0x02, 0x00, 0x02, 0x22,
-        0x00, 0x0e, 0x26, 0x00, 0x02, 0x14, 0x00, 0x04, 0x82, 0x00, 0x04, 0x0e, 0x00, 0x0f, 0x02,
-        0x00, 0x21, 0x0f, 0x34, 0x01, 0x0b, 0x06, 0xaa, 0x00, 0x0a, 0x9c, 0x00, 0x04, 0x18, 0x00,
-        0x02, 0x16, 0x00, 0x0f, 0x78, 0x00, 0x05, 0x0f, 0x0c, 0x01, 0x09, 0x06, 0x34, 0x00, 0x02,
-        0x44, 0x00, 0x0f, 0x02, 0x00, 0x03, 0x04, 0x26, 0x00, 0x0e, 0xa6, 0x00, 0x04, 0x42, 0x00,
-        0x06, 0x24, 0x00, 0x0f, 0x02, 0x00, 0x01, 0x0f, 0x56, 0x00, 0x03, 0x06, 0x2a, 0x05, 0x06,
-        0x44, 0x01, 0x0f, 0x02, 0x00, 0x01, 0x06, 0x7c, 0x03, 0x0e, 0x2c, 0x05, 0x04, 0x1c, 0x00,
-        0x04, 0x08, 0x00, 0x0f, 0x02, 0x00, 0x03, 0x2f, 0x45, 0x29, 0x58, 0x00, 0x01, 0x00, 0x64,
-        0x0e, 0x04, 0xb0, 0x03, 0x0f, 0x82, 0x00, 0x09, 0x02, 0x1e, 0x00, 0x0f, 0xfe, 0x00, 0x01,
-        0x0c, 0x48, 0x04, 0x0f, 0x02, 0x00, 0x07, 0x02, 0x2c, 0x00, 0x0f, 0x02, 0x00, 0x01, 0x06,
-        0x34, 0x00, 0x0f, 0x1e, 0x00, 0x01, 0x08, 0x24, 0x01, 0x0e, 0x7e, 0x01, 0x0c, 0xc2, 0x00,
-        0x0f, 0x02, 0x00, 0x07, 0x0f, 0x3c, 0x00, 0x03, 0x08, 0x5e, 0x00, 0x0f, 0x80, 0x00, 0x07,
-        0x04, 0xe4, 0x01, 0x0f, 0x22, 0x00, 0x05, 0x0f, 0x76, 0x00, 0x07, 0x08, 0x02, 0x00, 0x02,
-        0x6e, 0x00, 0x0e, 0x02, 0x00, 0x0f, 0x5e, 0x00, 0x0d, 0x06, 0x22, 0x00, 0x0f, 0xc4, 0x00,
-        0x11, 0x0f, 0x02, 0x00, 0x09, 0x0e, 0x7c, 0x00, 0x0f, 0x00, 0x01, 0x13, 0x06, 0x54, 0x00,
-        0x02, 0x32, 0x00, 0x0e, 0x02, 0x00, 0x06, 0xc4, 0x00, 0x0f, 0x02, 0x00, 0x09, 0x0e, 0xbe,
-        0x02, 0x0f, 0x80, 0x00, 0x35, 0x08, 0xa4, 0x00, 0x0f, 0x02, 0x00, 0x07, 0x0f, 0x40, 0x01,
-        0x03, 0x06, 0x30, 0x00, 0x02, 0x90, 0x00, 0x0e, 0x02, 0x00, 0x06, 0x22, 0x00, 0x0f, 0xc2,
-        0x00, 0x03, 0x00, 0xac, 0x11, 0x26, 0x45, 0x29, 0x26, 0x00, 0x0e, 0x02, 0x00, 0x04, 0x9e,
-        0x03, 0x08, 0x2c, 0x06, 0x02, 0x02, 0x00, 0x06, 0x80, 0x03, 0x0f, 0x9e, 0x00, 0x03, 0x02,
-        0x02, 0x00, 0x06, 0x52, 0x00, 0x02, 0x10, 0x00, 0x0f, 0x02, 0x00, 0x01, 0x06, 0x24, 0x00,
-        0x0e, 0x02, 0x00, 0x04, 0x1e, 0x00, 0x0e, 0x64, 0x00, 0x06, 0x2c, 0x00, 0x0f, 0x54, 0x00,
-        0x01, 0x04, 0x02, 0x00, 0x06, 0x26, 0x00, 0x0f, 0x4c, 0x05, 0x13, 0x0a, 0x02, 0x00, 0x02,
-        0x46, 0x00, 0x02, 0x14, 0x00, 0x0c, 0x82, 0x00, 0x06, 0x3a, 0x02, 0x02, 0x26, 0x00, 0x0f,
-        0x02, 0x00, 0x03, 0x06, 0x26, 0x00, 0x0f, 0x02, 0x00, 0x21, 0x02, 0x54, 0x00, 0x04, 0x44,
-        0x00, 0x02, 0x0e, 0x00, 0x04, 0x02, 0x00, 0x04, 0x16, 0x00, 0x0c, 0x18, 0x00, 0x0a, 0x02,
-        0x00, 0x08, 0x76, 0x00, 0x0f, 0x02, 0x01, 0x09, 0x08, 0x02, 0x00, 0x04, 0x34, 0x00, 0x06,
-        0x4a, 0x00, 0x0f, 0x12, 0x00, 0x07, 0x0e, 0x18, 0x01, 0x0c, 0x02, 0x00, 0x04, 0x50, 0x00,
-        0x0c, 0x40, 0x01, 0x0f, 0x02, 0x00, 0x07, 0x02, 0x32, 0x00, 0x08, 0x88, 0x09, 0x04, 0xf0,
-        0x08, 0x06, 0xc6, 0x02, 0x04, 0x92, 0x00, 0x08, 0xa6, 0x00, 0x0f, 0x02, 0x00, 0x03, 0x06,
-        0x2a, 0x00, 0x0f, 0x4c, 0x06, 0x07, 0x08, 0x02, 0x00, 0x04, 0x30, 0x00, 0x08, 0x14, 0x00,
-        0x0c, 0x16, 0x00, 0x02, 0xa2, 0x00, 0x02, 0x02, 0x00, 0x0a, 0x28, 0x00, 0x0e, 0x02, 0x00,
-        0x02, 0x26, 0x00, 0x02, 0x02, 0x00, 0x0e, 0x1e, 0x00, 0x0c, 0x02, 0x00, 0x04, 0x5a, 0x00,
-        0x2c, 0x86, 0x31, 0x1a, 0x00, 0x02, 0x42, 0x00, 0x02, 0x16, 0x01, 0x02, 0x0c, 0x00, 0x02,
-        0x02, 0x00, 0x0c, 0x28, 0x00, 0x0e, 0x02, 0x00, 0x02, 0x28, 0x00, 0x0f, 0xac, 0x01, 0x11,
-        0x04, 0x2c, 0x00, 0x0f, 0xac, 0x01, 0x01, 0x04, 0x9a, 0x00, 0x06, 0x0a, 0x00, 0x0f, 0x7e,
-        0x01, 0x11, 0x06, 0x54, 0x00, 0x02, 0x02, 0x00, 0x06, 0xc2, 0x01, 0x0f, 0x02, 0x00, 0x01,
-        0x02, 0x24, 0x00, 0x0f, 0x7e, 0x00, 0x01, 0x0c, 0x48, 0x00, 0x04, 0x02, 0x00, 0x02, 0x1a,
-        0x00, 0x0f, 0x02, 0x00, 0x0d, 0x04, 0xbc, 0x00, 0x0f, 0xb2, 0x00, 0x0d, 0x02, 0x22, 0x00,
-        0x0f, 0x56, 0x00, 0x05, 0x08, 0x46, 0x00, 0x0f, 0x4e, 0x01, 0x13, 0x04, 0x02, 0x00, 0x06,
-        0x2c, 0x05, 0x0f, 0xde, 0x00, 0x07, 0x04, 0x7e, 0x00, 0x0f, 0xfe, 0x00, 0x05, 0x06, 0x22,
-        0x00, 0x04, 0x02, 0x00, 0x0f, 0x4c, 0x01, 0x0b, 0x0a, 0x02, 0x00, 0x04, 0x42, 0x03, 0x02,
-        0x02, 0x00, 0x0a, 0x1c, 0x00, 0x02, 0x02, 0x00, 0x04, 0xa4, 0x00, 0x02, 0x62, 0x02, 0x0f,
-        0x02, 0x00, 0x03, 0x02, 0x3e, 0x00, 0x02, 0x02, 0x00, 0x0e, 0x12, 0x06, 0x0f, 0x02, 0x00,
-        0x0b, 0x08, 0x3e, 0x01, 0x0f, 0xe0, 0x0f, 0x01, 0x02, 0x56, 0x00, 0x0f, 0xfe, 0x00, 0x07,
-        0x28, 0x45, 0x29, 0x42, 0x00, 0x0f, 0xc4, 0x00, 0x03, 0x0f, 0x02, 0x00, 0x0b, 0x0a, 0x40,
-        0x00, 0x0a, 0x6a, 0x00, 0x0f, 0x78, 0x10, 0x0b, 0x22, 0xff, 0xff, 0x0c, 0x15, 0x04, 0x02,
-        0x00, 0x0a, 0x3c, 0x00, 0x0f, 0x02, 0x00, 0x17, 0x0c, 0x82, 0x00, 0x06, 0x6c, 0x01, 0x04,
-        0x5a, 0x00, 0x0f, 0x4c, 0x00, 0x01, 0x0a, 0xbc, 0x01, 0x0f, 0x7e, 0x00, 0x27, 0x02, 0xc8,
-        0x00, 0x04, 0x6a, 0x00, 0x04, 0x02, 0x00, 0x26, 0xc3, 0x18, 0x98, 0x00, 0x02, 0x24, 0x00,
-        0x08, 0x02, 0x00, 0x0e, 0x30, 0x00, 0x0f, 0x26, 0x00, 0x01, 0x0f, 0x02, 0x00, 0x19, 0x0c,
-        0xce, 0x00, 0x08, 0x02, 0x00, 0x06, 0x48, 0x00, 0x22, 0x00, 0x00, 0x92, 0x06, 0x08, 0x1e,
-        0x00, 0x0f, 0x9e, 0x02, 0x0d, 0x0f, 0x02, 0x00, 0x15, 0x04, 0x00, 0x0f, 0x0f, 0x02, 0x00,
-        0x1d, 0x0f, 0xb6, 0x02, 0x01, 0x0f, 0x02, 0x00, 0x25, 0x0f, 0x7c, 0x00, 0x1d, 0x0f, 0xea,
-        0x0f, 0x11, 0x0f, 0x02, 0x00, 0x1d, 0x02, 0x56, 0x00, 0x0f, 0x02, 0x00, 0x13, 0x0f, 0x5c,
-        0x00, 0x1d, 0x0f, 0x02, 0x00, 0x17, 0x0e, 0xe4, 0x01, 0x0a, 0x02, 0x00, 0x0f, 0x4a, 0x00,
-        0x17, 0x0f, 0x02, 0x00, 0x2b, 0x02, 0x1e, 0x13, 0x02, 0xe8, 0x03, 0x2f, 0x04, 0x21, 0x78,
-        0x00, 0x57, 0x0f, 0x02, 0x00, 0xff, 0xff, 0xbf, 0x1f, 0x00, 0x01, 0x00, 0xff, 0x89, 0x8f,
-        0x12, 0x32, 0x44, 0x50, 0x50, 0x44, 0x33, 0x13, 0xa3, 0x01, 0x21, 0x44, 0x32, 0x77, 0xb9,
-        0xeb, 0xac, 0x04, 0x4f, 0xec, 0xba, 0x79, 0x34, 0x44, 0x00, 0x1a, 0x34, 0x11, 0x75, 0xd5,
-        0x3c, 0x00, 0x04, 0x02, 0x00, 0x3f, 0xd7, 0x77, 0x12, 0x43, 0x00, 0x15, 0x34, 0x13, 0x87,
-        0xf2, 0x36, 0x00, 0x08, 0x02, 0x00, 0x2f, 0xf2, 0x89, 0xc9, 0x00, 0x12, 0x25, 0x01, 0x62,
-        0xb8, 0x00, 0x84, 0xf6, 0xd0, 0xbb, 0xaf, 0xae, 0xbd, 0xd5, 0xfa, 0x46, 0x00, 0x3f, 0xeb,
-        0x62, 0x01, 0x84, 0x00, 0x0e, 0x22, 0x16, 0xb9, 0x2e, 0x00, 0x42, 0xfa, 0xb0, 0x66, 0x26,
-        0x2e, 0x00, 0x53, 0x17, 0xf1, 0xff, 0xc8, 0xb7, 0x44, 0x00, 0x2f, 0xb8, 0x16, 0x41, 0x00,
-        0x0c, 0x21, 0x38, 0xe6, 0x3f, 0x00, 0x26, 0xeb, 0x7b, 0x29, 0x00, 0x81, 0x9d, 0xff, 0xf9,
-        0x27, 0x00, 0x11, 0x6e, 0xe1, 0x19, 0x00, 0x2f, 0xe5, 0x36, 0x41, 0x00, 0x0a, 0x20, 0x48,
-        0xf4, 0x50, 0x23, 0x36, 0xf7, 0x81, 0x0c, 0x26, 0x00, 0xb0, 0x34, 0xfd, 0xff, 0x8c, 0x00,
-        0x00, 0x00, 0x00, 0x05, 0x6a, 0xf0, 0x6c, 0x23, 0x26, 0xf4, 0x48, 0x1b, 0x00, 0x0d, 0x02,
-        0x00, 0x11, 0x48, 0xa7, 0x00, 0x27, 0xc7, 0x24, 0x19, 0x00, 0x52, 0x01, 0xc6, 0xff, 0xe8,
-        0x0e, 0x10, 0x00, 0x20, 0x1a, 0xb3, 0xad, 0x23, 0x1f, 0xfa, 0x41, 0x00, 0x07, 0x11, 0x38,
-        0x7e, 0x00, 0x22, 0x8d, 0x04, 0x2f, 0x00, 0x02, 0x02, 0x00, 0x42, 0x5c, 0xff, 0xff, 0x61,
-        0x0a, 0x00, 0x9f, 0x00, 0x00, 0x01, 0x82, 0xfe, 0xff, 0xff, 0xff, 0xf4, 0xc3, 0x00, 0x05,
-        0x11, 0x16, 0xfc, 0x00, 0x14, 0x71, 0x2e, 0x00, 0x01, 0x02, 0x00, 0x51, 0x0c, 0xe4, 0xff,
-        0xca, 0x02, 0x0a, 0x00, 0x01, 0x02, 0x00, 0x66, 0x60, 0xfd, 0xff, 0xff, 0xff, 0xe5, 0x1c,
-        0x01, 0x08, 0x02, 0x00, 0x21, 0x02, 0xba, 0x22, 0x01, 0x18, 0x77, 0x14, 0x00, 0x58, 0x00,
-        0x85, 0xff, 0xfe, 0x38, 0x11, 0x00, 0x62, 0x64, 0xfe, 0xff, 0xff, 0xff, 0xb8, 0x99, 0x01,
-        0x0b, 0x02, 0x00, 0x10, 0x64, 0x8b, 0x24, 0x47, 0xee, 0xff, 0xf2, 0x18, 0x18, 0x00, 0x47,
-        0x22, 0xf7, 0xff, 0xa1, 0x0f, 0x00, 0x40, 0x00, 0x00, 0x00, 0x82, 0xb1, 0x24, 0x11, 0x62,
-        0x0b, 0x00, 0x0a, 0x02, 0x00, 0xa7, 0x13, 0xec, 0xff, 0xff, 0xff, 0xd2, 0x2b, 0xf9, 0xff,
-        0x9c, 0x18, 0x00, 0x47, 0xaf, 0xff, 0xf2, 0x1a, 0x0f, 0x00, 0x04, 0xa6, 0x00, 0x1f, 0xeb,
-        0xcc, 0x02, 0x00, 0xb1, 0x89, 0xff, 0xff, 0xff, 0xfb, 0x34, 0x00, 0x8a, 0xff, 0xfd, 0x34,
-        0x29, 0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0x43, 0xff, 0xff, 0x76, 0x0a, 0x00, 0x06, 0x02,
-        0x00, 0x66, 0x18, 0xf1, 0xff, 0xff, 0xff, 0x86, 0x10, 0x00, 0x03, 0x02, 0x00, 0xc3, 0x13,
-        0xf2, 0xff, 0xff, 0xff, 0x82, 0x00, 0x00, 0x0e, 0xe8, 0xff, 0xc1, 0x13, 0x00, 0x64, 0x00,
-        0x04, 0xd4, 0xff, 0xdb, 0x07, 0x0d, 0x00, 0x05, 0x02, 0x00, 0x5d, 0x75, 0xff, 0xff, 0xff,
-        0xf2, 0x81, 0x00, 0xd3, 0x77, 0xff, 0xff, 0xff, 0xf1, 0x0f, 0x00, 0x00, 0x00, 0x62, 0xff,
-        0xff, 0x54, 0x2c, 0x00, 0x43, 0x6d, 0xff, 0xff, 0x4d, 0x0b, 0x00, 0x07, 0x02, 0x00, 0x2d,
-        0x07, 0xe6, 0x66, 0x01, 0xf1, 0x02, 0x00, 0x00, 0x00, 0xd7, 0xff, 0xff, 0xff, 0x89, 0x00,
-        0x00, 0x00, 0x00, 0x02, 0xca, 0xff, 0xe2, 0x0a, 0x13, 0x00, 0x41, 0x12, 0xec, 0xff, 0xba,
-        0x09, 0x00, 0x0b, 0x02, 0x00, 0x5b, 0x7a, 0xff, 0xff, 0xff, 0xd9, 0x14, 0x00, 0x52, 0x34,
-        0xff, 0xff, 0xff, 0xf9, 0x2b, 0x01, 0x41, 0x3c, 0xfe, 0xff, 0x7a, 0x1e, 0x00, 0x5f, 0x97,
-        0xff, 0xff, 0xc6, 0xaa, 0x01, 0x00, 0x00, 0x01, 0x62, 0x03, 0x11, 0x32, 0x23, 0x00, 0x05,
-        0x02, 0x00, 0x53, 0x7a, 0xff, 0xff, 0xff, 0xb3, 0x0e, 0x00, 0x91, 0xa7, 0xff, 0xf3, 0x1a,
-        0x00, 0x00, 0x00, 0x2b, 0xfb, 0x10, 0x02, 0x0f, 0x02, 0x00, 0x04, 0x13, 0x78, 0x2d, 0x00,
-        0x03, 0x02, 0x00, 0x53, 0xba, 0xff, 0xff, 0xff, 0x64, 0x0c, 0x00, 0x86, 0x1d, 0xf5, 0xff,
-        0x9f, 0x00, 0x00, 0x00, 0xc0, 0x3a, 0x00, 0x1a, 0xf8, 0x86, 0x00, 0x53, 0xc4, 0xff, 0xff,
-        0xff, 0xb9, 0x2d, 0x00, 0x03, 0x02, 0x00, 0x53, 0xec, 0xff, 0xff, 0xff, 0x26, 0x0c, 0x00,
-        0x76, 0x00, 0x80, 0xff, 0xfd, 0x35, 0x00, 0x56, 0x3f, 0x00, 0x34, 0xff, 0xff, 0x4e, 0x1b,
-        0x00, 0x01, 0x02, 0x00, 0x51, 0x2c, 0xff, 0xff, 0xff, 0xea, 0x0a, 0x00, 0x04, 0x02, 0x00,
-        0x55, 0x13, 0xff, 0xff, 0xff, 0xf2, 0x96, 0x02, 0x68, 0x0a, 0xe1, 0xff, 0xc3, 0x0a, 0xe0,
-        0x40, 0x00, 0x24, 0xda, 0x06, 0x2a, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x04, 0xf7, 0xff,
-        0xff, 0xff, 0x11, 0x0c, 0x00, 0x02, 0x02, 0x00, 0x52, 0x35, 0xff, 0xff, 0xff, 0xd2, 0x0b,
-        0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x58, 0xff, 0xff, 0xc3, 0x3f, 0x00, 0x32, 0xff, 0xff,
-        0x75, 0x19, 0x00, 0x03, 0x02, 0x00, 0x53, 0xd3, 0xff, 0xff, 0xff, 0x33, 0x0c, 0x00, 0x01,
-        0x02, 0x00, 0x38, 0x43, 0xff, 0xff, 0xac, 0x01, 0x1b, 0x01, 0x3e, 0x00, 0x41, 0xff, 0xff,
-        0xf1, 0x17, 0x28, 0x00, 0x03, 0x02, 0x00, 0x53, 0xc1, 0xff, 0xff, 0xff, 0x42, 0x0c, 0x00,
-        0x01, 0x02, 0x00, 0x51, 0x4f, 0xff, 0xff, 0xff, 0xaf, 0x0a, 0x00, 0x02, 0x02, 0x00, 0x2a,
-        0x31, 0xfd, 0x7f, 0x00, 0x19, 0xff, 0x16, 0x03, 0x2c, 0x00, 0xb2, 0x13, 0x01, 0x52, 0x4f,
-        0xff, 0xff, 0xff, 0xb2, 0x3b, 0x00, 0x02, 0x02, 0x00, 0x1c, 0x9c, 0x40, 0x00, 0x22, 0xfd,
-        0x35, 0x19, 0x00, 0x01, 0x02, 0x00, 0x1c, 0xb0, 0x40, 0x00, 0x36, 0x43, 0xff, 0xff, 0xf7,
-        0x02, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x17, 0xf1, 0x41, 0x00, 0x15, 0xc3, 0x5f, 0x01, 0x72,
-        0x00, 0x00, 0xbc, 0xff, 0xff, 0xff, 0x41, 0x29, 0x00, 0x02, 0x02, 0x00, 0x52, 0x34, 0xff,
-        0xff, 0xff, 0xd3, 0x0b, 0x00, 0x03, 0x02, 0x00, 0x1a, 0x75, 0x40, 0x00, 0x43, 0xc3, 0xff,
-        0xff, 0x58, 0x1a, 0x00, 0x4c, 0x00, 0x00, 0x00, 0xd6, 0x81, 0x02, 0x59, 0x12, 0xff, 0xff,
-        0xff, 0xf7, 0xf8, 0x04, 0x28, 0x06, 0xda, 0x41, 0x00, 0x52, 0xe0, 0x0a, 0xc3, 0xff, 0xe1,
-        0x16, 0x03, 0x91, 0x00, 0x00, 0x00, 0x03, 0xf7, 0xff, 0xff, 0xff, 0x10, 0x0b, 0x00, 0x04,
-        0x02, 0x00, 0x54, 0xeb, 0xff, 0xff, 0xff, 0x2c, 0x0d, 0x00, 0x01, 0x02, 0x00, 0x18, 0x4e,
-        0x40, 0x00, 0x61, 0x55, 0x00, 0x31, 0xfd, 0xff, 0x80, 0x18, 0x00, 0x81, 0x00, 0x00, 0x00,
-        0x32, 0xff, 0xff, 0xff, 0xe9, 0x0a, 0x00, 0x05, 0x02, 0x00, 0x5a, 0xb8, 0xff, 0xff, 0xff,
-        0xc4, 0xa6, 0x02, 0x16, 0xf8, 0x41, 0x00, 0x83, 0xc0, 0x00, 0x00, 0x00, 0x9f, 0xff, 0xf5,
-        0x1d, 0x2f, 0x00, 0x53, 0x70, 0xff, 0xff, 0xff, 0xb7, 0x0c, 0x00, 0x03, 0x02, 0x00, 0x16,
-        0x78, 0x2d, 0x00, 0x0e, 0x02, 0x00, 0x22, 0xfd, 0x33, 0x52, 0x01, 0x13, 0xa7, 0x2d, 0x00,
-        0x1d, 0xc2, 0x51, 0x02, 0x11, 0x00, 0x80, 0x14, 0x1a, 0xb9, 0x81, 0x00, 0x02, 0x02, 0x00,
-        0x41, 0xc9, 0xff, 0xff, 0x98, 0x38, 0x00, 0x41, 0x7a, 0xff, 0xfe, 0x3c, 0x09, 0x00, 0x61,
-        0x23, 0xfc, 0xff, 0xff, 0xff, 0x2f, 0x0b, 0x00, 0x06, 0x02, 0x00, 0x56, 0xd2, 0xff, 0xff,
-        0xff, 0x79, 0x0f, 0x00, 0x06, 0x02, 0x00, 0x41, 0xba, 0xff, 0xee, 0x15, 0x0e, 0x00, 0x41,
-        0x07, 0xdb, 0xff, 0xce, 0x0b, 0x06, 0x51, 0x98, 0xff, 0xff, 0xff, 0xd4, 0x13, 0x00, 0x07,
-        0x02, 0x00, 0x59, 0x75, 0xff, 0xff, 0xff, 0xe5, 0x26, 0x03, 0x02, 0x02, 0x00, 0x42, 0x52,
-        0xff, 0xff, 0x6f, 0x0a, 0x00, 0x22, 0x00, 0x54, 0xb9, 0x05, 0x63, 0x17, 0xf7, 0xff, 0xff,
-        0xff, 0x74, 0x14, 0x00, 0x05, 0x02, 0x00, 0x2e, 0x11, 0xf1, 0xd5, 0x00, 0x81, 0x00, 0x00,
-        0x00, 0x08, 0xdd, 0xff, 0xd6, 0x05, 0x0a, 0x00, 0xe9, 0x00, 0x00, 0x00, 0xc1, 0xff, 0xe8,
-        0x0e, 0x00, 0x00, 0x8d, 0xff, 0xff, 0xff, 0xf0, 0x7e, 0x03, 0x01, 0x02, 0x00, 0x61, 0x86,
-        0xff, 0xff, 0xff, 0xf5, 0x1f, 0x0b, 0x00, 0x07, 0x02, 0x00, 0x36, 0x7a, 0xff, 0xff, 0x30,
-        0x07, 0xb7, 0x30, 0xfc, 0xff, 0x8a, 0x00, 0x37, 0xfc, 0xff, 0xff, 0xff, 0x83, 0x23, 0x00,
-        0x03, 0x02, 0x00, 0x73, 0x12, 0xea, 0xff, 0xff, 0xff, 0xbb, 0x03, 0x0e, 0x00, 0x03, 0x02,
-        0x00, 0x29, 0x19, 0xf2, 0x17, 0x03, 0x9e, 0x9c, 0xff, 0xf9, 0x2b, 0xd4, 0xff, 0xff, 0xff,
-        0xe9, 0x7f, 0x00, 0x30, 0x00, 0x00, 0x61, 0x4b, 0x2b, 0x13, 0x84, 0x39, 0x00, 0x03, 0x02,
-        0x00, 0x38, 0xa0, 0xff, 0xf8, 0xcd, 0x07, 0x40, 0x18, 0xf2, 0xff, 0xee, 0x71, 0x2b, 0x13,
-        0x5f, 0x1f, 0x00, 0x09, 0x02, 0x00, 0x78, 0x01, 0xb7, 0xff, 0xff, 0xff, 0xfe, 0x67, 0x14,
-        0x00, 0x22, 0x35, 0xfd, 0xd4, 0x05, 0x05, 0x02, 0x00, 0x11, 0x77, 0x1d, 0x02, 0x17, 0xb6,
-        0x4b, 0x03, 0x07, 0x02, 0x00, 0x76, 0x15, 0xe5, 0xff, 0xff, 0xff, 0xfe, 0x65, 0x12, 0x00,
-        0x56, 0x01, 0xc6, 0xff, 0xe7, 0x0d, 0x0f, 0x00, 0x41, 0x00, 0x00, 0x00, 0x72, 0x97, 0x14,
-        0x11, 0x14, 0x0c, 0x00, 0x0e, 0x02, 0x00, 0x75, 0x36, 0xf4, 0xff, 0xff, 0xff, 0xfe, 0x88,
-        0x04, 0x01, 0x48, 0x5b, 0xff, 0xff, 0x60, 0x26, 0x00, 0x20, 0x06, 0x91, 0x2e, 0x2c, 0x18,
-        0xf3, 0x0a, 0x04, 0x0a, 0x02, 0x00, 0x02, 0xc0, 0x08, 0x13, 0xb9, 0xe8, 0x02, 0x29, 0x0b,
-        0xe3, 0x3c, 0x08, 0x31, 0x00, 0x26, 0xca, 0xc0, 0x08, 0x1a, 0x47, 0x34, 0x00, 0x09, 0x02,
-        0x00, 0x02, 0x40, 0x09, 0x21, 0xf3, 0x71, 0x36, 0x07, 0x46, 0x82, 0xff, 0xfe, 0x39, 0x1e,
-        0x00, 0x21, 0x0d, 0x85, 0x51, 0x03, 0x1f, 0xf3, 0x3f, 0x00, 0x09, 0x41, 0x00, 0x00, 0x36,
-        0xe4, 0x22, 0x01, 0x85, 0xe6, 0x75, 0x14, 0x00, 0x1f, 0xf6, 0xff, 0xa2, 0x3f, 0x00, 0x31,
-        0x17, 0x7b, 0xec, 0x19, 0x00, 0x1f, 0xe3, 0xbd, 0x00, 0x07, 0x02, 0x02, 0x00, 0x21, 0x15,
-        0xb7, 0x28, 0x00, 0x42, 0xff, 0xfc, 0xbb, 0xc3, 0xc7, 0x06, 0x61, 0x00, 0x00, 0x02, 0x27,
-        0x68, 0xb2, 0x99, 0x09, 0x32, 0xff, 0xff, 0xb7, 0x0b, 0x03, 0x0f, 0x02, 0x00, 0x09, 0x32,
-        0x01, 0x61, 0xea, 0x42, 0x00, 0xa4, 0xff, 0xff, 0xfd, 0xde, 0xbf, 0xb0, 0xb0, 0xbb, 0xd3,
-        0xf7, 0x10, 0x00, 0x2f, 0xea, 0x61, 0xb9, 0x01, 0x03, 0x0b, 0x02, 0x00, 0x2d, 0x11, 0x85,
-        0x3d, 0x05, 0x6d, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x86, 0x35, 0x08, 0x0f, 0x02, 0x00, 0x05,
-        0x32, 0x11, 0x75, 0xd4, 0x34, 0x00, 0x06, 0x02, 0x00, 0x1f, 0xd6, 0xc0, 0x0b, 0x17, 0x01,
-        0x02, 0x00, 0x35, 0x30, 0x76, 0xb7, 0xc8, 0x00, 0x3b, 0xeb, 0xb9, 0x77, 0xef, 0x07, 0x0f,
-        0x02, 0x00, 0x13, 0x7f, 0x11, 0x30, 0x43, 0x4f, 0x4f, 0x44, 0x30, 0x2d, 0x03, 0x01, 0x0f,
-        0x02, 0x00, 0xff, 0x72, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0x5f, 0x05, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0xff, 0x89, 0x8f, 0x12, 0x32, 0x44, 0x50, 0x50, 0x44, 0x33, 0x13, 0x2b, 0x00, 0x10,
+        0x0d, 0x01, 0x00, 0x53, 0x32, 0x77, 0xb9, 0xeb, 0xff, 0x01, 0x00, 0x4f, 0xec, 0xba, 0x79,
+        0x34, 0x33, 0x00, 0x10, 0x06, 0x01, 0x00, 0x34, 0x11, 0x75, 0xd5, 0x3c, 0x00, 0x04, 0x01,
+        0x00, 0x3f, 0xd7, 0x77, 0x12, 0x39, 0x00, 0x10, 0x01, 0x01, 0x00, 0x3c, 0x13, 0x87, 0xf2,
+        0x3e, 0x00, 0x00, 0x01, 0x00, 0x2f, 0xf2, 0x89, 0xc9, 0x00, 0x12, 0x25, 0x01, 0x62, 0xb8,
+        0x00, 0x84, 0xf6, 0xd0, 0xbb, 0xaf, 0xae, 0xbd, 0xd5, 0xfa, 0x10, 0x00, 0x3f, 0xeb, 0x62,
+        0x01, 0x3f, 0x00, 0x0e, 0x22, 0x16, 0xb9, 0x2c, 0x00, 0x42, 0xfa, 0xb0, 0x66, 0x26, 0x2e,
+        0x00, 0x53, 0x17, 0xf1, 0xff, 0xc8, 0xb7, 0x44, 0x00, 0x2f, 0xb8, 0x16, 0x3f, 0x00, 0x0c,
+        0x22, 0x38, 0xe6, 0x6a, 0x00, 0x16, 0x7b, 0x29, 0x00, 0x81, 0x9d, 0xff, 0xf9, 0x27, 0x00,
+        0x11, 0x6e, 0xe1, 0x19, 0x00, 0x2f, 0xe5, 0x36, 0x3f, 0x00, 0x0a, 0x20, 0x48, 0xf4, 0x25,
+        0x00, 0x36, 0xf7, 0x81, 0x0c, 0x13, 0x00, 0x40, 0x34, 0xfd, 0xff, 0x8c, 0x08, 0x00, 0x30,
+        0x05, 0x6a, 0xf0, 0x1c, 0x00, 0x2f, 0xf4, 0x48, 0x3f, 0x00, 0x09, 0x01, 0xa7, 0x00, 0x27,
+        0xc7, 0x24, 0x13, 0x00, 0x52, 0x01, 0xc6, 0xff, 0xe8, 0x0e, 0x0b, 0x00, 0x21, 0x1a, 0xb3,
+        0xd9, 0x00, 0x0f, 0x41, 0x00, 0x07, 0x11, 0x38, 0x7e, 0x00, 0x28, 0x8d, 0x04, 0x14, 0x00,
+        0x44, 0x5c, 0xff, 0xff, 0x61, 0x0c, 0x00, 0x30, 0x01, 0x82, 0xfe, 0x82, 0x00, 0x0f, 0xc3,
+        0x00, 0x05, 0x11, 0x16, 0xfc, 0x00, 0x19, 0x71, 0x14, 0x00, 0x56, 0x0c, 0xe4, 0xff, 0xca,
+        0x02, 0x0f, 0x00, 0x20, 0x60, 0xfd, 0x04, 0x01, 0x0f, 0x45, 0x01, 0x03, 0x21, 0x02, 0xba,
+        0x22, 0x01, 0x19, 0x77, 0x15, 0x00, 0x48, 0x85, 0xff, 0xfe, 0x38, 0x10, 0x00, 0x10, 0x64,
+        0x82, 0x00, 0x1f, 0xb8, 0xc7, 0x01, 0x02, 0x10, 0x64, 0x3e, 0x00, 0x47, 0xee, 0xff, 0xf2,
+        0x18, 0x14, 0x00, 0x4a, 0x22, 0xf7, 0xff, 0xa1, 0x26, 0x00, 0x10, 0x82, 0x26, 0x00, 0x1c,
+        0x62, 0x3c, 0x00, 0x00, 0x76, 0x02, 0x97, 0xec, 0xff, 0xff, 0xff, 0xd2, 0x2b, 0xf9, 0xff,
+        0x9c, 0x15, 0x00, 0x4a, 0xaf, 0xff, 0xf2, 0x1a, 0x27, 0x00, 0x01, 0xa6, 0x00, 0x1f, 0xeb,
+        0xcc, 0x02, 0x00, 0xa6, 0x89, 0xff, 0xff, 0xff, 0xfb, 0x34, 0x00, 0x8a, 0xff, 0xfd, 0x2c,
+        0x03, 0x4c, 0x43, 0xff, 0xff, 0x76, 0x28, 0x00, 0x6c, 0x18, 0xf1, 0xff, 0xff, 0xff, 0x86,
+        0x16, 0x00, 0x20, 0x00, 0x13, 0xf4, 0x02, 0x74, 0x82, 0x00, 0x00, 0x0e, 0xe8, 0xff, 0xc1,
+        0x14, 0x00, 0x5d, 0x04, 0xd4, 0xff, 0xdb, 0x07, 0x2a, 0x00, 0x10, 0x75, 0x0c, 0x03, 0x0d,
+        0x81, 0x00, 0xd3, 0x77, 0xff, 0xff, 0xff, 0xf1, 0x0f, 0x00, 0x00, 0x00, 0x62, 0xff, 0xff,
+        0x54, 0x14, 0x00, 0x4d, 0x6d, 0xff, 0xff, 0x4d, 0x3f, 0x00, 0x20, 0x00, 0x07, 0xa7, 0x01,
+        0x0a, 0x66, 0x01, 0x80, 0x00, 0x00, 0x00, 0xd7, 0xff, 0xff, 0xff, 0x89, 0x09, 0x00, 0x51,
+        0x02, 0xca, 0xff, 0xe2, 0x0a, 0x13, 0x00, 0x4e, 0x12, 0xec, 0xff, 0xba, 0x3f, 0x00, 0x7b,
+        0x00, 0x00, 0x7a, 0xff, 0xff, 0xff, 0xd9, 0x14, 0x00, 0x52, 0x34, 0xff, 0xff, 0xff, 0xf9,
+        0x2b, 0x01, 0x41, 0x3c, 0xfe, 0xff, 0x7a, 0x09, 0x00, 0x5f, 0x97, 0xff, 0xff, 0xc6, 0xaa,
+        0x01, 0x00, 0x00, 0x01, 0x62, 0x03, 0x1e, 0x32, 0x54, 0x00, 0x13, 0xb3, 0x0c, 0x00, 0x30,
+        0xa7, 0xff, 0xf3, 0x4a, 0x00, 0x24, 0x2b, 0xfb, 0xb8, 0x03, 0x0f, 0x01, 0x00, 0x01, 0x1a,
+        0x78, 0x40, 0x00, 0x00, 0x96, 0x01, 0x13, 0x64, 0x0c, 0x00, 0x86, 0x1d, 0xf5, 0xff, 0x9f,
+        0x00, 0x00, 0x00, 0xc0, 0x2d, 0x00, 0x1a, 0xf8, 0x81, 0x00, 0x5a, 0xc4, 0xff, 0xff, 0xff,
+        0xb9, 0x40, 0x00, 0x00, 0xfd, 0x01, 0x14, 0x26, 0x0d, 0x00, 0x68, 0x80, 0xff, 0xfd, 0x35,
+        0x00, 0x56, 0x6e, 0x00, 0x19, 0x4e, 0x2d, 0x00, 0x59, 0x2c, 0xff, 0xff, 0xff, 0xea, 0x12,
+        0x00, 0x10, 0x13, 0x94, 0x01, 0x05, 0x96, 0x02, 0x68, 0x0a, 0xe1, 0xff, 0xc3, 0x0a, 0xe0,
+        0x40, 0x00, 0x28, 0xda, 0x06, 0x2e, 0x00, 0x68, 0x04, 0xf7, 0xff, 0xff, 0xff, 0x11, 0x12,
+        0x00, 0x10, 0x35, 0x7c, 0x02, 0x06, 0x0f, 0x00, 0x48, 0x58, 0xff, 0xff, 0xc3, 0x3f, 0x00,
+        0x38, 0xff, 0xff, 0x75, 0x2e, 0x00, 0x68, 0x00, 0xd3, 0xff, 0xff, 0xff, 0x33, 0x11, 0x00,
+        0x38, 0x43, 0xff, 0xff, 0xac, 0x01, 0x1b, 0x01, 0x3e, 0x00, 0x48, 0xff, 0xff, 0xf1, 0x17,
+        0x2f, 0x00, 0x58, 0xc1, 0xff, 0xff, 0xff, 0x42, 0x11, 0x00, 0x57, 0x4f, 0xff, 0xff, 0xff,
+        0xaf, 0x10, 0x00, 0x10, 0x31, 0xa8, 0x03, 0x09, 0x01, 0x00, 0x08, 0x16, 0x03, 0x2c, 0x00,
+        0xb2, 0x13, 0x01, 0x00, 0x40, 0x00, 0x18, 0xb2, 0x11, 0x00, 0x1c, 0x9c, 0x40, 0x00, 0x27,
+        0xfd, 0x35, 0x1e, 0x00, 0x1c, 0xb0, 0x40, 0x00, 0x00, 0xc0, 0x00, 0x05, 0xf7, 0x02, 0x00,
+        0x01, 0x00, 0x10, 0x17, 0x26, 0x03, 0x09, 0x01, 0x00, 0x17, 0xc3, 0xf5, 0x03, 0x58, 0xbc,
+        0xff, 0xff, 0xff, 0x41, 0x2f, 0x00, 0x00, 0x7f, 0x02, 0x18, 0xd3, 0x11, 0x00, 0x01, 0x26,
+        0x03, 0x08, 0x3e, 0x00, 0x36, 0xff, 0xff, 0x58, 0x1d, 0x00, 0x1c, 0xd6, 0x81, 0x02, 0x10,
+        0x12, 0x76, 0x05, 0x09, 0xf8, 0x04, 0x28, 0x06, 0xda, 0x3f, 0x00, 0x52, 0xe0, 0x0a, 0xc3,
+        0xff, 0xe1, 0x16, 0x03, 0x40, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x01, 0x18, 0x10, 0x2e, 0x00,
+        0x10, 0x00, 0x74, 0x06, 0x19, 0x2c, 0x12, 0x00, 0x18, 0x4e, 0x40, 0x00, 0x10, 0x55, 0x52,
+        0x01, 0x14, 0x80, 0x1b, 0x00, 0x59, 0x32, 0xff, 0xff, 0xff, 0xe9, 0x2d, 0x00, 0x6a, 0x00,
+        0xb8, 0xff, 0xff, 0xff, 0xc4, 0xa6, 0x02, 0x16, 0xf8, 0x3f, 0x00, 0x83, 0xc0, 0x00, 0x00,
+        0x00, 0x9f, 0xff, 0xf5, 0x1d, 0x2d, 0x00, 0x5a, 0x70, 0xff, 0xff, 0xff, 0xb7, 0x40, 0x00,
+        0x18, 0x78, 0x6e, 0x00, 0x0c, 0x01, 0x00, 0x10, 0xfd, 0x2c, 0x02, 0x43, 0x17, 0xf1, 0xff,
+        0xa7, 0x2d, 0x00, 0x1d, 0xc2, 0x51, 0x02, 0x20, 0x00, 0x31, 0x28, 0x00, 0x1a, 0xb9, 0x81,
+        0x00, 0x02, 0x01, 0x00, 0x41, 0xc9, 0xff, 0xff, 0x98, 0x23, 0x00, 0x41, 0x7a, 0xff, 0xfe,
+        0x3c, 0x09, 0x00, 0x6a, 0x23, 0xfc, 0xff, 0xff, 0xff, 0x2f, 0x40, 0x00, 0x6b, 0x00, 0xd2,
+        0xff, 0xff, 0xff, 0x79, 0x14, 0x00, 0x01, 0x01, 0x00, 0x41, 0xba, 0xff, 0xee, 0x15, 0x09,
+        0x00, 0x41, 0x07, 0xdb, 0xff, 0xce, 0x0b, 0x06, 0x5c, 0x98, 0xff, 0xff, 0xff, 0xd4, 0x27,
+        0x00, 0x00, 0xb0, 0x01, 0x19, 0xe5, 0x26, 0x03, 0x02, 0x01, 0x00, 0x43, 0x52, 0xff, 0xff,
+        0x6f, 0x0b, 0x00, 0x12, 0x54, 0xb9, 0x05, 0x10, 0x17, 0x7e, 0x01, 0x1c, 0x74, 0x28, 0x00,
+        0x10, 0x11, 0x31, 0x02, 0x0b, 0xd5, 0x00, 0x84, 0x00, 0x00, 0x00, 0x08, 0xdd, 0xff, 0xd6,
+        0x05, 0x0d, 0x00, 0x11, 0xc1, 0x0b, 0x07, 0x59, 0x8d, 0xff, 0xff, 0xff, 0xf0, 0x7e, 0x03,
+        0x01, 0x01, 0x00, 0x6c, 0x86, 0xff, 0xff, 0xff, 0xf5, 0x1f, 0x16, 0x00, 0x36, 0x7a, 0xff,
+        0xff, 0x30, 0x07, 0x60, 0x30, 0xfc, 0xff, 0x8a, 0x00, 0x37, 0xfe, 0x00, 0x1c, 0x83, 0x28,
+        0x00, 0x9a, 0x00, 0x00, 0x12, 0xea, 0xff, 0xff, 0xff, 0xbb, 0x03, 0x15, 0x00, 0x29, 0x19,
+        0xf2, 0x17, 0x03, 0x50, 0x9c, 0xff, 0xf9, 0x2b, 0xd4, 0xfd, 0x01, 0x0e, 0x7f, 0x00, 0x30,
+        0x00, 0x00, 0x61, 0x83, 0x01, 0x1a, 0x84, 0x14, 0x00, 0x38, 0xa0, 0xff, 0xf8, 0xcd, 0x07,
+        0x40, 0x18, 0xf2, 0xff, 0xee, 0x26, 0x00, 0x1c, 0x5f, 0x3c, 0x00, 0x00, 0x01, 0x00, 0x78,
+        0x01, 0xb7, 0xff, 0xff, 0xff, 0xfe, 0x67, 0x13, 0x00, 0x22, 0x35, 0xfd, 0xd4, 0x05, 0x05,
+        0x01, 0x00, 0x00, 0x26, 0x06, 0x3f, 0xff, 0xff, 0xb6, 0x07, 0x09, 0x03, 0x20, 0x15, 0xe5,
+        0x41, 0x00, 0x16, 0x65, 0x11, 0x00, 0x59, 0x01, 0xc6, 0xff, 0xe7, 0x0d, 0x23, 0x00, 0x10,
+        0x72, 0x3f, 0x00, 0x2e, 0xe3, 0x14, 0x3c, 0x00, 0x01, 0x01, 0x00, 0x10, 0x36, 0x40, 0x08,
+        0x25, 0xfe, 0x88, 0x04, 0x01, 0x48, 0x5b, 0xff, 0xff, 0x60, 0x20, 0x00, 0x20, 0x06, 0x91,
+        0x3f, 0x00, 0x18, 0xf3, 0x0a, 0x04, 0x0a, 0x01, 0x00, 0x02, 0xc0, 0x08, 0x13, 0xb9, 0xe8,
+        0x02, 0x29, 0x0b, 0xe3, 0x3c, 0x08, 0x30, 0x00, 0x26, 0xca, 0x1e, 0x00, 0x2f, 0xfa, 0x47,
+        0x3e, 0x00, 0x05, 0x05, 0x40, 0x09, 0x21, 0xf3, 0x71, 0x36, 0x07, 0x46, 0x82, 0xff, 0xfe,
+        0x39, 0x1b, 0x00, 0x21, 0x0d, 0x85, 0x51, 0x03, 0x1f, 0xf3, 0x3f, 0x00, 0x09, 0x41, 0x00,
+        0x00, 0x36, 0xe4, 0x22, 0x01, 0x85, 0xe6, 0x75, 0x14, 0x00, 0x1f, 0xf6, 0xff, 0xa2, 0x18,
+        0x00, 0x20, 0x17, 0x7b, 0x22, 0x06, 0x3f, 0xff, 0xff, 0xe3, 0xbd, 0x00, 0x07, 0x02, 0x01,
+        0x00, 0x10, 0x15, 0x86, 0x01, 0x62, 0xff, 0xff, 0xff, 0xfc, 0xbb, 0xc3, 0xc7, 0x06, 0x63,
+        0x00, 0x00, 0x02, 0x27, 0x68, 0xb2, 0x40, 0x0a, 0x12, 0xb7, 0x0b, 0x03, 0x0f, 0x01, 0x00,
+        0x09, 0x20, 0x01, 0x61, 0x49, 0x02, 0x02, 0xb8, 0x03, 0x60, 0xde, 0xbf, 0xb0, 0xb0, 0xbb,
+        0xd3, 0xf0, 0x02, 0x01, 0x01, 0x00, 0x2f, 0xea, 0x61, 0xc0, 0x0a, 0x0f, 0x00, 0x0b, 0x03,
+        0x1d, 0x85, 0x3d, 0x05, 0x00, 0x01, 0x00, 0x2f, 0xf2, 0x86, 0x82, 0x0b, 0x16, 0x20, 0x11,
+        0x75, 0xa6, 0x02, 0x09, 0x01, 0x00, 0x1f, 0xd6, 0xc0, 0x0b, 0x17, 0x01, 0x01, 0x00, 0x35,
+        0x30, 0x76, 0xb7, 0xc8, 0x00, 0x3b, 0xeb, 0xb9, 0x77, 0xef, 0x07, 0x0f, 0x01, 0x00, 0x13,
+        0x7f, 0x11, 0x30, 0x43, 0x4f, 0x4f, 0x44, 0x30, 0x2d, 0x03, 0x01, 0x0f, 0x01, 0x00, 0xff,
+        0x72, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
 
 };
 
@@ -219,11 +120,11 @@ const lv_image_dsc_t icon_camera = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 64,
                  .h = 64,
-                 .stride = 128,
+                 .stride = 64,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_camera_map),
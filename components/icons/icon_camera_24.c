@@ -20,55 +20,31 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_CAMERA_24 uint8_t
     icon_camera_24_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0xd1, 0x02, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0x5e, 0x62, 0x04, 0x21, 0xe3, 0x18, 0x04, 0x21, 0x06, 0x00, 0x0f, 0x7d, 0x00, 0x0d,
-        0x4a, 0x04, 0x21, 0xe3, 0x18, 0x02, 0x00, 0x0f, 0x34, 0x00, 0x07, 0x11, 0x24, 0x54, 0x00,
-        0x86, 0xe3, 0x18, 0x04, 0x21, 0xe3, 0x18, 0xa2, 0x10, 0x3a, 0x00, 0x3f, 0x04, 0x21, 0x24,
-        0x68, 0x00, 0x00, 0x11, 0x24, 0x5a, 0x00, 0x42, 0x04, 0x21, 0x00, 0x00, 0x1c, 0x00, 0x82,
-        0xe3, 0x18, 0xe3, 0x18, 0xff, 0xff, 0x00, 0x00, 0x38, 0x00, 0x0e, 0x32, 0x00, 0x02, 0x18,
-        0x00, 0x02, 0x2c, 0x00, 0x02, 0x2e, 0x00, 0x22, 0x45, 0x29, 0x0e, 0x00, 0x02, 0x74, 0x00,
-        0x02, 0x0c, 0x00, 0x04, 0x02, 0x00, 0x02, 0x2e, 0x00, 0x06, 0xae, 0x00, 0x02, 0x5e, 0x00,
-        0x04, 0x02, 0x00, 0x08, 0x1a, 0x00, 0x02, 0x02, 0x00, 0x64, 0xe3, 0x18, 0xe3, 0x18, 0x00,
-        0x00, 0x26, 0x00, 0x04, 0x08, 0x00, 0x04, 0x02, 0x00, 0x06, 0x1a, 0x00, 0x02, 0x02, 0x00,
-        0x02, 0x12, 0x01, 0x04, 0x18, 0x00, 0x04, 0x6c, 0x00, 0x0e, 0x02, 0x00, 0x02, 0x2e, 0x00,
-        0x06, 0x30, 0x00, 0x06, 0x98, 0x00, 0x02, 0x02, 0x00, 0x06, 0xb6, 0x00, 0x02, 0x44, 0x00,
-        0x08, 0x30, 0x00, 0x22, 0xa2, 0x10, 0x0e, 0x00, 0x02, 0x2a, 0x00, 0x06, 0x02, 0x00, 0x02,
-        0x16, 0x00, 0x0e, 0x30, 0x00, 0x04, 0x4c, 0x00, 0x06, 0x2a, 0x00, 0x02, 0x02, 0x00, 0x02,
-        0x30, 0x00, 0x28, 0xa2, 0x10, 0xd4, 0x00, 0x0a, 0xfc, 0x01, 0x02, 0x4c, 0x00, 0x04, 0x02,
-        0x00, 0x02, 0x48, 0x00, 0x0a, 0x22, 0x01, 0x0a, 0x22, 0x00, 0x06, 0x02, 0x00, 0x02, 0x18,
-        0x00, 0x2c, 0x00, 0x00, 0x30, 0x00, 0x02, 0x10, 0x00, 0x04, 0xda, 0x01, 0x02, 0x02, 0x00,
-        0x04, 0x80, 0x00, 0x0a, 0x6a, 0x01, 0x04, 0x02, 0x00, 0x02, 0x54, 0x00, 0x04, 0x0e, 0x00,
-        0x02, 0x10, 0x00, 0x02, 0x0e, 0x00, 0x02, 0x64, 0x00, 0x04, 0x3e, 0x00, 0x06, 0x02, 0x00,
-        0x08, 0xc4, 0x00, 0x24, 0x86, 0x31, 0xb8, 0x00, 0x04, 0x3c, 0x00, 0x02, 0xc6, 0x00, 0x08,
-        0x02, 0x00, 0x02, 0x70, 0x02, 0x02, 0x96, 0x00, 0x24, 0x04, 0x21, 0x5e, 0x00, 0x02, 0xda,
-        0x01, 0x0f, 0x70, 0x02, 0x01, 0x06, 0xd0, 0x02, 0x02, 0x02, 0x00, 0x02, 0x42, 0x01, 0x02,
-        0x18, 0x01, 0x0e, 0x9e, 0x02, 0x04, 0x02, 0x00, 0x02, 0x22, 0x00, 0x08, 0x02, 0x00, 0x0e,
-        0x8a, 0x00, 0x0c, 0x02, 0x00, 0x02, 0xca, 0x00, 0x02, 0x06, 0x00, 0x0c, 0x1c, 0x00, 0x0f,
-        0x02, 0x00, 0x4f, 0x1f, 0x00, 0x01, 0x00, 0x25, 0x6c, 0x20, 0x5a, 0x71, 0x71, 0x5a, 0x20,
-        0x3e, 0x00, 0x22, 0x4f, 0xcb, 0xb3, 0x00, 0x28, 0xcc, 0x4f, 0x1a, 0x00, 0xe5, 0x0e, 0xb2,
-        0xff, 0xd6, 0x71, 0x2a, 0x0b, 0x17, 0xe2, 0x76, 0xd5, 0xff, 0xb1, 0x0e, 0x1a, 0x00, 0xf5,
-        0x00, 0x0e, 0xd0, 0xfa, 0x70, 0x04, 0x00, 0x00, 0x00, 0x94, 0x73, 0x00, 0x01, 0x70, 0xf8,
-        0xd0, 0x19, 0x00, 0xf3, 0x01, 0xb2, 0xff, 0x97, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xd4, 0x06,
-        0x00, 0x00, 0x00, 0x45, 0xfa, 0xb2, 0x31, 0x00, 0xa1, 0x50, 0xff, 0x7b, 0xdb, 0x1f, 0x00,
-        0x00, 0x00, 0xbd, 0x49, 0x11, 0x00, 0x23, 0x6d, 0xff, 0x64, 0x00, 0x91, 0xcc, 0xd6, 0x02,
-        0x5c, 0xa8, 0x00, 0x00, 0x52, 0xb3, 0x17, 0x00, 0x41, 0x00, 0x04, 0xd9, 0xcc, 0x09, 0x00,
-        0xb2, 0x21, 0xff, 0x6d, 0x00, 0x01, 0xc6, 0x3b, 0x08, 0xde, 0xea, 0xdd, 0x01, 0x00, 0xf0,
-        0x00, 0xf0, 0xff, 0x21, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xff, 0x29, 0x00, 0x00, 0x36, 0xc9,
-        0x7d, 0x7a, 0x05, 0xf0, 0x05, 0x78, 0x00, 0x00, 0x00, 0x00, 0x28, 0xff, 0x5a, 0x00, 0x00,
-        0x00, 0x00, 0x73, 0xff, 0x0b, 0x00, 0x00, 0x00, 0xa0, 0xfd, 0x92, 0x05, 0x82, 0xf2, 0x19,
+        0x02, 0x00, 0x00, 0x00, 0x5e, 0x01, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0x25, 0x6c, 0x20, 0x5a, 0x71, 0x71, 0x5a, 0x20, 0x16, 0x00, 0x31, 0x4f, 0xcb, 0xff,
+        0x01, 0x00, 0x28, 0xcc, 0x4f, 0x16, 0x00, 0xe6, 0x0e, 0xb2, 0xff, 0xd6, 0x71, 0x2a, 0x0b,
+        0x17, 0xe2, 0x76, 0xd5, 0xff, 0xb1, 0x0e, 0x17, 0x00, 0xe5, 0xd0, 0xfa, 0x70, 0x04, 0x00,
+        0x00, 0x00, 0x94, 0x73, 0x00, 0x01, 0x70, 0xf8, 0xd0, 0x19, 0x00, 0x30, 0xb2, 0xff, 0x97,
+        0x07, 0x00, 0x93, 0x2c, 0xd4, 0x06, 0x00, 0x00, 0x00, 0x45, 0xfa, 0xb2, 0x17, 0x00, 0xa1,
+        0x50, 0xff, 0x7b, 0xdb, 0x1f, 0x00, 0x00, 0x00, 0xbd, 0x49, 0x0f, 0x00, 0x23, 0x6d, 0xff,
+        0x64, 0x00, 0x92, 0xcc, 0xd6, 0x02, 0x5c, 0xa8, 0x00, 0x00, 0x52, 0xb3, 0x0f, 0x00, 0x31,
+        0x04, 0xd9, 0xcc, 0x08, 0x00, 0xb2, 0x21, 0xff, 0x6d, 0x00, 0x01, 0xc6, 0x3b, 0x08, 0xde,
+        0xea, 0xdd, 0x01, 0x00, 0x30, 0xf0, 0xff, 0x21, 0x18, 0x00, 0x80, 0x5a, 0xff, 0x29, 0x00,
+        0x00, 0x36, 0xc9, 0x7d, 0xa7, 0x00, 0x10, 0x78, 0x11, 0x00, 0x30, 0x28, 0xff, 0x5a, 0x07,
+        0x00, 0x80, 0x73, 0xff, 0x0b, 0x00, 0x00, 0x00, 0xa0, 0xfd, 0x18, 0x00, 0x82, 0xf2, 0x19,
         0x00, 0x00, 0x00, 0x08, 0xff, 0x73, 0x18, 0x00, 0x60, 0x08, 0x00, 0x00, 0x00, 0x19, 0xf2,
-        0xaa, 0x05, 0x62, 0xfd, 0xa0, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x00, 0xf2, 0x0c, 0x59, 0xff,
-        0x28, 0x00, 0x00, 0x00, 0x00, 0x78, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xc9, 0x36, 0x00, 0x00,
-        0x2c, 0xff, 0x59, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0xf0, 0x70, 0x00, 0xa2, 0xdd, 0xea,
-        0xdf, 0x08, 0x3b, 0xc6, 0x01, 0x00, 0x72, 0xff, 0x27, 0x01, 0x31, 0xcb, 0xd9, 0x04, 0x99,
-        0x00, 0xa2, 0x00, 0xb5, 0x53, 0x00, 0x00, 0xa8, 0x5c, 0x03, 0xda, 0xcb, 0x0f, 0x00, 0x31,
-        0x4e, 0xff, 0x6e, 0x09, 0x00, 0xa1, 0x49, 0xbe, 0x00, 0x00, 0x00, 0x1f, 0xdb, 0x7e, 0xff,
-        0x4e, 0x0f, 0x00, 0xf3, 0x03, 0x00, 0x00, 0xb1, 0xfa, 0x47, 0x00, 0x00, 0x00, 0x05, 0xd4,
-        0x2e, 0x00, 0x00, 0x00, 0x00, 0x98, 0xff, 0xb1, 0x17, 0x00, 0xf4, 0x02, 0x00, 0x0e, 0xd0,
-        0xf8, 0x73, 0x01, 0x00, 0x70, 0x95, 0x00, 0x00, 0x00, 0x04, 0x72, 0xfa, 0xd0, 0x0d, 0x18,
-        0x00, 0xe6, 0x00, 0x0d, 0xb1, 0xff, 0xd8, 0x77, 0xe4, 0x19, 0x0b, 0x2b, 0x72, 0xd7, 0xff,
-        0xb1, 0x17, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x4e, 0x98, 0x01, 0x02, 0x01, 0xaf, 0x00, 0x0f,
-        0xc8, 0x01, 0x02, 0x0f, 0x02, 0x00, 0x11, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x18, 0x00, 0x62, 0xfd, 0xa0, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x00, 0x30, 0x59, 0xff, 0x28,
+        0x07, 0x00, 0x10, 0x78, 0x18, 0x00, 0x80, 0x7e, 0xc9, 0x36, 0x00, 0x00, 0x2c, 0xff, 0x59,
+        0x11, 0x00, 0x33, 0x20, 0xff, 0xf0, 0x71, 0x00, 0x92, 0xea, 0xdf, 0x08, 0x3b, 0xc6, 0x01,
+        0x00, 0x72, 0xff, 0x27, 0x01, 0x20, 0xcb, 0xd9, 0xed, 0x00, 0xc2, 0x00, 0x00, 0x00, 0xb5,
+        0x53, 0x00, 0x00, 0xa8, 0x5c, 0x03, 0xda, 0xcb, 0x0f, 0x00, 0x31, 0x4e, 0xff, 0x6e, 0x08,
+        0x00, 0xa3, 0x49, 0xbe, 0x00, 0x00, 0x00, 0x1f, 0xdb, 0x7e, 0xff, 0x4e, 0xf1, 0x00, 0x90,
+        0xb1, 0xfa, 0x47, 0x00, 0x00, 0x00, 0x05, 0xd4, 0x2e, 0x0d, 0x00, 0x33, 0x98, 0xff, 0xb1,
+        0x17, 0x00, 0x90, 0x00, 0x0e, 0xd0, 0xf8, 0x73, 0x01, 0x00, 0x70, 0x95, 0xed, 0x00, 0x44,
+        0x72, 0xfa, 0xd0, 0x0d, 0x18, 0x00, 0xe6, 0x00, 0x0d, 0xb1, 0xff, 0xd8, 0x77, 0xe4, 0x19,
+        0x0b, 0x2b, 0x72, 0xd7, 0xff, 0xb1, 0x17, 0x00, 0x00, 0x64, 0x00, 0x0f, 0x98, 0x01, 0x02,
+        0x00, 0x01, 0x00, 0x0f, 0xc8, 0x01, 0x03, 0x0f, 0x01, 0x00, 0x11, 0x50, 0x00, 0x00, 0x00,
+        0x00, 0x00,
 
 };
 
@@ -76,11 +52,11 @@ const lv_image_dsc_t icon_camera_24 = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 24,
                  .h = 24,
-                 .stride = 48,
+                 .stride = 24,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_camera_24_map),
@@ -20,101 +20,49 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_CENTER_FOCUS_STRONG
     uint8_t icon_center_focus_strong_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0x7d, 0x05, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0xff, 0xff, 0xff, 0xff, 0x86, 0x8e, 0x45, 0x29, 0x04, 0x21, 0xe3, 0x18, 0x04, 0x21,
-        0x02, 0x00, 0x0f, 0xaf, 0x04, 0x0d, 0x0e, 0x32, 0x00, 0x02, 0x4a, 0x00, 0x2f, 0x45, 0x29,
-        0x3a, 0x00, 0x0d, 0x06, 0x02, 0x00, 0x2f, 0xe3, 0x18, 0x02, 0x00, 0x07, 0x06, 0x26, 0x00,
-        0x0f, 0x02, 0x00, 0x03, 0x0f, 0x3a, 0x00, 0x07, 0x0f, 0x3c, 0x00, 0x0f, 0x02, 0x02, 0x00,
-        0x2f, 0x24, 0x21, 0x44, 0x00, 0x29, 0x0f, 0x3c, 0x00, 0x09, 0x0f, 0x04, 0x01, 0x13, 0x1f,
-        0x04, 0x80, 0x00, 0x46, 0x0f, 0x02, 0x01, 0x13, 0x0f, 0xc2, 0x00, 0x09, 0x0f, 0x42, 0x00,
-        0x0f, 0x0f, 0x3e, 0x00, 0x2b, 0x00, 0x0e, 0x07, 0x06, 0x00, 0x01, 0x02, 0x10, 0x00, 0x0f,
-        0x02, 0x00, 0x2f, 0x04, 0x94, 0x00, 0x0f, 0xbe, 0x02, 0x0f, 0x0f, 0x80, 0x00, 0xff, 0xff,
-        0x97, 0x06, 0x24, 0x03, 0x04, 0x02, 0x00, 0x0f, 0xdc, 0x02, 0x09, 0x0f, 0x24, 0x00, 0x11,
-        0x06, 0x02, 0x00, 0x06, 0x5c, 0x00, 0x06, 0x14, 0x00, 0x08, 0x02, 0x00, 0x04, 0x4e, 0x00,
-        0x0f, 0x02, 0x00, 0x01, 0x08, 0x28, 0x00, 0x06, 0x02, 0x00, 0x04, 0x2a, 0x00, 0x0f, 0xa4,
-        0x00, 0x09, 0x06, 0x02, 0x00, 0x0f, 0x80, 0x00, 0x0b, 0x04, 0x4c, 0x00, 0x0f, 0x02, 0x00,
-        0x05, 0x06, 0x48, 0x00, 0x06, 0x02, 0x00, 0x04, 0x2c, 0x00, 0x0f, 0x80, 0x00, 0x2f, 0x04,
-        0x4a, 0x00, 0x0f, 0x02, 0x00, 0x09, 0x06, 0x78, 0x00, 0x04, 0x02, 0x00, 0x04, 0x2e, 0x00,
-        0x0f, 0x80, 0x00, 0x13, 0x0f, 0x02, 0x00, 0x07, 0x04, 0x48, 0x00, 0x02, 0x02, 0x00, 0x82,
-        0x04, 0x21, 0x04, 0x21, 0xc3, 0x18, 0xa2, 0x10, 0x62, 0x07, 0x08, 0x02, 0x00, 0x0f, 0x42,
-        0x00, 0x07, 0x0f, 0x02, 0x00, 0x29, 0x08, 0x62, 0x00, 0x48, 0xe3, 0x18, 0x00, 0x00, 0x4c,
-        0x00, 0x2a, 0x00, 0x00, 0x1e, 0x00, 0x08, 0x1c, 0x00, 0x0f, 0x02, 0x00, 0x35, 0x06, 0x62,
-        0x00, 0x0f, 0x48, 0x01, 0x03, 0x06, 0x38, 0x02, 0x0f, 0x80, 0x00, 0x41, 0x0f, 0x5e, 0x00,
-        0x11, 0x0f, 0xa2, 0x00, 0x0d, 0x0f, 0x02, 0x00, 0x29, 0x06, 0x5c, 0x00, 0x0a, 0x7a, 0x01,
-        0x08, 0x02, 0x00, 0x08, 0x86, 0x01, 0x08, 0x18, 0x00, 0x0f, 0x02, 0x00, 0x31, 0x04, 0x80,
-        0x00, 0x0f, 0x7c, 0x01, 0x03, 0x04, 0x02, 0x00, 0x06, 0x26, 0x01, 0x04, 0x12, 0x00, 0x0f,
-        0x02, 0x00, 0x35, 0x0f, 0x80, 0x00, 0x75, 0x2f, 0xc3, 0x18, 0xd2, 0x00, 0x09, 0x24, 0xa2,
-        0x10, 0xa8, 0x00, 0x0f, 0x26, 0x00, 0x09, 0x0f, 0x02, 0x00, 0x21, 0x04, 0x58, 0x00, 0x2f,
-        0xa2, 0x10, 0x3e, 0x00, 0x09, 0x15, 0x24, 0x3c, 0x0a, 0x0f, 0x26, 0x00, 0x09, 0x0f, 0x02,
-        0x00, 0x21, 0x04, 0x80, 0x00, 0x0f, 0x00, 0x02, 0x8b, 0x04, 0xa6, 0x00, 0x0f, 0x00, 0x01,
-        0x47, 0x0f, 0x80, 0x03, 0x65, 0x06, 0x5a, 0x03, 0x0f, 0xdc, 0x00, 0x07, 0x06, 0xfe, 0x00,
-        0x0f, 0x24, 0x00, 0x07, 0x0f, 0x02, 0x00, 0x27, 0x06, 0x5e, 0x00, 0x0f, 0x04, 0x02, 0x03,
-        0x0f, 0xa2, 0x00, 0x11, 0x0f, 0x02, 0x00, 0x29, 0x06, 0x80, 0x00, 0x0e, 0x86, 0x01, 0x08,
-        0xfa, 0x04, 0x0f, 0xfe, 0x00, 0x43, 0x00, 0xa8, 0x13, 0x02, 0x5c, 0x00, 0x04, 0x02, 0x00,
-        0x6f, 0x04, 0x21, 0x04, 0x21, 0xa2, 0x10, 0x80, 0x07, 0x3f, 0x06, 0x48, 0x01, 0x02, 0x76,
-        0x00, 0x08, 0x02, 0x00, 0x04, 0x7c, 0x00, 0x0f, 0x02, 0x00, 0x09, 0x08, 0x30, 0x00, 0x02,
-        0x02, 0x00, 0x04, 0x2e, 0x00, 0x0f, 0xb8, 0x01, 0x03, 0x0c, 0x02, 0x00, 0x0f, 0x80, 0x00,
-        0x09, 0x06, 0x4c, 0x00, 0x0f, 0x02, 0x00, 0x05, 0x0c, 0x4e, 0x00, 0x08, 0x34, 0x00, 0x0f,
-        0x80, 0x00, 0x31, 0x02, 0x62, 0x10, 0x0f, 0x7e, 0x00, 0x01, 0x2f, 0x04, 0x21, 0x7e, 0x00,
-        0x03, 0x06, 0xb4, 0x00, 0x0f, 0x80, 0x00, 0x33, 0x08, 0x52, 0x00, 0x08, 0x02, 0x00, 0x02,
-        0x1a, 0x00, 0x0f, 0x02, 0x00, 0x01, 0x04, 0x26, 0x00, 0x0f, 0x80, 0x00, 0x37, 0x0f, 0x02,
-        0x00, 0x1b, 0x0f, 0x80, 0x00, 0xff, 0xff, 0x9d, 0x04, 0xae, 0x02, 0x0f, 0x02, 0x00, 0x03,
-        0x0f, 0xfa, 0x02, 0x0d, 0x0f, 0x36, 0x00, 0x03, 0x04, 0x02, 0x00, 0x0f, 0x3e, 0x00, 0x0d,
-        0x0f, 0xdc, 0x03, 0x05, 0x06, 0x02, 0x00, 0x02, 0x24, 0x00, 0x0f, 0x02, 0x00, 0x07, 0x06,
-        0x2a, 0x00, 0x0f, 0x02, 0x00, 0x01, 0x0f, 0x38, 0x00, 0x07, 0x06, 0x02, 0x00, 0x2f, 0x45,
-        0x29, 0x3a, 0x00, 0x01, 0x04, 0x02, 0x00, 0x06, 0x28, 0x00, 0x0f, 0x02, 0x00, 0x03, 0x04,
-        0x28, 0x00, 0x0f, 0x02, 0x00, 0x01, 0x0f, 0x80, 0x14, 0x13, 0x0f, 0x44, 0x00, 0x0b, 0x0f,
-        0x76, 0x00, 0x03, 0x06, 0x02, 0x00, 0x0f, 0x78, 0x00, 0x01, 0x04, 0x02, 0x00, 0x06, 0x26,
-        0x00, 0x0f, 0x02, 0x00, 0x0d, 0x02, 0x04, 0x01, 0x0f, 0x4c, 0x16, 0x01, 0x0f, 0x3a, 0x00,
-        0x0d, 0x0f, 0x34, 0x00, 0x01, 0x0f, 0xfc, 0x00, 0x19, 0x0f, 0x02, 0x00, 0xff, 0xff, 0xff,
-        0xff, 0x61, 0x1f, 0x00, 0x01, 0x00, 0xff, 0xff, 0x39, 0x45, 0x06, 0x5f, 0x9b, 0xaa, 0x01,
-        0x00, 0x0c, 0x57, 0x02, 0x05, 0x19, 0x00, 0x4c, 0xaa, 0x9b, 0x5f, 0x06, 0x1d, 0x00, 0x01,
-        0x02, 0x00, 0x28, 0x21, 0xd6, 0xfc, 0x06, 0x01, 0x13, 0x00, 0x07, 0x02, 0x00, 0x08, 0x1c,
-        0x00, 0x27, 0xd5, 0x21, 0x19, 0x00, 0x04, 0x02, 0x00, 0x19, 0x07, 0x3f, 0x00, 0x14, 0xff,
-        0x17, 0x00, 0x04, 0x02, 0x00, 0x08, 0x40, 0x00, 0x2f, 0xff, 0xd5, 0x82, 0x00, 0x00, 0x19,
-        0x5f, 0x22, 0x00, 0x0f, 0x40, 0x00, 0x0b, 0x24, 0xff, 0x5e, 0x57, 0x00, 0x06, 0x02, 0x00,
-        0x74, 0x9b, 0xff, 0xff, 0xff, 0xc0, 0x56, 0x55, 0x01, 0x00, 0x06, 0x19, 0x00, 0x02, 0x02,
-        0x00, 0x04, 0x18, 0x00, 0x72, 0x55, 0x56, 0xc0, 0xff, 0xff, 0xff, 0x9a, 0x15, 0x00, 0x08,
-        0x02, 0x00, 0x58, 0xaa, 0xff, 0xff, 0xff, 0x56, 0x11, 0x00, 0x0f, 0x02, 0x00, 0x05, 0x5e,
-        0x56, 0xff, 0xff, 0xff, 0xaa, 0x1d, 0x00, 0x5e, 0xaa, 0xff, 0xff, 0xff, 0x55, 0x17, 0x00,
-        0x0e, 0x02, 0x00, 0x1f, 0x55, 0x40, 0x00, 0xff, 0x16, 0xa9, 0x27, 0x76, 0xbd, 0xdd, 0xf4,
-        0xf4, 0xdd, 0xbc, 0x75, 0x26, 0x45, 0x01, 0x0f, 0x40, 0x01, 0x14, 0x34, 0x24, 0xa8, 0xfe,
-        0x52, 0x02, 0x37, 0xfe, 0xa6, 0x23, 0x42, 0x00, 0x0f, 0x40, 0x00, 0x13, 0x24, 0x54, 0xf5,
-        0x3e, 0x00, 0x00, 0xa2, 0x25, 0x26, 0xf7, 0x5a, 0x41, 0x00, 0x0f, 0x40, 0x00, 0x12, 0x15,
-        0x73, 0x7d, 0x00, 0x02, 0x02, 0x00, 0x25, 0xfe, 0x73, 0x41, 0x00, 0x0f, 0x40, 0x00, 0x04,
-        0x09, 0x02, 0x00, 0x11, 0x55, 0x3f, 0x00, 0x80, 0xcb, 0x67, 0x26, 0x0a, 0x0b, 0x27, 0x68,
-        0xcd, 0x24, 0x26, 0x29, 0xfe, 0x54, 0x21, 0x00, 0x0f, 0x02, 0x00, 0x0b, 0x82, 0x24, 0xf5,
-        0xff, 0xff, 0xff, 0xf7, 0x62, 0x01, 0x26, 0x00, 0x82, 0x01, 0x64, 0xf8, 0xff, 0xff, 0xff,
-        0xf5, 0x22, 0x0e, 0x00, 0x0f, 0x02, 0x00, 0x11, 0x66, 0xa8, 0xff, 0xff, 0xff, 0xf7, 0x3e,
-        0x2a, 0x00, 0x66, 0x3e, 0xf7, 0xff, 0xff, 0xff, 0xa6, 0x10, 0x00, 0x0f, 0x02, 0x00, 0x0c,
-        0x68, 0x27, 0xfe, 0xff, 0xff, 0xff, 0x62, 0x25, 0x00, 0x68, 0x64, 0xff, 0xff, 0xff, 0xfd,
-        0x26, 0x12, 0x00, 0x0f, 0x02, 0x00, 0x09, 0x53, 0x76, 0xff, 0xff, 0xff, 0xcb, 0xbd, 0x00,
-        0x02, 0x02, 0x00, 0x62, 0x01, 0xcd, 0xff, 0xff, 0xff, 0x74, 0x0c, 0x00, 0x0f, 0x02, 0x00,
-        0x0f, 0x5a, 0xbd, 0xff, 0xff, 0xff, 0x67, 0x27, 0x00, 0x5a, 0x69, 0xff, 0xff, 0xff, 0xbb,
-        0x13, 0x00, 0x0f, 0x02, 0x00, 0x07, 0x4b, 0xdd, 0xff, 0xff, 0xff, 0xad, 0x00, 0x5f, 0x27,
-        0xff, 0xff, 0xff, 0xdc, 0x32, 0x00, 0x07, 0x0a, 0x02, 0x00, 0x5a, 0xf4, 0xff, 0xff, 0xff,
-        0x0a, 0x13, 0x00, 0x5a, 0x0b, 0xff, 0xff, 0xff, 0xf4, 0x13, 0x00, 0x0f, 0x02, 0x00, 0x07,
-        0x5a, 0xf4, 0xff, 0xff, 0xff, 0x0b, 0x1f, 0x00, 0x5a, 0x0d, 0xff, 0xff, 0xff, 0xf2, 0x13,
-        0x00, 0x0f, 0x02, 0x00, 0x07, 0x0f, 0xc0, 0x00, 0x00, 0x1f, 0x28, 0xc0, 0x00, 0x19, 0x5a,
-        0xbc, 0xff, 0xff, 0xff, 0x68, 0x5f, 0x00, 0x1f, 0x6a, 0x40, 0x01, 0x19, 0x59, 0x75, 0xff,
-        0xff, 0xff, 0xcc, 0xc0, 0x01, 0x56, 0x02, 0xce, 0xff, 0xff, 0xff, 0x03, 0x03, 0x0f, 0x02,
-        0x00, 0x0c, 0x01, 0x40, 0x02, 0x18, 0x64, 0x25, 0x00, 0x68, 0x66, 0xff, 0xff, 0xff, 0xfd,
-        0x25, 0x12, 0x00, 0x0f, 0x02, 0x00, 0x0a, 0x58, 0xa6, 0xff, 0xff, 0xff, 0xf8, 0xc0, 0x02,
-        0x5f, 0xf8, 0xff, 0xff, 0xff, 0xa4, 0x33, 0x00, 0x0a, 0x09, 0x02, 0x00, 0x73, 0x23, 0xf5,
-        0xff, 0xff, 0xff, 0xf8, 0x64, 0xc3, 0x00, 0x7f, 0x02, 0x66, 0xf8, 0xff, 0xff, 0xff, 0xf4,
-        0xf5, 0x06, 0x01, 0x0f, 0x02, 0x00, 0x05, 0x11, 0x54, 0xc0, 0x03, 0x81, 0xcd, 0x69, 0x28,
-        0x0b, 0x0b, 0x28, 0x69, 0xce, 0xc0, 0x03, 0x1f, 0x53, 0x2c, 0x00, 0x05, 0x03, 0x02, 0x00,
-        0x0a, 0x40, 0x06, 0x0f, 0x40, 0x04, 0x1f, 0x0a, 0x40, 0x00, 0x0f, 0xc0, 0x04, 0x2d, 0x52,
-        0x00, 0x00, 0x1e, 0x99, 0xfc, 0xbb, 0x04, 0x4f, 0xff, 0xff, 0xfe, 0xaa, 0x40, 0x05, 0x1f,
-        0xca, 0x00, 0x00, 0x00, 0x25, 0x74, 0xbb, 0xdb, 0xf4, 0xf4, 0xdb, 0xbb, 0x74, 0xb9, 0x01,
-        0x0f, 0x00, 0x05, 0x04, 0x0b, 0xc0, 0x00, 0x0f, 0x02, 0x00, 0x07, 0x0f, 0x40, 0x00, 0xff,
-        0x09, 0x0f, 0xc0, 0x08, 0x29, 0x0f, 0x40, 0x09, 0x2d, 0x14, 0x5e, 0x2e, 0x02, 0x02, 0x02,
-        0x00, 0x0c, 0xc0, 0x01, 0x02, 0x16, 0x00, 0x04, 0x02, 0x00, 0x1c, 0x5d, 0x1f, 0x00, 0x44,
-        0x00, 0x00, 0x06, 0xd5, 0x1d, 0x00, 0x01, 0x02, 0x00, 0x0c, 0x21, 0x00, 0x01, 0x15, 0x00,
-        0x04, 0x02, 0x00, 0x1f, 0xd4, 0x40, 0x0a, 0x00, 0x29, 0x00, 0x21, 0x41, 0x00, 0x0f, 0x40,
-        0x00, 0x09, 0x1f, 0xd4, 0xcb, 0x03, 0x03, 0x36, 0x06, 0x5e, 0x9a, 0x26, 0x0b, 0x0c, 0x40,
-        0x00, 0x06, 0x1a, 0x00, 0x2f, 0x9a, 0x5e, 0x7e, 0x00, 0x01, 0x0f, 0x02, 0x00, 0xff, 0xff,
-        0x22, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0x6c, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0xff, 0xff, 0x39, 0x45, 0x06, 0x5f, 0x9b, 0xaa, 0x01, 0x00, 0x0c, 0x1d, 0x00, 0x06,
+        0x1a, 0x00, 0x3f, 0x9b, 0x5f, 0x06, 0x3f, 0x00, 0x02, 0x37, 0x21, 0xd6, 0xff, 0x01, 0x00,
+        0x0c, 0x1e, 0x00, 0x08, 0x1c, 0x00, 0x2f, 0xd5, 0x21, 0x3f, 0x00, 0x00, 0x19, 0x07, 0x3f,
+        0x00, 0x0f, 0x40, 0x00, 0x0a, 0x2f, 0xff, 0xd5, 0x82, 0x00, 0x00, 0x19, 0x5f, 0x22, 0x00,
+        0x0f, 0x40, 0x00, 0x0b, 0x2e, 0xff, 0x5e, 0x40, 0x00, 0x74, 0x9b, 0xff, 0xff, 0xff, 0xc0,
+        0x56, 0x55, 0x01, 0x00, 0x0c, 0x1f, 0x00, 0x05, 0x19, 0x00, 0x6e, 0x56, 0xc0, 0xff, 0xff,
+        0xff, 0x9a, 0x40, 0x00, 0x5e, 0xaa, 0xff, 0xff, 0xff, 0x56, 0x17, 0x00, 0x0e, 0x01, 0x00,
+        0x4d, 0x56, 0xff, 0xff, 0xff, 0x5f, 0x01, 0x02, 0x40, 0x00, 0x0d, 0x76, 0x00, 0x0f, 0x01,
+        0x00, 0x01, 0x1f, 0x55, 0x40, 0x00, 0xff, 0x16, 0xa9, 0x27, 0x76, 0xbd, 0xdd, 0xf4, 0xf4,
+        0xdd, 0xbc, 0x75, 0x26, 0x17, 0x00, 0x0f, 0x40, 0x00, 0x14, 0x34, 0x24, 0xa8, 0xfe, 0x2e,
+        0x02, 0x3f, 0xfe, 0xa6, 0x23, 0x40, 0x00, 0x1e, 0x28, 0x54, 0xf5, 0x70, 0x02, 0x2f, 0xf7,
+        0x5a, 0x40, 0x00, 0x1c, 0x15, 0x73, 0x7d, 0x00, 0x03, 0x83, 0x00, 0x1f, 0x73, 0x40, 0x00,
+        0x0d, 0x09, 0x01, 0x00, 0x11, 0x55, 0x3f, 0x00, 0x81, 0xcb, 0x67, 0x26, 0x0a, 0x0b, 0x27,
+        0x68, 0xcd, 0x41, 0x00, 0x1f, 0x54, 0x33, 0x00, 0x0c, 0x08, 0x01, 0x00, 0x10, 0x24, 0xbd,
+        0x00, 0x32, 0xf7, 0x62, 0x01, 0x0e, 0x00, 0x8f, 0x01, 0x64, 0xf8, 0xff, 0xff, 0xff, 0xf5,
+        0x22, 0x36, 0x00, 0x0d, 0x06, 0x01, 0x00, 0x10, 0xa8, 0x3f, 0x00, 0x16, 0x3e, 0x10, 0x00,
+        0x6f, 0x3e, 0xf7, 0xff, 0xff, 0xff, 0xa6, 0x32, 0x00, 0x09, 0x09, 0x01, 0x00, 0x10, 0x27,
+        0xbe, 0x00, 0x18, 0x62, 0x12, 0x00, 0x5a, 0x64, 0xff, 0xff, 0xff, 0xfd, 0xc7, 0x01, 0x0f,
+        0x01, 0x00, 0x08, 0x10, 0x76, 0xfc, 0x00, 0x03, 0xbd, 0x00, 0x02, 0x01, 0x00, 0x10, 0x01,
+        0x04, 0x01, 0x1f, 0x74, 0x32, 0x00, 0x07, 0x0a, 0x01, 0x00, 0x5a, 0xbd, 0xff, 0xff, 0xff,
+        0x67, 0x13, 0x00, 0x5f, 0x69, 0xff, 0xff, 0xff, 0xbb, 0x30, 0x00, 0x05, 0x0c, 0x01, 0x00,
+        0x4b, 0xdd, 0xff, 0xff, 0xff, 0xad, 0x00, 0x5f, 0x27, 0xff, 0xff, 0xff, 0xdc, 0x30, 0x00,
+        0x05, 0x0c, 0x01, 0x00, 0x5a, 0xf4, 0xff, 0xff, 0xff, 0x0a, 0x13, 0x00, 0x5f, 0x0b, 0xff,
+        0xff, 0xff, 0xf4, 0x30, 0x00, 0x05, 0x0c, 0x01, 0x00, 0x00, 0x40, 0x00, 0x1a, 0x0b, 0x13,
+        0x00, 0x5f, 0x0d, 0xff, 0xff, 0xff, 0xf2, 0x30, 0x00, 0x05, 0x0c, 0x01, 0x00, 0x0f, 0xc0,
+        0x00, 0x00, 0x1f, 0x28, 0xc0, 0x00, 0x19, 0x5a, 0xbc, 0xff, 0xff, 0xff, 0x68, 0x13, 0x00,
+        0x1f, 0x6a, 0x40, 0x01, 0x19, 0x59, 0x75, 0xff, 0xff, 0xff, 0xcc, 0xc0, 0x01, 0x56, 0x02,
+        0xce, 0xff, 0xff, 0xff, 0x03, 0x03, 0x0f, 0x01, 0x00, 0x0c, 0x01, 0x40, 0x02, 0x18, 0x64,
+        0x12, 0x00, 0x10, 0x66, 0x40, 0x02, 0x1f, 0x25, 0x32, 0x00, 0x07, 0x0b, 0x01, 0x00, 0x58,
+        0xa6, 0xff, 0xff, 0xff, 0xf8, 0xc0, 0x02, 0x00, 0x01, 0x03, 0x1f, 0xa4, 0x32, 0x00, 0x09,
+        0x0a, 0x01, 0x00, 0x10, 0x23, 0x40, 0x03, 0x23, 0xf8, 0x64, 0xc3, 0x00, 0x20, 0x02, 0x66,
+        0x3f, 0x00, 0x1f, 0xf4, 0xf5, 0x06, 0x01, 0x0f, 0x01, 0x00, 0x05, 0x11, 0x54, 0xc0, 0x03,
+        0x70, 0xcd, 0x69, 0x28, 0x0b, 0x0b, 0x28, 0x69, 0xfc, 0x00, 0x3f, 0xff, 0xfe, 0x53, 0x33,
+        0x00, 0x0c, 0x0f, 0x40, 0x04, 0x2d, 0x0f, 0xc0, 0x04, 0x3b, 0x55, 0x00, 0x00, 0x1e, 0x99,
+        0xfc, 0x7d, 0x00, 0x1f, 0xaa, 0x40, 0x05, 0x1f, 0xca, 0x00, 0x00, 0x00, 0x25, 0x74, 0xbb,
+        0xdb, 0xf4, 0xf4, 0xdb, 0xbb, 0x74, 0xb9, 0x01, 0x0f, 0x00, 0x07, 0xff, 0x17, 0x0f, 0x01,
+        0x00, 0x04, 0x0f, 0x40, 0x00, 0x08, 0x0f, 0xc0, 0x08, 0x29, 0x0f, 0x40, 0x09, 0x2d, 0x1a,
+        0x5e, 0xb1, 0x02, 0x0c, 0x1f, 0x00, 0x0a, 0x1e, 0x00, 0x1e, 0x5d, 0x40, 0x00, 0x2f, 0x06,
+        0xd5, 0x40, 0x00, 0x17, 0x1f, 0xd4, 0xc2, 0x0a, 0x01, 0x19, 0x21, 0x41, 0x00, 0x0f, 0x40,
+        0x00, 0x09, 0x1f, 0xd4, 0xcb, 0x03, 0x03, 0x3f, 0x06, 0x5e, 0x9a, 0x40, 0x0b, 0x11, 0x2f,
+        0x9a, 0x5e, 0x40, 0x0b, 0x03, 0x0f, 0x01, 0x00, 0xff, 0xff, 0x20, 0x50, 0x00, 0x00, 0x00,
+        0x00, 0x00,
 
 };
 
@@ -122,11 +70,11 @@ const lv_image_dsc_t icon_center_focus_strong = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 64,
                  .h = 64,
-                 .stride = 128,
+                 .stride = 64,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_center_focus_strong_map),
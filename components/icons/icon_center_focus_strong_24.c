@@ -20,37 +20,20 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST
     LV_ATTRIBUTE_ICON_CENTER_FOCUS_STRONG_24 uint8_t icon_center_focus_strong_24_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0xc5, 0x01, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0x84, 0x24, 0xe3, 0x18, 0x02, 0x00, 0x08, 0xa1, 0x00, 0x04, 0x14, 0x00, 0x0a, 0x16,
-        0x00, 0x08, 0x18, 0x00, 0x0a, 0x1a, 0x00, 0x06, 0x30, 0x00, 0x0e, 0x18, 0x00, 0x28, 0x04,
-        0x21, 0x5a, 0x00, 0x08, 0x02, 0x00, 0x2c, 0x04, 0x21, 0x30, 0x00, 0x2a, 0x04, 0x21, 0x40,
-        0x00, 0x0c, 0x02, 0x00, 0x0c, 0x4e, 0x00, 0x0a, 0x30, 0x00, 0x04, 0x86, 0x00, 0x06, 0x36,
-        0x00, 0x0f, 0x30, 0x00, 0x07, 0x02, 0x7c, 0x00, 0x04, 0x02, 0x00, 0x04, 0xa4, 0x00, 0x06,
-        0x0a, 0x00, 0x0c, 0x02, 0x00, 0x02, 0x2a, 0x00, 0x24, 0x04, 0x21, 0x38, 0x00, 0x0c, 0x20,
-        0x00, 0x0a, 0x02, 0x00, 0x02, 0x2e, 0x00, 0x04, 0x14, 0x00, 0x0a, 0x0e, 0x00, 0x0f, 0x02,
-        0x00, 0x01, 0x28, 0xe3, 0x18, 0x7a, 0x00, 0x02, 0x64, 0x00, 0x0f, 0x28, 0x00, 0x01, 0x04,
-        0x02, 0x00, 0x0a, 0x30, 0x00, 0x0f, 0x60, 0x00, 0x13, 0x06, 0x52, 0x00, 0x0f, 0x30, 0x00,
-        0x0f, 0x04, 0x24, 0x00, 0x06, 0x02, 0x00, 0x04, 0x7a, 0x00, 0x0a, 0x02, 0x00, 0x06, 0x80,
-        0x01, 0x02, 0xb4, 0x00, 0x04, 0x02, 0x00, 0x0f, 0x50, 0x01, 0x05, 0x06, 0x30, 0x00, 0x08,
-        0x64, 0x00, 0x02, 0x0e, 0x00, 0x02, 0x12, 0x00, 0x04, 0x3a, 0x00, 0x02, 0x02, 0x00, 0x0a,
-        0x30, 0x00, 0x0e, 0x02, 0x00, 0x0c, 0x30, 0x00, 0x0a, 0x18, 0x01, 0x0c, 0x02, 0x00, 0x02,
-        0xa4, 0x00, 0x08, 0x16, 0x00, 0x04, 0xb0, 0x00, 0x08, 0x1e, 0x01, 0x02, 0x88, 0x00, 0x06,
-        0x02, 0x00, 0x02, 0x12, 0x00, 0x04, 0x02, 0x00, 0x02, 0x62, 0x00, 0x2c, 0x04, 0x21, 0xa8,
-        0x00, 0x04, 0x1a, 0x02, 0x04, 0x28, 0x00, 0x0f, 0x02, 0x00, 0x7d, 0x1f, 0x00, 0x01, 0x00,
-        0x38, 0x52, 0x43, 0x77, 0x77, 0x77, 0x77, 0x50, 0x00, 0x52, 0x77, 0x77, 0x77, 0x77, 0x43,
-        0x0b, 0x00, 0x21, 0x00, 0x43, 0xf4, 0x00, 0x02, 0x0d, 0x00, 0x01, 0x0b, 0x00, 0x12, 0x42,
-        0x0c, 0x00, 0x32, 0x7d, 0xff, 0x08, 0x09, 0x00, 0x02, 0x02, 0x00, 0x32, 0x08, 0xff, 0x7d,
-        0x09, 0x00, 0x22, 0x80, 0xff, 0x08, 0x00, 0x04, 0x02, 0x00, 0x22, 0xff, 0x80, 0x0a, 0x00,
-        0x03, 0x18, 0x00, 0x41, 0x3c, 0x72, 0x72, 0x3c, 0x11, 0x00, 0x09, 0x18, 0x00, 0x20, 0x10,
-        0xb8, 0x4a, 0x05, 0x27, 0xb8, 0x10, 0x18, 0x00, 0x01, 0x02, 0x00, 0x81, 0xb8, 0xf8, 0x74,
-        0x18, 0x18, 0x74, 0xf8, 0xb8, 0x0d, 0x00, 0x06, 0x02, 0x00, 0xa6, 0x3b, 0xff, 0x74, 0x00,
-        0x00, 0x00, 0x00, 0x75, 0xff, 0x3b, 0x14, 0x00, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x74, 0xff,
-        0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x1f, 0x00, 0x06, 0x02, 0x00, 0x03, 0x18, 0x00, 0x1c,
-        0x19, 0x18, 0x00, 0x03, 0x48, 0x00, 0x1c, 0x76, 0x48, 0x00, 0x79, 0x00, 0xb8, 0xf8, 0x75,
-        0x19, 0x19, 0x75, 0x78, 0x00, 0x01, 0xc0, 0x00, 0x0f, 0xa8, 0x00, 0x00, 0x01, 0x18, 0x00,
-        0x0f, 0xd8, 0x00, 0x05, 0x07, 0x02, 0x00, 0x04, 0xf0, 0x00, 0x0f, 0x38, 0x01, 0x05, 0x0f,
-        0x68, 0x01, 0x05, 0x62, 0x00, 0x42, 0x83, 0x88, 0x88, 0x88, 0x49, 0x00, 0x52, 0x88, 0x88,
-        0x88, 0x83, 0x41, 0x0b, 0x00, 0x0f, 0x02, 0x00, 0x2e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0x38, 0x52, 0x43, 0x77, 0x77, 0x77, 0x77, 0x0b, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x43,
+        0x17, 0x00, 0x10, 0xff, 0x01, 0x00, 0x02, 0x0c, 0x00, 0x01, 0x0b, 0x00, 0x12, 0x42, 0x0c,
+        0x00, 0x38, 0x7d, 0xff, 0x08, 0x3e, 0x00, 0x32, 0x08, 0xff, 0x7d, 0x09, 0x00, 0x13, 0x80,
+        0x2c, 0x00, 0x04, 0x01, 0x00, 0x29, 0xff, 0x80, 0x18, 0x00, 0x4e, 0x3c, 0x72, 0x72, 0x3c,
+        0x18, 0x00, 0x20, 0x10, 0xb8, 0x5a, 0x00, 0x27, 0xb8, 0x10, 0x18, 0x00, 0x01, 0x01, 0x00,
+        0x8a, 0xb8, 0xf8, 0x74, 0x18, 0x18, 0x74, 0xf8, 0xb8, 0x53, 0x00, 0x40, 0x00, 0x3b, 0xff,
+        0x74, 0x07, 0x00, 0x3a, 0x75, 0xff, 0x3b, 0x18, 0x00, 0x30, 0x74, 0xff, 0x18, 0x07, 0x00,
+        0x12, 0x18, 0x1f, 0x00, 0x0d, 0x18, 0x00, 0x1c, 0x19, 0x18, 0x00, 0x03, 0x48, 0x00, 0x1c,
+        0x76, 0x48, 0x00, 0x79, 0x00, 0xb8, 0xf8, 0x75, 0x19, 0x19, 0x75, 0x78, 0x00, 0x0f, 0xa8,
+        0x00, 0x05, 0x0f, 0xd8, 0x00, 0x0a, 0x07, 0x01, 0x00, 0x04, 0x18, 0x00, 0x0f, 0x38, 0x01,
+        0x05, 0x0f, 0x68, 0x01, 0x05, 0x62, 0x00, 0x42, 0x83, 0x88, 0x88, 0x88, 0x0b, 0x00, 0x58,
+        0x88, 0x88, 0x88, 0x83, 0x41, 0x3e, 0x00, 0x0f, 0x01, 0x00, 0x28, 0x50, 0x00, 0x00, 0x00,
+        0x00, 0x00,
 
 };
 
@@ -58,11 +41,11 @@ const lv_image_dsc_t icon_center_focus_strong_24 = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 24,
                  .h = 24,
-                 .stride = 48,
+                 .stride = 24,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_center_focus_strong_24_map),
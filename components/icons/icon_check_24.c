@@ -20,22 +20,13 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_CHECK_24 uint8_t
     icon_check_24_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0xda, 0x00, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0xff, 0x31, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x47, 0x01, 0x17, 0x11, 0x00, 0x01, 0x00,
-        0x0f, 0x30, 0x00, 0x15, 0x01, 0x2d, 0x00, 0x0f, 0x60, 0x00, 0x16, 0x01, 0x2b, 0x00, 0x0f,
-        0x2e, 0x00, 0x32, 0x0e, 0xd4, 0x00, 0x01, 0x59, 0x00, 0x0f, 0x5c, 0x00, 0x06, 0x01, 0x1b,
-        0x00, 0x07, 0x06, 0x01, 0x02, 0x10, 0x00, 0x0f, 0xe8, 0x00, 0x07, 0x0a, 0x20, 0x00, 0x0a,
-        0x0e, 0x00, 0x0f, 0x02, 0x00, 0x03, 0x06, 0x24, 0x00, 0x06, 0x0a, 0x00, 0x0f, 0x02, 0x00,
-        0x0b, 0x04, 0x28, 0x00, 0x02, 0x02, 0x00, 0x0f, 0x2c, 0x00, 0x0b, 0x02, 0x02, 0x00, 0x02,
-        0x2a, 0x00, 0x0f, 0xb8, 0x00, 0x09, 0x0c, 0x02, 0x00, 0x0f, 0x2e, 0x00, 0x1b, 0x0f, 0x02,
-        0x00, 0xff, 0x00, 0x02, 0x40, 0x01, 0x0f, 0x02, 0x00, 0x89, 0x2f, 0x5a, 0x11, 0x9e, 0x00,
-        0x02, 0x3f, 0x6f, 0xfe, 0x87, 0x18, 0x00, 0x01, 0x4f, 0x70, 0xfe, 0xb4, 0x07, 0x18, 0x00,
-        0x00, 0x0f, 0x17, 0x00, 0x12, 0x23, 0x1b, 0x74, 0x3a, 0x00, 0x43, 0x6f, 0xfe, 0xae, 0x05,
-        0x0b, 0x00, 0x71, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x88, 0x09, 0x00, 0x0b, 0x17, 0x00,
-        0x5f, 0x00, 0x01, 0x95, 0xff, 0x8c, 0x5c, 0x00, 0x02, 0x4f, 0x01, 0x94, 0xff, 0x8c, 0x73,
-        0x00, 0x02, 0x4a, 0x01, 0x99, 0xff, 0xbc, 0x5c, 0x00, 0x03, 0x02, 0x00, 0x3f, 0x01, 0x94,
-        0xff, 0xb8, 0x00, 0x02, 0x38, 0x00, 0x01, 0x66, 0x8a, 0x00, 0x0f, 0x02, 0x00, 0x7a, 0x50,
-        0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0x8e, 0x2f, 0x5a, 0x11, 0x17, 0x00, 0x02, 0x3f, 0x6f, 0xfe, 0x87, 0x17, 0x00, 0x01,
+        0x4f, 0x70, 0xfe, 0xb4, 0x07, 0x17, 0x00, 0x25, 0x23, 0x1b, 0x74, 0x09, 0x00, 0x47, 0x6f,
+        0xfe, 0xae, 0x05, 0x26, 0x00, 0x3f, 0x80, 0xff, 0x88, 0x17, 0x00, 0x01, 0x5f, 0x00, 0x01,
+        0x95, 0xff, 0x8c, 0x5c, 0x00, 0x02, 0x4f, 0x01, 0x94, 0xff, 0x8c, 0x73, 0x00, 0x02, 0x4b,
+        0x01, 0x99, 0xff, 0xbc, 0x45, 0x00, 0x05, 0x32, 0x00, 0x0f, 0xa1, 0x00, 0x02, 0x3f, 0x00,
+        0x01, 0x66, 0x2e, 0x00, 0x00, 0x0f, 0x01, 0x00, 0x73, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
 
 };
 
@@ -43,11 +34,11 @@ const lv_image_dsc_t icon_check_24 = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 24,
                  .h = 24,
-                 .stride = 48,
+                 .stride = 24,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_check_24_map),
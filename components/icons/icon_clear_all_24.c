@@ -20,16 +20,13 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_CLEAR_ALL_24 uint8_t
     icon_clear_all_24_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0xff, 0x4b, 0x1f, 0x00, 0x01, 0x00, 0x08, 0x0f, 0x79, 0x01, 0x01, 0x0f, 0x2f, 0x00,
-        0x08, 0x0f, 0x30, 0x00, 0x32, 0x0f, 0x02, 0x00, 0x19, 0x0f, 0x8c, 0x00, 0xd9, 0x0f, 0xec,
-        0x00, 0x1d, 0x0f, 0x02, 0x00, 0xff, 0x38, 0x0f, 0x7a, 0x01, 0x09, 0x0f, 0x02, 0x00, 0x80,
-        0x27, 0x46, 0x71, 0x01, 0x00, 0x16, 0x38, 0xa1, 0x00, 0x18, 0xa0, 0x12, 0x02, 0x16, 0x80,
-        0x18, 0x00, 0x27, 0x09, 0x0f, 0x01, 0x00, 0x16, 0x07, 0x18, 0x00, 0x0f, 0x02, 0x00, 0x03,
-        0x27, 0x6c, 0xc0, 0x01, 0x00, 0x16, 0x6b, 0x24, 0x00, 0x0f, 0x18, 0x00, 0x05, 0x0f, 0x02,
-        0x00, 0x03, 0x17, 0x07, 0x73, 0x00, 0x26, 0x0f, 0x09, 0x24, 0x00, 0x18, 0x80, 0xa4, 0x00,
-        0x16, 0xa0, 0x18, 0x00, 0x17, 0x38, 0xd3, 0x00, 0x26, 0x71, 0x46, 0x18, 0x00, 0x0f, 0x02,
-        0x00, 0x8d, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0x9b, 0x27, 0x46, 0x71, 0x01, 0x00, 0x16, 0x38, 0x18, 0x00, 0x27, 0xa0, 0xff, 0x01,
+        0x00, 0x16, 0x80, 0x18, 0x00, 0x27, 0x09, 0x0f, 0x01, 0x00, 0x1f, 0x07, 0x53, 0x00, 0x02,
+        0x07, 0x01, 0x00, 0x27, 0x6c, 0xc0, 0x01, 0x00, 0x1f, 0x6b, 0x18, 0x00, 0x0f, 0x0f, 0x01,
+        0x00, 0x03, 0x18, 0x07, 0x74, 0x00, 0x16, 0x09, 0x18, 0x00, 0x18, 0x80, 0xa4, 0x00, 0x16,
+        0xa0, 0x18, 0x00, 0x18, 0x38, 0xd4, 0x00, 0x1f, 0x46, 0x53, 0x00, 0x02, 0x0f, 0x01, 0x00,
+        0x82, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
 
 };
 
@@ -37,11 +34,11 @@ const lv_image_dsc_t icon_clear_all_24 = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 24,
                  .h = 24,
-                 .stride = 48,
+                 .stride = 24,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_clear_all_24_map),
@@ -20,53 +20,16 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_DELETE uint8_t
     icon_delete_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0xa9, 0x02, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0xff, 0xff, 0xb2, 0x2f, 0xe3, 0x18, 0x02, 0x00, 0x03, 0x0f, 0xdb, 0x02, 0x35, 0x0f,
-        0x5e, 0x00, 0x03, 0x0f, 0x60, 0x00, 0x25, 0x0f, 0x4e, 0x00, 0x05, 0x0f, 0x02, 0x00, 0x11,
-        0x0f, 0xd2, 0x00, 0x11, 0x0f, 0x48, 0x00, 0x11, 0x0f, 0x02, 0x00, 0x05, 0x0f, 0x60, 0x00,
-        0x71, 0x00, 0x92, 0x04, 0x02, 0xa0, 0x00, 0x02, 0x0c, 0x00, 0x0f, 0x02, 0x00, 0x0f, 0x0f,
-        0x2e, 0x00, 0x1b, 0x0f, 0x60, 0x00, 0xff, 0x20, 0x02, 0x60, 0x01, 0x06, 0x90, 0x01, 0x0f,
-        0x10, 0x00, 0x03, 0x02, 0x5a, 0x01, 0x0f, 0x02, 0x00, 0x13, 0x02, 0x42, 0x00, 0x04, 0x2c,
-        0x00, 0x02, 0x0e, 0x00, 0x0f, 0x10, 0x00, 0x0d, 0x04, 0x2e, 0x00, 0x0f, 0x02, 0x00, 0x11,
-        0x02, 0x52, 0x00, 0x04, 0x2a, 0x00, 0x02, 0x0e, 0x00, 0x0f, 0x10, 0x00, 0x0d, 0x04, 0x2e,
-        0x00, 0x0f, 0x02, 0x00, 0x11, 0x02, 0x52, 0x00, 0x04, 0x2a, 0x00, 0x02, 0x0e, 0x00, 0x0f,
-        0x10, 0x00, 0x0d, 0x04, 0x2e, 0x00, 0x0f, 0x02, 0x00, 0x11, 0x02, 0x52, 0x00, 0x04, 0x2a,
-        0x00, 0x02, 0x0e, 0x00, 0x0f, 0x10, 0x00, 0x0d, 0x04, 0x2e, 0x00, 0x0f, 0x02, 0x00, 0x11,
-        0x02, 0x52, 0x00, 0x04, 0x2a, 0x00, 0x02, 0x0e, 0x00, 0x0f, 0x10, 0x00, 0x0d, 0x04, 0x2e,
-        0x00, 0x0f, 0x02, 0x00, 0x11, 0x02, 0x52, 0x00, 0x04, 0x2a, 0x00, 0x02, 0x0e, 0x00, 0x0f,
-        0x10, 0x00, 0x0d, 0x04, 0x2e, 0x00, 0x0f, 0x02, 0x00, 0x11, 0x02, 0x52, 0x00, 0x04, 0x2a,
-        0x00, 0x02, 0x0e, 0x00, 0x0f, 0x10, 0x00, 0x0d, 0x04, 0x2e, 0x00, 0x0f, 0x02, 0x00, 0x11,
-        0x02, 0x52, 0x00, 0x04, 0x2a, 0x00, 0x02, 0x0e, 0x00, 0x0f, 0x10, 0x00, 0x0d, 0x04, 0x2e,
-        0x00, 0x0f, 0x02, 0x00, 0x11, 0x02, 0x52, 0x00, 0x04, 0x2a, 0x00, 0x02, 0x0e, 0x00, 0x0f,
-        0x10, 0x00, 0x0d, 0x04, 0x2e, 0x00, 0x0f, 0x02, 0x00, 0x11, 0x02, 0x52, 0x00, 0x04, 0x2a,
-        0x00, 0x02, 0x0e, 0x00, 0x0f, 0x10, 0x00, 0x0d, 0x04, 0x2e, 0x00, 0x0f, 0x02, 0x00, 0x11,
-        0x02, 0x52, 0x00, 0x04, 0x2a, 0x00, 0x02, 0x0e, 0x00, 0x0f, 0x10, 0x00, 0x0d, 0x04, 0x2e,
-        0x00, 0x0f, 0x02, 0x00, 0x11, 0x02, 0x52, 0x00, 0x04, 0x2a, 0x00, 0x02, 0x0e, 0x00, 0x0f,
-        0x10, 0x00, 0x0d, 0x04, 0x2e, 0x00, 0x0f, 0x02, 0x00, 0x11, 0x02, 0x52, 0x00, 0x04, 0x2a,
-        0x00, 0x02, 0x0e, 0x00, 0x0f, 0x10, 0x00, 0x0d, 0x04, 0x2e, 0x00, 0x0f, 0x02, 0x00, 0x11,
-        0x02, 0x52, 0x00, 0x04, 0x2a, 0x00, 0x02, 0x0e, 0x00, 0x0f, 0x10, 0x00, 0x0d, 0x04, 0x2e,
-        0x00, 0x0f, 0x02, 0x00, 0x11, 0x02, 0x52, 0x00, 0x04, 0x2a, 0x00, 0x02, 0x0e, 0x00, 0x0f,
-        0x10, 0x00, 0x0d, 0x04, 0x2e, 0x00, 0x0f, 0x02, 0x00, 0x11, 0x02, 0x52, 0x00, 0x04, 0x2a,
-        0x00, 0x02, 0x0e, 0x00, 0x0f, 0x10, 0x00, 0x0d, 0x04, 0x2e, 0x00, 0x0f, 0x02, 0x00, 0x11,
-        0x02, 0x52, 0x00, 0x04, 0x2a, 0x00, 0x02, 0x0e, 0x00, 0x0f, 0x10, 0x00, 0x0d, 0x04, 0x2e,
-        0x00, 0x0f, 0x02, 0x00, 0x11, 0x02, 0x52, 0x00, 0x0f, 0x2a, 0x00, 0x11, 0x0f, 0x0e, 0x08,
-        0x1f, 0x0f, 0x32, 0x00, 0x1f, 0x0f, 0x8e, 0x00, 0x1b, 0x0f, 0x60, 0x00, 0x57, 0x0f, 0x22,
-        0x01, 0x13, 0x2f, 0x04, 0x21, 0xc0, 0x00, 0x25, 0x0f, 0x02, 0x00, 0x1b, 0x02, 0xfa, 0x00,
-        0x0f, 0x02, 0x00, 0x13, 0x04, 0x94, 0x00, 0x0f, 0x02, 0x00, 0x19, 0x0f, 0x5a, 0x00, 0x13,
-        0x04, 0x02, 0x00, 0x0f, 0x62, 0x00, 0x1d, 0x04, 0x38, 0x00, 0x0f, 0x02, 0x00, 0xff, 0xff,
-        0x9f, 0x1f, 0x00, 0x01, 0x00, 0xff, 0x4f, 0x17, 0xcc, 0x01, 0x00, 0x0f, 0x6d, 0x01, 0x11,
-        0x08, 0x42, 0x04, 0x0f, 0x30, 0x00, 0x08, 0x08, 0x27, 0x00, 0x0e, 0x02, 0x00, 0x0e, 0x39,
-        0x00, 0x0e, 0x24, 0x00, 0x08, 0x02, 0x00, 0x0f, 0x30, 0x00, 0x2f, 0x01, 0x62, 0x00, 0x0e,
-        0x47, 0x00, 0x0f, 0x17, 0x00, 0x06, 0x0f, 0x19, 0x00, 0x06, 0x0f, 0x47, 0x00, 0x04, 0x0f,
-        0x19, 0x00, 0x06, 0x0f, 0x30, 0x00, 0x3d, 0xcf, 0x31, 0xff, 0xff, 0xce, 0x00, 0x00, 0x00,
-        0x00, 0xce, 0xff, 0xff, 0x31, 0x77, 0x00, 0x08, 0x05, 0x79, 0x00, 0x0f, 0x30, 0x00, 0xff,
-        0xff, 0xff, 0x20, 0x0c, 0x02, 0x00, 0x0f, 0xc0, 0x03, 0x3d, 0x0c, 0x02, 0x00, 0x0f, 0x60,
-        0x00, 0x06, 0x4c, 0xf6, 0xff, 0xff, 0x1b, 0x2d, 0x00, 0x6e, 0x00, 0x00, 0x1e, 0xff, 0xff,
-        0xf6, 0x16, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x31, 0x05, 0x08, 0x02, 0x00, 0x12,
-        0xc6, 0x20, 0x00, 0x0c, 0x02, 0x00, 0x28, 0x3f, 0xfd, 0x25, 0x00, 0x06, 0x02, 0x00, 0x2c,
-        0xfd, 0x41, 0x2a, 0x00, 0x03, 0x02, 0x00, 0x36, 0x3f, 0xc5, 0xf6, 0x26, 0x00, 0x04, 0x02,
-        0x00, 0x2f, 0xf6, 0xc6, 0x2f, 0x00, 0x05, 0x0f, 0x02, 0x00, 0xff, 0x2e, 0x50, 0x00, 0x00,
-        0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0xff, 0x4f, 0x17, 0xcc, 0x01, 0x00, 0x0f, 0x2f, 0x00, 0x10, 0x27, 0x00, 0xff, 0x01,
+        0x00, 0x0f, 0x27, 0x00, 0x14, 0x0e, 0x01, 0x00, 0x0f, 0x30, 0x00, 0x5f, 0x01, 0x32, 0x00,
+        0x0f, 0x17, 0x00, 0x18, 0x0f, 0x30, 0x00, 0x86, 0x40, 0x31, 0xff, 0xff, 0xce, 0x08, 0x00,
+        0x4f, 0xce, 0xff, 0xff, 0x31, 0x30, 0x00, 0xff, 0xff, 0xff, 0x44, 0x0f, 0x17, 0x00, 0x14,
+        0x0f, 0x30, 0x00, 0x4f, 0x4e, 0xf6, 0xff, 0xff, 0x1b, 0x16, 0x00, 0x4f, 0x1e, 0xff, 0xff,
+        0xf6, 0x2e, 0x00, 0x01, 0x3f, 0x00, 0x00, 0xc6, 0x0d, 0x05, 0x05, 0x1f, 0xc6, 0x30, 0x00,
+        0x03, 0x2f, 0x3f, 0xfd, 0x2f, 0x00, 0x03, 0x2f, 0xfd, 0x41, 0x30, 0x00, 0x03, 0x4e, 0x00,
+        0x3f, 0xc5, 0xf6, 0x2e, 0x00, 0x2f, 0xf6, 0xc6, 0x2f, 0x00, 0x05, 0x0f, 0x01, 0x00, 0xff,
+        0x2e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
 
 };
 
@@ -74,11 +37,11 @@ const lv_image_dsc_t icon_delete = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 48,
                  .h = 48,
-                 .stride = 96,
+                 .stride = 48,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_delete_map),
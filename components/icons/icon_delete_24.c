@@ -20,24 +20,15 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_DELETE_24 uint8_t
     icon_delete_24_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0x8e, 0x26, 0xe3, 0x18, 0x02, 0x00, 0x0f, 0xad, 0x00, 0x07, 0x06, 0x24, 0x00, 0x0f,
-        0x02, 0x00, 0x03, 0x0c, 0x3a, 0x00, 0x2f, 0x04, 0x21, 0x28, 0x00, 0x03, 0x02, 0x02, 0x00,
-        0x2c, 0x04, 0x21, 0x30, 0x00, 0x02, 0x32, 0x00, 0x0e, 0x16, 0x00, 0x2f, 0xff, 0xff, 0x2e,
-        0x00, 0x03, 0x0f, 0x30, 0x00, 0x27, 0x22, 0xe3, 0x18, 0x68, 0x00, 0x06, 0x08, 0x00, 0x0f,
-        0x8e, 0x00, 0x01, 0x06, 0x60, 0x00, 0x06, 0x28, 0x00, 0x04, 0x38, 0x00, 0x0f, 0x30, 0x00,
-        0xff, 0x5c, 0x0c, 0x02, 0x00, 0x0f, 0x80, 0x01, 0x05, 0x5d, 0xe3, 0x18, 0xe3, 0x18, 0x24,
-        0x58, 0x02, 0x02, 0x88, 0x02, 0x0c, 0x44, 0x00, 0x02, 0x58, 0x02, 0x0f, 0x02, 0x00, 0x07,
-        0x02, 0x22, 0x00, 0x0c, 0x02, 0x00, 0x6a, 0xe3, 0x18, 0xe3, 0x18, 0x04, 0x21, 0x02, 0x00,
-        0x04, 0x16, 0x02, 0x0f, 0x02, 0x00, 0x85, 0x1f, 0x00, 0x01, 0x00, 0x3d, 0x11, 0x66, 0x01,
-        0x00, 0x09, 0x56, 0x00, 0x52, 0x3c, 0x77, 0x77, 0x77, 0x77, 0x01, 0x01, 0x54, 0x77, 0x77,
-        0x77, 0x77, 0x3c, 0x1d, 0x00, 0x12, 0x80, 0x14, 0x00, 0x04, 0x02, 0x00, 0x14, 0x80, 0x18,
-        0x00, 0x35, 0x00, 0x80, 0xff, 0x0b, 0x00, 0x17, 0x00, 0x17, 0x00, 0x0f, 0x18, 0x00, 0x0a,
-        0x6e, 0x98, 0xe6, 0x00, 0x00, 0xe6, 0x98, 0x30, 0x00, 0x0f, 0x18, 0x00, 0xad, 0x04, 0x02,
-        0x00, 0x08, 0x08, 0x01, 0x34, 0x7d, 0xff, 0x07, 0x17, 0x00, 0x34, 0x08, 0xff, 0x7d, 0x0b,
-        0x00, 0x44, 0x00, 0x00, 0x41, 0xfe, 0x4c, 0x01, 0x46, 0xff, 0xff, 0xff, 0x42, 0x18, 0x00,
-        0x43, 0x00, 0x41, 0x83, 0x88, 0x01, 0x00, 0x27, 0x83, 0x41, 0x17, 0x00, 0x0f, 0x02, 0x00,
-        0x2b, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0x3d, 0x11, 0x66, 0x01, 0x00, 0x09, 0x13, 0x00, 0x61, 0x3c, 0x77, 0x77, 0x77, 0x77,
+        0xff, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x3c, 0x18, 0x00, 0x12, 0x80, 0x14, 0x00, 0x04,
+        0x01, 0x00, 0x15, 0x80, 0x31, 0x00, 0x26, 0x80, 0xff, 0x3d, 0x00, 0x07, 0x17, 0x00, 0x0f,
+        0x18, 0x00, 0x0a, 0x6f, 0x98, 0xe6, 0x00, 0x00, 0xe6, 0x98, 0x18, 0x00, 0xbf, 0x04, 0x01,
+        0x00, 0x08, 0x18, 0x00, 0x34, 0x7d, 0xff, 0x07, 0x0b, 0x00, 0x36, 0x08, 0xff, 0x7d, 0x18,
+        0x00, 0x27, 0x41, 0xfe, 0x4f, 0x01, 0x16, 0x42, 0x18, 0x00, 0x43, 0x00, 0x41, 0x83, 0x88,
+        0x01, 0x00, 0x27, 0x83, 0x41, 0x17, 0x00, 0x0f, 0x01, 0x00, 0x2b, 0x50, 0x00, 0x00, 0x00,
+        0x00, 0x00,
 
 };
 
@@ -45,11 +36,11 @@ const lv_image_dsc_t icon_delete_24 = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 24,
                  .h = 24,
-                 .stride = 48,
+                 .stride = 24,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_delete_24_map),
@@ -20,102 +20,53 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_INFO uint8_t
     icon_info_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0x87, 0x05, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0xff, 0xf1, 0x2a, 0xe3, 0x18, 0x02, 0x00, 0x8f, 0x04, 0x21, 0xe3, 0x18, 0xe3, 0x18,
-        0x04, 0x21, 0x1b, 0x02, 0x2f, 0x11, 0x24, 0x4a, 0x00, 0x0f, 0x02, 0x00, 0x09, 0x2f, 0xa2,
-        0x10, 0x66, 0x00, 0x25, 0x22, 0x00, 0x00, 0xa8, 0x00, 0x0f, 0x02, 0x00, 0x0d, 0x4f, 0x04,
-        0x21, 0x00, 0x00, 0x64, 0x00, 0x1f, 0x0f, 0x5c, 0x00, 0x03, 0x4f, 0xa2, 0x10, 0xa2, 0x10,
-        0x70, 0x00, 0x01, 0x0f, 0x2c, 0x01, 0x1d, 0x0a, 0x5e, 0x00, 0x0f, 0xa0, 0x00, 0x03, 0x0a,
-        0xe0, 0x00, 0x0f, 0x62, 0x00, 0x19, 0x08, 0x5e, 0x00, 0x0f, 0x5c, 0x00, 0x03, 0x04, 0x02,
-        0x00, 0x08, 0x64, 0x00, 0x0f, 0x62, 0x00, 0x15, 0x06, 0x5e, 0x00, 0x0f, 0x32, 0x00, 0x13,
-        0x06, 0x30, 0x01, 0x0f, 0x30, 0x00, 0x11, 0x04, 0x2e, 0x00, 0x2f, 0x04, 0x21, 0x2e, 0x00,
-        0x11, 0x02, 0x02, 0x00, 0x0f, 0x92, 0x00, 0x17, 0x26, 0x00, 0x00, 0x60, 0x00, 0x02, 0x3c,
-        0x00, 0x0f, 0x02, 0x00, 0x13, 0x06, 0x62, 0x00, 0x0f, 0x50, 0x01, 0x0b, 0x0f, 0x5e, 0x00,
-        0x23, 0x00, 0x84, 0x05, 0x04, 0x3a, 0x00, 0x22, 0xe3, 0x18, 0x10, 0x00, 0x0f, 0x02, 0x00,
-        0x01, 0x06, 0x4e, 0x03, 0x0f, 0x1e, 0x00, 0x01, 0x6f, 0xff, 0xff, 0xa2, 0x10, 0x04, 0x21,
-        0x52, 0x03, 0x07, 0x04, 0xc4, 0x00, 0x0f, 0x72, 0x03, 0x07, 0x04, 0x84, 0x00, 0x0f, 0xe4,
-        0x00, 0x05, 0x02, 0x42, 0x00, 0x0f, 0x3a, 0x01, 0x05, 0x06, 0x4c, 0x02, 0x0f, 0x9e, 0x00,
-        0x03, 0x06, 0x60, 0x00, 0x0f, 0x20, 0x00, 0x25, 0x02, 0x80, 0x00, 0x0f, 0x40, 0x00, 0x05,
-        0x04, 0x1e, 0x00, 0x0f, 0xbe, 0x00, 0x05, 0x04, 0x22, 0x00, 0x1f, 0x24, 0xd8, 0x04, 0x06,
-        0x04, 0x1e, 0x02, 0x0f, 0xe2, 0x00, 0x03, 0x04, 0x1e, 0x01, 0x0f, 0xbe, 0x00, 0x05, 0x0f,
-        0x02, 0x00, 0x11, 0x0f, 0x44, 0x00, 0x09, 0x0f, 0x1c, 0x00, 0x09, 0x0f, 0x02, 0x00, 0x15,
-        0x0f, 0x44, 0x00, 0x09, 0x02, 0x1c, 0x00, 0x0f, 0xdc, 0x00, 0x03, 0x0f, 0x02, 0x00, 0x15,
-        0x0f, 0x44, 0x00, 0x09, 0x02, 0x1c, 0x00, 0x0f, 0x20, 0x01, 0x09, 0x02, 0xa2, 0x01, 0x0f,
-        0x82, 0x00, 0x09, 0x13, 0xc3, 0x8a, 0x06, 0x0f, 0x90, 0x00, 0x01, 0x02, 0x60, 0x00, 0x0f,
-        0xbe, 0x02, 0x07, 0x0f, 0x60, 0x00, 0x11, 0x22, 0x45, 0x29, 0x46, 0x00, 0x0f, 0x60, 0x00,
-        0x67, 0x0f, 0x7c, 0x00, 0x03, 0x02, 0x02, 0x00, 0x0f, 0x20, 0x01, 0x31, 0x0f, 0x5e, 0x01,
-        0x09, 0x0f, 0x60, 0x00, 0x0f, 0x02, 0x1e, 0x01, 0x0f, 0xa4, 0x00, 0x03, 0x0f, 0x1c, 0x00,
-        0x09, 0x02, 0x02, 0x00, 0x0f, 0x60, 0x00, 0x93, 0x0f, 0x20, 0x04, 0x0d, 0x0f, 0x42, 0x01,
-        0x07, 0x0f, 0x20, 0x04, 0x0b, 0x04, 0x22, 0x01, 0x0f, 0x40, 0x00, 0x07, 0x0f, 0x20, 0x01,
-        0x0d, 0x0f, 0x62, 0x01, 0x0d, 0x04, 0x20, 0x00, 0x0f, 0xc2, 0x00, 0x05, 0x0f, 0x60, 0x00,
-        0x0b, 0x04, 0xbe, 0x00, 0x0f, 0xde, 0x01, 0x03, 0x02, 0x40, 0x06, 0x02, 0x62, 0x00, 0x0f,
-        0xc2, 0x00, 0x05, 0x0f, 0x60, 0x00, 0x0b, 0x02, 0x3c, 0x00, 0x0f, 0xa2, 0x03, 0x11, 0x0f,
-        0x84, 0x00, 0x05, 0x02, 0xf6, 0x07, 0x0f, 0xa0, 0x00, 0x03, 0x02, 0x36, 0x00, 0x0f, 0x3a,
-        0x00, 0x05, 0x04, 0x02, 0x00, 0x06, 0xe4, 0x00, 0x0f, 0xc4, 0x00, 0x05, 0x0f, 0x02, 0x00,
-        0x03, 0x22, 0x04, 0x21, 0xdc, 0x00, 0x0f, 0x5c, 0x01, 0x07, 0x04, 0x02, 0x00, 0x04, 0x28,
-        0x00, 0x0f, 0x62, 0x00, 0x19, 0x0f, 0x34, 0x00, 0x1b, 0x06, 0x2e, 0x00, 0x0f, 0x0a, 0x01,
-        0x03, 0x0c, 0x02, 0x00, 0x02, 0x16, 0x01, 0x02, 0x02, 0x00, 0x0c, 0x1c, 0x00, 0x0f, 0x02,
-        0x00, 0x03, 0x06, 0x62, 0x00, 0x0f, 0x1c, 0x0b, 0x0d, 0x06, 0x50, 0x01, 0x0f, 0xf0, 0x00,
-        0x19, 0x0a, 0x62, 0x00, 0x0f, 0x54, 0x01, 0x05, 0x08, 0x5c, 0x00, 0x0f, 0x5e, 0x00, 0x1b,
-        0x0a, 0x62, 0x00, 0x06, 0x02, 0x00, 0x64, 0xc3, 0x18, 0x86, 0x31, 0x86, 0x31, 0x44, 0x06,
-        0x08, 0x02, 0x00, 0x0f, 0x0e, 0x02, 0x1b, 0x02, 0x02, 0x00, 0x0a, 0xa0, 0x00, 0x0f, 0x02,
-        0x00, 0x09, 0x0f, 0x90, 0x03, 0x05, 0x0f, 0x02, 0x00, 0x0f, 0x04, 0x72, 0x03, 0x0f, 0x02,
-        0x00, 0x07, 0x0f, 0xf0, 0x06, 0x09, 0x0f, 0x02, 0x00, 0x15, 0x06, 0xf0, 0x01, 0x08, 0x02,
-        0x00, 0x0f, 0x14, 0x01, 0x21, 0x0f, 0x02, 0x00, 0xff, 0xc0, 0x1f, 0x00, 0x01, 0x00, 0xee,
-        0xcf, 0x31, 0x74, 0xad, 0xd3, 0xee, 0xfa, 0xfa, 0xee, 0xd2, 0xac, 0x73, 0x30, 0x0d, 0x01,
-        0x0e, 0x38, 0x0d, 0x73, 0xd7, 0x04, 0x03, 0x3f, 0xd6, 0x73, 0x0c, 0x33, 0x00, 0x09, 0x38,
-        0x04, 0x71, 0xed, 0x2e, 0x00, 0x00, 0x6c, 0x13, 0x3f, 0xec, 0x70, 0x04, 0x32, 0x00, 0x06,
-        0x20, 0x28, 0xcf, 0x8e, 0x13, 0xff, 0x03, 0xe6, 0x97, 0x5a, 0x39, 0x22, 0x0b, 0x0b, 0x22,
-        0x39, 0x5b, 0x98, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x28, 0x31, 0x00, 0x04, 0x86, 0x50,
-        0xf4, 0xff, 0xff, 0xff, 0xc7, 0x4e, 0x03, 0x1f, 0x00, 0x86, 0x03, 0x50, 0xc9, 0xff, 0xff,
-        0xff, 0xf3, 0x4f, 0x12, 0x00, 0x07, 0x02, 0x00, 0x77, 0x60, 0xfc, 0xff, 0xff, 0xee, 0x5e,
-        0x01, 0x12, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x01, 0x60, 0xef, 0xff, 0xff, 0xfc, 0x60, 0x0c,
-        0x00, 0x0a, 0x02, 0x00, 0x6a, 0x50, 0xfc, 0xff, 0xff, 0xcf, 0x20, 0x14, 0x00, 0xa2, 0x00,
-        0x00, 0x00, 0x00, 0x21, 0xd0, 0xff, 0xff, 0xfc, 0x50, 0x0c, 0x00, 0x07, 0x02, 0x00, 0x67,
-        0x29, 0xf4, 0xff, 0xff, 0xc2, 0x0f, 0x11, 0x00, 0x05, 0x02, 0x00, 0x5c, 0x0f, 0xc3, 0xff,
-        0xff, 0xf3, 0xc4, 0x00, 0x5f, 0x04, 0xd0, 0xff, 0xff, 0xce, 0x2f, 0x00, 0x02, 0x7b, 0x00,
-        0x00, 0x0f, 0xd0, 0xff, 0xff, 0xcf, 0x26, 0x01, 0x4f, 0x72, 0xff, 0xff, 0xee, 0x8d, 0x00,
-        0x00, 0x02, 0x02, 0x00, 0x52, 0x21, 0xef, 0xff, 0xff, 0x6f, 0x0b, 0x00, 0x03, 0x02, 0x00,
-        0x53, 0x0d, 0xed, 0xff, 0xff, 0x5e, 0x0c, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x88,
-        0x87, 0xa9, 0x01, 0x48, 0x61, 0xff, 0xff, 0xec, 0x10, 0x00, 0x58, 0x00, 0x73, 0xff, 0xff,
-        0xc7, 0x1a, 0x01, 0x42, 0x81, 0xff, 0xff, 0x81, 0x3a, 0x00, 0x01, 0x02, 0x00, 0x51, 0x01,
-        0xca, 0xff, 0xff, 0x73, 0x0a, 0x00, 0x03, 0x02, 0x00, 0x43, 0xd6, 0xff, 0xff, 0x4e, 0x0b,
-        0x00, 0x01, 0x02, 0x00, 0x41, 0x7a, 0xff, 0xff, 0x7a, 0x09, 0x00, 0x03, 0x02, 0x00, 0x43,
-        0x50, 0xff, 0xff, 0xd6, 0x0b, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x30, 0xff, 0xff, 0xe6,
-        0x03, 0x0b, 0x00, 0x02, 0x02, 0x00, 0x42, 0x08, 0x73, 0x73, 0x07, 0x0a, 0x00, 0x02, 0x02,
-        0x00, 0x47, 0x04, 0xe9, 0xff, 0xff, 0x7d, 0x02, 0x42, 0x74, 0xff, 0xff, 0x97, 0x19, 0x00,
-        0x0f, 0x02, 0x00, 0x05, 0x19, 0x9b, 0x91, 0x00, 0x4f, 0xac, 0xff, 0xff, 0x5a, 0x2a, 0x00,
-        0x05, 0x02, 0x02, 0x00, 0x42, 0x5c, 0xff, 0xff, 0xab, 0x0a, 0x00, 0x82, 0x00, 0x00, 0x00,
-        0x00, 0xd3, 0xff, 0xff, 0x37, 0x0a, 0x00, 0x0f, 0x02, 0x00, 0x05, 0x46, 0x32, 0xff, 0xff,
-        0xd2, 0x1c, 0x00, 0x46, 0xed, 0xff, 0xff, 0x22, 0x0e, 0x00, 0x71, 0x00, 0x00, 0x00, 0x80,
-        0xff, 0xff, 0x80, 0x09, 0x00, 0x04, 0x02, 0x00, 0x44, 0x14, 0xff, 0xff, 0xed, 0x0c, 0x00,
-        0x66, 0x00, 0x00, 0xfa, 0xff, 0xff, 0x0b, 0x0e, 0x00, 0x0f, 0x30, 0x00, 0x01, 0x41, 0x06,
-        0xff, 0xff, 0xf9, 0x1a, 0x00, 0x01, 0x02, 0x00, 0x0f, 0x30, 0x00, 0x12, 0x11, 0xf8, 0x2b,
-        0x00, 0x01, 0x02, 0x00, 0x0f, 0x90, 0x00, 0x12, 0x11, 0xec, 0x2b, 0x00, 0x01, 0x02, 0x00,
-        0x41, 0xd3, 0xff, 0xff, 0x38, 0x09, 0x00, 0x04, 0x02, 0x00, 0x0d, 0xc0, 0x00, 0x44, 0x32,
-        0xff, 0xff, 0xd1, 0x1d, 0x00, 0x01, 0x50, 0x01, 0x16, 0x5b, 0x0e, 0x00, 0x0f, 0xc0, 0x00,
-        0x01, 0x19, 0x5d, 0x50, 0x01, 0x41, 0x74, 0xff, 0xff, 0x98, 0x28, 0x00, 0x04, 0x02, 0x00,
-        0x0d, 0x60, 0x00, 0x19, 0x9c, 0xb0, 0x01, 0x49, 0x31, 0xff, 0xff, 0xe7, 0x10, 0x02, 0x0c,
-        0x30, 0x00, 0x54, 0x04, 0xe9, 0xff, 0xff, 0x2f, 0x4d, 0x00, 0x69, 0x00, 0x00, 0x00, 0xd7,
-        0xff, 0xff, 0xd5, 0x03, 0x0c, 0x30, 0x00, 0x1a, 0x52, 0x70, 0x02, 0x58, 0x00, 0x73, 0xff,
-        0xff, 0xc9, 0xd0, 0x02, 0x0b, 0x30, 0x00, 0x51, 0x02, 0xcc, 0xff, 0xff, 0x72, 0x59, 0x00,
-        0x03, 0x02, 0x00, 0x48, 0x0c, 0xec, 0xff, 0xff, 0x05, 0x04, 0x0b, 0x30, 0x00, 0x49, 0x63,
-        0xff, 0xff, 0xeb, 0x30, 0x03, 0x63, 0x00, 0x70, 0xff, 0xff, 0xef, 0x21, 0x3d, 0x00, 0x71,
-        0x00, 0x00, 0x00, 0x44, 0x88, 0x88, 0x44, 0x09, 0x00, 0x01, 0x02, 0x00, 0x51, 0x23, 0xf0,
-        0xff, 0xff, 0x6e, 0x0a, 0x00, 0x05, 0x02, 0x00, 0x5f, 0x04, 0xce, 0xff, 0xff, 0xd0, 0xf0,
-        0x03, 0x05, 0x49, 0xd2, 0xff, 0xff, 0xcd, 0x0f, 0x01, 0x8f, 0x00, 0x00, 0x00, 0x28, 0xf3,
-        0xff, 0xff, 0xc3, 0x31, 0x00, 0x02, 0x61, 0x10, 0xc3, 0xff, 0xff, 0xf3, 0x26, 0x25, 0x00,
-        0x08, 0x02, 0x00, 0x57, 0x4f, 0xfc, 0xff, 0xff, 0xd0, 0x93, 0x00, 0x04, 0x02, 0x00, 0x59,
-        0x23, 0xd1, 0xff, 0xff, 0xfc, 0xad, 0x03, 0x03, 0x02, 0x00, 0x68, 0x60, 0xfc, 0xff, 0xff,
-        0xef, 0x60, 0x26, 0x01, 0xa1, 0x00, 0x00, 0x00, 0x01, 0x63, 0xf0, 0xff, 0xff, 0xfc, 0x5f,
-        0x0c, 0x00, 0x0c, 0x02, 0x00, 0x77, 0x4f, 0xf3, 0xff, 0xff, 0xff, 0xca, 0x51, 0xaa, 0x00,
-        0x3f, 0x04, 0x52, 0xcc, 0x70, 0x05, 0x07, 0x40, 0x00, 0x00, 0x27, 0xce, 0x5e, 0x19, 0xc0,
-        0xe9, 0x9b, 0x5c, 0x32, 0x14, 0x05, 0x05, 0x14, 0x32, 0x5d, 0x9c, 0xea, 0x6e, 0x19, 0x2c,
-        0xcd, 0x27, 0x59, 0x00, 0x05, 0x02, 0x00, 0x32, 0x04, 0x6f, 0xeb, 0x26, 0x06, 0x06, 0x02,
-        0x00, 0x35, 0xeb, 0x6e, 0x04, 0x1f, 0x00, 0x0f, 0x02, 0x00, 0x00, 0x36, 0x0c, 0x72, 0xd6,
-        0x2c, 0x00, 0x0f, 0x90, 0x06, 0x0e, 0x01, 0x02, 0x00, 0x9f, 0x30, 0x73, 0xab, 0xd1, 0xee,
-        0xfa, 0xfa, 0xee, 0xd1, 0xf0, 0x06, 0x11, 0x0f, 0x02, 0x00, 0xc9, 0x50, 0x00, 0x00, 0x00,
-        0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0xa9, 0x02, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0xee, 0xcf, 0x31, 0x74, 0xad, 0xd3, 0xee, 0xfa, 0xfa, 0xee, 0xd2, 0xac, 0x73, 0x30,
+        0x2d, 0x00, 0x0e, 0x47, 0x0d, 0x73, 0xd7, 0xff, 0x01, 0x00, 0x3f, 0xd6, 0x73, 0x0c, 0x2e,
+        0x00, 0x09, 0x38, 0x04, 0x71, 0xed, 0x2e, 0x00, 0x00, 0x01, 0x00, 0x3f, 0xec, 0x70, 0x04,
+        0x2f, 0x00, 0x06, 0x20, 0x28, 0xcf, 0x22, 0x00, 0xc0, 0xe6, 0x97, 0x5a, 0x39, 0x22, 0x0b,
+        0x0b, 0x22, 0x39, 0x5b, 0x98, 0xe7, 0x10, 0x00, 0x2f, 0xcf, 0x28, 0x2f, 0x00, 0x04, 0x86,
+        0x50, 0xf4, 0xff, 0xff, 0xff, 0xc7, 0x4e, 0x03, 0x12, 0x00, 0x8f, 0x03, 0x50, 0xc9, 0xff,
+        0xff, 0xff, 0xf3, 0x4f, 0x2f, 0x00, 0x02, 0x7a, 0x60, 0xfc, 0xff, 0xff, 0xee, 0x5e, 0x01,
+        0x15, 0x00, 0x7f, 0x01, 0x60, 0xef, 0xff, 0xff, 0xfc, 0x60, 0x2f, 0x00, 0x00, 0x6e, 0x50,
+        0xfc, 0xff, 0xff, 0xcf, 0x20, 0x18, 0x00, 0x6d, 0x21, 0xd0, 0xff, 0xff, 0xfc, 0x50, 0x17,
+        0x00, 0x6e, 0x29, 0xf4, 0xff, 0xff, 0xc2, 0x0f, 0x2f, 0x00, 0x7c, 0x00, 0x00, 0x0f, 0xc3,
+        0xff, 0xff, 0xf3, 0xc4, 0x00, 0x5f, 0x04, 0xd0, 0xff, 0xff, 0xce, 0x2f, 0x00, 0x02, 0x7b,
+        0x00, 0x00, 0x0f, 0xd0, 0xff, 0xff, 0xcf, 0x26, 0x01, 0x4f, 0x72, 0xff, 0xff, 0xee, 0x8d,
+        0x00, 0x00, 0x02, 0x01, 0x00, 0x59, 0x21, 0xef, 0xff, 0xff, 0x6f, 0x12, 0x00, 0x57, 0x0d,
+        0xed, 0xff, 0xff, 0x5e, 0x10, 0x00, 0x38, 0x0c, 0x88, 0x87, 0xa9, 0x01, 0x49, 0x61, 0xff,
+        0xff, 0xec, 0xb9, 0x01, 0x48, 0x73, 0xff, 0xff, 0xc7, 0x1a, 0x01, 0x47, 0x81, 0xff, 0xff,
+        0x81, 0x0f, 0x00, 0x58, 0x01, 0xca, 0xff, 0xff, 0x73, 0x30, 0x00, 0x48, 0xd6, 0xff, 0xff,
+        0x4e, 0x10, 0x00, 0x48, 0x7a, 0xff, 0xff, 0x7a, 0x10, 0x00, 0x47, 0x50, 0xff, 0xff, 0xd6,
+        0x0f, 0x00, 0x47, 0x30, 0xff, 0xff, 0xe6, 0xa7, 0x01, 0x68, 0x00, 0x00, 0x08, 0x73, 0x73,
+        0x07, 0x10, 0x00, 0x47, 0x04, 0xe9, 0xff, 0xff, 0x7d, 0x02, 0x48, 0x74, 0xff, 0xff, 0x97,
+        0x1f, 0x00, 0x0e, 0x01, 0x00, 0x19, 0x9b, 0x91, 0x00, 0x4f, 0xac, 0xff, 0xff, 0x5a, 0x2e,
+        0x00, 0x09, 0x66, 0x00, 0x00, 0x5c, 0xff, 0xff, 0xab, 0x0e, 0x00, 0x4f, 0xd3, 0xff, 0xff,
+        0x37, 0x2e, 0x00, 0x09, 0x66, 0x00, 0x00, 0x32, 0xff, 0xff, 0xd2, 0x0e, 0x00, 0x49, 0xed,
+        0xff, 0xff, 0x22, 0x1f, 0x00, 0x49, 0x80, 0xff, 0xff, 0x80, 0x11, 0x00, 0x46, 0x14, 0xff,
+        0xff, 0xed, 0x0e, 0x00, 0x4f, 0xfa, 0xff, 0xff, 0x0b, 0x30, 0x00, 0x0b, 0x4f, 0x06, 0xff,
+        0xff, 0xf9, 0x30, 0x00, 0x1c, 0x16, 0xf8, 0x0e, 0x00, 0x0f, 0x90, 0x00, 0x12, 0x16, 0xec,
+        0x0e, 0x00, 0x4f, 0xd3, 0xff, 0xff, 0x38, 0x30, 0x00, 0x0b, 0x46, 0x32, 0xff, 0xff, 0xd1,
+        0x0e, 0x00, 0x4f, 0xac, 0xff, 0xff, 0x5b, 0x30, 0x00, 0x0b, 0x19, 0x5d, 0x50, 0x01, 0x4f,
+        0x74, 0xff, 0xff, 0x98, 0x30, 0x00, 0x0b, 0x19, 0x9c, 0xb0, 0x01, 0x49, 0x31, 0xff, 0xff,
+        0xe7, 0x10, 0x02, 0x0c, 0x30, 0x00, 0x00, 0x10, 0x02, 0x17, 0x2f, 0x10, 0x00, 0x39, 0xd7,
+        0xff, 0xff, 0xd5, 0x03, 0x0c, 0x30, 0x00, 0x1a, 0x52, 0x70, 0x02, 0x00, 0xd0, 0x02, 0x18,
+        0xc9, 0xd0, 0x02, 0x0b, 0x30, 0x00, 0x58, 0x02, 0xcc, 0xff, 0xff, 0x72, 0x30, 0x00, 0x48,
+        0x0c, 0xec, 0xff, 0xff, 0x05, 0x04, 0x0b, 0x30, 0x00, 0x4a, 0x63, 0xff, 0xff, 0xeb, 0xe9,
+        0x04, 0x56, 0x70, 0xff, 0xff, 0xef, 0x21, 0x0f, 0x00, 0x46, 0x44, 0x88, 0x88, 0x44, 0x0e,
+        0x00, 0x59, 0x23, 0xf0, 0xff, 0xff, 0x6e, 0x2f, 0x00, 0x6f, 0x00, 0x04, 0xce, 0xff, 0xff,
+        0xd0, 0xf0, 0x03, 0x05, 0x49, 0xd2, 0xff, 0xff, 0xcd, 0x0f, 0x01, 0x00, 0x0c, 0x05, 0x4f,
+        0xf3, 0xff, 0xff, 0xc3, 0x31, 0x00, 0x02, 0x10, 0x10, 0x50, 0x04, 0x1d, 0x26, 0x17, 0x00,
+        0x57, 0x4f, 0xfc, 0xff, 0xff, 0xd0, 0x93, 0x00, 0x04, 0x01, 0x00, 0x59, 0x23, 0xd1, 0xff,
+        0xff, 0xfc, 0xad, 0x03, 0x03, 0x01, 0x00, 0x00, 0x10, 0x05, 0x2c, 0xef, 0x60, 0x10, 0x05,
+        0x6f, 0x63, 0xf0, 0xff, 0xff, 0xfc, 0x5f, 0x2f, 0x00, 0x00, 0x97, 0x00, 0x00, 0x4f, 0xf3,
+        0xff, 0xff, 0xff, 0xca, 0x51, 0xaa, 0x00, 0x3f, 0x04, 0x52, 0xcc, 0x70, 0x05, 0x07, 0x40,
+        0x00, 0x00, 0x27, 0xce, 0xc0, 0x05, 0xc0, 0xe9, 0x9b, 0x5c, 0x32, 0x14, 0x05, 0x05, 0x14,
+        0x32, 0x5d, 0x9c, 0xea, 0x10, 0x00, 0x2f, 0xcd, 0x27, 0x2f, 0x00, 0x04, 0x5c, 0x00, 0x00,
+        0x04, 0x6f, 0xeb, 0x30, 0x06, 0x2f, 0xeb, 0x6e, 0x30, 0x06, 0x07, 0x00, 0xb9, 0x01, 0x28,
+        0x72, 0xd6, 0x2e, 0x00, 0x0f, 0x90, 0x06, 0x0c, 0x01, 0x01, 0x00, 0x40, 0x30, 0x73, 0xab,
+        0xd1, 0xf0, 0x06, 0x1f, 0xd1, 0xf0, 0x06, 0x11, 0x0f, 0x01, 0x00, 0xc9, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x00,
 
 };
 
@@ -123,11 +74,11 @@ const lv_image_dsc_t icon_info = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 48,
                  .h = 48,
-                 .stride = 96,
+                 .stride = 48,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_info_map),
@@ -20,45 +20,26 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_INFO_24 uint8_t
     icon_info_24_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0x3d, 0x02, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0x5e, 0x26, 0xe3, 0x18, 0x02, 0x00, 0x0f, 0x7d, 0x00, 0x0b, 0x26, 0x00, 0x00, 0x2a,
-        0x00, 0x06, 0x02, 0x00, 0x2f, 0x00, 0x00, 0x36, 0x00, 0x03, 0x22, 0x04, 0x21, 0x24, 0x00,
-        0xc2, 0x04, 0x21, 0x04, 0x21, 0xc3, 0x18, 0xc3, 0x18, 0x04, 0x21, 0x04, 0x21, 0x14, 0x00,
-        0x2e, 0x04, 0x21, 0x32, 0x00, 0x02, 0x1a, 0x00, 0x0c, 0x4e, 0x00, 0x22, 0x00, 0x00, 0x18,
-        0x00, 0x0c, 0x32, 0x00, 0x04, 0x8a, 0x00, 0x0e, 0x48, 0x00, 0x04, 0xd0, 0x00, 0x0a, 0x96,
-        0x00, 0x0c, 0x44, 0x00, 0x28, 0x04, 0x21, 0x52, 0x00, 0x02, 0x64, 0x00, 0x08, 0x4c, 0x00,
-        0x48, 0xe3, 0x18, 0x04, 0x21, 0x42, 0x00, 0x0a, 0x20, 0x00, 0x02, 0x7e, 0x00, 0x06, 0x30,
-        0x00, 0x0c, 0x5e, 0x00, 0x02, 0x12, 0x00, 0x06, 0x20, 0x00, 0x0c, 0x62, 0x00, 0x02, 0x18,
-        0x01, 0x08, 0x20, 0x00, 0x0c, 0x02, 0x00, 0x0a, 0x92, 0x00, 0x68, 0xe3, 0x18, 0xe3, 0x18,
-        0xc3, 0x18, 0x24, 0x00, 0x0a, 0x90, 0x00, 0x48, 0xff, 0xff, 0xa2, 0x10, 0x12, 0x00, 0x6f,
-        0xe3, 0x18, 0xe3, 0x18, 0xa2, 0x10, 0x30, 0x00, 0x09, 0x11, 0x24, 0x9c, 0x01, 0x04, 0x22,
-        0x00, 0x0f, 0xc0, 0x00, 0x1d, 0x2a, 0x04, 0x21, 0x4e, 0x01, 0x02, 0x42, 0x00, 0x04, 0x4e,
-        0x00, 0x0e, 0xf0, 0x00, 0x0f, 0x50, 0x01, 0x1d, 0x02, 0x50, 0x00, 0x08, 0xa2, 0x01, 0x0a,
-        0x80, 0x01, 0x0f, 0x40, 0x01, 0x01, 0x0f, 0x14, 0x00, 0x01, 0x02, 0x02, 0x00, 0x0f, 0x1a,
-        0x00, 0x03, 0x02, 0x62, 0x01, 0x0a, 0xe6, 0x01, 0x04, 0xda, 0x01, 0x0a, 0x7c, 0x00, 0x04,
-        0x02, 0x00, 0x02, 0x32, 0x00, 0x02, 0xd0, 0x02, 0x44, 0xa2, 0x10, 0xa2, 0x10, 0xce, 0x02,
-        0x0f, 0x2e, 0x00, 0x03, 0x02, 0x02, 0x00, 0x02, 0x7c, 0x00, 0x0a, 0x02, 0x00, 0x02, 0x1a,
-        0x00, 0x0f, 0x02, 0x00, 0x07, 0x08, 0x2e, 0x00, 0x0f, 0x26, 0x00, 0x07, 0x0f, 0x02, 0x00,
-        0x45, 0x1f, 0x00, 0x01, 0x00, 0x25, 0x6b, 0x21, 0x5a, 0x72, 0x72, 0x5b, 0x22, 0x3e, 0x00,
-        0x32, 0x01, 0x52, 0xcd, 0xa9, 0x00, 0x37, 0xce, 0x52, 0x01, 0x1b, 0x00, 0xe5, 0x0f, 0xb6,
-        0xff, 0xc9, 0x67, 0x26, 0x0a, 0x0a, 0x26, 0x67, 0xca, 0xff, 0xb6, 0x0f, 0x19, 0x00, 0x43,
-        0x10, 0xd3, 0xf6, 0x5e, 0x27, 0x00, 0x44, 0x01, 0x60, 0xf7, 0xd3, 0x19, 0x00, 0x45, 0x01,
-        0xb6, 0xf6, 0x3b, 0x24, 0x00, 0x43, 0x00, 0x3b, 0xf7, 0xb5, 0x24, 0x00, 0x31, 0x52, 0xff,
-        0x5f, 0x17, 0x00, 0x21, 0x1f, 0x1f, 0x07, 0x00, 0x31, 0x61, 0xff, 0x51, 0x08, 0x00, 0x32,
-        0x00, 0xce, 0xca, 0x21, 0x00, 0x21, 0xb4, 0xb4, 0x10, 0x00, 0x31, 0x01, 0xcb, 0xcd, 0x08,
-        0x00, 0x31, 0x22, 0xff, 0x67, 0x08, 0x00, 0x32, 0x00, 0x19, 0x19, 0x08, 0x00, 0xa2, 0x68,
-        0xff, 0x21, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xff, 0x25, 0x10, 0x00, 0x04, 0x02, 0x00, 0xa2,
-        0x27, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x74, 0xff, 0x0a, 0x12, 0x00, 0x22, 0xbf, 0xbf,
-        0x08, 0x00, 0xa2, 0x0b, 0xff, 0x73, 0x00, 0x00, 0x00, 0x00, 0x73, 0xff, 0x0b, 0x10, 0x00,
-        0x04, 0x18, 0x00, 0xaa, 0x0d, 0xff, 0x72, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xff, 0x26, 0x18,
-        0x00, 0x03, 0x48, 0x00, 0x14, 0x20, 0x78, 0x00, 0x04, 0x30, 0x00, 0x12, 0x69, 0x78, 0x00,
-        0x23, 0x00, 0xcd, 0xa8, 0x00, 0x03, 0x18, 0x00, 0x32, 0x01, 0xcb, 0xce, 0x40, 0x00, 0x31,
-        0x51, 0xff, 0x60, 0x09, 0x00, 0x21, 0x8c, 0x8c, 0x07, 0x00, 0x14, 0x62, 0xd8, 0x00, 0x2a,
-        0x00, 0xb5, 0x08, 0x01, 0x02, 0xdf, 0x00, 0x72, 0x00, 0x00, 0x00, 0x0f, 0xd3, 0xf7, 0x61,
-        0xf3, 0x00, 0x36, 0x00, 0x01, 0x62, 0x38, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x0f, 0xb5, 0xff,
-        0xcb, 0x68, 0x28, 0x0b, 0x0b, 0x28, 0x68, 0xcc, 0xff, 0xb4, 0x4f, 0x01, 0x01, 0x02, 0x00,
-        0x22, 0x51, 0xce, 0x98, 0x01, 0x13, 0xcd, 0x34, 0x01, 0x06, 0x02, 0x00, 0x51, 0x21, 0x5a,
-        0x72, 0x72, 0x5a, 0x19, 0x01, 0x0f, 0x02, 0x00, 0x1d, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0x1c, 0x01, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0x25, 0x6b, 0x21, 0x5a, 0x72, 0x72, 0x5b, 0x22, 0x15, 0x00, 0x41, 0x01, 0x52, 0xcd,
+        0xff, 0x01, 0x00, 0x37, 0xce, 0x52, 0x01, 0x17, 0x00, 0xe5, 0x0f, 0xb6, 0xff, 0xc9, 0x67,
+        0x26, 0x0a, 0x0a, 0x26, 0x67, 0xca, 0xff, 0xb6, 0x0f, 0x17, 0x00, 0x43, 0x10, 0xd3, 0xf6,
+        0x5e, 0x27, 0x00, 0x44, 0x01, 0x60, 0xf7, 0xd3, 0x19, 0x00, 0x46, 0x01, 0xb6, 0xf6, 0x3b,
+        0x3c, 0x00, 0x33, 0x3b, 0xf7, 0xb5, 0x24, 0x00, 0x31, 0x52, 0xff, 0x5f, 0x08, 0x00, 0x21,
+        0x1f, 0x1f, 0x07, 0x00, 0x32, 0x61, 0xff, 0x51, 0x18, 0x00, 0x22, 0xce, 0xca, 0x21, 0x00,
+        0x22, 0xb4, 0xb4, 0x3f, 0x00, 0x21, 0xcb, 0xcd, 0x08, 0x00, 0x32, 0x22, 0xff, 0x67, 0x20,
+        0x00, 0x22, 0x19, 0x19, 0x08, 0x00, 0x30, 0x68, 0xff, 0x21, 0x07, 0x00, 0x36, 0x5b, 0xff,
+        0x25, 0x5e, 0x00, 0x00, 0x01, 0x00, 0x30, 0x27, 0xff, 0x5a, 0x07, 0x00, 0x32, 0x74, 0xff,
+        0x0a, 0x10, 0x00, 0x22, 0xbf, 0xbf, 0x08, 0x00, 0x30, 0x0b, 0xff, 0x73, 0x07, 0x00, 0x3a,
+        0x73, 0xff, 0x0b, 0x18, 0x00, 0x30, 0x0d, 0xff, 0x72, 0x07, 0x00, 0x3a, 0x5a, 0xff, 0x26,
+        0x18, 0x00, 0x03, 0x48, 0x00, 0x14, 0x20, 0x78, 0x00, 0x04, 0x18, 0x00, 0x12, 0x69, 0x78,
+        0x00, 0x23, 0x00, 0xcd, 0xa8, 0x00, 0x03, 0x18, 0x00, 0x32, 0x01, 0xcb, 0xce, 0x20, 0x00,
+        0x31, 0x51, 0xff, 0x60, 0x08, 0x00, 0x21, 0x8c, 0x8c, 0x07, 0x00, 0x14, 0x62, 0xd8, 0x00,
+        0x2a, 0x00, 0xb5, 0x08, 0x01, 0x02, 0xdf, 0x00, 0x00, 0x4f, 0x01, 0x34, 0xd3, 0xf7, 0x61,
+        0x38, 0x01, 0x16, 0x62, 0x38, 0x01, 0xf6, 0x00, 0x00, 0x00, 0x0f, 0xb5, 0xff, 0xcb, 0x68,
+        0x28, 0x0b, 0x0b, 0x28, 0x68, 0xcc, 0xff, 0xb4, 0x17, 0x00, 0x00, 0x64, 0x00, 0x12, 0xce,
+        0x98, 0x01, 0x14, 0xcd, 0x5c, 0x00, 0x05, 0x01, 0x00, 0x00, 0xc8, 0x01, 0x12, 0x5a, 0xa1,
+        0x00, 0x0f, 0x01, 0x00, 0x1c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
 
 };
 
@@ -66,11 +47,11 @@ const lv_image_dsc_t icon_info_24 = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 24,
                  .h = 24,
-                 .stride = 48,
+                 .stride = 24,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_info_24_map),
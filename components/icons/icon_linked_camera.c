@@ -20,104 +20,47 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_LINKED_CAMERA uint8_t
     icon_linked_camera_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0xad, 0x05, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0xff, 0x4b, 0xcf, 0xe3, 0x18, 0xe3, 0x18, 0x04, 0x21, 0xe3, 0x18, 0xe3, 0x18, 0x00,
-        0x00, 0x69, 0x01, 0x41, 0x28, 0xe3, 0x18, 0x02, 0x00, 0x0f, 0x62, 0x00, 0x3f, 0x06, 0xc0,
-        0x00, 0x02, 0x02, 0x00, 0x2f, 0x45, 0x29, 0x64, 0x00, 0x3f, 0x00, 0x82, 0x02, 0x15, 0xc3,
-        0xc8, 0x00, 0x0f, 0x62, 0x00, 0x1f, 0x02, 0x9a, 0x00, 0x0e, 0x02, 0x00, 0x22, 0x04, 0x21,
-        0x5c, 0x00, 0x04, 0x02, 0x00, 0x04, 0x22, 0x00, 0x04, 0x10, 0x00, 0x0f, 0x02, 0x00, 0x13,
-        0x04, 0x36, 0x00, 0x0e, 0x02, 0x00, 0x26, 0x04, 0x21, 0x1e, 0x00, 0x02, 0x4c, 0x00, 0x04,
-        0x24, 0x00, 0x02, 0x0e, 0x00, 0x0f, 0x02, 0x00, 0x11, 0x04, 0x1e, 0x02, 0x0f, 0x02, 0x00,
-        0x01, 0x08, 0x60, 0x00, 0x04, 0xcc, 0x00, 0x02, 0x28, 0x00, 0x0f, 0x4c, 0x02, 0x15, 0x06,
-        0x56, 0x01, 0x0f, 0x94, 0x00, 0x05, 0x02, 0x9c, 0x02, 0x02, 0x02, 0x00, 0x08, 0x88, 0x01,
-        0x0f, 0xbc, 0x00, 0x03, 0x02, 0x28, 0x00, 0x0f, 0x02, 0x00, 0x01, 0x0f, 0x30, 0x00, 0x03,
-        0x02, 0x02, 0x00, 0x22, 0x04, 0x21, 0x66, 0x00, 0x11, 0x24, 0x90, 0x01, 0x02, 0x3e, 0x00,
-        0x02, 0x1a, 0x00, 0x0a, 0x02, 0x00, 0x02, 0x1a, 0x00, 0x0e, 0x02, 0x00, 0x04, 0xfc, 0x00,
-        0x0f, 0x02, 0x00, 0x07, 0x04, 0x34, 0x00, 0x00, 0xcc, 0x04, 0x02, 0x0c, 0x00, 0x0f, 0x2c,
-        0x00, 0x01, 0x02, 0x1a, 0x00, 0x0e, 0x02, 0x00, 0x0f, 0x2c, 0x00, 0x01, 0x0c, 0x02, 0x00,
-        0x02, 0x36, 0x00, 0x0f, 0x60, 0x00, 0x13, 0x0c, 0x3c, 0x00, 0x0f, 0x02, 0x00, 0x11, 0x24,
-        0x04, 0x21, 0xe8, 0x00, 0x06, 0x6a, 0x00, 0x0c, 0x02, 0x00, 0x0f, 0x1a, 0x00, 0x07, 0x0f,
-        0x02, 0x00, 0x33, 0x0f, 0x60, 0x00, 0x33, 0x4f, 0x04, 0x21, 0x04, 0x21, 0xb2, 0x01, 0x03,
-        0x0f, 0x60, 0x00, 0x0f, 0x02, 0x3c, 0x00, 0x0f, 0x3e, 0x00, 0x03, 0x04, 0x02, 0x00, 0x0f,
-        0x46, 0x00, 0x07, 0x0f, 0x1a, 0x00, 0x07, 0x04, 0x1c, 0x00, 0x0a, 0x02, 0x00, 0x04, 0x52,
-        0x00, 0x0a, 0x02, 0x00, 0x02, 0x24, 0x00, 0x0a, 0x14, 0x00, 0x02, 0x02, 0x00, 0x0f, 0x1a,
-        0x00, 0x0d, 0x0e, 0x02, 0x00, 0x02, 0x38, 0x00, 0x0a, 0x02, 0x00, 0x02, 0x26, 0x00, 0x0a,
-        0x14, 0x00, 0x02, 0x02, 0x00, 0x0f, 0x1a, 0x00, 0x05, 0x02, 0x18, 0x00, 0x0f, 0x02, 0x00,
-        0x03, 0x02, 0x3a, 0x00, 0x08, 0x02, 0x00, 0x02, 0x28, 0x00, 0x08, 0x12, 0x00, 0x04, 0x02,
-        0x00, 0x0f, 0x1a, 0x00, 0x03, 0x02, 0x16, 0x00, 0x02, 0x02, 0x00, 0x02, 0x7a, 0x01, 0x02,
-        0xae, 0x03, 0x04, 0x02, 0x00, 0x04, 0x3e, 0x00, 0x04, 0x02, 0x00, 0x02, 0x18, 0x00, 0x04,
-        0x0e, 0x00, 0x08, 0x02, 0x00, 0x0f, 0x1a, 0x00, 0x03, 0x02, 0x16, 0x00, 0x0c, 0x82, 0x04,
-        0x02, 0x12, 0x00, 0x0c, 0x16, 0x00, 0x06, 0xaa, 0x01, 0x02, 0x0c, 0x00, 0x0a, 0x02, 0x00,
-        0x0f, 0x30, 0x00, 0x09, 0x0e, 0x32, 0x00, 0x02, 0x2e, 0x00, 0x0f, 0x18, 0x00, 0x05, 0x0a,
-        0x5a, 0x00, 0x02, 0x02, 0x00, 0x02, 0x32, 0x00, 0x02, 0x0c, 0x00, 0x04, 0x02, 0x00, 0x04,
-        0x0c, 0x01, 0x02, 0x1a, 0x01, 0x08, 0x02, 0x00, 0x02, 0x2e, 0x00, 0x04, 0xd6, 0x04, 0x06,
-        0x02, 0x00, 0x02, 0x18, 0x00, 0x06, 0x10, 0x00, 0x06, 0x02, 0x00, 0x0f, 0x1a, 0x00, 0x01,
-        0x02, 0x14, 0x00, 0x0f, 0x30, 0x00, 0x09, 0x0c, 0x7a, 0x00, 0x02, 0x32, 0x00, 0x06, 0x56,
-        0x00, 0x06, 0x02, 0x00, 0x0f, 0x1a, 0x00, 0x01, 0x04, 0xc0, 0x00, 0x06, 0x26, 0x00, 0x06,
-        0x02, 0x00, 0x02, 0x30, 0x00, 0x0f, 0x60, 0x00, 0x33, 0x0c, 0x46, 0x00, 0x04, 0x5e, 0x00,
-        0x0f, 0x20, 0x01, 0x2d, 0x06, 0x48, 0x00, 0x06, 0xb8, 0x00, 0x02, 0x02, 0x00, 0x02, 0xbe,
-        0x00, 0x0f, 0x18, 0x00, 0x05, 0x02, 0x24, 0x00, 0x0a, 0x02, 0x00, 0x02, 0x32, 0x00, 0x0a,
-        0x14, 0x00, 0x04, 0x16, 0x00, 0x0c, 0x4a, 0x00, 0x02, 0x12, 0x00, 0x0c, 0x16, 0x00, 0x06,
-        0x30, 0x00, 0x02, 0x0c, 0x00, 0x0a, 0x02, 0x00, 0x0f, 0x30, 0x00, 0x09, 0x04, 0x02, 0x00,
-        0x06, 0x42, 0x00, 0x02, 0x02, 0x00, 0x0f, 0x38, 0x01, 0x05, 0x0a, 0x5a, 0x00, 0x02, 0x02,
-        0x00, 0x02, 0x32, 0x00, 0x02, 0x0c, 0x00, 0x08, 0x02, 0x00, 0x02, 0x18, 0x00, 0x02, 0x02,
-        0x00, 0x04, 0x6c, 0x07, 0x04, 0x02, 0x00, 0x08, 0x28, 0x00, 0x02, 0x02, 0x00, 0x02, 0x1a,
-        0x00, 0x02, 0x0c, 0x00, 0x0a, 0x02, 0x00, 0x0f, 0x1a, 0x00, 0x0d, 0x0e, 0x02, 0x00, 0x0a,
-        0x40, 0x00, 0x02, 0x02, 0x00, 0x02, 0x26, 0x00, 0x02, 0x0c, 0x00, 0x0a, 0x02, 0x00, 0x0f,
-        0x1a, 0x00, 0x07, 0x04, 0x1c, 0x00, 0x08, 0x02, 0x00, 0x0e, 0x1a, 0x01, 0x02, 0x02, 0x00,
-        0x02, 0x24, 0x00, 0x02, 0x0c, 0x00, 0x0a, 0x02, 0x00, 0x0f, 0x1a, 0x00, 0x07, 0x04, 0x02,
-        0x00, 0x11, 0x24, 0x9c, 0x06, 0x02, 0x88, 0x08, 0x0f, 0x02, 0x00, 0x05, 0x0f, 0x46, 0x00,
-        0x07, 0x0f, 0x1a, 0x00, 0x07, 0x0f, 0x02, 0x00, 0x19, 0x0f, 0x46, 0x00, 0x07, 0x0f, 0x1a,
-        0x00, 0x07, 0x0f, 0x02, 0x00, 0x19, 0x0f, 0x46, 0x00, 0x07, 0x02, 0x1a, 0x00, 0x0f, 0x3c,
-        0x01, 0x03, 0x0f, 0x02, 0x00, 0x15, 0x0f, 0x44, 0x00, 0x09, 0x04, 0x1c, 0x00, 0x0f, 0x02,
-        0x00, 0x31, 0x0f, 0x90, 0x00, 0x01, 0x0f, 0x58, 0x00, 0x31, 0x04, 0x02, 0x00, 0x0f, 0x60,
-        0x00, 0x01, 0x0f, 0x62, 0x00, 0x37, 0x0f, 0x5e, 0x00, 0x03, 0x0f, 0x02, 0x00, 0xff, 0xff,
-        0x85, 0x1f, 0x00, 0x01, 0x00, 0x9b, 0x6f, 0x74, 0xe8, 0xd2, 0x98, 0x4c, 0x04, 0xb4, 0x00,
-        0x17, 0x10, 0x76, 0xe0, 0x12, 0x2f, 0xd9, 0x54, 0x31, 0x00, 0x16, 0x9f, 0x19, 0x49, 0x68,
-        0xaf, 0xf7, 0xff, 0xff, 0x9c, 0x06, 0x32, 0x00, 0x16, 0x7f, 0x00, 0x00, 0x1c, 0xa0, 0xff,
-        0xff, 0xbb, 0x31, 0x00, 0x06, 0x26, 0x23, 0xe6, 0xf9, 0x03, 0x13, 0x89, 0x56, 0x00, 0x43,
-        0x63, 0xf9, 0xff, 0x9c, 0x0b, 0x00, 0x0c, 0x02, 0x00, 0x26, 0x19, 0xdd, 0x2f, 0x00, 0xec,
-        0xff, 0x89, 0x00, 0x4e, 0x9b, 0x5e, 0x09, 0x00, 0x00, 0x00, 0x62, 0xff, 0xff, 0x53, 0x2a,
-        0x00, 0x01, 0x02, 0x00, 0x27, 0x11, 0xd2, 0x2f, 0x00, 0xef, 0xff, 0x89, 0x00, 0x76, 0xff,
-        0xff, 0xe4, 0x3e, 0x00, 0x00, 0x00, 0xa0, 0xff, 0xd8, 0x26, 0x01, 0x01, 0x61, 0x0a, 0xc5,
-        0xff, 0xff, 0xfa, 0x4a, 0x3a, 0x00, 0x02, 0x02, 0x00, 0xc2, 0x3f, 0xa0, 0xf2, 0xff, 0xf8,
-        0x3c, 0x00, 0x00, 0x1c, 0xf7, 0xff, 0x4b, 0x12, 0x00, 0x01, 0x02, 0x00, 0x34, 0x42, 0xc7,
-        0xf6, 0x58, 0x00, 0x21, 0xfe, 0x5c, 0x12, 0x00, 0x05, 0x02, 0x00, 0xa5, 0x18, 0xca, 0xff,
-        0xde, 0x07, 0x00, 0x00, 0xb0, 0xff, 0x97, 0x13, 0x00, 0x34, 0x00, 0x42, 0xfd, 0x2e, 0x00,
-        0x36, 0xff, 0xff, 0x70, 0x17, 0x00, 0x02, 0x02, 0x00, 0x92, 0x19, 0xf2, 0xff, 0x56, 0x00,
-        0x00, 0x6a, 0xff, 0xd0, 0x0f, 0x00, 0x56, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x2f, 0x00, 0x12,
-        0x85, 0x12, 0x00, 0x08, 0x02, 0x00, 0x86, 0xa3, 0xff, 0x95, 0x00, 0x00, 0x49, 0xff, 0xe8,
-        0x14, 0x00, 0x46, 0xf6, 0xff, 0xff, 0x1b, 0x0e, 0x00, 0x0c, 0x02, 0x00, 0x86, 0x3e, 0x77,
-        0x50, 0x00, 0x00, 0x1a, 0x77, 0x75, 0x18, 0x00, 0x0f, 0xd8, 0x02, 0x1d, 0x0f, 0x30, 0x00,
-        0x10, 0x3f, 0x88, 0x88, 0x88, 0x60, 0x00, 0x08, 0x46, 0x17, 0x2e, 0x2e, 0x16, 0x1f, 0x00,
-        0x0d, 0x53, 0x00, 0x0a, 0x60, 0x00, 0x30, 0x09, 0x75, 0xd5, 0x76, 0x15, 0x32, 0xd5, 0x75,
-        0x09, 0x2b, 0x00, 0x01, 0x02, 0x00, 0x09, 0x23, 0x00, 0x09, 0x0d, 0x00, 0x15, 0x2c, 0x12,
-        0x02, 0x21, 0xdd, 0x2b, 0x2b, 0x00, 0x01, 0x02, 0x00, 0x09, 0x23, 0x00, 0x08, 0x0d, 0x00,
-        0xd6, 0x2c, 0xf0, 0xff, 0xff, 0xff, 0xf4, 0xd1, 0xd1, 0xf5, 0xff, 0xff, 0xff, 0xf0, 0x31,
-        0x00, 0x08, 0x23, 0x00, 0x08, 0x0d, 0x00, 0xf5, 0x00, 0x09, 0xde, 0xff, 0xff, 0xef, 0x63,
-        0x08, 0x00, 0x00, 0x08, 0x64, 0xef, 0xff, 0xff, 0xdc, 0x93, 0x00, 0x07, 0x23, 0x00, 0x09,
-        0x0d, 0x00, 0x43, 0x75, 0xff, 0xff, 0xef, 0x56, 0x00, 0x51, 0x2b, 0xef, 0xff, 0xff, 0x74,
-        0x8d, 0x00, 0x0a, 0x53, 0x00, 0x09, 0x30, 0x00, 0x41, 0xd5, 0xff, 0xff, 0x63, 0x21, 0x00,
-        0x71, 0x00, 0x00, 0x00, 0x65, 0xff, 0xff, 0xd4, 0x09, 0x00, 0x0f, 0x30, 0x00, 0x07, 0x51,
-        0x17, 0xff, 0xff, 0xf4, 0x08, 0x21, 0x00, 0x81, 0x00, 0x00, 0x00, 0x09, 0xf5, 0xff, 0xff,
-        0x15, 0x0a, 0x00, 0x09, 0x53, 0x00, 0x08, 0x0d, 0x00, 0x43, 0x31, 0xff, 0xff, 0xcf, 0x22,
-        0x00, 0x71, 0x00, 0x00, 0x00, 0xd0, 0xff, 0xff, 0x2f, 0x09, 0x00, 0x08, 0x23, 0x00, 0x09,
-        0x6d, 0x00, 0x28, 0x30, 0xff, 0x88, 0x02, 0x41, 0xd1, 0xff, 0xff, 0x2e, 0x21, 0x00, 0x0f,
-        0x30, 0x00, 0x06, 0x46, 0x16, 0xff, 0xff, 0xf5, 0x90, 0x00, 0x1f, 0xf6, 0x90, 0x00, 0x0e,
-        0x53, 0x00, 0xd5, 0xff, 0xff, 0x64, 0x53, 0x00, 0x54, 0x00, 0x66, 0xff, 0xff, 0xd3, 0x0c,
-        0x00, 0x0f, 0x50, 0x01, 0x14, 0x1f, 0x73, 0x30, 0x00, 0x0d, 0xf5, 0x00, 0x09, 0xdd, 0xff,
-        0xff, 0xef, 0x65, 0x09, 0x00, 0x00, 0x09, 0x66, 0xf0, 0xff, 0xff, 0xdb, 0x9c, 0x00, 0x0f,
-        0x60, 0x00, 0x05, 0xaf, 0x00, 0x2b, 0xf0, 0xff, 0xff, 0xff, 0xf5, 0xd2, 0xd2, 0xf6, 0x10,
-        0x02, 0x13, 0x44, 0x00, 0x00, 0x2b, 0xdc, 0x9e, 0x03, 0x13, 0xdb, 0xe9, 0x01, 0x0a, 0x43,
-        0x01, 0x0c, 0x0d, 0x00, 0x40, 0x00, 0x09, 0x74, 0xd4, 0x46, 0x18, 0x25, 0xd3, 0x73, 0x8d,
-        0x00, 0x0c, 0x23, 0x00, 0x09, 0x9d, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x15, 0x2e, 0x2e,
-        0xd9, 0x01, 0x03, 0x02, 0x00, 0x09, 0x23, 0x00, 0x09, 0x0d, 0x00, 0x0f, 0x02, 0x00, 0x03,
-        0x09, 0x23, 0x00, 0x09, 0x0d, 0x00, 0x0f, 0x02, 0x00, 0x03, 0x09, 0x23, 0x00, 0x0f, 0x50,
-        0x04, 0x0b, 0x82, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0xf6, 0x0a, 0x00, 0x0b, 0xb0,
-        0x04, 0x0f, 0x02, 0x00, 0x07, 0x12, 0xc6, 0x2c, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x41,
-        0x10, 0x05, 0x0f, 0x02, 0x00, 0x05, 0x22, 0xfd, 0x41, 0x2c, 0x00, 0x01, 0x02, 0x00, 0x3f,
-        0x42, 0xc6, 0xf6, 0x28, 0x00, 0x05, 0x02, 0x02, 0x00, 0x28, 0xf6, 0xc6, 0x2f, 0x00, 0x0f,
-        0x02, 0x00, 0xff, 0x34, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0x58, 0x02, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0x9b, 0x6f, 0x74, 0xe8, 0xd2, 0x98, 0x4c, 0x04, 0x29, 0x00, 0x10, 0x03, 0x01, 0x00,
+        0x7f, 0x76, 0xff, 0xff, 0xff, 0xff, 0xd9, 0x54, 0x2a, 0x00, 0x10, 0x02, 0x01, 0x00, 0x9f,
+        0x19, 0x49, 0x68, 0xaf, 0xf7, 0xff, 0xff, 0x9c, 0x06, 0x2c, 0x00, 0x10, 0x04, 0x01, 0x00,
+        0x5f, 0x1c, 0xa0, 0xff, 0xff, 0xbb, 0x31, 0x00, 0x06, 0x20, 0x23, 0xe6, 0x83, 0x00, 0x02,
+        0x01, 0x00, 0x13, 0x89, 0x14, 0x00, 0x4f, 0x63, 0xf9, 0xff, 0x9c, 0x2f, 0x00, 0x04, 0x26,
+        0x19, 0xdd, 0x2f, 0x00, 0xef, 0xff, 0x89, 0x00, 0x4e, 0x9b, 0x5e, 0x09, 0x00, 0x00, 0x00,
+        0x62, 0xff, 0xff, 0x53, 0x2f, 0x00, 0x02, 0x27, 0x11, 0xd2, 0x2f, 0x00, 0x20, 0xff, 0x89,
+        0xf0, 0x00, 0x8f, 0xe4, 0x3e, 0x00, 0x00, 0x00, 0xa0, 0xff, 0xd8, 0x26, 0x01, 0x01, 0x67,
+        0x0a, 0xc5, 0xff, 0xff, 0xfa, 0x4a, 0x11, 0x00, 0xc7, 0x3f, 0xa0, 0xf2, 0xff, 0xf8, 0x3c,
+        0x00, 0x00, 0x1c, 0xf7, 0xff, 0x4b, 0x17, 0x00, 0x34, 0x42, 0xc7, 0xf6, 0x54, 0x00, 0x2a,
+        0xfe, 0x5c, 0x43, 0x00, 0xa7, 0x18, 0xca, 0xff, 0xde, 0x07, 0x00, 0x00, 0xb0, 0xff, 0x97,
+        0x2f, 0x00, 0x16, 0xfd, 0x84, 0x00, 0x1a, 0x70, 0x2f, 0x00, 0xb6, 0x00, 0x00, 0x19, 0xf2,
+        0xff, 0x56, 0x00, 0x00, 0x6a, 0xff, 0xd0, 0x13, 0x00, 0x16, 0xc7, 0x2f, 0x00, 0x1c, 0x85,
+        0x2f, 0x00, 0xa6, 0x00, 0x00, 0xa3, 0xff, 0x95, 0x00, 0x00, 0x49, 0xff, 0xe8, 0x12, 0x00,
+        0x4e, 0xf6, 0xff, 0xff, 0x1b, 0x28, 0x00, 0x04, 0x01, 0x00, 0x86, 0x3e, 0x77, 0x50, 0x00,
+        0x00, 0x1a, 0x77, 0x75, 0x12, 0x00, 0x3f, 0xff, 0xff, 0xff, 0x2f, 0x00, 0x07, 0x0f, 0x01,
+        0x00, 0x00, 0x0f, 0x30, 0x00, 0x10, 0x36, 0x88, 0x88, 0x88, 0x0d, 0x00, 0x0d, 0x30, 0x00,
+        0x4a, 0x17, 0x2e, 0x2e, 0x16, 0x12, 0x00, 0x09, 0x23, 0x00, 0x0a, 0x30, 0x00, 0x30, 0x09,
+        0x75, 0xd5, 0xfa, 0x00, 0x20, 0xd5, 0x75, 0xda, 0x01, 0x0f, 0x30, 0x00, 0x0f, 0x15, 0x2c,
+        0x12, 0x02, 0x2f, 0xdd, 0x2b, 0x30, 0x00, 0x10, 0xd6, 0x2c, 0xf0, 0xff, 0xff, 0xff, 0xf4,
+        0xd1, 0xd1, 0xf5, 0xff, 0xff, 0xff, 0xf0, 0x31, 0x00, 0x0f, 0x30, 0x00, 0x05, 0xf5, 0x00,
+        0x09, 0xde, 0xff, 0xff, 0xef, 0x63, 0x08, 0x00, 0x00, 0x08, 0x64, 0xef, 0xff, 0xff, 0xdc,
+        0x93, 0x00, 0x0f, 0x30, 0x00, 0x05, 0x43, 0x75, 0xff, 0xff, 0xef, 0x56, 0x00, 0x5f, 0x2b,
+        0xef, 0xff, 0xff, 0x74, 0x30, 0x00, 0x0d, 0x44, 0xd5, 0xff, 0xff, 0x63, 0x0c, 0x00, 0x4f,
+        0x65, 0xff, 0xff, 0xd4, 0x30, 0x00, 0x0c, 0x54, 0x17, 0xff, 0xff, 0xf4, 0x08, 0x17, 0x00,
+        0x5f, 0x09, 0xf5, 0xff, 0xff, 0x15, 0x30, 0x00, 0x0b, 0x46, 0x31, 0xff, 0xff, 0xcf, 0x18,
+        0x00, 0x4f, 0xd0, 0xff, 0xff, 0x2f, 0x30, 0x00, 0x0b, 0x28, 0x30, 0xff, 0x88, 0x02, 0x4f,
+        0xd1, 0xff, 0xff, 0x2e, 0x30, 0x00, 0x0b, 0x46, 0x16, 0xff, 0xff, 0xf5, 0x90, 0x00, 0x1f,
+        0xf6, 0x90, 0x00, 0x0e, 0x00, 0xf0, 0x00, 0x14, 0x64, 0x0c, 0x00, 0x4f, 0x66, 0xff, 0xff,
+        0xd3, 0x23, 0x00, 0x00, 0x0f, 0x50, 0x01, 0x09, 0x1f, 0x73, 0x30, 0x00, 0x0d, 0xf5, 0x00,
+        0x09, 0xdd, 0xff, 0xff, 0xef, 0x65, 0x09, 0x00, 0x00, 0x09, 0x66, 0xf0, 0xff, 0xff, 0xdb,
+        0x9c, 0x00, 0x0f, 0x10, 0x02, 0x06, 0x10, 0x2b, 0x10, 0x02, 0x30, 0xf5, 0xd2, 0xd2, 0xd1,
+        0x03, 0x0f, 0x10, 0x02, 0x10, 0x44, 0x00, 0x00, 0x2b, 0xdc, 0x70, 0x02, 0x1f, 0xdb, 0x70,
+        0x02, 0x11, 0x50, 0x00, 0x00, 0x09, 0x74, 0xd4, 0x2e, 0x00, 0x25, 0xd3, 0x73, 0x8d, 0x00,
+        0x0f, 0x30, 0x00, 0x0b, 0x64, 0x00, 0x00, 0x00, 0x15, 0x2e, 0x2e, 0x49, 0x01, 0x0f, 0x30,
+        0x00, 0x12, 0x0e, 0x01, 0x00, 0x0f, 0x30, 0x00, 0x2a, 0x0f, 0x50, 0x04, 0x0b, 0x00, 0x01,
+        0x00, 0x46, 0x1b, 0xff, 0xff, 0xf6, 0x0e, 0x00, 0x07, 0xb0, 0x04, 0x0f, 0x01, 0x00, 0x07,
+        0x16, 0xc6, 0x30, 0x00, 0x17, 0x41, 0x10, 0x05, 0x0f, 0x01, 0x00, 0x05, 0x27, 0xfd, 0x41,
+        0x6f, 0x00, 0x25, 0x42, 0xc6, 0x70, 0x05, 0x0f, 0x01, 0x00, 0x03, 0x28, 0xf6, 0xc6, 0x2f,
+        0x00, 0x0f, 0x01, 0x00, 0xff, 0x34, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
 
 };
 
@@ -125,11 +68,11 @@ const lv_image_dsc_t icon_linked_camera = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 48,
                  .h = 48,
-                 .stride = 96,
+                 .stride = 48,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_linked_camera_map),
@@ -20,43 +20,24 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_LINKED_CAMERA_24
     uint8_t icon_linked_camera_24_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0x1a, 0x02, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0x3a, 0x8f, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0x00, 0x00, 0x55, 0x00, 0x15, 0x02,
-        0x30, 0x00, 0x4f, 0xe3, 0x18, 0xe3, 0x18, 0x32, 0x00, 0x05, 0x02, 0x1e, 0x00, 0x04, 0x02,
-        0x00, 0x00, 0xae, 0x00, 0x4f, 0x24, 0x21, 0x04, 0x21, 0x32, 0x00, 0x05, 0x22, 0x00, 0x00,
-        0x1c, 0x00, 0x0a, 0x02, 0x00, 0x68, 0xff, 0xff, 0x04, 0x21, 0x04, 0x21, 0x96, 0x00, 0x08,
-        0x20, 0x00, 0x26, 0x04, 0x21, 0x7c, 0x00, 0x02, 0x3e, 0x00, 0x48, 0x04, 0x21, 0x24, 0x21,
-        0x18, 0x00, 0x08, 0x2e, 0x00, 0x02, 0x84, 0x00, 0x08, 0x02, 0x00, 0x02, 0x2a, 0x00, 0x08,
-        0x1a, 0x00, 0x57, 0xe3, 0x18, 0xe3, 0x18, 0x24, 0x56, 0x00, 0x0a, 0x02, 0x00, 0x22, 0x24,
-        0x21, 0x92, 0x00, 0x06, 0x4a, 0x00, 0x08, 0x0c, 0x00, 0x02, 0x02, 0x00, 0x08, 0x4e, 0x00,
-        0x02, 0x02, 0x00, 0x08, 0x12, 0x00, 0x0a, 0x30, 0x00, 0x08, 0x9e, 0x00, 0x02, 0x2c, 0x00,
-        0x00, 0xd4, 0x01, 0x02, 0x96, 0x00, 0x02, 0x02, 0x00, 0x08, 0x30, 0x00, 0x02, 0x2e, 0x00,
-        0x13, 0x04, 0x44, 0x01, 0x06, 0x32, 0x00, 0x0f, 0x30, 0x00, 0x09, 0x20, 0xa2, 0x10, 0x26,
-        0x02, 0x2f, 0xa2, 0x10, 0x30, 0x00, 0x0f, 0x28, 0xe3, 0x18, 0x48, 0x00, 0x02, 0x6c, 0x00,
-        0x02, 0x84, 0x00, 0x08, 0x18, 0x00, 0x06, 0x90, 0x00, 0x0f, 0x30, 0x00, 0x1d, 0x02, 0x32,
-        0x00, 0x0f, 0x90, 0x00, 0x17, 0x02, 0x30, 0x00, 0x0f, 0xf0, 0x00, 0x19, 0x04, 0x32, 0x00,
-        0x02, 0x02, 0x00, 0x02, 0xbc, 0x00, 0x02, 0x16, 0x00, 0x06, 0x28, 0x02, 0x06, 0xc0, 0x00,
-        0x04, 0x02, 0x00, 0x08, 0x1a, 0x01, 0x02, 0x02, 0x00, 0x08, 0x30, 0x00, 0x0f, 0x10, 0x02,
-        0x0b, 0x02, 0xd4, 0x02, 0x08, 0x04, 0x03, 0x02, 0x7c, 0x00, 0x0f, 0x02, 0x00, 0x0f, 0x02,
-        0x3c, 0x00, 0x02, 0x9e, 0x00, 0x02, 0xe4, 0x00, 0x0f, 0x02, 0x00, 0x05, 0x08, 0x5e, 0x00,
-        0x0f, 0x02, 0x00, 0x7b, 0x1f, 0x00, 0x01, 0x00, 0x13, 0x4f, 0x1b, 0x6f, 0x3a, 0x01, 0x2a,
-        0x00, 0x01, 0x58, 0x23, 0xac, 0xe9, 0xcc, 0x29, 0x19, 0x00, 0xc7, 0x09, 0x73, 0x77, 0x77,
-        0x77, 0x77, 0x5c, 0x00, 0x00, 0x07, 0x80, 0xed, 0x19, 0x00, 0x21, 0x04, 0xb2, 0xf7, 0x00,
-        0x72, 0xc4, 0x31, 0xb6, 0x42, 0x00, 0x80, 0xca, 0x4b, 0x00, 0x71, 0x43, 0x77, 0x77, 0x77,
-        0xb0, 0xff, 0x69, 0x3e, 0x00, 0xc1, 0x10, 0x72, 0xf1, 0x3f, 0x07, 0xea, 0x38, 0x00, 0x00,
-        0x00, 0x00, 0x43, 0x2a, 0x00, 0x11, 0x7d, 0x17, 0x00, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x72,
-        0xb2, 0x00, 0xad, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xff, 0x07, 0x11, 0x00, 0x03, 0x02,
-        0x00, 0xb3, 0x0e, 0x2a, 0x00, 0x1f, 0x19, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x12, 0x00,
-        0x23, 0x12, 0x12, 0x09, 0x00, 0x27, 0xcc, 0x66, 0x18, 0x00, 0x61, 0x45, 0xd3, 0xff, 0xff,
-        0xd3, 0x44, 0x1a, 0x00, 0x26, 0xff, 0x80, 0x18, 0x00, 0x71, 0x45, 0xfb, 0xda, 0x78, 0x79,
-        0xda, 0xfb, 0x19, 0x00, 0x08, 0x18, 0x00, 0x8b, 0xd3, 0xd9, 0x0c, 0x00, 0x00, 0x0c, 0xda,
-        0xd1, 0x18, 0x00, 0xaf, 0x12, 0xff, 0x79, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xff, 0x11, 0x18,
-        0x00, 0x13, 0x3f, 0x00, 0xd3, 0xda, 0x48, 0x00, 0x02, 0x9b, 0x00, 0x44, 0xfb, 0xda, 0x79,
-        0x79, 0xdb, 0xfb, 0x43, 0x60, 0x00, 0x71, 0x00, 0x00, 0x44, 0xd1, 0xff, 0xff, 0xd1, 0x17,
-        0x00, 0x09, 0x90, 0x00, 0x51, 0x00, 0x00, 0x00, 0x12, 0x11, 0x07, 0x00, 0x04, 0x90, 0x00,
-        0x0b, 0x08, 0x01, 0x32, 0x00, 0x00, 0x07, 0x2d, 0x01, 0x02, 0x38, 0x01, 0x09, 0x02, 0x00,
-        0x11, 0x42, 0x39, 0x00, 0x39, 0x42, 0x83, 0x88, 0x01, 0x00, 0x21, 0x83, 0x41, 0x17, 0x00,
-        0x0f, 0x02, 0x00, 0x2e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0x13, 0x4f, 0x1b, 0x6f, 0x3a, 0x01, 0x18, 0x00, 0x01, 0x58, 0x23, 0xac, 0xe9, 0xcc,
+        0x29, 0x11, 0x00, 0xc7, 0x09, 0x73, 0x77, 0x77, 0x77, 0x77, 0x5c, 0x00, 0x00, 0x07, 0x80,
+        0xed, 0x19, 0x00, 0x30, 0x04, 0xb2, 0xff, 0x01, 0x00, 0x72, 0xc4, 0x31, 0xb6, 0x42, 0x00,
+        0x80, 0xca, 0x4b, 0x00, 0x71, 0x43, 0x77, 0x77, 0x77, 0xb0, 0xff, 0x69, 0x0c, 0x00, 0x71,
+        0x10, 0x72, 0xf1, 0x3f, 0x07, 0xea, 0x38, 0x17, 0x00, 0x01, 0x2a, 0x00, 0x14, 0x7d, 0x3a,
+        0x00, 0x50, 0x72, 0xb2, 0x00, 0xad, 0x6e, 0x09, 0x00, 0x38, 0x7d, 0xff, 0x07, 0x69, 0x00,
+        0x50, 0x0e, 0x2a, 0x00, 0x1f, 0x19, 0x09, 0x00, 0x23, 0x80, 0xff, 0x12, 0x00, 0x23, 0x12,
+        0x12, 0x09, 0x00, 0x27, 0xcc, 0x66, 0x18, 0x00, 0x61, 0x45, 0xd3, 0xff, 0xff, 0xd3, 0x44,
+        0x0b, 0x00, 0x26, 0xff, 0x80, 0x18, 0x00, 0x71, 0x45, 0xfb, 0xda, 0x78, 0x79, 0xda, 0xfb,
+        0x19, 0x00, 0x08, 0x18, 0x00, 0x8b, 0xd3, 0xd9, 0x0c, 0x00, 0x00, 0x0c, 0xda, 0xd1, 0x18,
+        0x00, 0x30, 0x12, 0xff, 0x79, 0x0c, 0x00, 0x3f, 0x7a, 0xff, 0x11, 0x18, 0x00, 0x13, 0x3f,
+        0x00, 0xd3, 0xda, 0x48, 0x00, 0x02, 0x9c, 0x00, 0x44, 0xfb, 0xda, 0x79, 0x79, 0xdb, 0xfb,
+        0x43, 0x18, 0x00, 0x61, 0x00, 0x44, 0xd1, 0xff, 0xff, 0xd1, 0x17, 0x00, 0x0a, 0x18, 0x00,
+        0x30, 0x00, 0x00, 0x12, 0x5c, 0x00, 0x06, 0x18, 0x00, 0x0b, 0x08, 0x01, 0x32, 0x00, 0x00,
+        0x07, 0x2d, 0x01, 0x02, 0x38, 0x01, 0x09, 0x01, 0x00, 0x11, 0x42, 0x20, 0x00, 0x39, 0x42,
+        0x83, 0x88, 0x01, 0x00, 0x2a, 0x83, 0x41, 0x40, 0x00, 0x0f, 0x01, 0x00, 0x25, 0x50, 0x00,
+        0x00, 0x00, 0x00, 0x00,
 
 };
 
@@ -64,11 +45,11 @@ const lv_image_dsc_t icon_linked_camera_24 = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 24,
                  .h = 24,
-                 .stride = 48,
+                 .stride = 24,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_linked_camera_24_map),
@@ -20,50 +20,28 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_LOCATION_DISABLED
     uint8_t icon_location_disabled_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0x7d, 0x02, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0x32, 0x4f, 0xe3, 0x18, 0xe3, 0x18, 0x49, 0x00, 0x19, 0x0f, 0x30, 0x00, 0x0b, 0x28,
-        0x04, 0x21, 0x4e, 0x00, 0x8a, 0xa2, 0x10, 0x04, 0x21, 0xe3, 0x18, 0xe3, 0x18, 0x16, 0x00,
-        0x08, 0x02, 0x00, 0x24, 0xe3, 0x18, 0x50, 0x00, 0x02, 0x2a, 0x00, 0x08, 0x02, 0x00, 0x28,
-        0x04, 0x21, 0x2a, 0x00, 0x02, 0x02, 0x00, 0x22, 0x00, 0x00, 0x22, 0x00, 0xa2, 0xff, 0xff,
-        0x04, 0x21, 0x04, 0x21, 0xe3, 0x18, 0x04, 0x21, 0x02, 0x00, 0x02, 0x16, 0x00, 0x08, 0x7c,
-        0x00, 0x04, 0x02, 0x00, 0x06, 0x32, 0x00, 0x0a, 0x02, 0x00, 0x0f, 0x32, 0x00, 0x07, 0x04,
-        0x4e, 0x00, 0x0a, 0x30, 0x00, 0x0f, 0x4a, 0x00, 0x0b, 0x02, 0x34, 0x00, 0x0c, 0x32, 0x00,
-        0x0f, 0x16, 0x00, 0x01, 0x02, 0x14, 0x00, 0x0f, 0x96, 0x00, 0x09, 0x0a, 0xf8, 0x00, 0x02,
-        0x30, 0x00, 0x0f, 0x7e, 0x00, 0x05, 0x04, 0x1e, 0x00, 0x02, 0x02, 0x00, 0x04, 0x88, 0x00,
-        0x11, 0xc3, 0xd2, 0x01, 0x0f, 0x64, 0x00, 0x01, 0x19, 0x24, 0x90, 0x01, 0x04, 0x04, 0x01,
-        0x02, 0x30, 0x00, 0x0f, 0x32, 0x00, 0x01, 0x02, 0x60, 0x00, 0x08, 0x24, 0x02, 0x02, 0x12,
-        0x00, 0x02, 0x70, 0x00, 0x0e, 0x32, 0x00, 0x02, 0xee, 0x01, 0x04, 0x1e, 0x00, 0x00, 0xa2,
-        0x02, 0x0a, 0x30, 0x00, 0x0c, 0x32, 0x00, 0x0e, 0x30, 0x00, 0x02, 0x14, 0x00, 0x06, 0x62,
-        0x00, 0x0a, 0x32, 0x00, 0x0a, 0x1a, 0x00, 0x02, 0x02, 0x00, 0x0e, 0x44, 0x00, 0x06, 0xfa,
-        0x00, 0x0f, 0x30, 0x00, 0x01, 0x02, 0x16, 0x00, 0x0a, 0x68, 0x01, 0x06, 0x32, 0x00, 0x0f,
-        0x02, 0x00, 0x01, 0x04, 0x1e, 0x00, 0x64, 0xe3, 0x18, 0x04, 0x21, 0x00, 0x00, 0x40, 0x00,
-        0x02, 0x02, 0x00, 0x0f, 0x30, 0x00, 0x01, 0x06, 0x64, 0x00, 0x08, 0x02, 0x00, 0x02, 0x0a,
-        0x01, 0x0f, 0x32, 0x00, 0x07, 0x04, 0x2c, 0x01, 0x02, 0x2a, 0x00, 0x02, 0xfa, 0x00, 0x02,
-        0x34, 0x00, 0x02, 0x52, 0x00, 0x0f, 0x02, 0x00, 0x03, 0x0a, 0x52, 0x00, 0x2f, 0x86, 0x31,
-        0x6c, 0x03, 0x07, 0x02, 0x02, 0x00, 0x08, 0xcc, 0x01, 0x0f, 0x02, 0x00, 0x2b, 0x1f, 0x00,
-        0x01, 0x00, 0x0f, 0x2f, 0x1a, 0x1a, 0x24, 0x00, 0x03, 0x29, 0xbf, 0xbf, 0x18, 0x00, 0x21,
-        0x20, 0x66, 0x0f, 0x00, 0x61, 0x0b, 0x40, 0xd8, 0xd9, 0x48, 0x12, 0x0b, 0x00, 0x02, 0x02,
-        0x00, 0x80, 0x8d, 0xff, 0x73, 0x00, 0x00, 0x1e, 0x9c, 0xf9, 0xea, 0x04, 0x32, 0xf9, 0xad,
-        0x28, 0x15, 0x00, 0xf1, 0x04, 0x00, 0x00, 0x00, 0x03, 0xa5, 0xff, 0x73, 0x00, 0x0f, 0xba,
-        0x92, 0x40, 0x1d, 0x18, 0x37, 0x84, 0xee, 0xfa, 0x64, 0x15, 0x00, 0x05, 0x19, 0x00, 0x02,
-        0x0b, 0x00, 0x42, 0x00, 0x12, 0xb6, 0xff, 0x57, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x27,
-        0xff, 0x19, 0x00, 0x42, 0x03, 0xb5, 0xfa, 0x2c, 0x16, 0x00, 0x56, 0x00, 0x00, 0xa4, 0xf2,
-        0xaa, 0x19, 0x00, 0x33, 0x10, 0xeb, 0xb3, 0x18, 0x00, 0x56, 0x0f, 0xfc, 0x8d, 0x03, 0xa4,
-        0x19, 0x00, 0x32, 0x7d, 0xfc, 0x18, 0x19, 0x00, 0x47, 0x48, 0xff, 0x32, 0x00, 0x19, 0x00,
-        0xd7, 0x30, 0xff, 0x52, 0x00, 0x00, 0x00, 0x00, 0x22, 0xaa, 0xcf, 0xff, 0x0a, 0x00, 0x19,
-        0x00, 0xd7, 0x0d, 0xff, 0xd0, 0xaa, 0x22, 0x00, 0x00, 0x29, 0xcc, 0xe3, 0xff, 0x0a, 0x00,
-        0x19, 0x00, 0xb1, 0x0f, 0xff, 0xe3, 0xcc, 0x29, 0x00, 0x00, 0x00, 0x00, 0x57, 0xff, 0x07,
-        0x00, 0x04, 0x4b, 0x00, 0x32, 0x31, 0xff, 0x50, 0x60, 0x00, 0x31, 0x1f, 0xfe, 0x72, 0x09,
-        0x00, 0x03, 0x19, 0x00, 0x31, 0x7f, 0xfd, 0x17, 0x0f, 0x00, 0x51, 0x00, 0x00, 0xbf, 0xe2,
-        0x09, 0x0a, 0x00, 0x02, 0x19, 0x00, 0x21, 0xb4, 0xb0, 0x0d, 0x00, 0x61, 0x00, 0x00, 0x00,
-        0x39, 0xfe, 0xa1, 0x08, 0x00, 0x02, 0x7d, 0x00, 0x22, 0x11, 0x2a, 0x0d, 0x00, 0x71, 0x00,
-        0x00, 0x00, 0x7c, 0xff, 0xa0, 0x08, 0x09, 0x00, 0x26, 0x03, 0xa6, 0xc8, 0x00, 0xe7, 0x00,
-        0x00, 0x00, 0x01, 0x7e, 0xfe, 0xe0, 0x6b, 0x20, 0x01, 0x00, 0x25, 0x7b, 0xe9, 0x13, 0x01,
-        0xea, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xc6, 0xff, 0xff, 0xfc, 0xfb, 0xff, 0xff, 0xb7, 0x37,
-        0x32, 0x00, 0xe2, 0x00, 0x00, 0x26, 0x62, 0xdf, 0xde, 0x58, 0x1b, 0x00, 0x00, 0x04, 0xaa,
-        0xff, 0x6b, 0x2c, 0x00, 0x04, 0x02, 0x00, 0x03, 0xc8, 0x01, 0x34, 0x05, 0x99, 0x2b, 0x12,
-        0x00, 0x02, 0x02, 0x00, 0x22, 0x33, 0x33, 0x08, 0x00, 0x0f, 0x02, 0x00, 0x05, 0x50, 0x00,
-        0x00, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0x30, 0x01, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0x0f, 0x2f, 0x1a, 0x1a, 0x18, 0x00, 0x03, 0x29, 0xbf, 0xbf, 0x0f, 0x00, 0x21, 0x20,
+        0x66, 0x07, 0x00, 0x67, 0x0b, 0x40, 0xd8, 0xd9, 0x48, 0x12, 0x18, 0x00, 0xf5, 0x00, 0x8d,
+        0xff, 0x73, 0x00, 0x00, 0x1e, 0x9c, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xad, 0x28, 0x18,
+        0x00, 0xfa, 0x01, 0x03, 0xa5, 0xff, 0x73, 0x00, 0x0f, 0xba, 0x92, 0x40, 0x1d, 0x18, 0x37,
+        0x84, 0xee, 0xfa, 0x64, 0x19, 0x00, 0x03, 0x01, 0x00, 0x32, 0x12, 0xb6, 0xff, 0x57, 0x00,
+        0x00, 0x01, 0x00, 0x26, 0x27, 0xff, 0x19, 0x00, 0x44, 0x03, 0xb5, 0xfa, 0x2c, 0x0c, 0x00,
+        0x36, 0xa4, 0xf2, 0xaa, 0x19, 0x00, 0x33, 0x10, 0xeb, 0xb3, 0x0a, 0x00, 0x56, 0x0f, 0xfc,
+        0x8d, 0x03, 0xa4, 0x19, 0x00, 0x32, 0x7d, 0xfc, 0x18, 0x09, 0x00, 0x47, 0x48, 0xff, 0x32,
+        0x00, 0x19, 0x00, 0x30, 0x30, 0xff, 0x52, 0x07, 0x00, 0x67, 0x22, 0xaa, 0xcf, 0xff, 0x0a,
+        0x00, 0x19, 0x00, 0xa0, 0x0d, 0xff, 0xd0, 0xaa, 0x22, 0x00, 0x00, 0x29, 0xcc, 0xe3, 0x18,
+        0x00, 0x06, 0x19, 0x00, 0x50, 0x0f, 0xff, 0xe3, 0xcc, 0x29, 0x09, 0x00, 0x21, 0x57, 0xff,
+        0x07, 0x00, 0x04, 0x19, 0x00, 0x32, 0x31, 0xff, 0x50, 0x39, 0x00, 0x31, 0x1f, 0xfe, 0x72,
+        0x08, 0x00, 0x03, 0x19, 0x00, 0x33, 0x7f, 0xfd, 0x17, 0x6a, 0x00, 0x37, 0xbf, 0xe2, 0x09,
+        0x19, 0x00, 0x24, 0xb4, 0xb0, 0x9a, 0x00, 0x32, 0x39, 0xfe, 0xa1, 0x09, 0x00, 0x01, 0x19,
+        0x00, 0x24, 0x11, 0x2a, 0x18, 0x00, 0x52, 0x00, 0x7c, 0xff, 0xa0, 0x08, 0x19, 0x00, 0x16,
+        0xa6, 0xc8, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x01, 0x7e, 0xfe, 0xe0, 0x6b, 0x20, 0x01, 0x00,
+        0x25, 0x7b, 0xe9, 0x13, 0x01, 0x00, 0x01, 0x00, 0xaa, 0x3d, 0xc6, 0xff, 0xff, 0xfc, 0xfb,
+        0xff, 0xff, 0xb7, 0x37, 0x32, 0x00, 0xe9, 0x00, 0x00, 0x26, 0x62, 0xdf, 0xde, 0x58, 0x1b,
+        0x00, 0x00, 0x04, 0xaa, 0xff, 0x6b, 0x19, 0x00, 0x04, 0xc8, 0x01, 0x3a, 0x05, 0x99, 0x2b,
+        0x18, 0x00, 0x2a, 0x33, 0x33, 0x10, 0x00, 0x0c, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+        0x00,
 
 };
 
@@ -71,11 +49,11 @@ const lv_image_dsc_t icon_location_disabled = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 24,
                  .h = 24,
-                 .stride = 48,
+                 .stride = 24,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_location_disabled_map),
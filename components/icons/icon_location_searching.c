@@ -20,97 +20,52 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_LOCATION_SEARCHING
     uint8_t icon_location_searching_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0x3c, 0x05, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0xff, 0x39, 0x22, 0xe3, 0x18, 0x02, 0x00, 0x0f, 0x53, 0x01, 0x45, 0x8f, 0x04, 0x21,
-        0xe3, 0x18, 0xe3, 0x18, 0x04, 0x21, 0x60, 0x00, 0xfd, 0x42, 0x00, 0x00, 0x04, 0x21, 0x1c,
-        0x01, 0x04, 0x02, 0x00, 0x6f, 0x04, 0x21, 0xe3, 0x18, 0x00, 0x00, 0x28, 0x01, 0x31, 0x02,
-        0x4c, 0x00, 0x0f, 0x02, 0x00, 0x03, 0x2f, 0x04, 0x21, 0xec, 0x01, 0x2b, 0x02, 0x42, 0x00,
-        0x0f, 0x02, 0x00, 0x0b, 0x4f, 0x04, 0x21, 0xc3, 0x18, 0xc8, 0x00, 0x23, 0x0f, 0x58, 0x00,
-        0x01, 0x04, 0x28, 0x01, 0x0a, 0x2e, 0x01, 0x0f, 0xc6, 0x00, 0x21, 0x0a, 0x5e, 0x00, 0x0f,
-        0xa2, 0x00, 0x01, 0x0a, 0x66, 0x00, 0x0f, 0x22, 0x00, 0x01, 0x0f, 0x02, 0x00, 0x07, 0x06,
-        0x5e, 0x00, 0x0f, 0xee, 0x02, 0x0b, 0x06, 0xc8, 0x00, 0x0f, 0x28, 0x00, 0x0b, 0x0a, 0x02,
-        0x00, 0x04, 0x5e, 0x00, 0x2f, 0x04, 0x21, 0x36, 0x00, 0x0f, 0x13, 0xc3, 0xd4, 0x03, 0x0f,
-        0x26, 0x01, 0x17, 0x06, 0x94, 0x00, 0x1f, 0x24, 0xaa, 0x03, 0x12, 0x11, 0x24, 0xd6, 0x03,
-        0x0f, 0xda, 0x03, 0x17, 0x02, 0x2c, 0x00, 0x0f, 0xf2, 0x00, 0x19, 0x04, 0x32, 0x00, 0x0f,
-        0x86, 0x01, 0x11, 0x04, 0x2c, 0x00, 0x0f, 0x1a, 0x01, 0x0f, 0x08, 0x02, 0x00, 0x06, 0xf4,
-        0x00, 0x08, 0x16, 0x00, 0x0f, 0x02, 0x00, 0x01, 0x04, 0x2a, 0x00, 0x0f, 0x1c, 0x00, 0x01,
-        0x0f, 0x02, 0x00, 0x09, 0x04, 0x98, 0x00, 0x0f, 0x24, 0x00, 0x09, 0x4f, 0xff, 0xff, 0xa2,
-        0x10, 0x28, 0x00, 0x13, 0x0e, 0x02, 0x00, 0x04, 0x38, 0x00, 0x0f, 0x6e, 0x03, 0x0b, 0x02,
-        0xbe, 0x00, 0x0f, 0x1c, 0x01, 0x1b, 0x04, 0x02, 0x00, 0x04, 0x62, 0x00, 0x04, 0x10, 0x00,
-        0x0f, 0x02, 0x00, 0x01, 0x0f, 0x24, 0x00, 0x11, 0x0f, 0x02, 0x00, 0x05, 0x0f, 0x3c, 0x00,
-        0x11, 0x0f, 0x24, 0x00, 0x11, 0x0f, 0x02, 0x00, 0x05, 0x02, 0xfc, 0x00, 0x0f, 0xc0, 0x00,
-        0x03, 0x04, 0x58, 0x00, 0x04, 0x02, 0x00, 0x0f, 0x44, 0x00, 0x05, 0x0f, 0x02, 0x00, 0x09,
-        0x04, 0x60, 0x00, 0x04, 0x02, 0x00, 0x08, 0x2c, 0x00, 0x04, 0x14, 0x00, 0x02, 0x02, 0x00,
-        0x28, 0xa2, 0x10, 0x1c, 0x00, 0x0f, 0x02, 0x00, 0x15, 0x06, 0x68, 0x03, 0x02, 0x02, 0x00,
-        0x08, 0x38, 0x00, 0x02, 0x12, 0x00, 0x06, 0x02, 0x00, 0x08, 0x1c, 0x00, 0x0f, 0x02, 0x00,
-        0x15, 0x08, 0x2a, 0x04, 0x0c, 0x44, 0x00, 0x02, 0x6c, 0x04, 0x04, 0xe2, 0x00, 0x0f, 0x40,
-        0x02, 0x2b, 0x04, 0x4a, 0x00, 0x0f, 0x98, 0x00, 0x01, 0x02, 0x7a, 0x00, 0x0f, 0x60, 0x00,
-        0x2b, 0x0f, 0x58, 0x00, 0x01, 0x04, 0x02, 0x00, 0x02, 0x60, 0x00, 0x0f, 0x24, 0x00, 0x0b,
-        0x0f, 0x02, 0x00, 0x05, 0x04, 0xfe, 0x00, 0x0f, 0x20, 0x00, 0x05, 0x00, 0x8a, 0x0a, 0x0f,
-        0x60, 0x00, 0x29, 0x0f, 0x3c, 0x00, 0x11, 0x04, 0x04, 0x02, 0x0f, 0x22, 0x01, 0x1f, 0x04,
-        0xbe, 0x00, 0x0f, 0x20, 0x04, 0x0b, 0x0f, 0x86, 0x00, 0x13, 0x0f, 0x02, 0x00, 0x01, 0x02,
-        0xbe, 0x00, 0x0f, 0x98, 0x00, 0x0f, 0x02, 0x28, 0x00, 0x0c, 0x60, 0x02, 0x0f, 0x02, 0x00,
-        0x0d, 0x04, 0xbe, 0x00, 0x0f, 0x7e, 0x01, 0x0b, 0x02, 0x02, 0x00, 0x02, 0x5e, 0x00, 0x0f,
-        0x66, 0x03, 0x19, 0x04, 0x32, 0x00, 0x0f, 0xbe, 0x00, 0x0f, 0x08, 0x22, 0x01, 0x0f, 0xa2,
-        0x09, 0x15, 0x2f, 0x00, 0x00, 0x60, 0x00, 0x1b, 0x08, 0xee, 0x00, 0x0f, 0xae, 0x01, 0x0d,
-        0x08, 0x2c, 0x00, 0x0f, 0x1c, 0x01, 0x11, 0x04, 0x02, 0x00, 0x04, 0x92, 0x00, 0x0f, 0xf4,
-        0x00, 0x0d, 0x06, 0x78, 0x01, 0x0f, 0x5e, 0x00, 0x19, 0x02, 0xd2, 0x0a, 0x04, 0x64, 0x00,
-        0x0f, 0xa6, 0x08, 0x05, 0x0a, 0x60, 0x09, 0x0f, 0xee, 0x0a, 0x1f, 0x06, 0x62, 0x00, 0x06,
-        0x4a, 0x00, 0x06, 0xa0, 0x01, 0x0a, 0x1e, 0x00, 0x04, 0xf8, 0x00, 0x0f, 0x02, 0x00, 0x1b,
-        0x0a, 0x46, 0x00, 0x0f, 0x02, 0x00, 0x05, 0x0f, 0x5e, 0x00, 0x25, 0x02, 0x28, 0x01, 0x0f,
-        0x64, 0x00, 0x09, 0x0f, 0xa0, 0x0b, 0x2d, 0x04, 0x02, 0x00, 0x0e, 0xba, 0x00, 0x2f, 0x04,
-        0x21, 0xb8, 0x00, 0x2b, 0x0f, 0x02, 0x00, 0x03, 0x02, 0x74, 0x01, 0x0f, 0x10, 0x01, 0x29,
-        0x0f, 0x02, 0x00, 0x0b, 0x0f, 0x60, 0x00, 0xad, 0x02, 0x0c, 0x03, 0x02, 0xa6, 0x02, 0x0f,
-        0x02, 0x00, 0xff, 0x36, 0x1f, 0x00, 0x01, 0x00, 0x92, 0x4f, 0x2b, 0x55, 0x55, 0x2b, 0xa9,
-        0x00, 0x19, 0x4f, 0x80, 0xff, 0xff, 0x80, 0x30, 0x00, 0x75, 0xcf, 0x04, 0x46, 0x79, 0xa8,
-        0xe4, 0xff, 0xff, 0xe4, 0xa8, 0x79, 0x45, 0x04, 0x94, 0x00, 0x0f, 0x36, 0x29, 0x91, 0xe9,
-        0xdb, 0x02, 0x3f, 0xe9, 0x91, 0x29, 0x32, 0x00, 0x0b, 0x36, 0x11, 0x88, 0xf9, 0x2e, 0x00,
-        0x00, 0xcb, 0x13, 0x3f, 0xfb, 0x99, 0x14, 0x32, 0x00, 0x08, 0x20, 0x3d, 0xea, 0xef, 0x13,
-        0xa0, 0xdb, 0x8f, 0x54, 0x3c, 0x27, 0x27, 0x3c, 0x54, 0x90, 0xdc, 0xfd, 0x13, 0x2f, 0xe9,
-        0x3c, 0x31, 0x00, 0x06, 0x76, 0x5e, 0xf8, 0xff, 0xff, 0xff, 0xb9, 0x34, 0x20, 0x00, 0x76,
-        0x35, 0xba, 0xff, 0xff, 0xff, 0xf8, 0x5d, 0x11, 0x00, 0x09, 0x02, 0x00, 0x69, 0x62, 0xfe,
-        0xff, 0xff, 0xe8, 0x46, 0x13, 0x00, 0x7a, 0x00, 0x47, 0xe9, 0xff, 0xff, 0xfe, 0x61, 0x14,
-        0x00, 0x03, 0x02, 0x00, 0x63, 0x3d, 0xf8, 0xff, 0xff, 0xd2, 0x20, 0x0d, 0x00, 0x05, 0x02,
-        0x00, 0x65, 0x1c, 0xcd, 0xff, 0xff, 0xfa, 0x42, 0x0f, 0x00, 0x06, 0x02, 0x00, 0x66, 0x17,
-        0xed, 0xff, 0xff, 0xce, 0x0d, 0x10, 0x00, 0x04, 0x02, 0x00, 0x64, 0x0d, 0xce, 0xff, 0xff,
-        0xec, 0x16, 0x0e, 0x00, 0x06, 0x02, 0x00, 0x56, 0x9d, 0xff, 0xff, 0xe7, 0x1d, 0x0f, 0x00,
-        0x06, 0x02, 0x00, 0x56, 0x1a, 0xe4, 0xff, 0xff, 0x9a, 0x0f, 0x00, 0x03, 0x02, 0x00, 0x53,
-        0x32, 0xfd, 0xff, 0xff, 0x3e, 0x0c, 0x00, 0x0b, 0x02, 0x00, 0x5b, 0x40, 0xff, 0xff, 0xfd,
-        0x31, 0x14, 0x00, 0x5c, 0x00, 0xa1, 0xff, 0xff, 0xad, 0x14, 0x00, 0x04, 0x02, 0x00, 0x44,
-        0xb0, 0xff, 0xff, 0x9f, 0x0c, 0x00, 0x03, 0x02, 0x00, 0x4f, 0x0b, 0xf3, 0xff, 0xfd, 0xcc,
-        0x01, 0x06, 0x53, 0x29, 0xfe, 0xff, 0xf2, 0x0a, 0x29, 0x00, 0x03, 0x02, 0x00, 0x43, 0x58,
-        0xff, 0xff, 0xca, 0x0b, 0x00, 0x0f, 0x02, 0x00, 0x00, 0x4a, 0xcb, 0xff, 0xff, 0x56, 0x17,
-        0x00, 0x4a, 0x8f, 0xff, 0xff, 0x7c, 0x12, 0x00, 0x08, 0x02, 0x00, 0x48, 0x7f, 0xff, 0xff,
-        0x8d, 0x10, 0x00, 0x6a, 0x00, 0x00, 0xbc, 0xff, 0xff, 0x3d, 0x12, 0x00, 0x08, 0x02, 0x00,
-        0x46, 0x3f, 0xff, 0xff, 0xbc, 0x10, 0x00, 0x86, 0x29, 0x66, 0x66, 0x66, 0xed, 0xff, 0xff,
-        0x25, 0x12, 0x00, 0x0c, 0x02, 0x00, 0x73, 0x26, 0xff, 0xff, 0xed, 0x66, 0x66, 0x66, 0xe1,
-        0x00, 0x12, 0x66, 0x8b, 0x02, 0x1c, 0x0c, 0x26, 0x00, 0x06, 0x02, 0x00, 0x12, 0x0e, 0x22,
-        0x00, 0x12, 0x66, 0x12, 0x00, 0x03, 0x30, 0x00, 0x12, 0x09, 0x0e, 0x00, 0x0f, 0x02, 0x00,
-        0x01, 0x19, 0x0a, 0x30, 0x00, 0x7d, 0x3d, 0x99, 0x99, 0x99, 0xf5, 0xff, 0xff, 0x3b, 0x02,
-        0x06, 0x02, 0x00, 0x77, 0x21, 0xff, 0xff, 0xf5, 0x99, 0x99, 0x99, 0xe2, 0x00, 0x46, 0xc6,
-        0xff, 0xff, 0x37, 0x20, 0x00, 0x0c, 0x02, 0x00, 0x4a, 0x39, 0xff, 0xff, 0xc5, 0x14, 0x00,
-        0x4a, 0x97, 0xff, 0xff, 0x6e, 0x12, 0x00, 0x08, 0x02, 0x00, 0x48, 0x71, 0xff, 0xff, 0x95,
-        0x10, 0x00, 0x6a, 0x00, 0x00, 0x65, 0xff, 0xff, 0xbb, 0x12, 0x00, 0x08, 0x02, 0x00, 0x48,
-        0xbc, 0xff, 0xff, 0x63, 0x10, 0x00, 0x7a, 0x00, 0x00, 0x15, 0xfa, 0xff, 0xf9, 0x17, 0x13,
-        0x00, 0x06, 0x02, 0x00, 0x4c, 0x18, 0xfa, 0xff, 0xfa, 0xc7, 0x03, 0x46, 0xb3, 0xff, 0xff,
-        0x94, 0x22, 0x00, 0x0a, 0x02, 0x00, 0x4a, 0x96, 0xff, 0xff, 0xb1, 0x12, 0x00, 0x6f, 0x00,
-        0x00, 0x4a, 0xff, 0xff, 0xfa, 0xb2, 0x01, 0x04, 0x5c, 0x26, 0xfa, 0xff, 0xff, 0x49, 0x30,
-        0x00, 0x6d, 0x00, 0xb7, 0xff, 0xff, 0xcf, 0x0b, 0x16, 0x00, 0x81, 0x00, 0x00, 0x00, 0x09,
-        0xcb, 0xff, 0xff, 0xba, 0x0a, 0x00, 0x09, 0x02, 0x00, 0x69, 0x29, 0xfa, 0xff, 0xff, 0xad,
-        0x02, 0x13, 0x00, 0x01, 0x02, 0x00, 0x61, 0x02, 0xae, 0xff, 0xff, 0xf9, 0x27, 0x0b, 0x00,
-        0x0a, 0x02, 0x00, 0x5b, 0x61, 0xff, 0xff, 0xff, 0xab, 0xe7, 0x02, 0x46, 0x00, 0x00, 0x08,
-        0xa3, 0x09, 0x02, 0x0b, 0x02, 0x00, 0x6a, 0x8c, 0xff, 0xff, 0xff, 0xcb, 0x1e, 0x15, 0x00,
-        0x6a, 0x1f, 0xcc, 0xff, 0xff, 0xff, 0x8b, 0x14, 0x00, 0x04, 0x02, 0x00, 0x84, 0x02, 0x90,
-        0xff, 0xff, 0xff, 0xf6, 0x88, 0x10, 0x10, 0x00, 0x9f, 0x00, 0x00, 0x11, 0x89, 0xf6, 0xff,
-        0xff, 0xff, 0x8f, 0xa6, 0x00, 0x00, 0x02, 0x02, 0x00, 0xf2, 0x07, 0x68, 0xfb, 0xff, 0xff,
-        0xff, 0xf1, 0xa9, 0x5d, 0x22, 0x09, 0x00, 0x00, 0x09, 0x22, 0x5e, 0xaa, 0xf2, 0xff, 0xff,
-        0xff, 0xfa, 0x67, 0x1c, 0x00, 0x0f, 0x02, 0x00, 0x02, 0x22, 0x31, 0xc2, 0x8a, 0x02, 0x33,
-        0xff, 0xf2, 0xf2, 0x09, 0x00, 0x2f, 0xc1, 0x30, 0x29, 0x00, 0x02, 0x04, 0x02, 0x00, 0x43,
-        0x01, 0x56, 0xc2, 0xfe, 0x2a, 0x00, 0x64, 0xff, 0xff, 0xff, 0xfe, 0xc2, 0x55, 0x19, 0x00,
-        0x0f, 0x02, 0x00, 0x07, 0xbf, 0x21, 0x76, 0xab, 0xda, 0xfd, 0xff, 0xff, 0xfd, 0xda, 0xaa,
-        0x76, 0xe3, 0x02, 0x08, 0x0a, 0x02, 0x00, 0x0f, 0xf0, 0x06, 0x79, 0x82, 0x00, 0x00, 0x00,
-        0x00, 0x44, 0x88, 0x88, 0x44, 0x0a, 0x00, 0x0f, 0x02, 0x00, 0x88, 0x50, 0x00, 0x00, 0x00,
-        0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0xa1, 0x02, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0x92, 0x4f, 0x2b, 0x55, 0x55, 0x2b, 0x27, 0x00, 0x10, 0x05, 0x01, 0x00, 0x4f, 0x80,
+        0xff, 0xff, 0x80, 0x27, 0x00, 0x10, 0x05, 0x01, 0x00, 0x0f, 0x30, 0x00, 0x49, 0xcf, 0x04,
+        0x46, 0x79, 0xa8, 0xe4, 0xff, 0xff, 0xe4, 0xa8, 0x79, 0x45, 0x04, 0x2e, 0x00, 0x0f, 0x45,
+        0x29, 0x91, 0xe9, 0xff, 0x01, 0x00, 0x3f, 0xe9, 0x91, 0x29, 0x2e, 0x00, 0x0b, 0x36, 0x11,
+        0x88, 0xf9, 0x2e, 0x00, 0x00, 0x01, 0x00, 0x3f, 0xfb, 0x99, 0x14, 0x2f, 0x00, 0x08, 0x20,
+        0x3d, 0xea, 0x24, 0x00, 0xa1, 0xdb, 0x8f, 0x54, 0x3c, 0x27, 0x27, 0x3c, 0x54, 0x90, 0xdc,
+        0x64, 0x00, 0x1f, 0x3c, 0x2f, 0x00, 0x06, 0x76, 0x5e, 0xf8, 0xff, 0xff, 0xff, 0xb9, 0x34,
+        0x11, 0x00, 0x7f, 0x35, 0xba, 0xff, 0xff, 0xff, 0xf8, 0x5d, 0x2f, 0x00, 0x04, 0x6a, 0x62,
+        0xfe, 0xff, 0xff, 0xe8, 0x46, 0x14, 0x00, 0x6f, 0x47, 0xe9, 0xff, 0xff, 0xfe, 0x61, 0x2f,
+        0x00, 0x02, 0x6c, 0x3d, 0xf8, 0xff, 0xff, 0xd2, 0x20, 0x16, 0x00, 0x6f, 0x1c, 0xcd, 0xff,
+        0xff, 0xfa, 0x42, 0x2f, 0x00, 0x00, 0x6e, 0x17, 0xed, 0xff, 0xff, 0xce, 0x0d, 0x18, 0x00,
+        0x6e, 0x0d, 0xce, 0xff, 0xff, 0xec, 0x16, 0x18, 0x00, 0x5e, 0x9d, 0xff, 0xff, 0xe7, 0x1d,
+        0x17, 0x00, 0x7d, 0x00, 0x00, 0x1a, 0xe4, 0xff, 0xff, 0x9a, 0x16, 0x00, 0x5f, 0x32, 0xfd,
+        0xff, 0xff, 0x3e, 0x2f, 0x00, 0x01, 0x7c, 0x00, 0x00, 0x40, 0xff, 0xff, 0xfd, 0x31, 0x15,
+        0x00, 0x4f, 0xa1, 0xff, 0xff, 0xad, 0x2f, 0x00, 0x03, 0x6b, 0x00, 0x00, 0xb0, 0xff, 0xff,
+        0x9f, 0x13, 0x00, 0x4f, 0x0b, 0xf3, 0xff, 0xfd, 0xcc, 0x01, 0x06, 0x5a, 0x29, 0xfe, 0xff,
+        0xf2, 0x0a, 0x13, 0x00, 0x4f, 0x58, 0xff, 0xff, 0xca, 0x2f, 0x00, 0x05, 0x6a, 0x00, 0x00,
+        0xcb, 0xff, 0xff, 0x56, 0x12, 0x00, 0x4f, 0x8f, 0xff, 0xff, 0x7c, 0x2e, 0x00, 0x05, 0x6a,
+        0x00, 0x00, 0x7f, 0xff, 0xff, 0x8d, 0x12, 0x00, 0x4f, 0xbc, 0xff, 0xff, 0x3d, 0x2e, 0x00,
+        0x05, 0x66, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xbc, 0x0e, 0x00, 0x8f, 0x29, 0x66, 0x66, 0x66,
+        0xed, 0xff, 0xff, 0x25, 0x30, 0x00, 0x07, 0x73, 0x26, 0xff, 0xff, 0xed, 0x66, 0x66, 0x66,
+        0xe1, 0x00, 0x12, 0x66, 0x8b, 0x02, 0x1f, 0x0c, 0x30, 0x00, 0x07, 0x12, 0x0e, 0x22, 0x00,
+        0x19, 0x66, 0x30, 0x00, 0x1f, 0x09, 0x30, 0x00, 0x07, 0x19, 0x0a, 0x30, 0x00, 0x7d, 0x3d,
+        0x99, 0x99, 0x99, 0xf5, 0xff, 0xff, 0x3b, 0x02, 0x06, 0x01, 0x00, 0x77, 0x21, 0xff, 0xff,
+        0xf5, 0x99, 0x99, 0x99, 0xe2, 0x00, 0x4f, 0xc6, 0xff, 0xff, 0x37, 0x30, 0x00, 0x07, 0x4a,
+        0x39, 0xff, 0xff, 0xc5, 0x12, 0x00, 0x4f, 0x97, 0xff, 0xff, 0x6e, 0x2e, 0x00, 0x05, 0x6a,
+        0x00, 0x00, 0x71, 0xff, 0xff, 0x95, 0x12, 0x00, 0x4f, 0x65, 0xff, 0xff, 0xbb, 0x2e, 0x00,
+        0x05, 0x01, 0x6e, 0x01, 0x1a, 0x63, 0x12, 0x00, 0x5f, 0x15, 0xfa, 0xff, 0xf9, 0x17, 0x2f,
+        0x00, 0x05, 0x4c, 0x18, 0xfa, 0xff, 0xfa, 0xc7, 0x03, 0x4f, 0xb3, 0xff, 0xff, 0x94, 0x2f,
+        0x00, 0x04, 0x5c, 0x00, 0x96, 0xff, 0xff, 0xb1, 0x14, 0x00, 0x4f, 0x4a, 0xff, 0xff, 0xfa,
+        0xb2, 0x01, 0x04, 0x5d, 0x26, 0xfa, 0xff, 0xff, 0x49, 0x16, 0x00, 0x5f, 0xb7, 0xff, 0xff,
+        0xcf, 0x0b, 0x2f, 0x00, 0x01, 0x5e, 0x09, 0xcb, 0xff, 0xff, 0xba, 0x17, 0x00, 0x6e, 0x29,
+        0xfa, 0xff, 0xff, 0xad, 0x02, 0x18, 0x00, 0x6e, 0x02, 0xae, 0xff, 0xff, 0xf9, 0x27, 0x18,
+        0x00, 0x6b, 0x00, 0x61, 0xff, 0xff, 0xff, 0xab, 0xe7, 0x02, 0x46, 0x00, 0x00, 0x08, 0xa3,
+        0xd9, 0x01, 0x0b, 0x01, 0x00, 0x6a, 0x8c, 0xff, 0xff, 0xff, 0xcb, 0x1e, 0x14, 0x00, 0x6f,
+        0x1f, 0xcc, 0xff, 0xff, 0xff, 0x8b, 0x2f, 0x00, 0x02, 0x96, 0x00, 0x02, 0x90, 0xff, 0xff,
+        0xff, 0xf6, 0x88, 0x10, 0x12, 0x00, 0x7f, 0x11, 0x89, 0xf6, 0xff, 0xff, 0xff, 0x8f, 0xa6,
+        0x00, 0x00, 0x02, 0x01, 0x00, 0xff, 0x07, 0x68, 0xfb, 0xff, 0xff, 0xff, 0xf1, 0xa9, 0x5d,
+        0x22, 0x09, 0x00, 0x00, 0x09, 0x22, 0x5e, 0xaa, 0xf2, 0xff, 0xff, 0xff, 0xfa, 0x67, 0x2e,
+        0x00, 0x05, 0x53, 0x00, 0x00, 0x00, 0x31, 0xc2, 0x68, 0x05, 0x10, 0xf2, 0x2b, 0x00, 0x00,
+        0x01, 0x00, 0x2f, 0xc1, 0x30, 0x2f, 0x00, 0x08, 0x66, 0x00, 0x00, 0x01, 0x56, 0xc2, 0xfe,
+        0x9e, 0x05, 0x3f, 0xfe, 0xc2, 0x55, 0x2e, 0x00, 0x0a, 0x01, 0x01, 0x00, 0xbf, 0x21, 0x76,
+        0xab, 0xda, 0xfd, 0xff, 0xff, 0xfd, 0xda, 0xaa, 0x76, 0xe3, 0x02, 0x08, 0x0a, 0x01, 0x00,
+        0x0f, 0xf0, 0x06, 0x79, 0x00, 0x01, 0x00, 0x4f, 0x44, 0x88, 0x88, 0x44, 0x27, 0x00, 0x10,
+        0x0f, 0x01, 0x00, 0x6b, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
 
 };
 
@@ -118,11 +73,11 @@ const lv_image_dsc_t icon_location_searching = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 48,
                  .h = 48,
-                 .stride = 96,
+                 .stride = 48,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_location_searching_map),
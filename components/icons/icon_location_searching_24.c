@@ -20,47 +20,26 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_LOCATION_SEARCHING_24
     uint8_t icon_location_searching_24_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0x53, 0x02, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0x32, 0x4f, 0xe3, 0x18, 0xe3, 0x18, 0x49, 0x00, 0x19, 0x0f, 0x30, 0x00, 0x19, 0x71,
-        0xc3, 0x18, 0x04, 0x21, 0xe3, 0x18, 0xe3, 0x06, 0x00, 0x0f, 0x64, 0x00, 0x0d, 0x2c, 0xe3,
-        0x18, 0x02, 0x00, 0x2f, 0x04, 0x21, 0x34, 0x00, 0x07, 0x04, 0x2c, 0x00, 0x22, 0x04, 0x21,
-        0x02, 0x00, 0x04, 0x10, 0x00, 0x0f, 0x32, 0x00, 0x03, 0x04, 0x20, 0x00, 0x08, 0x1e, 0x00,
-        0x0f, 0x32, 0x00, 0x07, 0x02, 0x2e, 0x00, 0x28, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x6c, 0x01,
-        0x22, 0x00, 0x00, 0x34, 0x00, 0x02, 0x0e, 0x00, 0x06, 0x02, 0x00, 0x02, 0xe2, 0x00, 0x06,
-        0x10, 0x00, 0x06, 0x02, 0x00, 0x02, 0x4a, 0x00, 0x06, 0x10, 0x00, 0x00, 0xb2, 0x01, 0x0f,
-        0x44, 0x00, 0x03, 0x04, 0x02, 0x00, 0x0e, 0x4c, 0x00, 0x0e, 0x12, 0x00, 0x08, 0x02, 0x00,
-        0x0a, 0x62, 0x00, 0x02, 0x6a, 0x01, 0x48, 0xe3, 0x18, 0xa2, 0x10, 0x24, 0x00, 0x08, 0x02,
-        0x00, 0x19, 0x24, 0x90, 0x01, 0x02, 0x8c, 0x00, 0x3f, 0xe3, 0x18, 0xc3, 0x02, 0x02, 0x06,
-        0x24, 0xa2, 0x10, 0x24, 0x00, 0x04, 0x46, 0x00, 0x0a, 0x72, 0x00, 0x0c, 0x02, 0x00, 0x02,
-        0x2e, 0x00, 0x08, 0x16, 0x00, 0x0f, 0x30, 0x00, 0x0f, 0x0c, 0x3c, 0x01, 0x0e, 0x44, 0x00,
-        0x04, 0x02, 0x00, 0x11, 0xc3, 0x24, 0x02, 0x04, 0x0e, 0x00, 0x04, 0x02, 0x00, 0x0f, 0x22,
-        0x01, 0x07, 0x0f, 0x1a, 0x00, 0x05, 0x02, 0x62, 0x00, 0x0a, 0x78, 0x00, 0x2f, 0x04, 0x21,
-        0xaa, 0x00, 0x07, 0x04, 0xfa, 0x01, 0x66, 0xe3, 0x18, 0x04, 0x21, 0x00, 0x00, 0x0e, 0x00,
-        0x0f, 0x26, 0x02, 0x01, 0x04, 0x02, 0x00, 0x02, 0x64, 0x00, 0x0a, 0x02, 0x00, 0x04, 0x1c,
-        0x00, 0x0f, 0x02, 0x00, 0x05, 0x02, 0x82, 0x00, 0x02, 0xc6, 0x01, 0x0f, 0x24, 0x00, 0x05,
-        0x0c, 0x02, 0x00, 0x0f, 0xc0, 0x03, 0x49, 0x0f, 0x02, 0x00, 0x0b, 0x1f, 0x00, 0x01, 0x00,
-        0x0f, 0x2f, 0x1a, 0x1a, 0x24, 0x00, 0x03, 0x2f, 0xbf, 0xbf, 0x18, 0x00, 0x01, 0x6c, 0x13,
-        0x48, 0xd9, 0xd9, 0x48, 0x12, 0x1a, 0x00, 0x30, 0x2a, 0xae, 0xfa, 0xea, 0x04, 0x39, 0xf9,
-        0xad, 0x28, 0x1a, 0x00, 0xc7, 0x65, 0xfa, 0xed, 0x83, 0x37, 0x18, 0x18, 0x37, 0x84, 0xee,
-        0xfa, 0x64, 0x19, 0x00, 0x42, 0x67, 0xff, 0xb6, 0x11, 0x0f, 0x00, 0x42, 0x12, 0xb6, 0xff,
-        0x66, 0x0a, 0x00, 0x71, 0x00, 0x00, 0x00, 0x2e, 0xfb, 0xb4, 0x03, 0x09, 0x00, 0x71, 0x00,
-        0x00, 0x00, 0x03, 0xb5, 0xfa, 0x2c, 0x09, 0x00, 0x61, 0x00, 0x00, 0x00, 0xb5, 0xea, 0x0f,
-        0x08, 0x00, 0x01, 0x02, 0x00, 0x31, 0x10, 0xeb, 0xb3, 0x08, 0x00, 0x53, 0x00, 0x00, 0x19,
-        0xfc, 0x7b, 0x0a, 0x00, 0x01, 0x02, 0x00, 0x31, 0x7d, 0xfc, 0x18, 0x08, 0x00, 0x42, 0x00,
-        0x53, 0xff, 0x2e, 0x09, 0x00, 0x02, 0x02, 0x00, 0xc2, 0x30, 0xff, 0x52, 0x00, 0x00, 0x00,
-        0x00, 0x22, 0xaa, 0xd0, 0xff, 0x0c, 0x12, 0x00, 0x02, 0x02, 0x00, 0xc2, 0x0d, 0xff, 0xd0,
-        0xaa, 0x22, 0x00, 0x00, 0x29, 0xcc, 0xe3, 0xff, 0x0a, 0x12, 0x00, 0x02, 0x02, 0x00, 0xb1,
-        0x0b, 0xff, 0xe3, 0xcc, 0x29, 0x00, 0x00, 0x00, 0x00, 0x57, 0xff, 0x07, 0x00, 0x04, 0x02,
-        0x00, 0x32, 0x2a, 0xff, 0x56, 0x0b, 0x00, 0x32, 0x1f, 0xfe, 0x72, 0x09, 0x00, 0x02, 0x02,
-        0x00, 0x32, 0x74, 0xfe, 0x1d, 0x09, 0x00, 0x43, 0x00, 0xbf, 0xe2, 0x09, 0x0a, 0x00, 0x61,
-        0x00, 0x00, 0x00, 0x0a, 0xe4, 0xbd, 0x08, 0x00, 0x61, 0x00, 0x00, 0x00, 0x39, 0xfe, 0xa1,
-        0x08, 0x00, 0x01, 0x02, 0x00, 0x31, 0xa3, 0xfd, 0x37, 0x08, 0x00, 0x82, 0x00, 0x00, 0x00,
-        0x00, 0x7c, 0xff, 0xa0, 0x08, 0x0a, 0x00, 0x37, 0x08, 0xa1, 0xff, 0xcd, 0x00, 0xe2, 0x01,
-        0x7e, 0xfe, 0xe0, 0x6b, 0x20, 0x01, 0x02, 0x21, 0x6b, 0xe0, 0xfe, 0x7d, 0x01, 0x22, 0x00,
-        0x02, 0x02, 0x00, 0xa2, 0x3d, 0xc6, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0xc4, 0x3c, 0x10,
-        0x00, 0x06, 0x02, 0x00, 0x66, 0x26, 0x62, 0xdf, 0xdf, 0x61, 0x25, 0x10, 0x00, 0x06, 0x02,
-        0x00, 0x0f, 0xc8, 0x01, 0x03, 0x46, 0x00, 0x00, 0x33, 0x33, 0x24, 0x00, 0x0f, 0x02, 0x00,
-        0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0x1a, 0x01, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0x0f, 0x2f, 0x1a, 0x1a, 0x18, 0x00, 0x03, 0x2f, 0xbf, 0xbf, 0x16, 0x00, 0x01, 0x6c,
+        0x13, 0x48, 0xd9, 0xd9, 0x48, 0x12, 0x16, 0x00, 0xa9, 0x2a, 0xae, 0xfa, 0xff, 0xff, 0xff,
+        0xff, 0xf9, 0xad, 0x28, 0x17, 0x00, 0xc7, 0x65, 0xfa, 0xed, 0x83, 0x37, 0x18, 0x18, 0x37,
+        0x84, 0xee, 0xfa, 0x64, 0x17, 0x00, 0x42, 0x67, 0xff, 0xb6, 0x11, 0x0a, 0x00, 0x45, 0x12,
+        0xb6, 0xff, 0x66, 0x17, 0x00, 0x44, 0x2e, 0xfb, 0xb4, 0x03, 0x0c, 0x00, 0x44, 0x03, 0xb5,
+        0xfa, 0x2c, 0x0c, 0x00, 0x36, 0xb5, 0xea, 0x0f, 0x3c, 0x00, 0x33, 0x10, 0xeb, 0xb3, 0x0a,
+        0x00, 0x36, 0x19, 0xfc, 0x7b, 0x17, 0x00, 0x52, 0x00, 0x00, 0x7d, 0xfc, 0x18, 0x09, 0x00,
+        0x38, 0x53, 0xff, 0x2e, 0x18, 0x00, 0x30, 0x30, 0xff, 0x52, 0x07, 0x00, 0x58, 0x22, 0xaa,
+        0xd0, 0xff, 0x0c, 0x18, 0x00, 0xc8, 0x0d, 0xff, 0xd0, 0xaa, 0x22, 0x00, 0x00, 0x29, 0xcc,
+        0xe3, 0xff, 0x0a, 0x18, 0x00, 0x50, 0x0b, 0xff, 0xe3, 0xcc, 0x29, 0x09, 0x00, 0x21, 0x57,
+        0xff, 0x07, 0x00, 0x04, 0x01, 0x00, 0x32, 0x2a, 0xff, 0x56, 0x09, 0x00, 0x38, 0x1f, 0xfe,
+        0x72, 0x18, 0x00, 0x33, 0x74, 0xfe, 0x1d, 0x0a, 0x00, 0x36, 0xbf, 0xe2, 0x09, 0x17, 0x00,
+        0x34, 0x0a, 0xe4, 0xbd, 0x0b, 0x00, 0x36, 0x39, 0xfe, 0xa1, 0x18, 0x00, 0x35, 0xa3, 0xfd,
+        0x37, 0x0c, 0x00, 0x42, 0x7c, 0xff, 0xa0, 0x08, 0x0a, 0x00, 0x37, 0x08, 0xa1, 0xff, 0xcd,
+        0x00, 0xe6, 0x01, 0x7e, 0xfe, 0xe0, 0x6b, 0x20, 0x01, 0x02, 0x21, 0x6b, 0xe0, 0xfe, 0x7d,
+        0x01, 0x18, 0x00, 0xc8, 0x00, 0x00, 0x3d, 0xc6, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0xc4,
+        0x3c, 0x16, 0x00, 0x00, 0x01, 0x00, 0x6c, 0x26, 0x62, 0xdf, 0xdf, 0x61, 0x25, 0x16, 0x00,
+        0x00, 0x01, 0x00, 0x0f, 0xc8, 0x01, 0x03, 0x4f, 0x00, 0x00, 0x33, 0x33, 0x18, 0x00, 0x03,
+        0x04, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
 
 };
 
@@ -68,11 +47,11 @@ const lv_image_dsc_t icon_location_searching_24 = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 24,
                  .h = 24,
-                 .stride = 48,
+                 .stride = 24,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_location_searching_24_map),
@@ -20,34 +20,19 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_LOCK_24 uint8_t
     icon_lock_24_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0x96, 0x01, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0x5e, 0x17, 0x00, 0x01, 0x00, 0x0f, 0x7d, 0x00, 0x0f, 0x07, 0x2d, 0x00, 0x01, 0x02,
-        0x00, 0x0f, 0x32, 0x00, 0x0b, 0x01, 0x23, 0x00, 0x03, 0x26, 0x00, 0x01, 0x09, 0x00, 0x03,
-        0x0c, 0x00, 0x0f, 0x02, 0x00, 0x05, 0x01, 0x21, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x0a, 0x0e,
-        0x00, 0x0f, 0x02, 0x00, 0x01, 0x0a, 0x22, 0x00, 0x0a, 0x0e, 0x00, 0x0f, 0x02, 0x00, 0x01,
-        0x08, 0x5e, 0x00, 0x00, 0x6a, 0x01, 0x0c, 0x10, 0x00, 0x08, 0x02, 0x00, 0x02, 0x4e, 0x00,
-        0x0f, 0x02, 0x00, 0x03, 0x08, 0x28, 0x00, 0x02, 0x02, 0x00, 0x0f, 0x28, 0x00, 0x03, 0x06,
-        0x02, 0x00, 0x02, 0x26, 0x00, 0x06, 0x02, 0x00, 0x02, 0x1a, 0x00, 0x06, 0x10, 0x00, 0x06,
-        0x02, 0x00, 0x0f, 0x1a, 0x00, 0x03, 0x0f, 0xaa, 0x00, 0x0d, 0x06, 0x40, 0x00, 0x02, 0x02,
-        0x00, 0x0f, 0x30, 0x00, 0x29, 0x02, 0x82, 0x00, 0x06, 0x54, 0x00, 0x08, 0x0c, 0x00, 0x04,
-        0x02, 0x00, 0x08, 0x14, 0x00, 0x0f, 0x30, 0x00, 0x7d, 0x0c, 0x02, 0x00, 0x08, 0xac, 0x00,
-        0x04, 0x02, 0x00, 0x0f, 0x14, 0x00, 0x01, 0x04, 0x02, 0x00, 0x0f, 0x1c, 0x00, 0x01, 0x02,
-        0xe4, 0x00, 0x04, 0x22, 0x00, 0x08, 0x02, 0x00, 0x0f, 0x1a, 0x00, 0x03, 0x02, 0x16, 0x00,
-        0x0f, 0x02, 0x00, 0x07, 0x08, 0x42, 0x00, 0x02, 0x02, 0x00, 0x0f, 0x2c, 0x00, 0x07, 0x0f,
-        0x2e, 0x00, 0x01, 0x0f, 0x02, 0x00, 0x45, 0x0f, 0x86, 0x00, 0x09, 0x0f, 0x02, 0x00, 0x0a,
-        0x6d, 0x3c, 0xbb, 0xf4, 0xf4, 0xbb, 0x3c, 0x23, 0x00, 0x8b, 0x57, 0xfb, 0xe4, 0x98, 0x98,
-        0xe4, 0xfb, 0x57, 0x19, 0x00, 0xaa, 0x13, 0xf1, 0xc8, 0x10, 0x00, 0x00, 0x10, 0xc8, 0xf1,
-        0x13, 0x19, 0x00, 0xaa, 0x5f, 0xff, 0x37, 0x00, 0x00, 0x00, 0x00, 0x38, 0xff, 0x5f, 0x18,
-        0x00, 0xaa, 0x7d, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0x7d, 0x18, 0x00, 0x22,
-        0x80, 0xff, 0x10, 0x00, 0x22, 0xff, 0x80, 0x08, 0x00, 0x02, 0x02, 0x00, 0x51, 0x42, 0x77,
-        0xbb, 0xff, 0x77, 0x01, 0x00, 0x42, 0xff, 0xbb, 0x77, 0x41, 0x14, 0x00, 0x58, 0x00, 0x00,
-        0x00, 0x42, 0xfe, 0x36, 0x01, 0x15, 0xfe, 0x19, 0x00, 0x31, 0x7d, 0xff, 0x07, 0x20, 0x00,
-        0x01, 0x02, 0x00, 0x16, 0x07, 0x63, 0x00, 0x04, 0x5d, 0x00, 0x02, 0x02, 0x00, 0x06, 0x63,
-        0x00, 0x0f, 0x18, 0x00, 0x0b, 0x41, 0x19, 0xa1, 0xa1, 0x18, 0xb4, 0x01, 0x05, 0x93, 0x00,
-        0x02, 0x30, 0x00, 0x4f, 0xa1, 0xff, 0xff, 0xa0, 0x18, 0x00, 0x19, 0x3f, 0x19, 0xa0, 0xa0,
-        0x48, 0x00, 0x02, 0x04, 0x02, 0x00, 0x0f, 0x90, 0x00, 0x0f, 0x0f, 0xd8, 0x00, 0x05, 0x1a,
-        0x41, 0x08, 0x01, 0x14, 0x40, 0x52, 0x00, 0x45, 0x00, 0x41, 0x83, 0x88, 0x01, 0x00, 0x16,
-        0x83, 0x17, 0x00, 0x0f, 0x02, 0x00, 0x14, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0x25, 0x6d, 0x3c, 0xbb, 0xf4, 0xf4, 0xbb, 0x3c, 0x17, 0x00, 0x8b, 0x57, 0xfb, 0xe4,
+        0x98, 0x98, 0xe4, 0xfb, 0x57, 0x17, 0x00, 0xaa, 0x13, 0xf1, 0xc8, 0x10, 0x00, 0x00, 0x10,
+        0xc8, 0xf1, 0x13, 0x18, 0x00, 0x30, 0x5f, 0xff, 0x37, 0x07, 0x00, 0x3a, 0x38, 0xff, 0x5f,
+        0x18, 0x00, 0x30, 0x7d, 0xff, 0x06, 0x07, 0x00, 0x3a, 0x06, 0xff, 0x7d, 0x18, 0x00, 0x22,
+        0x80, 0xff, 0x08, 0x00, 0x28, 0xff, 0x80, 0x16, 0x00, 0x51, 0x42, 0x77, 0xbb, 0xff, 0x77,
+        0x01, 0x00, 0x46, 0xff, 0xbb, 0x77, 0x41, 0x17, 0x00, 0x27, 0xfe, 0xff, 0x01, 0x00, 0x15,
+        0xfe, 0x19, 0x00, 0x36, 0x7d, 0xff, 0x07, 0x3c, 0x00, 0x16, 0x07, 0x63, 0x00, 0x04, 0x5d,
+        0x00, 0x02, 0x01, 0x00, 0x06, 0x63, 0x00, 0x0f, 0x18, 0x00, 0x0b, 0x4f, 0x19, 0xa1, 0xa1,
+        0x18, 0x18, 0x00, 0x01, 0x4f, 0xa1, 0xff, 0xff, 0xa0, 0x18, 0x00, 0x19, 0x3f, 0x19, 0xa0,
+        0xa0, 0x48, 0x00, 0x02, 0x04, 0x01, 0x00, 0x0f, 0x18, 0x00, 0x0f, 0x0f, 0xd8, 0x00, 0x05,
+        0x1a, 0x41, 0x08, 0x01, 0x15, 0x40, 0x24, 0x00, 0x35, 0x41, 0x83, 0x88, 0x01, 0x00, 0x16,
+        0x83, 0x17, 0x00, 0x0f, 0x01, 0x00, 0x14, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
 
 };
 
@@ -55,11 +40,11 @@ const lv_image_dsc_t icon_lock_24 = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 24,
                  .h = 24,
-                 .stride = 48,
+                 .stride = 24,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_lock_24_map),
@@ -20,106 +20,47 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_LOCK_OPEN_RIGHT
     uint8_t icon_lock_open_right_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0xc2, 0x05, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0xff, 0xff, 0xc6, 0x1b, 0x00, 0x01, 0x00, 0x0f, 0xe7, 0x02, 0x57, 0x0b, 0x79, 0x00,
-        0x09, 0x02, 0x00, 0x0f, 0x86, 0x00, 0x4f, 0x09, 0x6f, 0x00, 0x0f, 0x02, 0x00, 0x00, 0x0f,
-        0x82, 0x00, 0x4b, 0x0f, 0x71, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x0f, 0x82, 0x00, 0x47, 0x0d,
-        0x6b, 0x00, 0x0f, 0x02, 0x00, 0x04, 0x0f, 0x82, 0x00, 0x43, 0x0c, 0x6d, 0x00, 0x08, 0x66,
-        0x00, 0x0f, 0x1c, 0x00, 0x09, 0x0f, 0x02, 0x00, 0x35, 0x0a, 0x64, 0x00, 0x0c, 0x56, 0x00,
-        0x0f, 0x1e, 0x00, 0x0b, 0x0f, 0x02, 0x00, 0x2f, 0x08, 0x60, 0x00, 0x0f, 0x4e, 0x00, 0x03,
-        0x08, 0x22, 0x00, 0x0f, 0x24, 0x00, 0x05, 0x0f, 0x02, 0x00, 0x27, 0x08, 0x5e, 0x00, 0x0f,
-        0x46, 0x00, 0x05, 0x0f, 0x24, 0x00, 0x11, 0x0f, 0x02, 0x00, 0x25, 0x06, 0x5c, 0x00, 0x0f,
-        0x42, 0x00, 0x09, 0x0f, 0x26, 0x00, 0x13, 0x0f, 0x02, 0x00, 0x21, 0x0f, 0x5a, 0x00, 0x13,
-        0x0f, 0x26, 0x00, 0x13, 0x0f, 0x02, 0x00, 0x21, 0x0f, 0x5a, 0x00, 0x13, 0x0f, 0x26, 0x00,
-        0x13, 0x0f, 0x02, 0x00, 0x21, 0x0f, 0x5a, 0x00, 0x13, 0x0f, 0x26, 0x00, 0x13, 0x0f, 0x02,
-        0x00, 0x21, 0x04, 0x5a, 0x00, 0x0f, 0x3c, 0x00, 0x21, 0x0f, 0x02, 0x00, 0x31, 0x0f, 0x80,
-        0x00, 0xff, 0x44, 0x04, 0x56, 0x01, 0x0f, 0x02, 0x00, 0x29, 0x0f, 0xde, 0x01, 0x25, 0x0f,
-        0x74, 0x00, 0x29, 0x0c, 0x02, 0x00, 0x0f, 0x84, 0x00, 0x1f, 0x0c, 0x42, 0x00, 0x0f, 0x02,
-        0x00, 0x2d, 0x0f, 0x82, 0x00, 0x1d, 0x0f, 0x70, 0x00, 0x2d, 0x0c, 0x02, 0x00, 0x0f, 0x80,
-        0x00, 0xa7, 0x0f, 0xba, 0x00, 0x1d, 0x08, 0x02, 0x00, 0x06, 0x06, 0x01, 0x08, 0x16, 0x00,
-        0x0f, 0x02, 0x00, 0x11, 0x04, 0x3a, 0x00, 0x0f, 0x2c, 0x00, 0x11, 0x0f, 0x02, 0x00, 0x09,
-        0x0f, 0x48, 0x00, 0x25, 0x0f, 0x38, 0x00, 0x25, 0x0c, 0x02, 0x00, 0x0f, 0x48, 0x00, 0x25,
-        0x0f, 0x38, 0x00, 0x25, 0x0c, 0x02, 0x00, 0x0f, 0x48, 0x00, 0x25, 0x0f, 0x38, 0x00, 0x25,
-        0x0c, 0x02, 0x00, 0x0f, 0x48, 0x00, 0x25, 0x0f, 0x38, 0x00, 0x25, 0x0c, 0x02, 0x00, 0x0f,
-        0x48, 0x00, 0x25, 0x0f, 0x38, 0x00, 0x25, 0x0c, 0x02, 0x00, 0x0f, 0x48, 0x00, 0x25, 0x0f,
-        0x38, 0x00, 0x25, 0x0c, 0x02, 0x00, 0x0f, 0x48, 0x00, 0x25, 0x0f, 0x38, 0x00, 0x0f, 0x04,
-        0x22, 0x00, 0x0f, 0x4e, 0x0b, 0x0b, 0x02, 0x20, 0x00, 0x0f, 0xc8, 0x03, 0x1f, 0x0f, 0x38,
-        0x00, 0x0d, 0x04, 0x20, 0x00, 0x04, 0x02, 0x00, 0x0c, 0xf8, 0x00, 0x04, 0x02, 0x00, 0x0f,
-        0x20, 0x00, 0x0d, 0x0f, 0x02, 0x00, 0x05, 0x0f, 0x38, 0x00, 0x0b, 0x04, 0x1e, 0x00, 0x08,
-        0x02, 0x00, 0x0f, 0x4a, 0x00, 0x03, 0x04, 0x22, 0x00, 0x0f, 0x1e, 0x00, 0x03, 0x0f, 0x02,
-        0x00, 0x07, 0x0f, 0x38, 0x00, 0x0b, 0x04, 0x1e, 0x00, 0x08, 0x02, 0x00, 0x0f, 0x4c, 0x00,
-        0x03, 0x04, 0x22, 0x00, 0x0f, 0x1e, 0x00, 0x03, 0x0f, 0x02, 0x00, 0x07, 0x0f, 0x38, 0x00,
-        0x0b, 0x04, 0x1e, 0x00, 0x08, 0x02, 0x00, 0x0f, 0x4c, 0x00, 0x03, 0x04, 0x22, 0x00, 0x0f,
-        0x1e, 0x00, 0x03, 0x0f, 0x02, 0x00, 0x07, 0x0f, 0x38, 0x00, 0x0b, 0x04, 0x1e, 0x00, 0x08,
-        0x02, 0x00, 0x0f, 0x4c, 0x00, 0x03, 0x04, 0x22, 0x00, 0x0f, 0x1e, 0x00, 0x03, 0x0f, 0x02,
-        0x00, 0x07, 0x0f, 0x38, 0x00, 0x0b, 0x04, 0x1e, 0x00, 0x08, 0x02, 0x00, 0x0f, 0x4c, 0x00,
-        0x03, 0x04, 0x22, 0x00, 0x0f, 0x1e, 0x00, 0x03, 0x0f, 0x02, 0x00, 0x07, 0x0f, 0x38, 0x00,
-        0x0b, 0x04, 0x1e, 0x00, 0x08, 0x02, 0x00, 0x0f, 0x4c, 0x00, 0x03, 0x04, 0x22, 0x00, 0x0f,
-        0x1e, 0x00, 0x03, 0x0f, 0x02, 0x00, 0x07, 0x0f, 0x38, 0x00, 0x0d, 0x04, 0x20, 0x00, 0x04,
-        0x02, 0x00, 0x0f, 0x4a, 0x00, 0x05, 0x0f, 0x20, 0x00, 0x0d, 0x0f, 0x02, 0x00, 0x05, 0x0f,
-        0x38, 0x00, 0x0f, 0x04, 0x22, 0x00, 0x0f, 0x5e, 0x04, 0x0b, 0x02, 0x20, 0x00, 0x0f, 0xa0,
-        0x00, 0x07, 0x0f, 0x02, 0x00, 0x05, 0x0f, 0x38, 0x00, 0x25, 0x0c, 0x02, 0x00, 0x0f, 0x48,
-        0x00, 0x25, 0x0f, 0x38, 0x00, 0x25, 0x0c, 0x02, 0x00, 0x0f, 0x48, 0x00, 0x25, 0x0f, 0x38,
-        0x00, 0x25, 0x0c, 0x02, 0x00, 0x0f, 0x48, 0x00, 0x25, 0x0f, 0x38, 0x00, 0x25, 0x0c, 0x02,
-        0x00, 0x0f, 0x48, 0x00, 0x25, 0x0f, 0x38, 0x00, 0x25, 0x0c, 0x02, 0x00, 0x0f, 0x48, 0x00,
-        0x25, 0x0f, 0x38, 0x00, 0x25, 0x0c, 0x02, 0x00, 0x0f, 0x48, 0x00, 0x25, 0x0f, 0x38, 0x00,
-        0x25, 0x0c, 0x02, 0x00, 0x0f, 0x48, 0x00, 0x25, 0x04, 0x38, 0x00, 0x0f, 0xba, 0x03, 0x1f,
-        0x08, 0x02, 0x00, 0x0f, 0x46, 0x00, 0x27, 0x06, 0x3a, 0x00, 0x0f, 0x02, 0x00, 0x33, 0x08,
-        0x96, 0x00, 0x0f, 0x02, 0x00, 0x11, 0x0f, 0x76, 0x00, 0x33, 0x06, 0x02, 0x00, 0x0f, 0x74,
-        0x00, 0x11, 0x08, 0x02, 0x00, 0x06, 0x3a, 0x00, 0x0f, 0x02, 0x00, 0x33, 0x08, 0x5c, 0x00,
-        0x0f, 0x02, 0x00, 0x13, 0x0f, 0x78, 0x00, 0x33, 0x02, 0x02, 0x00, 0x0f, 0x72, 0x00, 0x13,
-        0x0e, 0x02, 0x00, 0x02, 0x3e, 0x00, 0x0f, 0x02, 0x00, 0x2b, 0x0e, 0x56, 0x00, 0x0f, 0x02,
-        0x00, 0xff, 0xff, 0xfb, 0x0f, 0x5c, 0x03, 0x2b, 0x0f, 0x02, 0x00, 0xff, 0x1c, 0x8f, 0x21,
-        0x68, 0x88, 0xa0, 0xa0, 0x88, 0x67, 0x21, 0x36, 0x01, 0x22, 0x34, 0x01, 0x53, 0xd0, 0xb8,
-        0x04, 0x3f, 0xcf, 0x52, 0x01, 0x43, 0x00, 0x1e, 0x24, 0x1a, 0xc4, 0x3e, 0x00, 0x00, 0xf2,
-        0x21, 0x2f, 0xc2, 0x1a, 0x41, 0x00, 0x1c, 0x22, 0x32, 0xe4, 0x39, 0x00, 0x04, 0x02, 0x00,
-        0x2f, 0xe4, 0x32, 0x41, 0x00, 0x1a, 0x20, 0x22, 0xeb, 0x68, 0x22, 0x80, 0xfb, 0xbc, 0x7b,
-        0x5f, 0x5f, 0x7b, 0xbc, 0xfb, 0x74, 0x22, 0x1f, 0xea, 0x06, 0x01, 0x19, 0x20, 0x0a, 0xd4,
-        0xa7, 0x22, 0x22, 0xb5, 0x26, 0x74, 0x00, 0x20, 0x27, 0xb7, 0xb5, 0x22, 0x22, 0xd3, 0x0a,
-        0x0e, 0x00, 0x0f, 0x02, 0x00, 0x11, 0x10, 0x7a, 0xe6, 0x22, 0x24, 0x8b, 0x02, 0x2b, 0x00,
-        0x20, 0x02, 0x8c, 0xf6, 0x22, 0x14, 0x78, 0x0f, 0x00, 0x0f, 0x02, 0x00, 0x0e, 0x67, 0x11,
-        0xf0, 0xff, 0xff, 0xff, 0xa3, 0x27, 0x00, 0x77, 0x01, 0xa4, 0xff, 0xff, 0xff, 0xef, 0x10,
-        0x12, 0x00, 0x0f, 0x02, 0x00, 0x0a, 0x68, 0x5e, 0xff, 0xff, 0xff, 0xeb, 0x0f, 0x23, 0x00,
-        0x68, 0x0f, 0xec, 0xff, 0xff, 0xff, 0x5b, 0x12, 0x00, 0x0f, 0x02, 0x00, 0x09, 0x5a, 0xa8,
-        0xff, 0xff, 0xff, 0x82, 0x21, 0x00, 0x5a, 0x84, 0xff, 0xff, 0xff, 0xa6, 0x13, 0x00, 0x0f,
-        0x02, 0x00, 0x07, 0x5a, 0xd5, 0xff, 0xff, 0xff, 0x37, 0x1f, 0x00, 0x5a, 0x39, 0xff, 0xff,
-        0xff, 0xd4, 0x13, 0x00, 0x0f, 0x02, 0x00, 0x07, 0x5a, 0xed, 0xff, 0xff, 0xff, 0x11, 0x1f,
-        0x00, 0x5a, 0x13, 0xff, 0xff, 0xff, 0xeb, 0x13, 0x00, 0x0f, 0x02, 0x00, 0x07, 0x4b, 0xfe,
-        0xff, 0xff, 0xff, 0xb2, 0x02, 0x5f, 0x01, 0x55, 0x55, 0x55, 0x54, 0x32, 0x00, 0x07, 0x0a,
-        0x02, 0x00, 0x00, 0xa4, 0x24, 0x0a, 0x12, 0x00, 0x0f, 0x02, 0x00, 0x1b, 0x0f, 0x40, 0x00,
-        0x98, 0x3e, 0x23, 0x4d, 0x55, 0x01, 0x00, 0x00, 0xa4, 0x25, 0x03, 0x16, 0x00, 0x2f, 0x4d,
-        0x23, 0xfb, 0x00, 0x09, 0x24, 0x1a, 0xb9, 0xa0, 0x03, 0x0f, 0x02, 0x00, 0x07, 0x1f, 0xb8,
-        0xfb, 0x03, 0x07, 0x2f, 0x13, 0xdc, 0x37, 0x00, 0x07, 0x06, 0x02, 0x00, 0x2f, 0xdc, 0x12,
-        0x83, 0x00, 0x05, 0x16, 0x8f, 0x25, 0x00, 0x0f, 0x02, 0x00, 0x09, 0x1f, 0x8d, 0x40, 0x00,
-        0x05, 0x6f, 0xe1, 0xff, 0xff, 0xff, 0xce, 0xaa, 0x01, 0x00, 0x0a, 0x5f, 0xce, 0xff, 0xff,
-        0xff, 0xdf, 0x40, 0x00, 0x05, 0x5f, 0xfc, 0xff, 0xff, 0xff, 0x0c, 0x1d, 0x00, 0x05, 0x02,
-        0x02, 0x00, 0x52, 0x0c, 0xff, 0xff, 0xff, 0xfc, 0x0b, 0x00, 0x0e, 0x02, 0x00, 0x0f, 0x28,
-        0x02, 0x11, 0x0f, 0x24, 0x00, 0x09, 0x0f, 0x1c, 0x00, 0x09, 0x04, 0x02, 0x00, 0x0f, 0x24,
-        0x00, 0x09, 0x0f, 0x1c, 0x00, 0x09, 0x04, 0x02, 0x00, 0x0f, 0x24, 0x00, 0x09, 0x0f, 0x1c,
-        0x00, 0x09, 0x04, 0x02, 0x00, 0x0f, 0x24, 0x00, 0x09, 0x0f, 0x1c, 0x00, 0x09, 0x04, 0x02,
-        0x00, 0x0f, 0x24, 0x00, 0x09, 0x0f, 0x1c, 0x00, 0x09, 0x04, 0x02, 0x00, 0x0f, 0x24, 0x00,
-        0x09, 0x0f, 0x1c, 0x00, 0x09, 0x04, 0x02, 0x00, 0x0f, 0x24, 0x00, 0x09, 0x0d, 0x1c, 0x00,
-        0x64, 0x0b, 0x69, 0xa0, 0xa0, 0x69, 0x0b, 0x3b, 0x00, 0x01, 0x02, 0x00, 0x0d, 0x24, 0x00,
-        0x07, 0x02, 0x00, 0x0c, 0x1c, 0x00, 0x20, 0x2b, 0xe1, 0x1e, 0x29, 0x27, 0xe0, 0x2b, 0x23,
-        0x00, 0x0d, 0x24, 0x00, 0x08, 0x02, 0x00, 0x0b, 0x1c, 0x00, 0x11, 0x0b, 0x3f, 0x00, 0x38,
-        0xff, 0xff, 0xe0, 0x82, 0x00, 0x0b, 0x24, 0x00, 0x09, 0x02, 0x00, 0x0b, 0x1c, 0x00, 0x14,
-        0x69, 0x45, 0x03, 0x17, 0x68, 0x26, 0x00, 0x0b, 0x24, 0x00, 0x09, 0x02, 0x00, 0x0b, 0x1c,
-        0x00, 0x14, 0x9f, 0x40, 0x00, 0x17, 0x9e, 0x26, 0x00, 0x0b, 0x24, 0x00, 0x09, 0x02, 0x00,
-        0x0b, 0x1c, 0x00, 0x0f, 0x40, 0x00, 0x2d, 0x05, 0xc0, 0x00, 0x17, 0x67, 0x66, 0x00, 0x0b,
-        0x64, 0x00, 0x09, 0x02, 0x00, 0x0b, 0x1c, 0x00, 0x22, 0x0b, 0xe0, 0xc1, 0x00, 0x1f, 0xdf,
-        0x40, 0x01, 0x24, 0x21, 0x00, 0x2b, 0x41, 0x00, 0x1f, 0xdf, 0xc0, 0x01, 0x25, 0x78, 0x00,
-        0x00, 0x0b, 0x68, 0x9f, 0x9f, 0x67, 0x7e, 0x00, 0x0d, 0xa4, 0x00, 0x09, 0x02, 0x00, 0x0b,
-        0xc0, 0x00, 0x0f, 0x02, 0x00, 0x02, 0x0f, 0x24, 0x00, 0x09, 0x0f, 0x1c, 0x00, 0x09, 0x04,
-        0x02, 0x00, 0x0f, 0x24, 0x00, 0x09, 0x0f, 0x1c, 0x00, 0x09, 0x04, 0x02, 0x00, 0x0f, 0x24,
-        0x00, 0x09, 0x0f, 0x1c, 0x00, 0x09, 0x04, 0x02, 0x00, 0x0f, 0x24, 0x00, 0x09, 0x0f, 0x1c,
-        0x00, 0x09, 0x04, 0x02, 0x00, 0x0f, 0x24, 0x00, 0x09, 0x0f, 0x1c, 0x00, 0x09, 0x04, 0x02,
-        0x00, 0x0f, 0x24, 0x00, 0x09, 0x0f, 0x1c, 0x00, 0x09, 0x04, 0x02, 0x00, 0x0f, 0x24, 0x00,
-        0x09, 0x0f, 0x40, 0x06, 0x2d, 0x0f, 0xc0, 0x06, 0x2d, 0x12, 0x8e, 0xf0, 0x02, 0x0f, 0x02,
-        0x00, 0x0d, 0x14, 0x8c, 0xcc, 0x00, 0x0c, 0x02, 0x00, 0x1f, 0x12, 0xc0, 0x07, 0x12, 0x1b,
-        0xdb, 0xcb, 0x09, 0x07, 0x02, 0x00, 0x2f, 0x1a, 0xb8, 0x7c, 0x00, 0x0d, 0x47, 0xff, 0xff,
-        0xb6, 0x19, 0x31, 0x00, 0x0d, 0x02, 0x00, 0x1f, 0x22, 0xc0, 0x08, 0x01, 0x07, 0x02, 0x00,
-        0x2d, 0x4d, 0x22, 0x33, 0x00, 0x0f, 0x02, 0x00, 0xff, 0x67, 0x50, 0x00, 0x00, 0x00, 0x00,
-        0x00,
+        0x02, 0x00, 0x00, 0x00, 0x4f, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0xff, 0x59, 0x8f, 0x21, 0x68, 0x88, 0xa0, 0xa0, 0x88, 0x67, 0x21, 0x2b, 0x00, 0x10,
+        0x0e, 0x01, 0x00, 0x43, 0x01, 0x53, 0xd0, 0xff, 0x01, 0x00, 0x3f, 0xcf, 0x52, 0x01, 0x31,
+        0x00, 0x10, 0x0a, 0x01, 0x00, 0x24, 0x1a, 0xc4, 0x3e, 0x00, 0x00, 0x01, 0x00, 0x2f, 0xc2,
+        0x1a, 0x33, 0x00, 0x10, 0x08, 0x01, 0x00, 0x28, 0x32, 0xe4, 0x3f, 0x00, 0x4f, 0xff, 0xff,
+        0xe4, 0x32, 0x35, 0x00, 0x10, 0x06, 0x01, 0x00, 0x20, 0x22, 0xeb, 0x35, 0x00, 0x80, 0xfb,
+        0xbc, 0x7b, 0x5f, 0x5f, 0x7b, 0xbc, 0xfb, 0x0c, 0x00, 0x1f, 0xea, 0x06, 0x01, 0x19, 0x20,
+        0x0a, 0xd4, 0x33, 0x00, 0x22, 0xb5, 0x26, 0x0e, 0x00, 0x20, 0x27, 0xb7, 0x0e, 0x00, 0x2f,
+        0xd3, 0x0a, 0x36, 0x00, 0x0d, 0x06, 0x01, 0x00, 0x10, 0x7a, 0x31, 0x00, 0x24, 0x8b, 0x02,
+        0x0f, 0x00, 0x20, 0x02, 0x8c, 0x10, 0x00, 0x1f, 0x78, 0x34, 0x00, 0x0b, 0x07, 0x01, 0x00,
+        0x67, 0x11, 0xf0, 0xff, 0xff, 0xff, 0xa3, 0x11, 0x00, 0x7f, 0x01, 0xa4, 0xff, 0xff, 0xff,
+        0xef, 0x10, 0x33, 0x00, 0x08, 0x09, 0x01, 0x00, 0x68, 0x5e, 0xff, 0xff, 0xff, 0xeb, 0x0f,
+        0x12, 0x00, 0x6f, 0x0f, 0xec, 0xff, 0xff, 0xff, 0x5b, 0x32, 0x00, 0x07, 0x0a, 0x01, 0x00,
+        0x5a, 0xa8, 0xff, 0xff, 0xff, 0x82, 0x13, 0x00, 0x5f, 0x84, 0xff, 0xff, 0xff, 0xa6, 0x30,
+        0x00, 0x05, 0x0c, 0x01, 0x00, 0x5a, 0xd5, 0xff, 0xff, 0xff, 0x37, 0x13, 0x00, 0x5f, 0x39,
+        0xff, 0xff, 0xff, 0xd4, 0x30, 0x00, 0x05, 0x0c, 0x01, 0x00, 0x5a, 0xed, 0xff, 0xff, 0xff,
+        0x11, 0x13, 0x00, 0x10, 0x13, 0xd3, 0x00, 0x0f, 0x30, 0x00, 0x05, 0x0c, 0x01, 0x00, 0x4b,
+        0xfe, 0xff, 0xff, 0xff, 0xb2, 0x02, 0x5f, 0x01, 0x55, 0x55, 0x55, 0x54, 0x30, 0x00, 0x05,
+        0x0c, 0x01, 0x00, 0x00, 0xae, 0x01, 0x0f, 0x27, 0x00, 0x10, 0x0f, 0x01, 0x00, 0x06, 0x0f,
+        0x40, 0x00, 0x98, 0x3e, 0x23, 0x4d, 0x55, 0x01, 0x00, 0x00, 0x40, 0x00, 0x03, 0x0b, 0x00,
+        0x2f, 0x4d, 0x23, 0x3e, 0x00, 0x09, 0x2a, 0x1a, 0xb9, 0xa6, 0x03, 0x0f, 0x01, 0x00, 0x01,
+        0x1f, 0xb8, 0xfb, 0x03, 0x07, 0x2f, 0x13, 0xdc, 0x3f, 0x00, 0x0f, 0x4f, 0xff, 0xff, 0xdc,
+        0x12, 0x40, 0x00, 0x05, 0x1f, 0x8f, 0x3e, 0x00, 0x10, 0x4f, 0xff, 0xff, 0xff, 0x8d, 0x40,
+        0x00, 0x05, 0x6f, 0xe1, 0xff, 0xff, 0xff, 0xce, 0xaa, 0x01, 0x00, 0x0a, 0x5f, 0xce, 0xff,
+        0xff, 0xff, 0xdf, 0x40, 0x00, 0x05, 0x5f, 0xfc, 0xff, 0xff, 0xff, 0x0c, 0x1d, 0x00, 0x05,
+        0x02, 0x01, 0x00, 0x5f, 0x0c, 0xff, 0xff, 0xff, 0xfc, 0x1d, 0x00, 0x05, 0x00, 0x9d, 0x00,
+        0x0f, 0x1c, 0x00, 0x05, 0x0f, 0x24, 0x00, 0x11, 0x0f, 0x40, 0x00, 0xff, 0x7f, 0x6f, 0x0b,
+        0x69, 0xa0, 0xa0, 0x69, 0x0b, 0x24, 0x00, 0x0b, 0x0f, 0x1c, 0x00, 0x08, 0x10, 0x2b, 0x91,
+        0x02, 0x3f, 0xff, 0xe0, 0x2b, 0x24, 0x00, 0x09, 0x0f, 0x1c, 0x00, 0x08, 0x11, 0x0b, 0x3f,
+        0x00, 0x38, 0xff, 0xff, 0xe0, 0x82, 0x00, 0x0f, 0x40, 0x00, 0x18, 0x14, 0x69, 0x31, 0x03,
+        0x1f, 0x68, 0x24, 0x00, 0x07, 0x09, 0x01, 0x00, 0x0b, 0x1c, 0x00, 0x14, 0x9f, 0x40, 0x00,
+        0x1f, 0x9e, 0x24, 0x00, 0x07, 0x09, 0x01, 0x00, 0x0f, 0x40, 0x00, 0x3c, 0x05, 0xc0, 0x00,
+        0x1f, 0x67, 0x24, 0x00, 0x07, 0x09, 0x01, 0x00, 0x0b, 0x1c, 0x00, 0x22, 0x0b, 0xe0, 0x3f,
+        0x00, 0x1f, 0xdf, 0x40, 0x01, 0x24, 0x21, 0x00, 0x2b, 0x41, 0x00, 0x1f, 0xdf, 0xc0, 0x01,
+        0x25, 0x7f, 0x00, 0x00, 0x0b, 0x68, 0x9f, 0x9f, 0x67, 0x40, 0x02, 0x27, 0x0f, 0x24, 0x00,
+        0x1d, 0x0f, 0x40, 0x00, 0xff, 0x6e, 0x0f, 0x40, 0x06, 0x2d, 0x0f, 0xc0, 0x06, 0x2d, 0x14,
+        0x8e, 0x31, 0x03, 0x0f, 0x01, 0x00, 0x0b, 0x1f, 0x8c, 0x40, 0x00, 0x05, 0x1f, 0x12, 0xc0,
+        0x07, 0x12, 0x1b, 0xdb, 0xcb, 0x09, 0x07, 0x01, 0x00, 0x2f, 0x1a, 0xb8, 0x3f, 0x00, 0x0f,
+        0x2f, 0xb6, 0x19, 0x3f, 0x00, 0x06, 0x00, 0xe9, 0x0b, 0x0f, 0xc0, 0x08, 0x01, 0x07, 0x01,
+        0x00, 0x2f, 0x4d, 0x22, 0x3e, 0x00, 0x09, 0x0f, 0x01, 0x00, 0xff, 0x5c, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x00,
 
 };
 
@@ -127,11 +68,11 @@ const lv_image_dsc_t icon_lock_open_right = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 64,
                  .h = 64,
-                 .stride = 128,
+                 .stride = 64,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_lock_open_right_map),
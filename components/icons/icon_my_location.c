@@ -20,49 +20,27 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_MY_LOCATION uint8_t
     icon_my_location_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0x6e, 0x02, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0x32, 0x4f, 0x04, 0x21, 0x04, 0x21, 0x49, 0x00, 0x19, 0x4f, 0xe3, 0x18, 0xe3, 0x18,
-        0x30, 0x00, 0x15, 0x35, 0xc3, 0x18, 0xe3, 0x02, 0x00, 0x0f, 0x34, 0x00, 0x0d, 0x06, 0x2a,
-        0x00, 0x02, 0x02, 0x00, 0x2f, 0x04, 0x21, 0x34, 0x00, 0x09, 0x02, 0x24, 0x00, 0x66, 0xe3,
-        0x18, 0xe3, 0x18, 0xc3, 0x18, 0x66, 0x00, 0x0f, 0xca, 0x00, 0x05, 0x88, 0xe3, 0x18, 0xe3,
-        0x18, 0x04, 0x21, 0xa2, 0x10, 0x84, 0x00, 0x22, 0xa2, 0x10, 0x16, 0x00, 0x08, 0x14, 0x00,
-        0x02, 0x02, 0x00, 0x02, 0x18, 0x00, 0x22, 0x00, 0x00, 0x0e, 0x00, 0x06, 0x02, 0x00, 0x22,
-        0x00, 0x00, 0x72, 0x00, 0x06, 0x12, 0x00, 0x02, 0x02, 0x00, 0x44, 0xe3, 0x18, 0xe3, 0x18,
-        0x5c, 0x00, 0x46, 0xe3, 0x18, 0x04, 0x21, 0xba, 0x00, 0x2e, 0x24, 0x21, 0x2e, 0x01, 0x02,
-        0xae, 0x00, 0x02, 0x3a, 0x00, 0x11, 0x04, 0x20, 0x00, 0x02, 0x70, 0x00, 0x08, 0x12, 0x00,
-        0x02, 0x0c, 0x00, 0x02, 0x02, 0x00, 0x02, 0x20, 0x00, 0x00, 0xec, 0x01, 0x02, 0x0a, 0x00,
-        0x06, 0x02, 0x00, 0x06, 0x14, 0x00, 0x02, 0x2a, 0x00, 0x06, 0x22, 0x00, 0x02, 0x8e, 0x00,
-        0x02, 0x5e, 0x00, 0x00, 0x26, 0x02, 0x11, 0xc3, 0x00, 0x01, 0x00, 0x30, 0x02, 0x02, 0xf6,
-        0x00, 0x04, 0x96, 0x00, 0x02, 0x0a, 0x00, 0x08, 0x30, 0x00, 0x11, 0xc3, 0xdc, 0x01, 0x0f,
-        0x30, 0x00, 0x05, 0x06, 0x64, 0x00, 0x06, 0x0a, 0x00, 0x06, 0x80, 0x01, 0x06, 0x14, 0x00,
-        0x02, 0x2a, 0x00, 0x02, 0x02, 0x00, 0x0f, 0xf0, 0x00, 0x1d, 0x02, 0xb8, 0x00, 0x02, 0xc2,
-        0x00, 0x0f, 0x50, 0x01, 0x11, 0x04, 0xc6, 0x00, 0x0f, 0xb0, 0x01, 0x17, 0x02, 0x62, 0x00,
-        0x39, 0xe3, 0x18, 0x24, 0xf8, 0x02, 0x11, 0x24, 0x8c, 0x01, 0x02, 0x26, 0x01, 0x0e, 0x02,
-        0x00, 0x02, 0x4c, 0x01, 0x82, 0x04, 0x21, 0xe3, 0x18, 0xa2, 0x10, 0xa2, 0x10, 0xe4, 0x01,
-        0x0f, 0x2e, 0x00, 0x07, 0x06, 0x96, 0x00, 0x08, 0x02, 0x00, 0x0f, 0x5c, 0x00, 0x05, 0x06,
-        0x02, 0x00, 0x08, 0x2e, 0x00, 0x06, 0x16, 0x00, 0x0f, 0x02, 0x00, 0x0b, 0x0e, 0x62, 0x02,
-        0x0f, 0x02, 0x00, 0x0b, 0x0f, 0xf0, 0x03, 0x1d, 0x0f, 0x02, 0x00, 0x07, 0x1f, 0x00, 0x01,
-        0x00, 0x0f, 0x2f, 0x26, 0x26, 0x24, 0x00, 0x03, 0x2f, 0xbf, 0xbf, 0x18, 0x00, 0x01, 0x6c,
-        0x1c, 0x55, 0xdc, 0xdc, 0x55, 0x1b, 0x1a, 0x00, 0x30, 0x34, 0xbb, 0xfd, 0xea, 0x04, 0x39,
-        0xfd, 0xba, 0x33, 0x1a, 0x00, 0xc7, 0x73, 0xfd, 0xe6, 0x76, 0x2b, 0x0a, 0x0a, 0x2b, 0x77,
-        0xe7, 0xfc, 0x71, 0x19, 0x00, 0x42, 0x72, 0xff, 0xaa, 0x0c, 0x0f, 0x00, 0x36, 0x0c, 0xab,
-        0xff, 0x19, 0x00, 0x42, 0x34, 0xfd, 0xaa, 0x01, 0x17, 0x00, 0x64, 0x00, 0x00, 0x01, 0xac,
-        0xfc, 0x32, 0x0c, 0x00, 0xf3, 0x01, 0xbb, 0xe6, 0x0c, 0x00, 0x00, 0x00, 0x24, 0x67, 0x67,
-        0x23, 0x00, 0x00, 0x00, 0x0d, 0xe8, 0xb9, 0x18, 0x00, 0xf3, 0x02, 0x1c, 0xfd, 0x76, 0x00,
-        0x00, 0x00, 0x60, 0xf7, 0xff, 0xff, 0xf7, 0x60, 0x00, 0x00, 0x00, 0x78, 0xfd, 0x96, 0x00,
-        0xf7, 0x1d, 0x55, 0xff, 0x2b, 0x00, 0x00, 0x24, 0xf7, 0xb5, 0x1b, 0x1b, 0xb6, 0xf7, 0x23,
-        0x00, 0x00, 0x2d, 0xff, 0x54, 0x00, 0x00, 0x00, 0x00, 0x25, 0xbb, 0xd9, 0xff, 0x0b, 0x00,
-        0x00, 0x67, 0xff, 0x1b, 0x00, 0x00, 0x1c, 0xff, 0x67, 0x00, 0x00, 0x0c, 0xff, 0xd9, 0xbb,
-        0x25, 0x18, 0x00, 0x1a, 0x1c, 0x18, 0x00, 0x03, 0x48, 0x00, 0x58, 0x23, 0xf7, 0xb6, 0x1c,
-        0x1c, 0x48, 0x00, 0x54, 0x00, 0x00, 0x1c, 0xfd, 0x77, 0x78, 0x00, 0x73, 0x5f, 0x00, 0x00,
-        0x00, 0x79, 0xfd, 0x1a, 0x91, 0x00, 0xa1, 0xba, 0xe7, 0x0c, 0x00, 0x00, 0x00, 0x23, 0x67,
-        0x67, 0x22, 0xa8, 0x00, 0x13, 0xb7, 0x17, 0x00, 0x48, 0x00, 0x33, 0xfc, 0xab, 0xd8, 0x00,
-        0x14, 0x31, 0x18, 0x00, 0x52, 0x00, 0x71, 0xff, 0xac, 0x0d, 0x0d, 0x00, 0x42, 0x0d, 0xac,
-        0xff, 0x70, 0x0a, 0x00, 0x01, 0x02, 0x00, 0xb8, 0x71, 0xfc, 0xe8, 0x78, 0x2d, 0x0b, 0x0b,
-        0x2e, 0x79, 0xe8, 0xfc, 0x17, 0x00, 0x42, 0x00, 0x00, 0x32, 0xb9, 0x68, 0x01, 0x21, 0xb8,
-        0x30, 0x28, 0x00, 0x07, 0x02, 0x00, 0x54, 0x1a, 0x54, 0xdc, 0xdc, 0x54, 0x8a, 0x00, 0x09,
-        0x02, 0x00, 0x0f, 0xc8, 0x01, 0x03, 0x0f, 0xf8, 0x01, 0x07, 0x04, 0x02, 0x00, 0x50, 0x00,
-        0x00, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0x2c, 0x01, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0x0f, 0x2f, 0x26, 0x26, 0x18, 0x00, 0x03, 0x2f, 0xbf, 0xbf, 0x16, 0x00, 0x01, 0x6c,
+        0x1c, 0x55, 0xdc, 0xdc, 0x55, 0x1b, 0x16, 0x00, 0xa9, 0x34, 0xbb, 0xfd, 0xff, 0xff, 0xff,
+        0xff, 0xfd, 0xba, 0x33, 0x17, 0x00, 0xc7, 0x73, 0xfd, 0xe6, 0x76, 0x2b, 0x0a, 0x0a, 0x2b,
+        0x77, 0xe7, 0xfc, 0x71, 0x17, 0x00, 0x42, 0x72, 0xff, 0xaa, 0x0c, 0x0a, 0x00, 0x36, 0x0c,
+        0xab, 0xff, 0x19, 0x00, 0x44, 0x34, 0xfd, 0xaa, 0x01, 0x0c, 0x00, 0x44, 0x01, 0xac, 0xfc,
+        0x32, 0x0c, 0x00, 0x20, 0xbb, 0xe6, 0x2e, 0x00, 0xa3, 0x24, 0x67, 0x67, 0x23, 0x00, 0x00,
+        0x00, 0x0d, 0xe8, 0xb9, 0x17, 0x00, 0xf3, 0x02, 0x1c, 0xfd, 0x76, 0x00, 0x00, 0x00, 0x60,
+        0xf7, 0xff, 0xff, 0xf7, 0x60, 0x00, 0x00, 0x00, 0x78, 0xfd, 0x96, 0x00, 0xf0, 0x03, 0x55,
+        0xff, 0x2b, 0x00, 0x00, 0x24, 0xf7, 0xb5, 0x1b, 0x1b, 0xb6, 0xf7, 0x23, 0x00, 0x00, 0x2d,
+        0xff, 0x54, 0x16, 0x00, 0xf7, 0x07, 0x25, 0xbb, 0xd9, 0xff, 0x0b, 0x00, 0x00, 0x67, 0xff,
+        0x1b, 0x00, 0x00, 0x1c, 0xff, 0x67, 0x00, 0x00, 0x0c, 0xff, 0xd9, 0xbb, 0x25, 0x18, 0x00,
+        0x1a, 0x1c, 0x18, 0x00, 0x03, 0x48, 0x00, 0x58, 0x23, 0xf7, 0xb6, 0x1c, 0x1c, 0x48, 0x00,
+        0x00, 0x78, 0x00, 0x14, 0x77, 0x78, 0x00, 0x73, 0x5f, 0x00, 0x00, 0x00, 0x79, 0xfd, 0x1a,
+        0x91, 0x00, 0x20, 0xba, 0xe7, 0xa8, 0x00, 0x41, 0x23, 0x67, 0x67, 0x22, 0xa8, 0x00, 0x14,
+        0xb7, 0xc0, 0x00, 0x38, 0x33, 0xfc, 0xab, 0xd8, 0x00, 0x14, 0x31, 0x0c, 0x00, 0x52, 0x00,
+        0x71, 0xff, 0xac, 0x0d, 0x0a, 0x00, 0x45, 0x0d, 0xac, 0xff, 0x70, 0x17, 0x00, 0xd8, 0x00,
+        0x00, 0x71, 0xfc, 0xe8, 0x78, 0x2d, 0x0b, 0x0b, 0x2e, 0x79, 0xe8, 0xfc, 0x17, 0x00, 0x42,
+        0x00, 0x00, 0x32, 0xb9, 0x68, 0x01, 0x29, 0xb8, 0x30, 0x17, 0x00, 0x84, 0x00, 0x00, 0x00,
+        0x1a, 0x54, 0xdc, 0xdc, 0x54, 0x8a, 0x00, 0x09, 0x01, 0x00, 0x0f, 0xc8, 0x01, 0x03, 0x0f,
+        0xf8, 0x01, 0x07, 0x04, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
 
 };
 
@@ -70,11 +48,11 @@ const lv_image_dsc_t icon_my_location = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 24,
                  .h = 24,
-                 .stride = 48,
+                 .stride = 24,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_my_location_map),
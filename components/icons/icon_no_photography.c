@@ -20,104 +20,44 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_NO_PHOTOGRAPHY
     uint8_t icon_no_photography_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0xac, 0x05, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0xff, 0x75, 0x2f, 0xc3, 0x18, 0x89, 0x01, 0x49, 0x5f, 0x04, 0x21, 0xe3, 0x18, 0xe3,
-        0x62, 0x00, 0x46, 0x24, 0xe3, 0x18, 0x02, 0x00, 0x0f, 0xc4, 0x00, 0x43, 0x22, 0x45, 0x29,
-        0xc0, 0x00, 0x0f, 0xc4, 0x00, 0x03, 0x02, 0x18, 0x00, 0x0f, 0x02, 0x00, 0x01, 0x2f, 0x04,
-        0x21, 0x90, 0x00, 0x15, 0x0f, 0x62, 0x00, 0x07, 0x06, 0x7a, 0x00, 0x0f, 0x02, 0x00, 0x03,
-        0x0f, 0x62, 0x00, 0x2b, 0x0f, 0x5e, 0x00, 0x0d, 0x0f, 0xf2, 0x00, 0x03, 0x0f, 0x02, 0x00,
-        0x03, 0x0f, 0xc4, 0x00, 0x01, 0x13, 0xc3, 0x9a, 0x01, 0x0e, 0x0a, 0x01, 0x02, 0x5c, 0x00,
-        0x6f, 0xe3, 0x18, 0xe3, 0x18, 0xa2, 0x10, 0x50, 0x00, 0x03, 0x0e, 0x02, 0x00, 0x02, 0x30,
-        0x00, 0x02, 0x02, 0x00, 0x04, 0x1e, 0x00, 0x2f, 0xa2, 0x10, 0x5e, 0x00, 0x01, 0x00, 0x56,
-        0x04, 0x02, 0x28, 0x00, 0x0f, 0x02, 0x00, 0x01, 0x02, 0x20, 0x00, 0x0c, 0x02, 0x00, 0x0c,
-        0x2a, 0x00, 0x04, 0x20, 0x00, 0x24, 0x00, 0x00, 0x0a, 0x00, 0x0c, 0x02, 0x00, 0x0f, 0x3e,
-        0x01, 0x07, 0x0c, 0x2a, 0x00, 0x0f, 0x90, 0x00, 0x03, 0x02, 0x18, 0x00, 0x0f, 0x02, 0x00,
-        0x09, 0x0c, 0x94, 0x00, 0x04, 0x02, 0x00, 0x0f, 0x34, 0x00, 0x01, 0x04, 0x1c, 0x00, 0x08,
-        0x96, 0x00, 0x0f, 0x28, 0x00, 0x01, 0x0f, 0x02, 0x00, 0x09, 0x04, 0x44, 0x00, 0x0f, 0x24,
-        0x00, 0x01, 0x02, 0x1c, 0x00, 0x00, 0xb0, 0x05, 0x0f, 0xea, 0x01, 0x01, 0x0f, 0x02, 0x00,
-        0x15, 0x06, 0x46, 0x00, 0x0c, 0x02, 0x00, 0x08, 0x1a, 0x00, 0x0f, 0x62, 0x00, 0x27, 0x08,
-        0x46, 0x00, 0x0a, 0x02, 0x00, 0x0a, 0x1a, 0x00, 0x0f, 0x26, 0x01, 0x03, 0x1f, 0x24, 0xa8,
-        0x04, 0x0e, 0x0a, 0x46, 0x00, 0x08, 0x02, 0x00, 0x0c, 0x1a, 0x00, 0x0f, 0x62, 0x00, 0x01,
-        0x44, 0xa2, 0x10, 0x04, 0x21, 0xa2, 0x01, 0x08, 0x3c, 0x00, 0x06, 0x02, 0x00, 0x0c, 0x46,
-        0x00, 0x06, 0x02, 0x00, 0x0e, 0x1a, 0x00, 0x0f, 0x62, 0x00, 0x07, 0x2f, 0xe3, 0x18, 0x16,
-        0x03, 0x0b, 0x06, 0x56, 0x00, 0x06, 0x02, 0x00, 0x02, 0x36, 0x00, 0x06, 0x10, 0x00, 0x00,
-        0x9a, 0x07, 0x0f, 0x62, 0x00, 0x1f, 0x0f, 0x46, 0x00, 0x01, 0x02, 0x02, 0x00, 0x0f, 0x1a,
-        0x00, 0x03, 0x02, 0x72, 0x01, 0x02, 0x02, 0x00, 0x02, 0x28, 0x00, 0x04, 0x26, 0x01, 0x02,
-        0x02, 0x00, 0x04, 0x14, 0x00, 0x04, 0x02, 0x00, 0x0f, 0x16, 0x00, 0x03, 0x06, 0x60, 0x03,
-        0x02, 0x0c, 0x00, 0x06, 0x02, 0x00, 0x02, 0x30, 0x00, 0x04, 0x02, 0x00, 0x04, 0x18, 0x00,
-        0x02, 0x88, 0x01, 0x0f, 0x94, 0x06, 0x01, 0x0f, 0x16, 0x00, 0x03, 0x0f, 0x60, 0x00, 0x15,
-        0x0c, 0x62, 0x00, 0x0f, 0xf8, 0x04, 0x05, 0x02, 0x52, 0x00, 0x0a, 0x02, 0x00, 0x0f, 0x7a,
-        0x00, 0x01, 0x02, 0x90, 0x02, 0x24, 0xe3, 0x18, 0x48, 0x05, 0x08, 0xb2, 0x00, 0x04, 0xc4,
-        0x00, 0x0f, 0x46, 0x00, 0x0f, 0x02, 0x02, 0x00, 0x0a, 0x3e, 0x00, 0x02, 0x02, 0x00, 0x02,
-        0x14, 0x00, 0x2f, 0xe3, 0x18, 0xea, 0x01, 0x07, 0x0c, 0xc2, 0x00, 0x02, 0x32, 0x00, 0x02,
-        0x3e, 0x00, 0x0a, 0x02, 0x00, 0x0f, 0x1a, 0x00, 0x01, 0x04, 0x40, 0x02, 0x0f, 0x4c, 0x02,
-        0x07, 0x1b, 0x24, 0x24, 0x07, 0x0f, 0x46, 0x00, 0x01, 0x02, 0x02, 0x00, 0x0f, 0x1a, 0x00,
-        0x01, 0x04, 0x60, 0x00, 0x02, 0xa6, 0x00, 0x04, 0x0e, 0x00, 0x02, 0xd2, 0x00, 0x0f, 0x02,
-        0x00, 0x03, 0x0f, 0x1e, 0x00, 0x07, 0x0f, 0x1a, 0x00, 0x03, 0x02, 0x16, 0x00, 0x02, 0xc2,
-        0x00, 0x0f, 0x62, 0x00, 0x11, 0x02, 0x30, 0x00, 0x0f, 0x7c, 0x00, 0x01, 0x0f, 0x1a, 0x00,
-        0x03, 0x02, 0x16, 0x00, 0x0f, 0x62, 0x00, 0x17, 0x08, 0x2c, 0x00, 0x0a, 0x02, 0x00, 0x0f,
-        0x1a, 0x00, 0x03, 0x02, 0x16, 0x00, 0x04, 0x02, 0x00, 0x00, 0x6e, 0x0b, 0x0f, 0x4c, 0x02,
-        0x01, 0x06, 0x02, 0x00, 0x02, 0x2a, 0x00, 0x06, 0x10, 0x00, 0x06, 0x02, 0x00, 0x0f, 0x1a,
-        0x00, 0x05, 0x02, 0x18, 0x00, 0x02, 0x02, 0x00, 0x08, 0x82, 0x01, 0x02, 0x02, 0x00, 0x06,
-        0x40, 0x00, 0x02, 0x02, 0x00, 0x0f, 0x16, 0x00, 0x03, 0x0f, 0x60, 0x03, 0x07, 0x06, 0x1a,
-        0x00, 0x0f, 0x02, 0x00, 0x05, 0x02, 0x24, 0x00, 0x04, 0x02, 0x00, 0x02, 0x26, 0x00, 0x04,
-        0x0e, 0x00, 0x08, 0x02, 0x00, 0x0f, 0x1a, 0x00, 0x07, 0x04, 0x1c, 0x00, 0x08, 0x02, 0x00,
-        0x04, 0x7a, 0x03, 0x08, 0x72, 0x03, 0x06, 0x2a, 0x00, 0x02, 0x0c, 0x00, 0x0a, 0x02, 0x00,
-        0x0e, 0x2c, 0x00, 0x0c, 0x02, 0x00, 0x64, 0x24, 0x21, 0x04, 0x21, 0xe3, 0x18, 0xf2, 0x02,
-        0x08, 0x2c, 0x01, 0x06, 0x2a, 0x00, 0x02, 0x16, 0x00, 0x06, 0x10, 0x00, 0x06, 0x02, 0x00,
-        0x0f, 0x60, 0x00, 0x0f, 0x0c, 0x02, 0x00, 0x0f, 0x46, 0x07, 0x01, 0x02, 0xfe, 0x01, 0x0c,
-        0x2a, 0x00, 0x0f, 0xda, 0x00, 0x0b, 0x0f, 0x02, 0x00, 0x07, 0x0f, 0x62, 0x00, 0x05, 0x0f,
-        0x32, 0x00, 0x01, 0x02, 0xc0, 0x00, 0x0f, 0x1c, 0x00, 0x03, 0x0f, 0x02, 0x00, 0x07, 0x02,
-        0x10, 0x01, 0x02, 0x02, 0x00, 0x04, 0x26, 0x00, 0x0f, 0x32, 0x0a, 0x03, 0x02, 0x24, 0x00,
-        0x0f, 0x02, 0x00, 0x2b, 0x04, 0x62, 0x00, 0x0f, 0x02, 0x00, 0x01, 0x0f, 0x5a, 0x00, 0x2b,
-        0x04, 0x02, 0x00, 0x0f, 0x5a, 0x00, 0x01, 0x04, 0x02, 0x00, 0x04, 0x24, 0x00, 0x0f, 0x02,
-        0x00, 0x2b, 0x04, 0x4e, 0x00, 0x0f, 0x02, 0x00, 0x3b, 0x0f, 0xea, 0x01, 0x01, 0x0f, 0x02,
-        0x00, 0x3b, 0x0f, 0x62, 0x00, 0x4f, 0x06, 0x4c, 0x02, 0x02, 0x30, 0x06, 0x0f, 0x02, 0x00,
-        0x3f, 0x04, 0xc4, 0x00, 0x0f, 0x60, 0x00, 0x45, 0x02, 0xc4, 0x00, 0x0f, 0x5e, 0x00, 0x47,
-        0x0f, 0x02, 0x00, 0x5f, 0x1f, 0x00, 0x01, 0x00, 0xb0, 0x1f, 0x1c, 0xc4, 0x00, 0x1b, 0x3f,
-        0x30, 0xec, 0x8c, 0x31, 0x00, 0x19, 0x5f, 0x29, 0xee, 0xff, 0xff, 0x87, 0x31, 0x00, 0x18,
-        0x56, 0x06, 0xb2, 0xff, 0xff, 0xff, 0x62, 0x00, 0x26, 0x22, 0xe6, 0xd5, 0x01, 0x2f, 0xe9,
-        0x27, 0x48, 0x00, 0x01, 0x09, 0x31, 0x00, 0x26, 0x16, 0xd9, 0x2f, 0x00, 0x4f, 0xff, 0xff,
+        0x02, 0x00, 0x00, 0x00, 0x22, 0x02, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0xb0, 0x1f, 0x1c, 0x24, 0x00, 0x10, 0x07, 0x01, 0x00, 0x3f, 0x30, 0xec, 0x8c, 0x26,
+        0x00, 0x10, 0x05, 0x01, 0x00, 0x5f, 0x29, 0xee, 0xff, 0xff, 0x87, 0x28, 0x00, 0x10, 0x04,
+        0x01, 0x00, 0x56, 0x06, 0xb2, 0xff, 0xff, 0xff, 0x62, 0x00, 0x35, 0x22, 0xe6, 0xff, 0x01,
+        0x00, 0x2f, 0xe9, 0x27, 0x31, 0x00, 0x0e, 0x26, 0x16, 0xd9, 0x2f, 0x00, 0x4f, 0xff, 0xff,
         0xdd, 0x1a, 0x31, 0x00, 0x0c, 0x28, 0x0f, 0xce, 0x2f, 0x00, 0x4f, 0xff, 0xff, 0xd3, 0x12,
-        0x31, 0x00, 0x0b, 0x54, 0x0a, 0xbe, 0xff, 0xfc, 0x50, 0x23, 0x00, 0x64, 0x44, 0xf9, 0xff,
-        0xff, 0xc8, 0x0c, 0x0e, 0x00, 0x08, 0x02, 0x00, 0x33, 0x4a, 0xfd, 0xff, 0xf5, 0x00, 0x36,
-        0x0c, 0xc1, 0x60, 0x19, 0x00, 0x24, 0x5c, 0xfe, 0x6e, 0x00, 0x36, 0xf6, 0xc6, 0x42, 0x17,
-        0x00, 0x31, 0x00, 0x42, 0xfd, 0x18, 0x00, 0x01, 0x26, 0x01, 0x17, 0x03, 0x18, 0x00, 0x21,
-        0x00, 0x70, 0x18, 0x00, 0x01, 0x02, 0x00, 0x17, 0xfd, 0x31, 0x00, 0x11, 0xc7, 0x12, 0x00,
-        0x03, 0x31, 0x00, 0x09, 0x02, 0x00, 0x13, 0x85, 0x1a, 0x00, 0x46, 0xff, 0xff, 0xff, 0xc6,
-        0x19, 0x00, 0x64, 0xf6, 0xff, 0xff, 0x1b, 0x08, 0xb7, 0x93, 0x00, 0x0f, 0x02, 0x00, 0x01,
-        0x46, 0x1b, 0xff, 0xff, 0xf6, 0x18, 0x00, 0x3b, 0xff, 0xff, 0xff, 0x57, 0x01, 0x0d, 0x02,
-        0x00, 0x01, 0x23, 0x00, 0x04, 0x02, 0x00, 0x02, 0x0d, 0x00, 0x09, 0x88, 0x01, 0x0c, 0x02,
-        0x00, 0x02, 0x23, 0x00, 0x03, 0x02, 0x00, 0x03, 0x0d, 0x00, 0x07, 0x93, 0x00, 0x2b, 0x15,
-        0x2d, 0x79, 0x01, 0x03, 0x23, 0x00, 0x02, 0x02, 0x00, 0x04, 0x0d, 0x00, 0x06, 0x31, 0x00,
-        0x62, 0x0c, 0xc2, 0xff, 0xd2, 0x75, 0x09, 0x1e, 0x00, 0x01, 0x02, 0x00, 0x04, 0x23, 0x00,
-        0x01, 0x02, 0x00, 0x05, 0x0d, 0x00, 0x09, 0x31, 0x00, 0x31, 0xff, 0xde, 0x2e, 0x1e, 0x00,
-        0x01, 0x02, 0x00, 0x05, 0x23, 0x00, 0x0a, 0x0d, 0x00, 0x0a, 0x31, 0x00, 0x22, 0xf1, 0x2f,
-        0x20, 0x00, 0x09, 0x23, 0x00, 0x0a, 0x0d, 0x00, 0x24, 0x0d, 0xf2, 0x57, 0x01, 0x55, 0x0c,
-        0xc2, 0xff, 0xff, 0xdf, 0x93, 0x00, 0x0f, 0x60, 0x00, 0x04, 0x21, 0x00, 0x6a, 0x9c, 0x01,
-        0x01, 0xea, 0x01, 0x51, 0x0c, 0xc2, 0xff, 0xff, 0x75, 0x50, 0x00, 0x0a, 0x53, 0x00, 0x09,
-        0x3d, 0x00, 0x47, 0xce, 0xff, 0xff, 0xe4, 0x62, 0x00, 0x11, 0xd2, 0x2d, 0x00, 0x0f, 0x30,
-        0x00, 0x07, 0x55, 0x0e, 0xff, 0xff, 0xf6, 0x13, 0xea, 0x01, 0x41, 0x0c, 0xc2, 0xff, 0x11,
-        0x2e, 0x00, 0x09, 0x53, 0x00, 0x08, 0x0d, 0x00, 0x49, 0x2c, 0xff, 0xff, 0xd4, 0xf5, 0x00,
-        0x04, 0x23, 0x01, 0x0f, 0xc0, 0x00, 0x04, 0x49, 0x30, 0xff, 0xff, 0xcf, 0x26, 0x01, 0x1f,
-        0x15, 0x60, 0x00, 0x0b, 0x58, 0x16, 0xff, 0xff, 0xf5, 0x08, 0x31, 0x00, 0x04, 0x02, 0x00,
-        0x0f, 0x60, 0x00, 0x04, 0x6f, 0x00, 0xd5, 0xff, 0xff, 0x64, 0x00, 0x31, 0x00, 0x00, 0x0f,
-        0x30, 0x00, 0x05, 0x5f, 0x75, 0xff, 0xff, 0xef, 0x2b, 0x31, 0x00, 0x00, 0x0f, 0x30, 0x00,
-        0x05, 0xb4, 0x09, 0xdd, 0xff, 0xff, 0xef, 0x65, 0x09, 0x00, 0x00, 0x14, 0xe3, 0x57, 0x01,
-        0x01, 0x02, 0x00, 0x0f, 0x30, 0x00, 0x05, 0xa6, 0x00, 0x2b, 0xf0, 0xff, 0xff, 0xff, 0xf5,
-        0xd2, 0xd5, 0xf7, 0xb9, 0x01, 0x0a, 0x43, 0x01, 0x0c, 0x8d, 0x01, 0x21, 0x2b, 0xdc, 0x2a,
-        0x00, 0x35, 0xff, 0xff, 0xff, 0x1b, 0x02, 0x0c, 0x23, 0x00, 0x09, 0x6d, 0x00, 0x40, 0x00,
-        0x09, 0x74, 0xd4, 0x46, 0x18, 0x35, 0xcd, 0x6a, 0x0d, 0xb9, 0x01, 0x0b, 0x23, 0x00, 0x0a,
-        0x30, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x15, 0x2e, 0x2b, 0x0d, 0xf5, 0x00, 0x18, 0xc2, 0x8b,
-        0x06, 0x0d, 0x30, 0x00, 0x04, 0x02, 0x00, 0x06, 0xa3, 0x03, 0x34, 0x0a, 0xbe, 0xff, 0x15,
-        0x00, 0x0f, 0x30, 0x00, 0x08, 0x09, 0x31, 0x00, 0x06, 0x30, 0x00, 0x46, 0xf6, 0xff, 0xff,
-        0x1b, 0x0e, 0x00, 0x09, 0x02, 0x00, 0x07, 0x4c, 0x02, 0x06, 0x18, 0x00, 0x04, 0xb0, 0x04,
-        0x0f, 0x02, 0x00, 0x06, 0x01, 0x10, 0x03, 0x06, 0x02, 0x00, 0x12, 0x41, 0x10, 0x05, 0x0f,
-        0x02, 0x00, 0x08, 0x0b, 0x31, 0x00, 0x3f, 0x42, 0xc6, 0xf6, 0x2d, 0x00, 0x08, 0x0f, 0x2b,
-        0x05, 0x03, 0x0f, 0x02, 0x00, 0x07, 0x06, 0xf5, 0x00, 0x0f, 0x02, 0x00, 0x14, 0x0f, 0x31,
-        0x00, 0x1e, 0x01, 0x26, 0x01, 0x1f, 0x70, 0x5e, 0x00, 0x14, 0x03, 0x88, 0x01, 0x22, 0xd7,
-        0x18, 0x0b, 0x00, 0x0f, 0x02, 0x00, 0x13, 0x3f, 0x08, 0x92, 0x16, 0x29, 0x00, 0x13, 0x0f,
-        0x02, 0x00, 0x27, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x31, 0x00, 0x0b, 0x54, 0x0a, 0xbe, 0xff, 0xfc, 0x50, 0x17, 0x00, 0x6f, 0x44, 0xf9, 0xff,
+        0xff, 0xc8, 0x0c, 0x31, 0x00, 0x01, 0x33, 0x4a, 0xfd, 0xff, 0xf5, 0x00, 0x36, 0x0c, 0xc1,
+        0x60, 0x17, 0x00, 0x24, 0x5c, 0xfe, 0x68, 0x00, 0x37, 0xf6, 0xc6, 0x42, 0x2f, 0x00, 0x10,
+        0x42, 0x2f, 0x00, 0x03, 0x31, 0x00, 0x18, 0x03, 0x48, 0x00, 0x16, 0x70, 0x9a, 0x00, 0x17,
+        0xfd, 0x31, 0x00, 0x13, 0xc7, 0x14, 0x00, 0x0e, 0x57, 0x01, 0x16, 0x85, 0x31, 0x00, 0x16,
+        0xc6, 0x16, 0x00, 0x6f, 0xf6, 0xff, 0xff, 0x1b, 0x08, 0xb7, 0x31, 0x00, 0x02, 0x03, 0x01,
+        0x00, 0x46, 0x1b, 0xff, 0xff, 0xf6, 0x0e, 0x00, 0x3d, 0xff, 0xff, 0xff, 0x88, 0x01, 0x0b,
+        0x01, 0x00, 0x01, 0x23, 0x00, 0x0a, 0x0d, 0x00, 0x0f, 0x31, 0x00, 0x0a, 0x0f, 0x30, 0x00,
+        0x00, 0x17, 0x00, 0x93, 0x00, 0x2b, 0x15, 0x2d, 0x79, 0x01, 0x0f, 0x30, 0x00, 0x01, 0x07,
+        0x31, 0x00, 0x6f, 0x0c, 0xc2, 0xff, 0xd2, 0x75, 0x09, 0x30, 0x00, 0x0d, 0x0a, 0x31, 0x00,
+        0x3f, 0xff, 0xde, 0x2e, 0x30, 0x00, 0x0d, 0x0b, 0x31, 0x00, 0x2f, 0xf1, 0x2f, 0x30, 0x00,
+        0x0d, 0x38, 0x00, 0x0d, 0xf2, 0x31, 0x00, 0x15, 0xdf, 0x93, 0x00, 0x0f, 0x30, 0x00, 0x05,
+        0x16, 0x6a, 0xb9, 0x01, 0x00, 0x31, 0x00, 0x1f, 0x75, 0x30, 0x00, 0x0d, 0x48, 0xce, 0xff,
+        0xff, 0xe4, 0xf5, 0x00, 0x0f, 0x30, 0x00, 0x0c, 0x58, 0x0e, 0xff, 0xff, 0xf6, 0x13, 0xc4,
+        0x00, 0x1f, 0x11, 0x30, 0x00, 0x0b, 0x49, 0x2c, 0xff, 0xff, 0xd4, 0xf5, 0x00, 0x04, 0x23,
+        0x01, 0x0f, 0x30, 0x00, 0x04, 0x49, 0x30, 0xff, 0xff, 0xcf, 0x26, 0x01, 0x1f, 0x15, 0x30,
+        0x00, 0x0b, 0x59, 0x16, 0xff, 0xff, 0xf5, 0x08, 0xea, 0x01, 0x0f, 0x30, 0x00, 0x0b, 0x5a,
+        0x00, 0xd5, 0xff, 0xff, 0x64, 0x1b, 0x02, 0x0f, 0x30, 0x00, 0x0b, 0x5f, 0x75, 0xff, 0xff,
+        0xef, 0x2b, 0x31, 0x00, 0x00, 0x0f, 0x30, 0x00, 0x05, 0xb9, 0x09, 0xdd, 0xff, 0xff, 0xef,
+        0x65, 0x09, 0x00, 0x00, 0x14, 0xe3, 0x31, 0x00, 0x0f, 0x30, 0x00, 0x05, 0xaa, 0x00, 0x2b,
+        0xf0, 0xff, 0xff, 0xff, 0xf5, 0xd2, 0xd5, 0xf7, 0x72, 0x03, 0x0f, 0x30, 0x00, 0x06, 0x34,
+        0x00, 0x2b, 0xdc, 0x82, 0x03, 0x05, 0x1b, 0x02, 0x0f, 0x30, 0x00, 0x0a, 0x40, 0x00, 0x09,
+        0x74, 0xd4, 0x2e, 0x00, 0x37, 0xcd, 0x6a, 0x0d, 0xc4, 0x00, 0x0f, 0x30, 0x00, 0x08, 0x00,
+        0x2f, 0x03, 0x3a, 0x2e, 0x2b, 0x0d, 0xf5, 0x00, 0x1f, 0xc2, 0x30, 0x00, 0x0a, 0x04, 0x01,
+        0x00, 0x09, 0xc9, 0x04, 0x0f, 0x30, 0x00, 0x10, 0x09, 0x31, 0x00, 0x06, 0x16, 0x00, 0x00,
+        0x50, 0x04, 0x0f, 0x31, 0x00, 0x04, 0x07, 0x1b, 0x02, 0x06, 0x15, 0x00, 0x04, 0xb0, 0x04,
+        0x0f, 0x01, 0x00, 0x06, 0x0b, 0x98, 0x04, 0x12, 0x41, 0x10, 0x05, 0x0f, 0x31, 0x00, 0x17,
+        0x3f, 0x42, 0xc6, 0xf6, 0x31, 0x00, 0x1b, 0x0f, 0x01, 0x00, 0x0a, 0x0f, 0xfa, 0x04, 0x0b,
+        0x0f, 0x01, 0x00, 0x00, 0x0f, 0x31, 0x00, 0x1e, 0x01, 0x26, 0x01, 0x1f, 0x70, 0x29, 0x00,
+        0x10, 0x04, 0x01, 0x00, 0x5f, 0x06, 0xb2, 0xff, 0xd7, 0x18, 0x28, 0x00, 0x10, 0x05, 0x01,
+        0x00, 0x3f, 0x08, 0x92, 0x16, 0x26, 0x00, 0x10, 0x0f, 0x01, 0x00, 0x2a, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x00,
 
 };
 
@@ -125,11 +65,11 @@ const lv_image_dsc_t icon_no_photography = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 48,
                  .h = 48,
-                 .stride = 96,
+                 .stride = 48,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_no_photography_map),
@@ -20,48 +20,25 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_NO_PHOTOGRAPHY_24
     uint8_t icon_no_photography_24_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0x5e, 0x02, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0x4e, 0x4f, 0x24, 0x21, 0xe3, 0x18, 0x65, 0x00, 0x19, 0x46, 0xe3, 0x18, 0xe3, 0x18,
-        0x32, 0x00, 0x02, 0x0e, 0x00, 0x06, 0x02, 0x00, 0x0e, 0x4a, 0x00, 0x22, 0x00, 0x00, 0x1e,
-        0x00, 0x00, 0xca, 0x00, 0x04, 0x0c, 0x00, 0x06, 0x02, 0x00, 0x2f, 0x00, 0x00, 0x32, 0x00,
-        0x09, 0x02, 0x30, 0x00, 0x04, 0x22, 0x00, 0x26, 0x04, 0x21, 0x38, 0x00, 0x06, 0x16, 0x00,
-        0x08, 0x84, 0x00, 0x2a, 0xff, 0xff, 0x50, 0x00, 0x08, 0x30, 0x00, 0x06, 0x32, 0x00, 0x44,
-        0xe3, 0x18, 0xe3, 0x18, 0x4c, 0x00, 0x04, 0x5c, 0x00, 0x0a, 0x02, 0x00, 0x11, 0x24, 0x6a,
-        0x00, 0x04, 0x14, 0x00, 0x11, 0x04, 0x22, 0x01, 0x02, 0x8c, 0x00, 0x02, 0x16, 0x00, 0x44,
-        0x86, 0x31, 0x04, 0x21, 0x1e, 0x00, 0x02, 0x02, 0x00, 0x26, 0xe3, 0x18, 0x12, 0x00, 0x02,
-        0x30, 0x00, 0x08, 0x32, 0x00, 0x08, 0x3c, 0x00, 0x02, 0x02, 0x00, 0x0f, 0x30, 0x00, 0x01,
-        0x08, 0x28, 0x00, 0x0c, 0x32, 0x00, 0x0f, 0x30, 0x00, 0x03, 0x02, 0xcc, 0x00, 0x02, 0x96,
-        0x00, 0x02, 0x32, 0x00, 0x02, 0x5e, 0x00, 0x0f, 0x30, 0x00, 0x05, 0x04, 0xf6, 0x00, 0x06,
-        0x32, 0x00, 0x04, 0xb6, 0x00, 0x06, 0x0a, 0x00, 0x02, 0x26, 0x00, 0x02, 0x48, 0x00, 0x02,
-        0x2a, 0x01, 0x02, 0x5a, 0x00, 0x02, 0x5e, 0x01, 0x24, 0x86, 0x31, 0x1a, 0x00, 0x04, 0x3a,
-        0x00, 0x08, 0x30, 0x00, 0x02, 0x32, 0x00, 0x26, 0xa2, 0x10, 0x32, 0x00, 0x04, 0x02, 0x00,
-        0x0f, 0x30, 0x00, 0x09, 0x44, 0xe3, 0x18, 0x04, 0x21, 0x9a, 0x00, 0x0f, 0x30, 0x00, 0x0d,
-        0x02, 0x62, 0x00, 0x08, 0x02, 0x00, 0x02, 0x32, 0x00, 0x0f, 0x60, 0x00, 0x05, 0x02, 0x02,
-        0x00, 0x44, 0xe3, 0x18, 0x24, 0x21, 0x22, 0x01, 0x02, 0x32, 0x00, 0x08, 0x30, 0x00, 0x22,
-        0xe3, 0x18, 0x20, 0x00, 0x0e, 0x02, 0x00, 0x06, 0xc8, 0x00, 0x22, 0x00, 0x00, 0x38, 0x00,
-        0x0f, 0x82, 0x00, 0x01, 0x0f, 0x02, 0x00, 0x01, 0x02, 0x2a, 0x00, 0x04, 0x02, 0x00, 0x04,
-        0xe4, 0x00, 0x0f, 0x02, 0x00, 0x05, 0x04, 0x96, 0x00, 0x0f, 0x02, 0x00, 0x13, 0x06, 0x96,
-        0x00, 0x0f, 0x02, 0x00, 0x15, 0x28, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x02, 0x00, 0x19, 0x1f,
-        0x00, 0x01, 0x00, 0x1d, 0x2f, 0x0d, 0x64, 0x32, 0x00, 0x03, 0xf5, 0x00, 0x75, 0xff, 0x83,
-        0x00, 0x00, 0x00, 0x00, 0x09, 0x72, 0x77, 0x77, 0x77, 0x77, 0x73, 0x09, 0x25, 0x00, 0x82,
-        0x01, 0x96, 0xff, 0x8a, 0x00, 0x00, 0x03, 0xad, 0x95, 0x00, 0x25, 0xb3, 0x04, 0x19, 0x00,
-        0xf1, 0x04, 0x02, 0xbf, 0xff, 0x83, 0x00, 0x03, 0xa4, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x68,
-        0xff, 0xb0, 0x77, 0x77, 0x77, 0x43, 0x1c, 0x00, 0x71, 0x43, 0xff, 0xff, 0xff, 0x83, 0x00,
-        0x01, 0x0c, 0x00, 0x21, 0x00, 0x7d, 0x37, 0x00, 0x12, 0x42, 0x0b, 0x00, 0x22, 0x08, 0x9d,
-        0x64, 0x00, 0x03, 0x02, 0x00, 0xb1, 0x07, 0xff, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff,
-        0x00, 0x02, 0x19, 0x00, 0x23, 0x05, 0x10, 0x19, 0x00, 0x23, 0xff, 0x80, 0x18, 0x00, 0x02,
-        0x19, 0x00, 0x41, 0x03, 0xa4, 0xd0, 0x39, 0x1a, 0x00, 0x06, 0x18, 0x00, 0x31, 0x00, 0x02,
-        0xad, 0x7d, 0x00, 0x11, 0xfb, 0x19, 0x00, 0x07, 0x18, 0x00, 0x31, 0x00, 0xce, 0xf8, 0x19,
-        0x00, 0x1b, 0xcf, 0x18, 0x00, 0x41, 0x0f, 0xff, 0x76, 0x9d, 0x19, 0x00, 0x1a, 0x10, 0x18,
-        0x00, 0x31, 0x12, 0xff, 0x79, 0x7d, 0x00, 0x2a, 0x03, 0x05, 0x18, 0x00, 0x41, 0x00, 0xd3,
-        0xda, 0x0c, 0x19, 0x00, 0x0b, 0x48, 0x00, 0x72, 0x00, 0x44, 0xfb, 0xda, 0x79, 0x78, 0xf8,
-        0xc8, 0x00, 0x08, 0x78, 0x00, 0x71, 0x00, 0x44, 0xd1, 0xff, 0xff, 0xcd, 0xad, 0x19, 0x00,
-        0x09, 0x18, 0x00, 0x42, 0x00, 0x00, 0x12, 0x0e, 0xc8, 0x00, 0x21, 0x00, 0xa3, 0xd8, 0x00,
-        0x31, 0x7d, 0xff, 0x07, 0xce, 0x00, 0x01, 0x02, 0x00, 0x01, 0x64, 0x00, 0x24, 0x03, 0x33,
-        0x38, 0x01, 0x09, 0x02, 0x00, 0x02, 0x7d, 0x00, 0x58, 0x00, 0x00, 0x42, 0x83, 0x88, 0x01,
-        0x00, 0x11, 0xb2, 0x64, 0x00, 0x0e, 0x02, 0x00, 0x4e, 0x02, 0x9d, 0xff, 0x7e, 0x16, 0x00,
-        0x61, 0x00, 0x00, 0x00, 0x02, 0x94, 0x40, 0x08, 0x00, 0x0c, 0x02, 0x00, 0x50, 0x00, 0x00,
-        0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0x1d, 0x2f, 0x0d, 0x64, 0x18, 0x00, 0x03, 0x30, 0x75, 0xff, 0x83, 0x07, 0x00, 0x85,
+        0x09, 0x72, 0x77, 0x77, 0x77, 0x77, 0x73, 0x09, 0x18, 0x00, 0x91, 0x01, 0x96, 0xff, 0x8a,
+        0x00, 0x00, 0x03, 0xad, 0xff, 0x01, 0x00, 0x25, 0xb3, 0x04, 0x19, 0x00, 0x80, 0x02, 0xbf,
+        0xff, 0x83, 0x00, 0x03, 0xa4, 0x6a, 0x0c, 0x00, 0x71, 0x68, 0xff, 0xb0, 0x77, 0x77, 0x77,
+        0x43, 0x18, 0x00, 0x72, 0x43, 0xff, 0xff, 0xff, 0x83, 0x00, 0x01, 0x25, 0x00, 0x11, 0x7d,
+        0x36, 0x00, 0x12, 0x42, 0x0b, 0x00, 0x22, 0x08, 0x9d, 0x64, 0x00, 0x03, 0x01, 0x00, 0x30,
+        0x07, 0xff, 0x7d, 0x07, 0x00, 0x41, 0x80, 0xff, 0x00, 0x02, 0x19, 0x00, 0x23, 0x05, 0x10,
+        0x19, 0x00, 0x23, 0xff, 0x80, 0x18, 0x00, 0x02, 0x19, 0x00, 0x4b, 0x03, 0xa4, 0xd0, 0x39,
+        0x18, 0x00, 0x31, 0x00, 0x02, 0xad, 0x19, 0x00, 0x11, 0xfb, 0x19, 0x00, 0x07, 0x18, 0x00,
+        0x31, 0x00, 0xce, 0xf8, 0x19, 0x00, 0x1b, 0xcf, 0x18, 0x00, 0x32, 0x0f, 0xff, 0x76, 0x4b,
+        0x00, 0x00, 0x64, 0x00, 0x07, 0x18, 0x00, 0x32, 0x12, 0xff, 0x79, 0x64, 0x00, 0x1b, 0x05,
+        0x48, 0x00, 0x32, 0xd3, 0xda, 0x0c, 0x96, 0x00, 0x0b, 0x18, 0x00, 0x50, 0x44, 0xfb, 0xda,
+        0x79, 0x78, 0x64, 0x00, 0x0b, 0x18, 0x00, 0x60, 0x00, 0x44, 0xd1, 0xff, 0xff, 0xcd, 0x96,
+        0x00, 0x0b, 0x18, 0x00, 0x43, 0x00, 0x00, 0x12, 0x0e, 0xe1, 0x00, 0x11, 0xa3, 0x18, 0x00,
+        0x33, 0x7d, 0xff, 0x07, 0x19, 0x00, 0x00, 0xc8, 0x00, 0x01, 0x7d, 0x00, 0x10, 0x33, 0x0b,
+        0x00, 0x00, 0x38, 0x01, 0x09, 0x01, 0x00, 0x04, 0x2c, 0x01, 0x38, 0x42, 0x83, 0x88, 0x01,
+        0x00, 0x19, 0xb2, 0x45, 0x01, 0x09, 0x4b, 0x00, 0x1f, 0x7e, 0x19, 0x00, 0x03, 0x2f, 0x94,
+        0x40, 0x18, 0x00, 0x02, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
 
 };
 
@@ -69,11 +46,11 @@ const lv_image_dsc_t icon_no_photography_24 = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 24,
                  .h = 24,
-                 .stride = 48,
+                 .stride = 24,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_no_photography_24_map),
@@ -20,21 +20,13 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_NORTH_EAST_20 uint8_t
     icon_north_east_20_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0xcd, 0x00, 0x00, 0x00, 0xb0, 0x04, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0x9c, 0x1b, 0x00, 0x01, 0x00, 0x0f, 0xbf, 0x00, 0x05, 0x0b, 0x27, 0x00, 0x0f, 0x28,
-        0x00, 0x06, 0x04, 0x02, 0x00, 0x04, 0x30, 0x00, 0x04, 0x10, 0x00, 0x0f, 0x02, 0x00, 0x03,
-        0x04, 0x26, 0x00, 0x0f, 0x28, 0x00, 0x0b, 0x02, 0x26, 0x00, 0x02, 0x08, 0x00, 0x0f, 0x48,
-        0x00, 0x03, 0x00, 0x76, 0x01, 0x04, 0x26, 0x00, 0x02, 0x0a, 0x00, 0x02, 0x14, 0x00, 0x0e,
-        0x02, 0x00, 0x06, 0x26, 0x00, 0x02, 0x0c, 0x00, 0x0e, 0x22, 0x00, 0x04, 0x1a, 0x00, 0x06,
-        0x1c, 0x00, 0x08, 0x0c, 0x00, 0x08, 0x02, 0x00, 0x08, 0x4c, 0x00, 0x0f, 0x02, 0x00, 0x07,
-        0x0f, 0x26, 0x00, 0x39, 0x02, 0x4e, 0x00, 0x0f, 0x6c, 0x00, 0x07, 0x0f, 0x02, 0x00, 0x8f,
-        0x02, 0x0e, 0x01, 0x0f, 0x02, 0x00, 0x3f, 0x12, 0x11, 0x01, 0x00, 0x18, 0x01, 0x5a, 0x00,
-        0x03, 0x0e, 0x01, 0x18, 0x15, 0x14, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xf2, 0x14,
-        0x00, 0x3c, 0x49, 0xf2, 0x4e, 0x14, 0x00, 0x4b, 0x49, 0xf2, 0x4e, 0x00, 0x14, 0x00, 0x4b,
-        0x49, 0xf2, 0x4e, 0x00, 0x14, 0x00, 0x01, 0x13, 0x00, 0x0a, 0x14, 0x00, 0x02, 0x13, 0x00,
-        0x09, 0x14, 0x00, 0x03, 0x13, 0x00, 0x08, 0x02, 0x00, 0x0f, 0x13, 0x00, 0x00, 0x38, 0x43,
-        0xf2, 0x4c, 0x22, 0x00, 0x01, 0x02, 0x00, 0x21, 0x13, 0x43, 0x07, 0x00, 0x0f, 0x02, 0x00,
-        0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x90, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0x44, 0x12, 0x11, 0x01, 0x00, 0x18, 0x01, 0x14, 0x00, 0x12, 0xff, 0x01, 0x00, 0x1c,
+        0x15, 0x2c, 0x00, 0x2d, 0x4c, 0xf2, 0x14, 0x00, 0x3c, 0x49, 0xf2, 0x4e, 0x14, 0x00, 0x4b,
+        0x49, 0xf2, 0x4e, 0x00, 0x14, 0x00, 0x00, 0x13, 0x00, 0x0b, 0x14, 0x00, 0x01, 0x13, 0x00,
+        0x0a, 0x14, 0x00, 0x02, 0x13, 0x00, 0x09, 0x14, 0x00, 0x03, 0x13, 0x00, 0x0e, 0x39, 0x00,
+        0x09, 0x01, 0x00, 0x3c, 0x43, 0xf2, 0x4c, 0x13, 0x00, 0x3d, 0x00, 0x13, 0x43, 0x13, 0x00,
+        0x0f, 0x01, 0x00, 0x35, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
 
 };
 
@@ -42,11 +34,11 @@ const lv_image_dsc_t icon_north_east_20 = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 20,
                  .h = 20,
-                 .stride = 40,
+                 .stride = 20,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_north_east_20_map),
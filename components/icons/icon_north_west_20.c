@@ -20,20 +20,13 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_NORTH_WEST_20 uint8_t
     icon_north_west_20_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0xb0, 0x04, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0x94, 0x1b, 0x00, 0x01, 0x00, 0x0f, 0xb7, 0x00, 0x05, 0x0b, 0x27, 0x00, 0x0f, 0x28,
-        0x00, 0x0e, 0x0f, 0x20, 0x00, 0x05, 0x04, 0x02, 0x00, 0x06, 0x50, 0x00, 0x04, 0x12, 0x00,
-        0x0f, 0x02, 0x00, 0x03, 0x02, 0x6c, 0x00, 0x02, 0x2e, 0x00, 0x0f, 0x22, 0x00, 0x03, 0x02,
-        0x02, 0x00, 0x02, 0x28, 0x00, 0x02, 0x08, 0x00, 0x0f, 0x2a, 0x00, 0x09, 0x06, 0x1e, 0x00,
-        0x0f, 0x54, 0x00, 0x0b, 0x06, 0x28, 0x00, 0x02, 0x0c, 0x00, 0x0f, 0x54, 0x00, 0x09, 0x06,
-        0x02, 0x00, 0x0f, 0x54, 0x00, 0x0b, 0x08, 0x02, 0x00, 0x0f, 0x2a, 0x00, 0x45, 0x08, 0x64,
-        0x00, 0x0f, 0x02, 0x00, 0x89, 0x02, 0x00, 0x01, 0x0f, 0x02, 0x00, 0x3b, 0x22, 0x01, 0x11,
-        0x01, 0x00, 0x08, 0x56, 0x00, 0x13, 0x15, 0x05, 0x01, 0x0a, 0x14, 0x00, 0x28, 0xf2, 0x4c,
-        0x10, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x15, 0xff, 0x48, 0xf2, 0x4f, 0x0b, 0x00, 0x05,
-        0x02, 0x00, 0x3d, 0x15, 0xff, 0x00, 0x15, 0x00, 0x3d, 0x15, 0xff, 0x00, 0x15, 0x00, 0x3d,
-        0x15, 0xff, 0x00, 0x15, 0x00, 0x01, 0x14, 0x00, 0x0d, 0x2a, 0x00, 0x01, 0x02, 0x00, 0x0d,
-        0x54, 0x00, 0x0f, 0x2a, 0x00, 0x06, 0x32, 0x4c, 0xf2, 0x43, 0x1e, 0x00, 0x08, 0x02, 0x00,
-        0x28, 0x43, 0x13, 0x0e, 0x00, 0x0f, 0x02, 0x00, 0x30, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x90, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0x40, 0x22, 0x01, 0x11, 0x01, 0x00, 0x08, 0x14, 0x00, 0x22, 0x15, 0xff, 0x01, 0x00,
+        0x0a, 0x14, 0x00, 0x2c, 0xf2, 0x4c, 0x3c, 0x00, 0x5d, 0x15, 0xff, 0x48, 0xf2, 0x4f, 0x14,
+        0x00, 0x1d, 0x00, 0x15, 0x00, 0x3d, 0x15, 0xff, 0x00, 0x15, 0x00, 0x00, 0x14, 0x00, 0x0c,
+        0x15, 0x00, 0x01, 0x14, 0x00, 0x0e, 0x3f, 0x00, 0x0f, 0x15, 0x00, 0x1b, 0x3e, 0x4c, 0xf2,
+        0x43, 0x15, 0x00, 0x2e, 0x43, 0x13, 0x14, 0x00, 0x0f, 0x01, 0x00, 0x2a, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x00,
 
 };
 
@@ -41,11 +34,11 @@ const lv_image_dsc_t icon_north_west_20 = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 20,
                  .h = 20,
-                 .stride = 40,
+                 .stride = 20,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_north_west_20_map),
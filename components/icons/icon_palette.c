@@ -20,113 +20,57 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_PALETTE uint8_t
     icon_palette_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0x32, 0x06, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0xff, 0xf1, 0x2c, 0xe3, 0x18, 0x02, 0x00, 0x8f, 0x04, 0x21, 0xe3, 0x18, 0xe3, 0x18,
-        0xc3, 0x18, 0x1d, 0x02, 0x2d, 0x2c, 0x00, 0x00, 0x5a, 0x00, 0x0c, 0x02, 0x00, 0x4f, 0x04,
-        0x21, 0x00, 0x00, 0x66, 0x00, 0x25, 0x0c, 0x4c, 0x00, 0x0f, 0x02, 0x00, 0x07, 0x0f, 0x62,
-        0x00, 0x1f, 0x1d, 0xc3, 0x14, 0x01, 0x04, 0xae, 0x00, 0x24, 0x04, 0x21, 0x20, 0x01, 0x06,
-        0x02, 0x00, 0x2f, 0x04, 0x21, 0x2c, 0x01, 0x1b, 0x06, 0x3a, 0x00, 0x6f, 0xe3, 0x18, 0xe3,
-        0x18, 0x24, 0x21, 0xa0, 0x00, 0x03, 0x02, 0x1e, 0x00, 0x06, 0x02, 0x00, 0x0f, 0x26, 0x00,
-        0x03, 0x0e, 0x02, 0x00, 0x06, 0x32, 0x00, 0x2f, 0x04, 0x21, 0x36, 0x00, 0x0d, 0x02, 0x24,
-        0x00, 0x04, 0x02, 0x00, 0x0e, 0x4c, 0x00, 0x0e, 0x02, 0x00, 0x04, 0x2c, 0x00, 0x3f, 0xe3,
-        0x18, 0x04, 0xb8, 0x00, 0x04, 0x0c, 0x02, 0x00, 0x06, 0x32, 0x00, 0x0f, 0x62, 0x00, 0x0f,
-        0x06, 0x2c, 0x00, 0x04, 0x5e, 0x00, 0x4c, 0xc3, 0x18, 0x04, 0x21, 0xc8, 0x00, 0x0c, 0x14,
-        0x00, 0x02, 0xb0, 0x02, 0x0f, 0x94, 0x00, 0x0f, 0x06, 0x90, 0x02, 0x04, 0xb0, 0x01, 0x08,
-        0xe8, 0x01, 0x04, 0xb8, 0x00, 0x0f, 0x14, 0x00, 0x01, 0x02, 0x5e, 0x00, 0x06, 0x96, 0x00,
-        0x0f, 0x02, 0x00, 0x03, 0x0e, 0x26, 0x00, 0x0f, 0x9a, 0x00, 0x01, 0x0f, 0x14, 0x00, 0x01,
-        0x06, 0x3c, 0x00, 0x06, 0x88, 0x00, 0x0c, 0x02, 0x00, 0x06, 0x38, 0x00, 0x06, 0x1a, 0x00,
-        0x06, 0x14, 0x00, 0x04, 0x30, 0x01, 0x0f, 0x14, 0x00, 0x03, 0x08, 0x62, 0x00, 0x02, 0x0e,
-        0x00, 0x0e, 0x02, 0x00, 0x02, 0xbe, 0x00, 0x0a, 0x92, 0x03, 0x02, 0x14, 0x00, 0x02, 0x02,
-        0x00, 0x04, 0x32, 0x00, 0x02, 0x0e, 0x00, 0x02, 0x02, 0x00, 0x04, 0x14, 0x00, 0x0a, 0x78,
-        0x00, 0x02, 0x10, 0x00, 0x0c, 0x02, 0x00, 0x02, 0x32, 0x00, 0x06, 0xa8, 0x00, 0x02, 0x02,
-        0x00, 0x1f, 0xe3, 0xe0, 0x01, 0x00, 0x0f, 0x14, 0x00, 0x01, 0x0f, 0xc2, 0x00, 0x0d, 0x02,
-        0x5e, 0x00, 0x42, 0xe3, 0x18, 0x45, 0x29, 0x2c, 0x00, 0x0f, 0x02, 0x00, 0x21, 0x04, 0x4e,
-        0x01, 0x0f, 0x3c, 0x00, 0x01, 0x04, 0x60, 0x00, 0x0f, 0x1c, 0x00, 0x01, 0x0f, 0x02, 0x00,
-        0x15, 0x02, 0x44, 0x00, 0x0c, 0x02, 0x01, 0x02, 0x02, 0x00, 0x02, 0x1c, 0x00, 0x02, 0x60,
-        0x00, 0x0c, 0xe0, 0x02, 0x0f, 0x02, 0x00, 0x09, 0x08, 0x2c, 0x00, 0x0f, 0xc0, 0x00, 0x09,
-        0x06, 0x1c, 0x00, 0x0f, 0xe0, 0x02, 0x01, 0x0f, 0x02, 0x00, 0x05, 0x0a, 0x2c, 0x00, 0x22,
-        0x45, 0x29, 0xa6, 0x00, 0x0f, 0x2e, 0x00, 0x01, 0x02, 0x1a, 0x00, 0x26, 0xe3, 0x18, 0x6a,
-        0x00, 0x0f, 0xea, 0x00, 0x05, 0x08, 0x02, 0x00, 0x04, 0x96, 0x00, 0x02, 0x2c, 0x00, 0x22,
-        0xa2, 0x10, 0x46, 0x00, 0x08, 0x22, 0x00, 0x04, 0x02, 0x00, 0x02, 0x1a, 0x00, 0x2c, 0x86,
-        0x31, 0x34, 0x00, 0x0f, 0x02, 0x00, 0x0b, 0x0a, 0x60, 0x00, 0x04, 0x0e, 0x00, 0x0f, 0x34,
-        0x00, 0x01, 0x02, 0x60, 0x00, 0x24, 0xa2, 0x10, 0x0a, 0x00, 0x02, 0x02, 0x00, 0x0f, 0x2a,
-        0x00, 0x01, 0x08, 0x02, 0x00, 0x02, 0x26, 0x00, 0x02, 0x02, 0x00, 0x04, 0x0e, 0x00, 0x0f,
-        0xe0, 0x01, 0x0f, 0x0f, 0xe0, 0x02, 0x05, 0x0f, 0x02, 0x00, 0x01, 0x08, 0x2c, 0x00, 0x02,
-        0x68, 0x00, 0x0f, 0x96, 0x00, 0x03, 0x0f, 0xdc, 0x00, 0x09, 0x0f, 0x02, 0x00, 0x13, 0x04,
-        0x5e, 0x00, 0x0f, 0x60, 0x00, 0x03, 0x04, 0x1e, 0x00, 0x0f, 0x4c, 0x00, 0x13, 0x0e, 0x02,
-        0x00, 0x11, 0x24, 0x54, 0x08, 0x0f, 0x42, 0x00, 0x07, 0x02, 0x1c, 0x00, 0x0f, 0x1e, 0x00,
-        0x05, 0x0f, 0x02, 0x00, 0x0d, 0x04, 0x3e, 0x00, 0x0f, 0x7e, 0x01, 0x05, 0x06, 0x20, 0x01,
-        0x0f, 0x70, 0x08, 0x1b, 0x11, 0xc3, 0xf6, 0x07, 0x04, 0x5c, 0x01, 0x0f, 0xa0, 0x00, 0x0b,
-        0x02, 0x20, 0x00, 0x0f, 0xc2, 0x00, 0x0d, 0x04, 0x26, 0x00, 0x0f, 0x02, 0x00, 0x03, 0x0f,
-        0xe8, 0x00, 0x09, 0x04, 0x32, 0x00, 0x0f, 0xc2, 0x00, 0x09, 0x04, 0x24, 0x00, 0x0f, 0x02,
-        0x00, 0x01, 0x0f, 0x98, 0x02, 0x03, 0x06, 0x02, 0x00, 0x04, 0x7e, 0x03, 0x0f, 0x28, 0x00,
-        0x07, 0x04, 0x22, 0x00, 0x0f, 0x02, 0x00, 0x01, 0x06, 0x48, 0x00, 0x0f, 0x02, 0x00, 0x07,
-        0x04, 0x38, 0x00, 0x0f, 0x62, 0x00, 0x05, 0x06, 0x20, 0x00, 0x0f, 0xe4, 0x00, 0x09, 0x0f,
-        0x02, 0x00, 0x07, 0x0e, 0xe0, 0x07, 0x0a, 0x02, 0x00, 0x04, 0xc8, 0x01, 0x0a, 0x16, 0x00,
-        0x0f, 0x02, 0x00, 0x19, 0x04, 0xa2, 0x00, 0x06, 0x42, 0x08, 0x08, 0x02, 0x00, 0x02, 0x1e,
-        0x00, 0x0f, 0xde, 0x00, 0x05, 0x0f, 0x02, 0x00, 0x13, 0x04, 0xa4, 0x00, 0x0f, 0x48, 0x00,
-        0x01, 0x02, 0x60, 0x00, 0x0f, 0x1a, 0x00, 0x01, 0x0f, 0x02, 0x00, 0x19, 0x06, 0x62, 0x00,
-        0x0e, 0x4c, 0x02, 0x04, 0x62, 0x00, 0x0f, 0x50, 0x00, 0x19, 0x0e, 0x02, 0x00, 0x08, 0x62,
-        0x00, 0x0a, 0x64, 0x00, 0x0f, 0x60, 0x00, 0x33, 0x06, 0x48, 0x00, 0x08, 0x02, 0x00, 0x44,
-        0xc3, 0x18, 0x86, 0x31, 0x7a, 0x00, 0x0e, 0x94, 0x00, 0x0f, 0x02, 0x00, 0x1d, 0x06, 0x4c,
-        0x02, 0x0f, 0x02, 0x00, 0x01, 0x0f, 0x4e, 0x00, 0x1d, 0x0f, 0x02, 0x00, 0x03, 0x24, 0xa2,
-        0x10, 0xb0, 0x00, 0x0c, 0x02, 0x00, 0x0f, 0x30, 0x00, 0x03, 0x0f, 0x02, 0x00, 0x23, 0x02,
-        0x64, 0x00, 0x02, 0x06, 0x00, 0x02, 0x02, 0x00, 0x0f, 0x48, 0x00, 0x23, 0x0f, 0x02, 0x00,
-        0xff, 0xc2, 0x1f, 0x00, 0x01, 0x00, 0xee, 0xdf, 0x1a, 0x5e, 0x9c, 0xc6, 0xe8, 0xf4, 0xff,
-        0xf3, 0xe5, 0xc2, 0x96, 0x5c, 0x14, 0x0e, 0x01, 0x0d, 0x47, 0x02, 0x53, 0xbb, 0xfd, 0x07,
-        0x03, 0x4f, 0xfc, 0xb9, 0x50, 0x02, 0x33, 0x00, 0x09, 0x27, 0x4d, 0xd7, 0x2d, 0x00, 0x02,
-        0x02, 0x00, 0x2f, 0xd4, 0x4c, 0x31, 0x00, 0x06, 0x20, 0x14, 0xaf, 0x8e, 0x13, 0xd0, 0xf7,
-        0xaf, 0x6f, 0x41, 0x2b, 0x16, 0x03, 0x17, 0x2b, 0x46, 0x84, 0xc6, 0xfb, 0x9f, 0x13, 0x2f,
-        0xa9, 0x13, 0x32, 0x00, 0x03, 0x87, 0x33, 0xe4, 0xff, 0xff, 0xff, 0xe1, 0x6e, 0x0e, 0x1e,
-        0x00, 0x87, 0x1b, 0x8d, 0xf3, 0xff, 0xff, 0xff, 0xdd, 0x2d, 0x13, 0x00, 0x05, 0x02, 0x00,
-        0x75, 0x43, 0xf3, 0xff, 0xff, 0xfa, 0x80, 0x09, 0x10, 0x00, 0x02, 0x02, 0x00, 0x72, 0x12,
-        0xa1, 0xff, 0xff, 0xff, 0xee, 0x34, 0x0d, 0x00, 0x08, 0x02, 0x00, 0x68, 0x39, 0xf4, 0xff,
-        0xff, 0xe4, 0x37, 0x12, 0x00, 0x03, 0x02, 0x00, 0x63, 0x56, 0xee, 0xff, 0xff, 0xec, 0x23,
-        0x0d, 0x00, 0x05, 0x02, 0x00, 0xd2, 0x1a, 0xe8, 0xff, 0xff, 0xd8, 0x1e, 0x00, 0x00, 0x00,
-        0x13, 0x68, 0x68, 0x12, 0x16, 0x00, 0x04, 0x0a, 0x00, 0x62, 0x2e, 0xec, 0xff, 0xff, 0xd3,
-        0x08, 0x14, 0x00, 0x04, 0x02, 0x00, 0xe1, 0x01, 0xbe, 0xff, 0xff, 0xdf, 0x1c, 0x00, 0x00,
-        0x00, 0x13, 0xe2, 0xff, 0xff, 0xe2, 0x31, 0x00, 0x06, 0x0a, 0x00, 0x54, 0x33, 0xef, 0xff,
-        0xff, 0x88, 0x2a, 0x00, 0x02, 0x02, 0x00, 0xa0, 0x62, 0xff, 0xff, 0xf6, 0x2f, 0x00, 0x00,
-        0x00, 0x00, 0x69, 0xb1, 0x14, 0x1a, 0x68, 0x0a, 0x00, 0x59, 0x00, 0x4d, 0xff, 0xff, 0xf9,
-        0x92, 0x00, 0x51, 0x08, 0xe5, 0xff, 0xff, 0x6f, 0x3a, 0x00, 0x0f, 0x30, 0x00, 0x02, 0x51,
-        0x00, 0xa8, 0xff, 0xff, 0x9d, 0x1f, 0x00, 0x03, 0x02, 0x00, 0x51, 0x6a, 0xff, 0xff, 0xd2,
-        0x03, 0x0c, 0x00, 0x51, 0x12, 0xe2, 0xff, 0xff, 0xe1, 0x90, 0x00, 0x06, 0x0a, 0x00, 0x71,
-        0x00, 0x00, 0x26, 0xfe, 0xff, 0xf6, 0x11, 0x20, 0x00, 0x02, 0x02, 0x00, 0x42, 0xd1, 0xff,
-        0xff, 0x58, 0x0a, 0x00, 0x43, 0x00, 0x12, 0x67, 0x67, 0x1a, 0x00, 0x06, 0x0a, 0x00, 0x63,
-        0x00, 0x00, 0xbd, 0xff, 0xff, 0x5a, 0x21, 0x00, 0x81, 0x00, 0x00, 0x00, 0x2d, 0xff, 0xff,
-        0xeb, 0x06, 0x0a, 0x00, 0x0f, 0x02, 0x00, 0x05, 0x19, 0x70, 0x91, 0x00, 0x4f, 0x72, 0xff,
-        0xff, 0x9c, 0x2a, 0x00, 0x05, 0x02, 0x02, 0x00, 0x42, 0x39, 0xff, 0xff, 0xca, 0x0a, 0x00,
-        0x86, 0x00, 0x00, 0x00, 0x00, 0xab, 0xff, 0xff, 0x5d, 0x70, 0x01, 0x0a, 0x02, 0x00, 0x02,
-        0x86, 0x01, 0x46, 0x16, 0xff, 0xff, 0xea, 0x18, 0x00, 0x47, 0xd2, 0xff, 0xff, 0x31, 0x7a,
-        0x01, 0x08, 0x02, 0x00, 0x03, 0x86, 0x01, 0x46, 0x06, 0xff, 0xff, 0xf9, 0x17, 0x00, 0x47,
-        0xed, 0xff, 0xff, 0x12, 0x7a, 0x01, 0x08, 0x02, 0x00, 0x03, 0x60, 0x01, 0x46, 0x0b, 0xff,
-        0xff, 0xf4, 0x17, 0x00, 0x4f, 0xf9, 0xff, 0xff, 0x05, 0x30, 0x00, 0x0b, 0x49, 0x1f, 0xff,
-        0xff, 0xdf, 0x30, 0x00, 0x19, 0x0b, 0x70, 0x01, 0x06, 0x02, 0x00, 0x03, 0x16, 0x00, 0x46,
-        0x54, 0xff, 0xff, 0xc2, 0x15, 0x00, 0x4a, 0xed, 0xff, 0xff, 0x22, 0x70, 0x01, 0x06, 0x02,
-        0x00, 0x02, 0x86, 0x01, 0x46, 0xa2, 0xff, 0xff, 0x82, 0x14, 0x00, 0x46, 0xd2, 0xff, 0xff,
-        0x39, 0x0e, 0x00, 0x0f, 0x02, 0x00, 0x00, 0x29, 0x25, 0xfb, 0x22, 0x00, 0x4f, 0xab, 0xff,
-        0xff, 0x5c, 0x26, 0x00, 0x00, 0x05, 0x02, 0x00, 0x55, 0x0d, 0xd1, 0xff, 0xff, 0xbf, 0x0e,
-        0x00, 0x01, 0xb0, 0x01, 0x17, 0x9a, 0x0f, 0x00, 0x0c, 0x02, 0x00, 0x67, 0x2c, 0xd4, 0xff,
-        0xff, 0xf9, 0x36, 0x16, 0x00, 0x57, 0x2e, 0xff, 0xff, 0xe9, 0x04, 0x10, 0x00, 0x07, 0x02,
-        0x00, 0x97, 0x0a, 0x21, 0x58, 0xaa, 0xfd, 0xff, 0xff, 0xff, 0x63, 0x14, 0x00, 0x69, 0x00,
-        0x00, 0xd3, 0xff, 0xff, 0x54, 0x11, 0x00, 0x56, 0x00, 0x00, 0x23, 0x9e, 0xe4, 0x8a, 0x04,
-        0x1a, 0xf7, 0x2f, 0x00, 0x5a, 0x00, 0x6f, 0xff, 0xff, 0xce, 0x99, 0x04, 0x22, 0x3d, 0xf1,
-        0x7f, 0x04, 0x01, 0x02, 0x00, 0x11, 0xb7, 0x4b, 0x03, 0x07, 0x02, 0x00, 0x23, 0x0b, 0xea,
-        0x55, 0x03, 0x04, 0x02, 0x00, 0x21, 0x0b, 0xe6, 0x29, 0x00, 0x74, 0xff, 0xff, 0xf5, 0xe1,
-        0xbf, 0x7f, 0x31, 0x16, 0x00, 0x06, 0x02, 0x00, 0x56, 0x6b, 0xff, 0xff, 0xf3, 0x28, 0x0f,
-        0x00, 0x62, 0x00, 0x54, 0xff, 0xff, 0xf0, 0x40, 0x42, 0x03, 0x0f, 0x02, 0x00, 0x02, 0x66,
-        0x03, 0xc9, 0xff, 0xff, 0xd7, 0x14, 0x1b, 0x00, 0x46, 0x78, 0xff, 0xff, 0x93, 0x0e, 0x00,
-        0x0f, 0x02, 0x00, 0x00, 0x56, 0x23, 0xf0, 0xff, 0xff, 0xcc, 0x31, 0x00, 0x4f, 0x6b, 0xff,
-        0xff, 0xa1, 0x26, 0x00, 0x00, 0x07, 0x02, 0x00, 0x55, 0x48, 0xfa, 0xff, 0xff, 0xd8, 0x93,
-        0x00, 0x57, 0x3b, 0xff, 0xff, 0xf5, 0x1d, 0x1e, 0x00, 0x0f, 0x02, 0x00, 0x00, 0x64, 0x57,
-        0xfa, 0xff, 0xff, 0xf3, 0x6a, 0x26, 0x01, 0x1f, 0xbe, 0x73, 0x03, 0x0e, 0x82, 0x00, 0x47,
-        0xf0, 0xff, 0xff, 0xff, 0xd0, 0x55, 0xb9, 0x01, 0x4f, 0x2d, 0xff, 0xff, 0xe8, 0x55, 0x00,
-        0x00, 0x09, 0x02, 0x00, 0x20, 0x23, 0xc9, 0x5e, 0x19, 0xa9, 0xea, 0x9c, 0x5c, 0x31, 0x14,
-        0x05, 0x38, 0xff, 0xff, 0xf7, 0x1d, 0x00, 0x0f, 0x02, 0x00, 0x01, 0x33, 0x03, 0x6b, 0xea,
-        0x77, 0x01, 0x00, 0x97, 0x19, 0x1f, 0xcd, 0x23, 0x00, 0x01, 0x0b, 0x02, 0x00, 0x32, 0x0b,
-        0x70, 0xd4, 0x2d, 0x00, 0x4b, 0xff, 0xff, 0xfe, 0x55, 0x1c, 0x00, 0x0f, 0x02, 0x00, 0x04,
-        0x9f, 0x2f, 0x72, 0xac, 0xd2, 0xee, 0xfa, 0xeb, 0xc0, 0x4e, 0x20, 0x00, 0x04, 0x0f, 0x02,
-        0x00, 0xd6, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0xe5, 0x02, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0xee, 0xdf, 0x1a, 0x5e, 0x9c, 0xc6, 0xe8, 0xf4, 0xff, 0xf3, 0xe5, 0xc2, 0x96, 0x5c,
+        0x14, 0x2d, 0x00, 0x0d, 0x56, 0x02, 0x53, 0xbb, 0xfd, 0xff, 0x01, 0x00, 0x4f, 0xfc, 0xb9,
+        0x50, 0x02, 0x2f, 0x00, 0x09, 0x27, 0x4d, 0xd7, 0x2d, 0x00, 0x02, 0x01, 0x00, 0x2f, 0xd4,
+        0x4c, 0x2e, 0x00, 0x06, 0x20, 0x14, 0xaf, 0x21, 0x00, 0xd0, 0xf7, 0xaf, 0x6f, 0x41, 0x2b,
+        0x16, 0x03, 0x17, 0x2b, 0x46, 0x84, 0xc6, 0xfb, 0x11, 0x00, 0x2f, 0xa9, 0x13, 0x2f, 0x00,
+        0x03, 0x87, 0x33, 0xe4, 0xff, 0xff, 0xff, 0xe1, 0x6e, 0x0e, 0x13, 0x00, 0x8f, 0x1b, 0x8d,
+        0xf3, 0xff, 0xff, 0xff, 0xdd, 0x2d, 0x2f, 0x00, 0x01, 0x7b, 0x43, 0xf3, 0xff, 0xff, 0xfa,
+        0x80, 0x09, 0x16, 0x00, 0x7e, 0x12, 0xa1, 0xff, 0xff, 0xff, 0xee, 0x34, 0x2f, 0x00, 0x6e,
+        0x39, 0xf4, 0xff, 0xff, 0xe4, 0x37, 0x18, 0x00, 0x7c, 0x00, 0x56, 0xee, 0xff, 0xff, 0xec,
+        0x23, 0x16, 0x00, 0xd2, 0x1a, 0xe8, 0xff, 0xff, 0xd8, 0x1e, 0x00, 0x00, 0x00, 0x13, 0x68,
+        0x68, 0x12, 0x13, 0x00, 0x04, 0x0a, 0x00, 0x6a, 0x2e, 0xec, 0xff, 0xff, 0xd3, 0x08, 0x2f,
+        0x00, 0x60, 0x01, 0xbe, 0xff, 0xff, 0xdf, 0x1c, 0x25, 0x00, 0x41, 0xe2, 0xff, 0xff, 0xe2,
+        0x27, 0x00, 0x06, 0x0a, 0x00, 0x5a, 0x33, 0xef, 0xff, 0xff, 0x88, 0x30, 0x00, 0x50, 0x62,
+        0xff, 0xff, 0xf6, 0x2f, 0x09, 0x00, 0x10, 0x69, 0x12, 0x01, 0x1a, 0x68, 0x0a, 0x00, 0x59,
+        0x00, 0x4d, 0xff, 0xff, 0xf9, 0x92, 0x00, 0x51, 0x08, 0xe5, 0xff, 0xff, 0x6f, 0x0a, 0x00,
+        0x0f, 0x30, 0x00, 0x02, 0x58, 0x00, 0xa8, 0xff, 0xff, 0x9d, 0x30, 0x00, 0x51, 0x6a, 0xff,
+        0xff, 0xd2, 0x03, 0x0a, 0x00, 0x51, 0x12, 0xe2, 0xff, 0xff, 0xe1, 0x86, 0x00, 0x06, 0x0a,
+        0x00, 0x77, 0x00, 0x00, 0x26, 0xfe, 0xff, 0xf6, 0x11, 0x30, 0x00, 0x43, 0xd1, 0xff, 0xff,
+        0x58, 0x0b, 0x00, 0x33, 0x12, 0x67, 0x67, 0x1a, 0x00, 0x06, 0x0a, 0x00, 0x66, 0x00, 0x00,
+        0xbd, 0xff, 0xff, 0x5a, 0x2f, 0x00, 0x57, 0x2d, 0xff, 0xff, 0xeb, 0x06, 0x3f, 0x00, 0x0e,
+        0x01, 0x00, 0x19, 0x70, 0x91, 0x00, 0x4f, 0x72, 0xff, 0xff, 0x9c, 0x2e, 0x00, 0x09, 0x66,
+        0x00, 0x00, 0x39, 0xff, 0xff, 0xca, 0x0e, 0x00, 0x48, 0xab, 0xff, 0xff, 0x5d, 0x7a, 0x01,
+        0x08, 0x01, 0x00, 0x02, 0x16, 0x00, 0x46, 0x16, 0xff, 0xff, 0xea, 0x14, 0x00, 0x47, 0xd2,
+        0xff, 0xff, 0x31, 0x70, 0x01, 0x09, 0x2f, 0x00, 0x02, 0x16, 0x00, 0x46, 0x06, 0xff, 0xff,
+        0xf9, 0x15, 0x00, 0x49, 0xed, 0xff, 0xff, 0x12, 0x40, 0x01, 0x06, 0x01, 0x00, 0x03, 0x16,
+        0x00, 0x46, 0x0b, 0xff, 0xff, 0xf4, 0x15, 0x00, 0x4f, 0xf9, 0xff, 0xff, 0x05, 0x30, 0x00,
+        0x0b, 0x49, 0x1f, 0xff, 0xff, 0xdf, 0x30, 0x00, 0x19, 0x0b, 0x70, 0x01, 0x06, 0x01, 0x00,
+        0x03, 0x16, 0x00, 0x46, 0x54, 0xff, 0xff, 0xc2, 0x15, 0x00, 0x4a, 0xed, 0xff, 0xff, 0x22,
+        0x70, 0x01, 0x07, 0x31, 0x00, 0x01, 0x16, 0x00, 0x46, 0xa2, 0xff, 0xff, 0x82, 0x14, 0x00,
+        0x4e, 0xd2, 0xff, 0xff, 0x39, 0x2a, 0x00, 0x07, 0x01, 0x00, 0x29, 0x25, 0xfb, 0x22, 0x00,
+        0x4f, 0xab, 0xff, 0xff, 0x5c, 0x2f, 0x00, 0x09, 0x57, 0x0d, 0xd1, 0xff, 0xff, 0xbf, 0x10,
+        0x00, 0x4f, 0x72, 0xff, 0xff, 0x9a, 0x2f, 0x00, 0x08, 0x67, 0x2c, 0xd4, 0xff, 0xff, 0xf9,
+        0x36, 0x11, 0x00, 0x5f, 0x2e, 0xff, 0xff, 0xe9, 0x04, 0x2c, 0x00, 0x03, 0x40, 0x0a, 0x21,
+        0x58, 0xaa, 0x62, 0x04, 0x19, 0x63, 0x16, 0x00, 0x4b, 0xd3, 0xff, 0xff, 0x54, 0x29, 0x00,
+        0x36, 0x23, 0x9e, 0xe4, 0x8a, 0x04, 0x1a, 0xf7, 0x2f, 0x00, 0x5a, 0x00, 0x6f, 0xff, 0xff,
+        0xce, 0x99, 0x04, 0x27, 0x3d, 0xf1, 0x84, 0x04, 0x11, 0xb7, 0x4b, 0x03, 0x07, 0x01, 0x00,
+        0x2b, 0x0b, 0xea, 0xab, 0x01, 0x23, 0x0b, 0xe6, 0x2b, 0x00, 0x5b, 0xf5, 0xe1, 0xbf, 0x7f,
+        0x31, 0x2e, 0x00, 0x87, 0x00, 0x00, 0x00, 0x6b, 0xff, 0xff, 0xf3, 0x28, 0x10, 0x00, 0x52,
+        0x54, 0xff, 0xff, 0xf0, 0x40, 0x42, 0x03, 0x0f, 0x01, 0x00, 0x02, 0x57, 0x03, 0xc9, 0xff,
+        0xff, 0xd7, 0x5e, 0x05, 0x4f, 0x78, 0xff, 0xff, 0x93, 0x2e, 0x00, 0x07, 0x00, 0xdf, 0x00,
+        0x46, 0xf0, 0xff, 0xff, 0xcc, 0x31, 0x00, 0x4f, 0x6b, 0xff, 0xff, 0xa1, 0x30, 0x00, 0x0a,
+        0x65, 0x00, 0x48, 0xfa, 0xff, 0xff, 0xd8, 0x93, 0x00, 0x5f, 0x3b, 0xff, 0xff, 0xf5, 0x1d,
+        0x31, 0x00, 0x0b, 0x64, 0x57, 0xfa, 0xff, 0xff, 0xf3, 0x6a, 0x26, 0x01, 0x1f, 0xbe, 0x73,
+        0x03, 0x0e, 0x82, 0x00, 0x47, 0xf0, 0xff, 0xff, 0xff, 0xd0, 0x55, 0xb9, 0x01, 0x4f, 0x2d,
+        0xff, 0xff, 0xe8, 0x30, 0x00, 0x0c, 0x30, 0x00, 0x23, 0xc9, 0x42, 0x01, 0xaf, 0xea, 0x9c,
+        0x5c, 0x31, 0x14, 0x05, 0x38, 0xff, 0xff, 0xf7, 0x30, 0x00, 0x0d, 0x47, 0x00, 0x03, 0x6b,
+        0xea, 0xa6, 0x01, 0x1f, 0xcd, 0x30, 0x00, 0x0e, 0x54, 0x00, 0x00, 0x0b, 0x70, 0xd4, 0x2f,
+        0x00, 0x2f, 0xfe, 0x55, 0x30, 0x00, 0x10, 0xcf, 0x00, 0x00, 0x00, 0x2f, 0x72, 0xac, 0xd2,
+        0xee, 0xfa, 0xeb, 0xc0, 0x4e, 0x2c, 0x00, 0x10, 0x0f, 0x01, 0x00, 0xca, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x00,
 
 };
 
@@ -134,11 +78,11 @@ const lv_image_dsc_t icon_palette = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 48,
                  .h = 48,
-                 .stride = 96,
+                 .stride = 48,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_palette_map),
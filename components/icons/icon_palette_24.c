@@ -20,50 +20,28 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_PALETTE_24 uint8_t
     icon_palette_24_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0x5e, 0x42, 0x04, 0x21, 0xe3, 0x18, 0x02, 0x00, 0x4f, 0x04, 0x21, 0x00, 0x00, 0x7f,
-        0x00, 0x0b, 0x02, 0x28, 0x00, 0x0c, 0x02, 0x00, 0x0f, 0x34, 0x00, 0x03, 0x06, 0x26, 0x00,
-        0xa4, 0x04, 0x21, 0x04, 0x21, 0x45, 0x29, 0xc3, 0x18, 0xe3, 0x18, 0x6c, 0x00, 0x0e, 0x32,
-        0x00, 0x11, 0xc3, 0x84, 0x00, 0x0e, 0x82, 0x00, 0x04, 0x46, 0x00, 0x0c, 0x32, 0x00, 0x11,
-        0xe3, 0x4e, 0x00, 0x02, 0x08, 0x00, 0x02, 0x1e, 0x00, 0x02, 0x2a, 0x00, 0x44, 0xff, 0xff,
-        0xa2, 0x10, 0x1c, 0x00, 0x06, 0x02, 0x00, 0x06, 0x12, 0x00, 0x04, 0x26, 0x00, 0x08, 0x0a,
-        0x00, 0x66, 0x04, 0x21, 0xe3, 0x18, 0x04, 0x21, 0x2e, 0x00, 0x02, 0x1c, 0x00, 0x02, 0x0c,
-        0x01, 0x0f, 0x30, 0x00, 0x01, 0x02, 0x16, 0x00, 0x24, 0xc3, 0x18, 0x32, 0x00, 0x02, 0xd6,
-        0x00, 0x04, 0x0e, 0x00, 0x0f, 0x02, 0x00, 0x01, 0x0a, 0x22, 0x00, 0x02, 0x70, 0x00, 0x06,
-        0x5a, 0x00, 0x08, 0x02, 0x00, 0x02, 0x16, 0x00, 0x02, 0xc4, 0x00, 0x04, 0x18, 0x00, 0x06,
-        0x12, 0x00, 0x06, 0x14, 0x00, 0x04, 0x02, 0x00, 0x0f, 0x30, 0x00, 0x23, 0x06, 0x10, 0x01,
-        0x00, 0x70, 0x02, 0x02, 0x90, 0x00, 0x02, 0x0c, 0x00, 0x0f, 0x02, 0x00, 0x01, 0x75, 0x00,
-        0x00, 0xe3, 0x18, 0xe3, 0x18, 0x24, 0x22, 0x01, 0x0f, 0x30, 0x00, 0x09, 0x1f, 0xc3, 0xe4,
-        0x01, 0x02, 0x06, 0x50, 0x01, 0x04, 0x02, 0x00, 0x02, 0x84, 0x00, 0x06, 0x02, 0x00, 0x04,
-        0x18, 0x00, 0x02, 0x02, 0x00, 0x02, 0x18, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x12, 0x03, 0x04,
-        0x1e, 0x02, 0x02, 0x7a, 0x00, 0x22, 0xa2, 0x10, 0x16, 0x00, 0x08, 0x02, 0x00, 0x02, 0x1a,
-        0x00, 0x04, 0x12, 0x00, 0x02, 0x5e, 0x01, 0x04, 0x0e, 0x00, 0x0f, 0x02, 0x00, 0x01, 0x13,
-        0x24, 0xf6, 0x02, 0x02, 0xe6, 0x01, 0x0f, 0x30, 0x00, 0x0f, 0x42, 0xff, 0xff, 0x24, 0x21,
-        0x26, 0x00, 0x4a, 0x04, 0x21, 0x04, 0x21, 0xa0, 0x01, 0x0f, 0x02, 0x00, 0x07, 0x02, 0x32,
-        0x00, 0x04, 0x02, 0x00, 0x0f, 0x28, 0x00, 0x07, 0x08, 0x02, 0x00, 0x02, 0x2e, 0x00, 0x2f,
-        0x04, 0x21, 0x30, 0x00, 0x15, 0x0f, 0x02, 0x00, 0x3b, 0x1f, 0x00, 0x01, 0x00, 0x25, 0x7b,
-        0x16, 0x55, 0x6e, 0x77, 0x62, 0x37, 0x03, 0x3f, 0x00, 0x31, 0x41, 0xbf, 0xfd, 0xa0, 0x00,
-        0x37, 0xeb, 0x82, 0x12, 0x1a, 0x00, 0xe5, 0x09, 0xa3, 0xff, 0xd8, 0x72, 0x2e, 0x0f, 0x06,
-        0x1c, 0x53, 0xa9, 0xfc, 0xe6, 0x42, 0x19, 0x00, 0x53, 0x0a, 0xc7, 0xfb, 0x70, 0x04, 0x0e,
-        0x00, 0x43, 0x2d, 0xd1, 0xfa, 0x49, 0x0b, 0x00, 0x91, 0x00, 0xab, 0xfa, 0x48, 0x00, 0x42,
-        0xb4, 0x41, 0x00, 0x05, 0x00, 0x42, 0x0c, 0xc4, 0xf3, 0x1e, 0x19, 0x00, 0x83, 0x4a, 0xff,
-        0x69, 0x00, 0x00, 0xb4, 0xff, 0xb3, 0x05, 0x00, 0x32, 0x16, 0xed, 0xaa, 0x18, 0x00, 0x83,
-        0xc9, 0xcf, 0x02, 0x00, 0x00, 0x41, 0xb3, 0x41, 0x05, 0x00, 0xb2, 0x00, 0x7d, 0xfa, 0x14,
-        0x00, 0x00, 0x00, 0x00, 0x20, 0xfe, 0x6a, 0x20, 0x00, 0x04, 0x02, 0x00, 0xa1, 0x2e, 0xff,
-        0x55, 0x00, 0x00, 0x00, 0x00, 0x59, 0xff, 0x26, 0x5d, 0x00, 0x02, 0x02, 0x00, 0xd1, 0x42,
-        0xb4, 0x41, 0x0c, 0xff, 0x72, 0x00, 0x00, 0x00, 0x00, 0x73, 0xff, 0x0b, 0x5d, 0x00, 0x02,
-        0x02, 0x00, 0x63, 0xb4, 0xff, 0xb3, 0x0b, 0xff, 0x74, 0x18, 0x00, 0x01, 0x5d, 0x00, 0x02,
-        0x02, 0x00, 0x63, 0x41, 0xb3, 0x41, 0x3d, 0xff, 0x50, 0x48, 0x00, 0x02, 0x13, 0x00, 0x03,
-        0x02, 0x00, 0x41, 0x03, 0xbc, 0xef, 0x0e, 0x78, 0x00, 0x23, 0xff, 0x68, 0x12, 0x00, 0x92,
-        0x00, 0x00, 0x00, 0x00, 0x14, 0x46, 0xc0, 0xff, 0x64, 0x0b, 0x00, 0x32, 0xcb, 0xcd, 0x01,
-        0x09, 0x00, 0x82, 0x4d, 0xda, 0xfe, 0xff, 0xff, 0xff, 0xed, 0x62, 0x0e, 0x00, 0x41, 0x00,
-        0x4e, 0xff, 0x65, 0x0a, 0x00, 0x81, 0x13, 0xf5, 0xcc, 0x88, 0x88, 0x74, 0x4f, 0x0c, 0x0d,
-        0x00, 0xe2, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xf8, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x37, 0xff,
-        0x52, 0x10, 0x00, 0x04, 0x02, 0x00, 0xa4, 0x0e, 0xd0, 0xf8, 0x66, 0x02, 0x00, 0x00, 0x0f,
-        0xef, 0xab, 0x12, 0x00, 0x03, 0x02, 0x00, 0x93, 0x0d, 0xb1, 0xff, 0xce, 0x69, 0x28, 0x0b,
-        0x9b, 0xf5, 0x10, 0x00, 0x06, 0x02, 0x00, 0x20, 0x4f, 0xcc, 0x69, 0x06, 0x16, 0xc1, 0x11,
-        0x00, 0x05, 0x02, 0x00, 0x55, 0x21, 0x5a, 0x72, 0x69, 0x11, 0x0e, 0x00, 0x0f, 0x02, 0x00,
-        0x19, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0x36, 0x01, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0x25, 0x7b, 0x16, 0x55, 0x6e, 0x77, 0x62, 0x37, 0x03, 0x16, 0x00, 0x40, 0x41, 0xbf,
+        0xfd, 0xff, 0x01, 0x00, 0x37, 0xeb, 0x82, 0x12, 0x16, 0x00, 0xe5, 0x09, 0xa3, 0xff, 0xd8,
+        0x72, 0x2e, 0x0f, 0x06, 0x1c, 0x53, 0xa9, 0xfc, 0xe6, 0x42, 0x17, 0x00, 0x53, 0x0a, 0xc7,
+        0xfb, 0x70, 0x04, 0x0c, 0x00, 0x44, 0x2d, 0xd1, 0xfa, 0x49, 0x18, 0x00, 0x81, 0xab, 0xfa,
+        0x48, 0x00, 0x42, 0xb4, 0x41, 0x00, 0x05, 0x00, 0x42, 0x0c, 0xc4, 0xf3, 0x1e, 0x17, 0x00,
+        0x83, 0x4a, 0xff, 0x69, 0x00, 0x00, 0xb4, 0xff, 0xb3, 0x05, 0x00, 0x32, 0x16, 0xed, 0xaa,
+        0x18, 0x00, 0x83, 0xc9, 0xcf, 0x02, 0x00, 0x00, 0x41, 0xb3, 0x41, 0x05, 0x00, 0x40, 0x00,
+        0x7d, 0xfa, 0x14, 0x17, 0x00, 0x37, 0x20, 0xfe, 0x6a, 0x83, 0x00, 0x60, 0x00, 0x00, 0x00,
+        0x2e, 0xff, 0x55, 0x07, 0x00, 0x31, 0x59, 0xff, 0x26, 0x5d, 0x00, 0x02, 0x01, 0x00, 0x60,
+        0x42, 0xb4, 0x41, 0x0c, 0xff, 0x72, 0x0a, 0x00, 0x31, 0x73, 0xff, 0x0b, 0x58, 0x00, 0x02,
+        0x01, 0x00, 0x63, 0xb4, 0xff, 0xb3, 0x0b, 0xff, 0x74, 0x18, 0x00, 0x02, 0x58, 0x00, 0x01,
+        0x01, 0x00, 0x63, 0x41, 0xb3, 0x41, 0x3d, 0xff, 0x50, 0x48, 0x00, 0x09, 0x5f, 0x00, 0x40,
+        0x03, 0xbc, 0xef, 0x0e, 0x08, 0x00, 0x37, 0x20, 0xff, 0x68, 0x16, 0x00, 0x52, 0x14, 0x46,
+        0xc0, 0xff, 0x64, 0x0b, 0x00, 0x32, 0xcb, 0xcd, 0x01, 0x09, 0x00, 0x83, 0x4d, 0xda, 0xfe,
+        0xff, 0xff, 0xff, 0xed, 0x62, 0x23, 0x00, 0x31, 0x4e, 0xff, 0x65, 0x08, 0x00, 0x85, 0x13,
+        0xf5, 0xcc, 0x88, 0x88, 0x74, 0x4f, 0x0c, 0x3c, 0x00, 0x30, 0xb1, 0xf8, 0x3f, 0x07, 0x00,
+        0x37, 0x37, 0xff, 0x52, 0x51, 0x00, 0xda, 0x00, 0x00, 0x00, 0x0e, 0xd0, 0xf8, 0x66, 0x02,
+        0x00, 0x00, 0x0f, 0xef, 0xab, 0x18, 0x00, 0xab, 0x00, 0x0d, 0xb1, 0xff, 0xce, 0x69, 0x28,
+        0x0b, 0x9b, 0xf5, 0x18, 0x00, 0x40, 0x00, 0x00, 0x4f, 0xcc, 0x96, 0x01, 0x1d, 0xc1, 0x18,
+        0x00, 0x7f, 0x00, 0x00, 0x21, 0x5a, 0x72, 0x69, 0x11, 0x18, 0x00, 0x00, 0x0f, 0x01, 0x00,
+        0x0f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
 
 };
 
@@ -71,11 +49,11 @@ const lv_image_dsc_t icon_palette_24 = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 24,
                  .h = 24,
-                 .stride = 48,
+                 .stride = 24,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_palette_24_map),
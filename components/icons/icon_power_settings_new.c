@@ -20,94 +20,47 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_POWER_SETTINGS_NEW
     uint8_t icon_power_settings_new_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0x19, 0x05, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0xff, 0xf9, 0x8f, 0x04, 0x21, 0xe3, 0x18, 0xe3, 0x18, 0x04, 0x21, 0x13, 0x02, 0x45,
-        0x0f, 0x60, 0x00, 0xff, 0x56, 0x0f, 0xc2, 0x01, 0x05, 0x0f, 0x80, 0x01, 0x0b, 0x0f, 0x36,
-        0x00, 0x05, 0x0c, 0x02, 0x00, 0x2f, 0x04, 0x21, 0x24, 0x02, 0x05, 0x0f, 0x60, 0x00, 0x09,
-        0x02, 0x1c, 0x00, 0x0c, 0x4c, 0x00, 0x0e, 0x02, 0x00, 0x02, 0x28, 0x00, 0x0f, 0x2c, 0x00,
-        0x03, 0x02, 0x1c, 0x00, 0x0f, 0xa8, 0x00, 0x01, 0x02, 0x32, 0x00, 0x0f, 0x1c, 0x00, 0x03,
-        0x08, 0x02, 0x00, 0x2f, 0x00, 0x00, 0x2a, 0x00, 0x09, 0x0f, 0x60, 0x00, 0x07, 0x02, 0x1a,
-        0x00, 0x68, 0xe3, 0x18, 0xe3, 0x18, 0x00, 0x00, 0x50, 0x00, 0x0c, 0x02, 0x00, 0x02, 0x24,
-        0x00, 0x0f, 0xbe, 0x00, 0x03, 0x04, 0x46, 0x00, 0x0f, 0xc0, 0x00, 0x01, 0x06, 0x3a, 0x00,
-        0x0f, 0x1e, 0x00, 0x03, 0x02, 0x02, 0x00, 0x11, 0x24, 0xa0, 0x03, 0x0f, 0x1c, 0x01, 0x03,
-        0x0f, 0x60, 0x00, 0x0d, 0x06, 0x62, 0x00, 0x1f, 0x24, 0xe0, 0x03, 0x06, 0x02, 0x5c, 0x00,
-        0x0f, 0x84, 0x00, 0x07, 0x02, 0x06, 0x01, 0x0f, 0xa2, 0x00, 0x05, 0x04, 0x3e, 0x00, 0x0f,
-        0xba, 0x01, 0x01, 0x00, 0x66, 0x06, 0x04, 0x7c, 0x01, 0x0f, 0x40, 0x00, 0x05, 0x0f, 0x60,
-        0x00, 0x0d, 0x04, 0x20, 0x00, 0x0f, 0x60, 0x00, 0x05, 0x04, 0x80, 0x00, 0x0f, 0xe0, 0x00,
-        0x07, 0x0f, 0xc0, 0x00, 0x0b, 0x04, 0x20, 0x00, 0x0f, 0x62, 0x00, 0x05, 0x02, 0x1a, 0x00,
-        0x0f, 0x7e, 0x00, 0x05, 0x06, 0x40, 0x00, 0x0f, 0xe0, 0x00, 0x07, 0x0f, 0x44, 0x00, 0x0b,
-        0x02, 0x60, 0x00, 0x0f, 0x3e, 0x00, 0x09, 0x0f, 0xc0, 0x00, 0x0d, 0x04, 0x22, 0x00, 0x0f,
-        0xa4, 0x00, 0x03, 0x02, 0x60, 0x00, 0x0f, 0x1c, 0x00, 0x03, 0x02, 0x02, 0x00, 0x0f, 0x60,
-        0x00, 0x0f, 0x02, 0x44, 0x00, 0x0f, 0xa4, 0x00, 0x03, 0x02, 0x1c, 0x00, 0x22, 0xc3, 0x18,
-        0x4c, 0x00, 0x0f, 0x02, 0x00, 0x01, 0x0f, 0x60, 0x00, 0x0f, 0x04, 0xe2, 0x02, 0x0f, 0x3e,
-        0x00, 0x01, 0x02, 0x60, 0x00, 0x2f, 0x86, 0x31, 0x1c, 0x00, 0x01, 0x02, 0x02, 0x00, 0x0f,
-        0x60, 0x00, 0x0f, 0x22, 0x45, 0x29, 0x46, 0x00, 0x02, 0x30, 0x00, 0x0a, 0x02, 0x00, 0x02,
-        0x1a, 0x00, 0x2a, 0xa2, 0x10, 0x16, 0x00, 0x08, 0x02, 0x00, 0x0f, 0x60, 0x00, 0x31, 0x0f,
-        0x7c, 0x00, 0x03, 0x02, 0x02, 0x00, 0x0f, 0x60, 0x00, 0x0f, 0x22, 0xc3, 0x18, 0xa6, 0x00,
-        0x02, 0x30, 0x00, 0x0a, 0x02, 0x00, 0x02, 0x1a, 0x00, 0x0f, 0x9c, 0x01, 0x03, 0x0f, 0x02,
-        0x00, 0x15, 0x02, 0x44, 0x00, 0x0f, 0x60, 0x00, 0x09, 0x0f, 0x1c, 0x00, 0x03, 0x0f, 0x02,
-        0x00, 0x15, 0x0f, 0x60, 0x00, 0x69, 0x02, 0x5e, 0x01, 0x0f, 0xc2, 0x05, 0x0d, 0x0f, 0x02,
-        0x00, 0x09, 0x0f, 0xc2, 0x04, 0x0d, 0x02, 0xde, 0x00, 0x0f, 0x82, 0x01, 0x27, 0x02, 0x40,
-        0x00, 0x0f, 0x62, 0x01, 0x07, 0x04, 0x20, 0x00, 0x0f, 0x84, 0x06, 0x0b, 0x0f, 0x02, 0x00,
-        0x05, 0x04, 0xbe, 0x00, 0x0f, 0x60, 0x00, 0x07, 0x22, 0xa2, 0x10, 0x62, 0x00, 0x0f, 0xc2,
-        0x00, 0x23, 0x02, 0x3c, 0x00, 0x0f, 0x42, 0x03, 0x11, 0x0f, 0x84, 0x00, 0x09, 0x0f, 0x02,
-        0x00, 0x05, 0x02, 0x36, 0x00, 0x0f, 0x3a, 0x00, 0x0d, 0x06, 0xe4, 0x00, 0x0f, 0xc4, 0x00,
-        0x1b, 0x2f, 0x04, 0x21, 0x1e, 0x02, 0x15, 0x04, 0x28, 0x00, 0x0f, 0x62, 0x00, 0x19, 0x0f,
-        0x34, 0x00, 0x1b, 0x06, 0x2e, 0x00, 0x0f, 0xaa, 0x01, 0x07, 0x08, 0x02, 0x00, 0x02, 0x16,
-        0x01, 0x02, 0x02, 0x00, 0x08, 0x18, 0x00, 0x0f, 0x02, 0x00, 0x07, 0x06, 0x62, 0x00, 0x2f,
-        0x04, 0x21, 0x4c, 0x02, 0x0b, 0x06, 0x50, 0x01, 0x0f, 0xf0, 0x00, 0x19, 0x0a, 0x62, 0x00,
-        0x0f, 0xb0, 0x02, 0x05, 0x08, 0x5c, 0x00, 0x0f, 0x5e, 0x00, 0x1b, 0x0a, 0x62, 0x00, 0x06,
-        0x02, 0x00, 0x64, 0xc3, 0x18, 0x86, 0x31, 0x86, 0x31, 0x24, 0x05, 0x08, 0x02, 0x00, 0x0f,
-        0x0e, 0x02, 0x1b, 0x02, 0x02, 0x00, 0x0a, 0xa0, 0x00, 0x0f, 0x02, 0x00, 0x09, 0x0f, 0x44,
-        0x01, 0x0b, 0x0f, 0x02, 0x00, 0x09, 0x04, 0x72, 0x03, 0x0f, 0x02, 0x00, 0x07, 0x0f, 0x90,
-        0x06, 0x09, 0x0f, 0x02, 0x00, 0x15, 0x06, 0xf0, 0x01, 0x08, 0x02, 0x00, 0x0f, 0x14, 0x01,
-        0x21, 0x0f, 0x02, 0x00, 0xff, 0xc0, 0x1f, 0x00, 0x01, 0x00, 0xf2, 0x4f, 0x80, 0xff, 0xff,
-        0x80, 0x09, 0x01, 0x19, 0x0f, 0x30, 0x00, 0xa1, 0x17, 0x2e, 0xe1, 0x00, 0x0b, 0xc0, 0x00,
-        0x08, 0x1b, 0x00, 0x04, 0x02, 0x00, 0x27, 0x4f, 0xfb, 0x12, 0x01, 0x0a, 0x30, 0x00, 0x34,
-        0x80, 0xfb, 0x4d, 0x26, 0x00, 0x05, 0x02, 0x00, 0x55, 0x28, 0xf4, 0xff, 0xff, 0x66, 0x0e,
-        0x00, 0x09, 0x30, 0x00, 0x55, 0x66, 0xff, 0xff, 0xf3, 0x27, 0x1b, 0x00, 0x02, 0x02, 0x00,
-        0x62, 0x04, 0xcf, 0xff, 0xff, 0xe2, 0x18, 0x0c, 0x00, 0x0c, 0x30, 0x00, 0x61, 0x18, 0xe2,
-        0xff, 0xff, 0xce, 0x04, 0x18, 0x00, 0x05, 0x02, 0x00, 0x55, 0x72, 0xff, 0xff, 0xf5, 0x31,
-        0x0e, 0x00, 0x0a, 0x60, 0x00, 0x66, 0x00, 0x32, 0xf5, 0xff, 0xff, 0x70, 0x1d, 0x00, 0x81,
-        0x00, 0x00, 0x00, 0x0e, 0xee, 0xff, 0xff, 0x75, 0x0a, 0x00, 0x02, 0x02, 0x00, 0x0a, 0x30,
-        0x00, 0x62, 0x00, 0x76, 0xff, 0xff, 0xed, 0x0d, 0x1a, 0x00, 0x02, 0x02, 0x00, 0x52, 0x75,
-        0xff, 0xff, 0xe2, 0x08, 0x0b, 0x00, 0x01, 0x02, 0x00, 0x0b, 0x30, 0x00, 0x2a, 0x09, 0xe2,
-        0x4f, 0x00, 0x51, 0x01, 0xd9, 0xff, 0xff, 0x61, 0x29, 0x00, 0x03, 0x02, 0x00, 0x0b, 0x30,
-        0x00, 0x53, 0x00, 0x61, 0xff, 0xff, 0xd8, 0x1b, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x34,
-        0xff, 0xff, 0xed, 0x07, 0x0b, 0x00, 0x02, 0x02, 0x00, 0x0c, 0x30, 0x00, 0x47, 0x08, 0xef,
-        0xff, 0xff, 0xdf, 0x00, 0x42, 0x76, 0xff, 0xff, 0x9f, 0x29, 0x00, 0x03, 0x02, 0x00, 0x0c,
-        0x30, 0x00, 0x53, 0x00, 0xa2, 0xff, 0xff, 0x74, 0x1c, 0x00, 0x71, 0x00, 0x00, 0x00, 0xae,
-        0xff, 0xff, 0x5f, 0x09, 0x00, 0x04, 0x02, 0x00, 0x0d, 0x30, 0x00, 0x44, 0x61, 0xff, 0xff,
-        0xac, 0x1d, 0x00, 0x66, 0x00, 0x00, 0xd5, 0xff, 0xff, 0x32, 0x0e, 0x00, 0x0d, 0x50, 0x01,
-        0x71, 0x00, 0x00, 0x00, 0x35, 0xff, 0xff, 0xd2, 0x09, 0x00, 0x01, 0x02, 0x00, 0x41, 0xee,
-        0xff, 0xff, 0x13, 0x09, 0x00, 0x04, 0x02, 0x00, 0x0d, 0x60, 0x00, 0x44, 0x15, 0xff, 0xff,
-        0xed, 0x1d, 0x00, 0x66, 0x00, 0x00, 0xfa, 0xff, 0xff, 0x05, 0x0e, 0x00, 0x0f, 0x60, 0x00,
-        0x01, 0x41, 0x06, 0xff, 0xff, 0xf8, 0x1a, 0x00, 0x01, 0x02, 0x00, 0x41, 0xfa, 0xff, 0xff,
-        0x0b, 0x09, 0x00, 0x04, 0x02, 0x00, 0x0d, 0x60, 0x00, 0x44, 0x06, 0xff, 0xff, 0xf9, 0x1d,
-        0x00, 0x66, 0x00, 0x00, 0xed, 0xff, 0xff, 0x22, 0x0e, 0x00, 0x0f, 0x60, 0x00, 0x01, 0x41,
-        0x14, 0xff, 0xff, 0xec, 0x1a, 0x00, 0x01, 0x02, 0x00, 0x41, 0xd3, 0xff, 0xff, 0x38, 0x09,
-        0x00, 0x0f, 0x02, 0x00, 0x06, 0x46, 0x32, 0xff, 0xff, 0xd1, 0x1d, 0x00, 0x46, 0xac, 0xff,
-        0xff, 0x5b, 0x0e, 0x00, 0x0f, 0x02, 0x00, 0x01, 0x46, 0x5d, 0xff, 0xff, 0xab, 0x18, 0x00,
-        0x46, 0x74, 0xff, 0xff, 0x98, 0x0e, 0x00, 0x0f, 0x02, 0x00, 0x01, 0x46, 0x9c, 0xff, 0xff,
-        0x73, 0x18, 0x00, 0x56, 0x30, 0xff, 0xff, 0xe7, 0x03, 0x0f, 0x00, 0x0e, 0x02, 0x00, 0x57,
-        0x04, 0xe9, 0xff, 0xff, 0x2f, 0x17, 0x00, 0x47, 0xd7, 0xff, 0xff, 0x4f, 0x0f, 0x00, 0x0d,
-        0x02, 0x00, 0x48, 0x52, 0xff, 0xff, 0xd6, 0x15, 0x00, 0x58, 0x73, 0xff, 0xff, 0xc9, 0x01,
-        0x11, 0x00, 0x0a, 0x02, 0x00, 0x58, 0x02, 0xcc, 0xff, 0xff, 0x72, 0x13, 0x00, 0x58, 0x0c,
-        0xec, 0xff, 0xff, 0x60, 0x11, 0x00, 0x0a, 0x02, 0x00, 0x59, 0x63, 0xff, 0xff, 0xeb, 0x0c,
-        0x13, 0x00, 0x59, 0x70, 0xff, 0xff, 0xef, 0x21, 0x12, 0x00, 0x07, 0x02, 0x00, 0x57, 0x23,
-        0xf0, 0xff, 0xff, 0x6e, 0x10, 0x00, 0x91, 0x00, 0x00, 0x00, 0x04, 0xce, 0xff, 0xff, 0xd0,
-        0x0f, 0x0b, 0x00, 0x0d, 0x02, 0x00, 0x5c, 0x0f, 0xd2, 0xff, 0xff, 0xcd, 0x0f, 0x01, 0x5f,
-        0x28, 0xf3, 0xff, 0xff, 0xc3, 0x31, 0x00, 0x02, 0x6d, 0x10, 0xc3, 0xff, 0xff, 0xf3, 0x26,
-        0x46, 0x00, 0x5f, 0x4f, 0xfc, 0xff, 0xff, 0xd0, 0x93, 0x00, 0x00, 0x6d, 0x23, 0xd1, 0xff,
-        0xff, 0xfc, 0x4e, 0x2f, 0x00, 0x8b, 0x00, 0x00, 0x5f, 0xfc, 0xff, 0xff, 0xef, 0x60, 0x26,
-        0x01, 0x6a, 0x01, 0x63, 0xf0, 0xff, 0xff, 0xfc, 0x4d, 0x03, 0x04, 0x02, 0x00, 0x77, 0x4f,
+        0x02, 0x00, 0x00, 0x00, 0x4d, 0x02, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0xf2, 0x4f, 0x80, 0xff, 0xff, 0x80, 0x27, 0x00, 0x10, 0x05, 0x01, 0x00, 0x0f, 0x30,
+        0x00, 0xa1, 0x17, 0x2e, 0x0c, 0x00, 0x0b, 0x30, 0x00, 0x08, 0x1b, 0x00, 0x04, 0x01, 0x00,
+        0x27, 0x4f, 0xfb, 0x22, 0x00, 0x0a, 0x30, 0x00, 0x3d, 0x80, 0xfb, 0x4d, 0x2f, 0x00, 0x5f,
+        0x28, 0xf4, 0xff, 0xff, 0x66, 0x30, 0x00, 0x03, 0x5b, 0x66, 0xff, 0xff, 0xf3, 0x27, 0x2f,
+        0x00, 0x6f, 0x04, 0xcf, 0xff, 0xff, 0xe2, 0x18, 0x30, 0x00, 0x03, 0x6a, 0x18, 0xe2, 0xff,
+        0xff, 0xce, 0x04, 0x30, 0x00, 0x56, 0x72, 0xff, 0xff, 0xf5, 0x31, 0x0f, 0x00, 0x0a, 0x90,
+        0x00, 0x59, 0x32, 0xf5, 0xff, 0xff, 0x70, 0x2f, 0x00, 0x57, 0x0e, 0xee, 0xff, 0xff, 0x75,
+        0x10, 0x00, 0x0b, 0xf0, 0x00, 0x58, 0x76, 0xff, 0xff, 0xed, 0x0d, 0x30, 0x00, 0x5f, 0x75,
+        0xff, 0xff, 0xe2, 0x08, 0x30, 0x00, 0x07, 0x2a, 0x09, 0xe2, 0x4f, 0x00, 0x57, 0x01, 0xd9,
+        0xff, 0xff, 0x61, 0x10, 0x00, 0x0d, 0x80, 0x01, 0x47, 0x61, 0xff, 0xff, 0xd8, 0x0f, 0x00,
+        0x5f, 0x34, 0xff, 0xff, 0xed, 0x07, 0x30, 0x00, 0x09, 0x47, 0x08, 0xef, 0xff, 0xff, 0xdf,
+        0x00, 0x48, 0x76, 0xff, 0xff, 0x9f, 0x1f, 0x00, 0x0e, 0xe0, 0x01, 0x46, 0xa2, 0xff, 0xff,
+        0x74, 0x0e, 0x00, 0x4f, 0xae, 0xff, 0xff, 0x5f, 0x30, 0x00, 0x0b, 0x46, 0x61, 0xff, 0xff,
+        0xac, 0x0e, 0x00, 0x4f, 0xd5, 0xff, 0xff, 0x32, 0x30, 0x00, 0x0b, 0x46, 0x35, 0xff, 0xff,
+        0xd2, 0x0e, 0x00, 0x4f, 0xee, 0xff, 0xff, 0x13, 0x30, 0x00, 0x0b, 0x46, 0x15, 0xff, 0xff,
+        0xed, 0x0e, 0x00, 0x4f, 0xfa, 0xff, 0xff, 0x05, 0x30, 0x00, 0x0b, 0x49, 0x06, 0xff, 0xff,
+        0xf8, 0x30, 0x00, 0x1f, 0x0b, 0x30, 0x00, 0x0e, 0x16, 0xf9, 0x0e, 0x00, 0x4f, 0xed, 0xff,
+        0xff, 0x22, 0x30, 0x00, 0x0b, 0x46, 0x14, 0xff, 0xff, 0xec, 0x0e, 0x00, 0x49, 0xd3, 0xff,
+        0xff, 0x38, 0x1f, 0x00, 0x0d, 0x01, 0x00, 0x46, 0x32, 0xff, 0xff, 0xd1, 0x0e, 0x00, 0x4f,
+        0xac, 0xff, 0xff, 0x5b, 0x2e, 0x00, 0x09, 0x66, 0x00, 0x00, 0x5d, 0xff, 0xff, 0xab, 0x0e,
+        0x00, 0x4f, 0x74, 0xff, 0xff, 0x98, 0x2e, 0x00, 0x09, 0x66, 0x00, 0x00, 0x9c, 0xff, 0xff,
+        0x73, 0x0e, 0x00, 0x5f, 0x30, 0xff, 0xff, 0xe7, 0x03, 0x2f, 0x00, 0x09, 0x57, 0x04, 0xe9,
+        0xff, 0xff, 0x2f, 0x10, 0x00, 0x4f, 0xd7, 0xff, 0xff, 0x4f, 0x2f, 0x00, 0x08, 0x58, 0x00,
+        0x52, 0xff, 0xff, 0xd6, 0x10, 0x00, 0x5f, 0x73, 0xff, 0xff, 0xc9, 0x01, 0x2f, 0x00, 0x07,
+        0x58, 0x02, 0xcc, 0xff, 0xff, 0x72, 0x11, 0x00, 0x5f, 0x0c, 0xec, 0xff, 0xff, 0x60, 0x30,
+        0x00, 0x07, 0x59, 0x63, 0xff, 0xff, 0xeb, 0x0c, 0x12, 0x00, 0x5f, 0x70, 0xff, 0xff, 0xef,
+        0x21, 0x2f, 0x00, 0x05, 0x5a, 0x23, 0xf0, 0xff, 0xff, 0x6e, 0x13, 0x00, 0x6f, 0x04, 0xce,
+        0xff, 0xff, 0xd0, 0x0f, 0x2f, 0x00, 0x03, 0x5c, 0x0f, 0xd2, 0xff, 0xff, 0xcd, 0x0f, 0x01,
+        0x5f, 0x28, 0xf3, 0xff, 0xff, 0xc3, 0x31, 0x00, 0x02, 0x6d, 0x10, 0xc3, 0xff, 0xff, 0xf3,
+        0x26, 0x17, 0x00, 0x5f, 0x4f, 0xfc, 0xff, 0xff, 0xd0, 0x93, 0x00, 0x00, 0x6e, 0x23, 0xd1,
+        0xff, 0xff, 0xfc, 0x4e, 0x18, 0x00, 0x7b, 0x00, 0x5f, 0xfc, 0xff, 0xff, 0xef, 0x60, 0x26,
+        0x01, 0x6a, 0x01, 0x63, 0xf0, 0xff, 0xff, 0xfc, 0x4d, 0x03, 0x04, 0x01, 0x00, 0x77, 0x4f,
         0xf3, 0xff, 0xff, 0xff, 0xca, 0x51, 0xaa, 0x00, 0x7f, 0x04, 0x52, 0xcc, 0xff, 0xff, 0xff,
-        0xf3, 0x9b, 0x01, 0x05, 0x20, 0x27, 0xce, 0x5e, 0x19, 0xc0, 0xe9, 0x9b, 0x5c, 0x32, 0x14,
-        0x05, 0x05, 0x14, 0x32, 0x5d, 0x9c, 0xea, 0x6e, 0x19, 0x1c, 0xcd, 0x0c, 0x05, 0x06, 0x02,
-        0x00, 0x3c, 0x04, 0x6f, 0xeb, 0x62, 0x09, 0x36, 0xeb, 0x6e, 0x04, 0x20, 0x00, 0x0e, 0x02,
-        0x00, 0x38, 0x0c, 0x72, 0xd6, 0x32, 0x00, 0x2a, 0xd6, 0x73, 0xa7, 0x01, 0x0f, 0x02, 0x00,
-        0x01, 0xcf, 0x30, 0x73, 0xab, 0xd1, 0xee, 0xfa, 0xfa, 0xee, 0xd1, 0xac, 0x73, 0x30, 0x20,
-        0x00, 0x01, 0x0f, 0x02, 0x00, 0xd6, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xf3, 0x9b, 0x01, 0x05, 0xf0, 0x03, 0x27, 0xce, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x9b, 0x5c,
+        0x32, 0x14, 0x05, 0x05, 0x14, 0x32, 0x5d, 0x9c, 0xea, 0x10, 0x00, 0x1c, 0xcd, 0x0c, 0x05,
+        0x06, 0x01, 0x00, 0x30, 0x04, 0x6f, 0xeb, 0x22, 0x00, 0x08, 0x01, 0x00, 0x2b, 0xeb, 0x6e,
+        0x0a, 0x05, 0x0a, 0x01, 0x00, 0x38, 0x0c, 0x72, 0xd6, 0x2e, 0x00, 0x2a, 0xd6, 0x73, 0xa7,
+        0x01, 0x0f, 0x01, 0x00, 0x01, 0xcf, 0x30, 0x73, 0xab, 0xd1, 0xee, 0xfa, 0xfa, 0xee, 0xd1,
+        0xac, 0x73, 0x30, 0x2d, 0x00, 0x0e, 0x0f, 0x01, 0x00, 0xc9, 0x50, 0x00, 0x00, 0x00, 0x00,
+        0x00,
 
 };
 
@@ -115,11 +68,11 @@ const lv_image_dsc_t icon_power_settings_new = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 48,
                  .h = 48,
-                 .stride = 96,
+                 .stride = 48,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_power_settings_new_map),
@@ -20,44 +20,23 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_POWER_SETTINGS_NEW_24
     uint8_t icon_power_settings_new_24_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0x21, 0x02, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0x62, 0x4f, 0x04, 0x21, 0x04, 0x21, 0x79, 0x00, 0x19, 0x4f, 0xe3, 0x18, 0xe3, 0x18,
-        0x30, 0x00, 0x3b, 0x0a, 0x82, 0x00, 0x0a, 0x60, 0x00, 0x0a, 0x1c, 0x00, 0x00, 0x22, 0x01,
-        0x66, 0x00, 0x00, 0xe3, 0x18, 0xe3, 0x18, 0xb4, 0x00, 0x08, 0x30, 0x00, 0x82, 0x04, 0x21,
-        0xe3, 0x18, 0xe3, 0x18, 0x00, 0x00, 0x2a, 0x00, 0x02, 0x02, 0x00, 0x28, 0xe3, 0x18, 0x22,
-        0x00, 0x02, 0x10, 0x00, 0x02, 0x1a, 0x00, 0x00, 0x70, 0x01, 0x02, 0x32, 0x00, 0x02, 0x0c,
-        0x00, 0x02, 0x02, 0x00, 0x0c, 0x42, 0x00, 0x0a, 0x3e, 0x00, 0x02, 0x7e, 0x00, 0x02, 0x2a,
-        0x00, 0x04, 0x4e, 0x00, 0x08, 0x10, 0x00, 0x0c, 0x30, 0x00, 0x02, 0x10, 0x00, 0x06, 0x22,
-        0x00, 0x0a, 0xbc, 0x00, 0x04, 0x20, 0x00, 0x02, 0x0a, 0x00, 0x02, 0x02, 0x00, 0x0a, 0xb0,
-        0x00, 0x62, 0xe3, 0x18, 0xe3, 0x18, 0xa2, 0x10, 0x1a, 0x00, 0x02, 0x02, 0x00, 0x08, 0x4e,
-        0x00, 0x00, 0x32, 0x02, 0x28, 0xa2, 0x10, 0x12, 0x00, 0x0f, 0x30, 0x00, 0x0f, 0x11, 0x24,
-        0x24, 0x01, 0x02, 0x3c, 0x00, 0x02, 0x30, 0x00, 0x06, 0x4c, 0x01, 0x0f, 0x02, 0x00, 0x01,
-        0x0a, 0x22, 0x01, 0x2f, 0x04, 0x21, 0x30, 0x00, 0x1b, 0x6a, 0xff, 0xff, 0xe3, 0x18, 0x04,
-        0x21, 0x92, 0x01, 0x08, 0x02, 0x00, 0x0c, 0x50, 0x01, 0x0f, 0x92, 0x00, 0x0d, 0x0a, 0x1e,
-        0x01, 0x02, 0x02, 0x00, 0x0f, 0x14, 0x00, 0x01, 0x02, 0x02, 0x00, 0x0f, 0x1a, 0x00, 0x03,
-        0x02, 0xd2, 0x00, 0x0c, 0x96, 0x00, 0x02, 0x8a, 0x00, 0x0f, 0xde, 0x00, 0x03, 0x02, 0x32,
-        0x00, 0xc6, 0xe3, 0x18, 0x04, 0x21, 0x04, 0x21, 0xa2, 0x10, 0xa2, 0x10, 0x04, 0x21, 0x12,
-        0x00, 0x02, 0x6a, 0x00, 0x0e, 0x02, 0x00, 0x02, 0x7c, 0x00, 0x0a, 0x02, 0x00, 0x0e, 0x26,
-        0x00, 0x0a, 0x02, 0x00, 0x08, 0x2e, 0x00, 0x0a, 0x1a, 0x00, 0x0f, 0x02, 0x00, 0x51, 0x1f,
-        0x00, 0x01, 0x00, 0x27, 0x2f, 0x59, 0x59, 0x3c, 0x00, 0x03, 0x2f, 0xbf, 0xbf, 0x18, 0x00,
-        0x14, 0x21, 0x0f, 0x69, 0x29, 0x00, 0x03, 0x30, 0x00, 0x21, 0x69, 0x0f, 0x0e, 0x00, 0x66,
-        0x00, 0x00, 0x01, 0xb6, 0xf8, 0x20, 0x18, 0x00, 0x42, 0x20, 0xf8, 0xb5, 0x01, 0x19, 0x00,
-        0x31, 0x53, 0xff, 0x66, 0x09, 0x00, 0x03, 0x30, 0x00, 0x31, 0x68, 0xff, 0x52, 0x0f, 0x00,
-        0x41, 0x00, 0xce, 0xd0, 0x02, 0x09, 0x00, 0x03, 0x18, 0x00, 0x31, 0x02, 0xd0, 0xce, 0x0f,
-        0x00, 0x31, 0x21, 0xff, 0x6c, 0x08, 0x00, 0x04, 0x18, 0x00, 0xba, 0x00, 0x6e, 0xff, 0x22,
-        0x00, 0x00, 0x00, 0x00, 0x5b, 0xff, 0x28, 0x18, 0x00, 0xaa, 0x2a, 0xff, 0x5a, 0x00, 0x00,
-        0x00, 0x00, 0x75, 0xff, 0x0b, 0x18, 0x00, 0x8c, 0x0c, 0xff, 0x73, 0x00, 0x00, 0x00, 0x00,
-        0x73, 0x18, 0x00, 0xa2, 0x0d, 0xff, 0x72, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xff, 0x26, 0x30,
-        0x00, 0x04, 0x02, 0x00, 0x12, 0x27, 0x48, 0x00, 0x34, 0x20, 0xfe, 0x67, 0x12, 0x00, 0x02,
-        0x02, 0x00, 0x31, 0x69, 0xff, 0x21, 0x09, 0x00, 0x23, 0xcd, 0xca, 0xc9, 0x00, 0x02, 0x02,
-        0x00, 0x22, 0x01, 0xcb, 0xa8, 0x00, 0x42, 0x00, 0x51, 0xff, 0x60, 0x12, 0x00, 0x02, 0x02,
-        0x00, 0x32, 0x62, 0xff, 0x51, 0x09, 0x00, 0x43, 0x00, 0xb5, 0xf6, 0x3b, 0x0a, 0x00, 0x61,
-        0x00, 0x00, 0x00, 0x3b, 0xf7, 0xb4, 0x08, 0x00, 0x73, 0x00, 0x00, 0x00, 0x0f, 0xd3, 0xf7,
-        0x61, 0x4b, 0x00, 0x44, 0x01, 0x62, 0xf7, 0xd3, 0x38, 0x01, 0xf6, 0x00, 0x00, 0x00, 0x0f,
-        0xb5, 0xff, 0xcb, 0x68, 0x28, 0x0b, 0x0b, 0x28, 0x68, 0xcc, 0xff, 0xb4, 0x17, 0x00, 0x52,
-        0x00, 0x00, 0x00, 0x51, 0xcd, 0x4d, 0x02, 0x14, 0xcd, 0x5c, 0x00, 0x05, 0x02, 0x00, 0x52,
-        0x21, 0x5a, 0x72, 0x72, 0x5a, 0xa1, 0x00, 0x0f, 0x02, 0x00, 0x1c, 0x50, 0x00, 0x00, 0x00,
-        0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0x27, 0x2f, 0x59, 0x59, 0x18, 0x00, 0x03, 0x2f, 0xbf, 0xbf, 0x18, 0x00, 0x14, 0x28,
+        0x0f, 0x69, 0x18, 0x00, 0x23, 0x69, 0x0f, 0x17, 0x00, 0x46, 0x01, 0xb6, 0xf8, 0x20, 0x18,
+        0x00, 0x42, 0x20, 0xf8, 0xb5, 0x01, 0x18, 0x00, 0x38, 0x53, 0xff, 0x66, 0x30, 0x00, 0x32,
+        0x68, 0xff, 0x52, 0x18, 0x00, 0x38, 0xce, 0xd0, 0x02, 0x18, 0x00, 0x31, 0x02, 0xd0, 0xce,
+        0x08, 0x00, 0x32, 0x21, 0xff, 0x6c, 0x20, 0x00, 0x04, 0x78, 0x00, 0x30, 0x6e, 0xff, 0x22,
+        0x07, 0x00, 0x3a, 0x5b, 0xff, 0x28, 0x18, 0x00, 0x30, 0x2a, 0xff, 0x5a, 0x07, 0x00, 0x3a,
+        0x75, 0xff, 0x0b, 0x18, 0x00, 0x30, 0x0c, 0xff, 0x73, 0x07, 0x00, 0x1c, 0x73, 0x18, 0x00,
+        0x30, 0x0d, 0xff, 0x72, 0x07, 0x00, 0x32, 0x5a, 0xff, 0x26, 0x10, 0x00, 0x04, 0x01, 0x00,
+        0x12, 0x27, 0x48, 0x00, 0x3a, 0x20, 0xfe, 0x67, 0x18, 0x00, 0x31, 0x69, 0xff, 0x21, 0x08,
+        0x00, 0x23, 0xcd, 0xca, 0xc9, 0x00, 0x02, 0x01, 0x00, 0x22, 0x01, 0xcb, 0xa8, 0x00, 0x48,
+        0x00, 0x51, 0xff, 0x60, 0x18, 0x00, 0x33, 0x62, 0xff, 0x51, 0x0a, 0x00, 0x36, 0xb5, 0xf6,
+        0x3b, 0x17, 0x00, 0x34, 0x3b, 0xf7, 0xb4, 0x0b, 0x00, 0x43, 0x0f, 0xd3, 0xf7, 0x61, 0x4b,
+        0x00, 0x44, 0x01, 0x62, 0xf7, 0xd3, 0x38, 0x01, 0xf6, 0x00, 0x00, 0x00, 0x0f, 0xb5, 0xff,
+        0xcb, 0x68, 0x28, 0x0b, 0x0b, 0x28, 0x68, 0xcc, 0xff, 0xb4, 0x17, 0x00, 0x00, 0x64, 0x00,
+        0x21, 0xcd, 0xff, 0x01, 0x00, 0x14, 0xcd, 0x5c, 0x00, 0x05, 0x01, 0x00, 0x52, 0x21, 0x5a,
+        0x72, 0x72, 0x5a, 0xa1, 0x00, 0x0f, 0x01, 0x00, 0x1c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
 
 };
 
@@ -65,11 +44,11 @@ const lv_image_dsc_t icon_power_settings_new_24 = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 24,
                  .h = 24,
-                 .stride = 48,
+                 .stride = 24,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_power_settings_new_24_map),
@@ -20,65 +20,30 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_REMOTE_GEN uint8_t
     icon_remote_gen_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0x66, 0x03, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0xcc, 0x2f, 0xe3, 0x18, 0x02, 0x00, 0x0b, 0x0f, 0xff, 0x00, 0x27, 0x2f, 0x00, 0x00,
-        0x5a, 0x00, 0x0b, 0x06, 0x02, 0x00, 0x2f, 0x00, 0x00, 0x66, 0x00, 0x21, 0x26, 0x04, 0x21,
-        0x42, 0x00, 0x0f, 0x02, 0x00, 0x0d, 0x0f, 0x60, 0x00, 0x21, 0x0f, 0x54, 0x00, 0x0d, 0x08,
-        0x02, 0x00, 0x0f, 0x60, 0x00, 0x1f, 0x04, 0xbe, 0x00, 0x0f, 0xfc, 0x00, 0x0b, 0x04, 0x44,
-        0x01, 0x2f, 0x04, 0x21, 0x62, 0x00, 0x1d, 0x04, 0x60, 0x00, 0x0f, 0x38, 0x00, 0x0d, 0x02,
-        0xc6, 0x00, 0x0f, 0x60, 0x00, 0x31, 0x22, 0x45, 0x29, 0x74, 0x00, 0x46, 0x04, 0x21, 0x45,
-        0x29, 0x76, 0x00, 0x0f, 0x60, 0x00, 0x35, 0x02, 0x5c, 0x00, 0x04, 0x02, 0x00, 0x06, 0xb0,
-        0x00, 0x02, 0x12, 0x00, 0x06, 0x10, 0x00, 0x0f, 0x02, 0x00, 0x15, 0x04, 0x50, 0x00, 0x02,
-        0x30, 0x00, 0x04, 0x0e, 0x00, 0x06, 0x02, 0x00, 0x04, 0x52, 0x00, 0x02, 0x12, 0x00, 0x04,
-        0x0e, 0x00, 0x0f, 0x02, 0x00, 0x17, 0x04, 0x52, 0x00, 0x00, 0x40, 0x04, 0x22, 0x45, 0x29,
-        0x46, 0x00, 0x0a, 0x02, 0x00, 0x02, 0x26, 0x01, 0x02, 0x14, 0x00, 0x0f, 0x60, 0x00, 0x2b,
-        0x02, 0x44, 0x00, 0x04, 0x6e, 0x00, 0x02, 0x0a, 0x00, 0x04, 0x54, 0x00, 0x02, 0x0e, 0x00,
-        0x0f, 0x60, 0x00, 0x33, 0x04, 0xfe, 0x00, 0x02, 0x54, 0x00, 0x02, 0x10, 0x00, 0x02, 0x0c,
-        0x00, 0x0f, 0x60, 0x00, 0x8b, 0x04, 0x8c, 0x01, 0x08, 0xb2, 0x00, 0x04, 0xb4, 0x00, 0x0f,
-        0xc0, 0x00, 0x31, 0x0f, 0xe0, 0x01, 0x4d, 0x08, 0xc2, 0x00, 0x04, 0x02, 0x00, 0x04, 0x72,
-        0x01, 0x02, 0x10, 0x00, 0x04, 0x0e, 0x00, 0x0f, 0x02, 0x00, 0x17, 0x04, 0x14, 0x01, 0x04,
-        0x32, 0x00, 0x04, 0x10, 0x00, 0x02, 0x02, 0x00, 0x06, 0x50, 0x00, 0x0c, 0x10, 0x00, 0x0f,
-        0x02, 0x00, 0x15, 0x04, 0x50, 0x00, 0x06, 0x30, 0x00, 0x06, 0x20, 0x04, 0x26, 0x86, 0x31,
-        0x16, 0x00, 0x0f, 0x60, 0x00, 0x37, 0x0f, 0x02, 0x00, 0x03, 0x0f, 0x60, 0x00, 0xff, 0x52,
-        0x02, 0x64, 0x01, 0x06, 0xec, 0x01, 0x02, 0x10, 0x00, 0x02, 0x44, 0x02, 0x08, 0x0c, 0x00,
-        0x0f, 0x02, 0x00, 0x19, 0x08, 0x40, 0x02, 0x02, 0x44, 0x00, 0x0c, 0x60, 0x00, 0x02, 0x10,
-        0x00, 0x02, 0x1c, 0x00, 0x02, 0x6c, 0x00, 0x0f, 0x02, 0x00, 0x19, 0x0f, 0x60, 0x00, 0x59,
-        0x02, 0xc6, 0x07, 0x06, 0xa4, 0x00, 0x02, 0x7c, 0x00, 0x02, 0xfa, 0x07, 0x0f, 0xc0, 0x00,
-        0x31, 0x0f, 0x02, 0x00, 0x09, 0x0f, 0x60, 0x00, 0x91, 0x02, 0xa4, 0x00, 0x02, 0xd0, 0x01,
-        0x00, 0x70, 0x0b, 0x02, 0x10, 0x00, 0x02, 0x30, 0x01, 0x08, 0x0c, 0x00, 0x0f, 0x02, 0x00,
-        0x19, 0x02, 0x64, 0x01, 0x02, 0x54, 0x00, 0x02, 0x44, 0x00, 0x02, 0x0c, 0x00, 0x06, 0x60,
-        0x00, 0x02, 0x10, 0x00, 0x02, 0x1c, 0x00, 0x02, 0x6c, 0x00, 0x0f, 0x02, 0x00, 0x19, 0x0f,
-        0x60, 0x00, 0x59, 0x0f, 0x40, 0x02, 0xff, 0xff, 0xeb, 0x02, 0x26, 0x05, 0x0f, 0x02, 0x00,
-        0x05, 0x02, 0x1a, 0x03, 0x0f, 0xc0, 0x03, 0x21, 0x04, 0xfa, 0x03, 0x0f, 0x02, 0x00, 0x13,
-        0x0f, 0x80, 0x00, 0x05, 0x0f, 0x02, 0x00, 0x09, 0x0f, 0x5a, 0x00, 0x13, 0x02, 0x02, 0x00,
-        0x0f, 0x48, 0x00, 0x09, 0x0f, 0x02, 0x00, 0x05, 0x04, 0xfc, 0x00, 0x0f, 0x02, 0x00, 0x0f,
-        0x0f, 0x44, 0x01, 0x0b, 0x0f, 0x02, 0x00, 0x0b, 0x0f, 0x5e, 0x00, 0x0d, 0x0f, 0x3e, 0x00,
-        0x0b, 0x0f, 0x02, 0x00, 0xaf, 0x1f, 0x00, 0x01, 0x00, 0x5c, 0x29, 0x1a, 0x22, 0x01, 0x00,
-        0x1f, 0x1a, 0x7f, 0x00, 0x0a, 0x3c, 0x01, 0x6f, 0xec, 0x62, 0x01, 0x3f, 0xec, 0x6f, 0x01,
-        0x33, 0x00, 0x07, 0x1c, 0x70, 0x2e, 0x00, 0x00, 0xde, 0x12, 0x1f, 0x6e, 0x30, 0x00, 0x07,
-        0x59, 0xec, 0xff, 0xff, 0xea, 0xdd, 0x01, 0x00, 0x4f, 0xea, 0xff, 0xff, 0xea, 0x30, 0x00,
-        0x06, 0x5a, 0x18, 0xff, 0xff, 0xec, 0x03, 0x1e, 0x00, 0x5a, 0x03, 0xec, 0xff, 0xff, 0x18,
-        0x13, 0x00, 0x06, 0x02, 0x00, 0x46, 0x1e, 0xff, 0xff, 0xe1, 0x0e, 0x00, 0x02, 0x02, 0x00,
-        0x42, 0xe1, 0xff, 0xff, 0x1e, 0x0a, 0x00, 0x0e, 0x02, 0x00, 0x05, 0x30, 0x00, 0x61, 0x06,
-        0x48, 0x73, 0x73, 0x48, 0x06, 0x21, 0x00, 0x0f, 0x30, 0x00, 0x11, 0x20, 0x40, 0xdf, 0xc6,
-        0x13, 0x2f, 0xdf, 0x3f, 0x30, 0x00, 0x14, 0x22, 0x40, 0xf9, 0x19, 0x01, 0x2f, 0xf9, 0x3f,
-        0x30, 0x00, 0x12, 0xcf, 0x06, 0xdf, 0xff, 0xff, 0xef, 0x98, 0x98, 0xef, 0xff, 0xff, 0xdd,
-        0x06, 0x60, 0x00, 0x11, 0xcf, 0x49, 0xff, 0xff, 0xef, 0x21, 0x00, 0x00, 0x21, 0xef, 0xff,
-        0xff, 0x47, 0x30, 0x00, 0x11, 0xcf, 0x76, 0xff, 0xff, 0x96, 0x00, 0x00, 0x00, 0x00, 0x98,
-        0xff, 0xff, 0x74, 0x30, 0x00, 0x11, 0x43, 0x74, 0xff, 0xff, 0x97, 0x30, 0x00, 0x1f, 0x73,
-        0x30, 0x00, 0x11, 0x1f, 0x48, 0x90, 0x00, 0x1c, 0x2f, 0x06, 0xde, 0xf0, 0x00, 0x1b, 0x24,
-        0x00, 0x3f, 0x50, 0x01, 0x1f, 0x3e, 0x50, 0x01, 0x12, 0x40, 0x00, 0x00, 0x3f, 0xde, 0x76,
-        0x15, 0x2f, 0xdc, 0x3e, 0xb0, 0x01, 0x14, 0x8f, 0x00, 0x00, 0x06, 0x47, 0x72, 0x72, 0x46,
-        0x05, 0x10, 0x02, 0x16, 0x08, 0x02, 0x00, 0x0f, 0x40, 0x02, 0x11, 0x08, 0x02, 0x00, 0x0f,
-        0x30, 0x00, 0x6f, 0xcf, 0x21, 0xd0, 0xef, 0x63, 0x00, 0x00, 0x00, 0x00, 0x63, 0xef, 0xcf,
-        0x20, 0x90, 0x00, 0x11, 0xcf, 0x8d, 0xff, 0xff, 0xee, 0x00, 0x00, 0x00, 0x00, 0xee, 0xff,
-        0xff, 0x8c, 0x30, 0x00, 0x11, 0xcf, 0x6f, 0xff, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00, 0xd0,
-        0xff, 0xff, 0x6d, 0x30, 0x00, 0x11, 0xcf, 0x04, 0x6e, 0x8c, 0x20, 0x00, 0x00, 0x00, 0x00,
-        0x20, 0x8c, 0x6d, 0x04, 0x30, 0x00, 0x11, 0x0a, 0x02, 0x00, 0x0f, 0x50, 0x01, 0x3f, 0x0f,
-        0x20, 0x01, 0xff, 0xf8, 0x0f, 0x90, 0x06, 0x1d, 0x2f, 0x00, 0xeb, 0xf0, 0x06, 0x1b, 0x22,
-        0x00, 0x6f, 0x29, 0x06, 0x0a, 0x02, 0x00, 0x1a, 0x6d, 0xe1, 0x02, 0x08, 0x02, 0x00, 0x3a,
-        0x01, 0x6e, 0xeb, 0x2c, 0x00, 0x4f, 0xff, 0xff, 0xea, 0x6e, 0xb0, 0x07, 0x08, 0x0f, 0x10,
-        0x08, 0x1d, 0x0f, 0x02, 0x00, 0x3b, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0x5b, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0x5c, 0x29, 0x1a, 0x22, 0x01, 0x00, 0x1f, 0x1a, 0x2d, 0x00, 0x0a, 0x4b, 0x01, 0x6f,
+        0xec, 0xff, 0x01, 0x00, 0x3f, 0xec, 0x6f, 0x01, 0x30, 0x00, 0x07, 0x1c, 0x70, 0x2e, 0x00,
+        0x00, 0x01, 0x00, 0x1f, 0x6e, 0x30, 0x00, 0x07, 0x59, 0xec, 0xff, 0xff, 0xea, 0xdd, 0x01,
+        0x00, 0x4f, 0xea, 0xff, 0xff, 0xea, 0x2f, 0x00, 0x06, 0x5a, 0x18, 0xff, 0xff, 0xec, 0x03,
+        0x13, 0x00, 0x5f, 0x03, 0xec, 0xff, 0xff, 0x18, 0x30, 0x00, 0x05, 0x4c, 0x1e, 0xff, 0xff,
+        0xe1, 0x14, 0x00, 0x4f, 0xe1, 0xff, 0xff, 0x1e, 0x2e, 0x00, 0x03, 0x07, 0x30, 0x00, 0x6f,
+        0x06, 0x48, 0x73, 0x73, 0x48, 0x06, 0x30, 0x00, 0x16, 0x20, 0x40, 0xdf, 0xe8, 0x00, 0x2f,
+        0xdf, 0x3f, 0x30, 0x00, 0x14, 0x22, 0x40, 0xf9, 0x19, 0x01, 0x10, 0xf9, 0x31, 0x00, 0x0f,
+        0x30, 0x00, 0x0f, 0xcf, 0x06, 0xdf, 0xff, 0xff, 0xef, 0x98, 0x98, 0xef, 0xff, 0xff, 0xdd,
+        0x06, 0x30, 0x00, 0x11, 0xcf, 0x49, 0xff, 0xff, 0xef, 0x21, 0x00, 0x00, 0x21, 0xef, 0xff,
+        0xff, 0x47, 0x30, 0x00, 0x11, 0x40, 0x76, 0xff, 0xff, 0x96, 0x0e, 0x00, 0x4f, 0x98, 0xff,
+        0xff, 0x74, 0x30, 0x00, 0x11, 0x43, 0x74, 0xff, 0xff, 0x97, 0x30, 0x00, 0x1f, 0x73, 0x30,
+        0x00, 0x11, 0x1f, 0x48, 0x90, 0x00, 0x1c, 0x2f, 0x06, 0xde, 0xf0, 0x00, 0x1b, 0x24, 0x00,
+        0x3f, 0x50, 0x01, 0x1f, 0x3e, 0xb0, 0x01, 0x14, 0x20, 0x3f, 0xde, 0x2f, 0x00, 0x10, 0xdc,
+        0x2f, 0x00, 0x0f, 0x10, 0x02, 0x14, 0x51, 0x47, 0x72, 0x72, 0x46, 0x05, 0x0b, 0x00, 0x0f,
+        0x30, 0x00, 0x12, 0x07, 0x01, 0x00, 0x0f, 0x30, 0x00, 0x9f, 0x40, 0x21, 0xd0, 0xef, 0x63,
+        0x0e, 0x00, 0x4f, 0x63, 0xef, 0xcf, 0x20, 0x30, 0x00, 0x11, 0x40, 0x8d, 0xff, 0xff, 0xee,
+        0x0e, 0x00, 0x4f, 0xee, 0xff, 0xff, 0x8c, 0x30, 0x00, 0x11, 0x40, 0x6f, 0xff, 0xff, 0xd0,
+        0x0e, 0x00, 0x4f, 0xd0, 0xff, 0xff, 0x6d, 0x30, 0x00, 0x11, 0x40, 0x04, 0x6e, 0x8c, 0x20,
+        0x0e, 0x00, 0x4f, 0x20, 0x8c, 0x6d, 0x04, 0x20, 0x01, 0xff, 0xff, 0x7d, 0x0f, 0x90, 0x06,
+        0x1d, 0x2f, 0x00, 0xeb, 0xf0, 0x06, 0x1b, 0x00, 0xeb, 0x00, 0x0e, 0x01, 0x00, 0x1f, 0x6d,
+        0x30, 0x00, 0x07, 0x3c, 0x01, 0x6e, 0xeb, 0x2e, 0x00, 0x2f, 0xea, 0x6e, 0xb0, 0x07, 0x08,
+        0x0f, 0x10, 0x08, 0x1d, 0x0f, 0x01, 0x00, 0x3b, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
 
 };
 
@@ -86,11 +51,11 @@ const lv_image_dsc_t icon_remote_gen = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 48,
                  .h = 48,
-                 .stride = 96,
+                 .stride = 48,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_remote_gen_map),
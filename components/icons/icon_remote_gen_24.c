@@ -20,34 +20,17 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_REMOTE_GEN_24 uint8_t
     icon_remote_gen_24_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0x8b, 0x01, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0x2a, 0x2c, 0x04, 0x21, 0x02, 0x00, 0x2f, 0xe3, 0x18, 0x51, 0x00, 0x07, 0x4f, 0x04,
-        0x21, 0xe3, 0x18, 0x02, 0x00, 0x01, 0x0f, 0x32, 0x00, 0x05, 0x0f, 0x1c, 0x00, 0x01, 0x0f,
-        0x14, 0x00, 0x01, 0x04, 0x02, 0x00, 0x04, 0x1c, 0x00, 0x04, 0x64, 0x00, 0x00, 0xdc, 0x00,
-        0x04, 0x14, 0x00, 0x0f, 0x02, 0x00, 0x01, 0x02, 0x1c, 0x00, 0x04, 0x2e, 0x00, 0x06, 0x0e,
-        0x00, 0x0f, 0x2c, 0x00, 0x01, 0x06, 0x4c, 0x00, 0x62, 0xe3, 0x18, 0xe3, 0x18, 0x04, 0x21,
-        0xcc, 0x00, 0x02, 0x0e, 0x00, 0x02, 0x1e, 0x00, 0x0e, 0x02, 0x00, 0x06, 0x52, 0x00, 0x0f,
-        0x30, 0x00, 0x1d, 0x02, 0x02, 0x00, 0x24, 0x04, 0x21, 0x44, 0x00, 0x0f, 0x02, 0x00, 0x03,
-        0x02, 0x60, 0x00, 0x04, 0x58, 0x01, 0x26, 0x04, 0x21, 0xa4, 0x00, 0x0f, 0x02, 0x00, 0x03,
-        0x04, 0x30, 0x00, 0x08, 0x02, 0x00, 0x0f, 0x14, 0x00, 0x01, 0x04, 0x02, 0x00, 0x0f, 0x1c,
-        0x00, 0x01, 0x0f, 0x14, 0x00, 0x01, 0x04, 0x02, 0x00, 0x02, 0x1c, 0x00, 0x0a, 0x8a, 0x00,
-        0x02, 0x14, 0x00, 0x0f, 0x02, 0x00, 0x03, 0x02, 0x1c, 0x00, 0x02, 0x06, 0x00, 0x04, 0x08,
-        0x00, 0x04, 0x0e, 0x00, 0x0f, 0x02, 0x00, 0x01, 0x0f, 0x1c, 0x00, 0x01, 0x0f, 0x14, 0x00,
-        0x01, 0x04, 0x02, 0x00, 0x02, 0x1c, 0x00, 0x0f, 0x90, 0x00, 0xff, 0x0c, 0x0f, 0x02, 0x00,
-        0x01, 0x04, 0x40, 0x01, 0x0e, 0x02, 0x00, 0x02, 0xca, 0x02, 0x08, 0x02, 0x00, 0x0f, 0x2e,
-        0x00, 0x09, 0x0f, 0x02, 0x00, 0x11, 0x1f, 0x00, 0x01, 0x00, 0x0b, 0x23, 0x57, 0x88, 0x01,
-        0x00, 0x19, 0x56, 0x28, 0x00, 0x41, 0x57, 0xff, 0xf1, 0xee, 0x01, 0x00, 0x29, 0xf1, 0xff,
-        0x19, 0x00, 0x24, 0x8d, 0xf3, 0x27, 0x00, 0x24, 0xf3, 0x8d, 0x0a, 0x00, 0xf2, 0x01, 0x00,
-        0x00, 0x00, 0x00, 0x8e, 0xf0, 0x00, 0x00, 0x41, 0xa8, 0xa8, 0x41, 0x00, 0x00, 0xf0, 0x8e,
-        0x12, 0x00, 0x02, 0x02, 0x00, 0x9e, 0x8e, 0xf0, 0x00, 0x41, 0xfd, 0xe0, 0xe0, 0xfd, 0x41,
-        0x18, 0x00, 0x6f, 0xa7, 0xe1, 0x08, 0x08, 0xe1, 0xa7, 0x18, 0x00, 0x04, 0x1e, 0xa6, 0x18,
-        0x00, 0x6e, 0x41, 0xfd, 0xe1, 0xe1, 0xfd, 0x40, 0x18, 0x00, 0x5f, 0x00, 0x40, 0xa7, 0xa7,
-        0x40, 0x78, 0x00, 0x00, 0x02, 0x81, 0x00, 0x0f, 0x30, 0x00, 0x00, 0x02, 0x02, 0x00, 0x0d,
-        0xa8, 0x00, 0x6e, 0x92, 0xc2, 0x00, 0x00, 0xc3, 0x92, 0x30, 0x00, 0x6e, 0x6c, 0x93, 0x00,
-        0x00, 0x93, 0x6c, 0x18, 0x00, 0x02, 0x47, 0x00, 0x0e, 0x18, 0x00, 0x0f, 0x48, 0x00, 0x62,
-        0x0f, 0x98, 0x01, 0x05, 0x16, 0x56, 0xc8, 0x01, 0x13, 0x55, 0xb1, 0x00, 0x02, 0x02, 0x00,
-        0x13, 0x56, 0xf7, 0x01, 0x1a, 0x88, 0x17, 0x00, 0x09, 0x02, 0x00, 0x50, 0x00, 0x00, 0x00,
-        0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0x0b, 0x23, 0x57, 0x88, 0x01, 0x00, 0x1a, 0x56, 0x17, 0x00, 0x31, 0xff, 0xf1, 0xee,
+        0x01, 0x00, 0x29, 0xf1, 0xff, 0x19, 0x00, 0x24, 0x8d, 0xf3, 0x0a, 0x00, 0x28, 0xf3, 0x8d,
+        0x18, 0x00, 0xcb, 0x8e, 0xf0, 0x00, 0x00, 0x41, 0xa8, 0xa8, 0x41, 0x00, 0x00, 0xf0, 0x8e,
+        0x18, 0x00, 0x6e, 0x41, 0xfd, 0xe0, 0xe0, 0xfd, 0x41, 0x18, 0x00, 0x6f, 0xa7, 0xe1, 0x08,
+        0x08, 0xe1, 0xa7, 0x18, 0x00, 0x04, 0x1f, 0xa6, 0x48, 0x00, 0x01, 0x4e, 0xe1, 0xe1, 0xfd,
+        0x40, 0x18, 0x00, 0x5f, 0x00, 0x40, 0xa7, 0xa7, 0x40, 0x78, 0x00, 0x00, 0x03, 0x01, 0x00,
+        0x0f, 0x18, 0x00, 0x16, 0x6e, 0x92, 0xc2, 0x00, 0x00, 0xc3, 0x92, 0x18, 0x00, 0x6f, 0x6c,
+        0x93, 0x00, 0x00, 0x93, 0x6c, 0x48, 0x00, 0x8c, 0x0f, 0x98, 0x01, 0x05, 0x16, 0x56, 0xc8,
+        0x01, 0x18, 0x55, 0x18, 0x00, 0x24, 0x00, 0x56, 0xf8, 0x01, 0x0a, 0x17, 0x00, 0x09, 0x01,
+        0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
 
 };
 
@@ -55,11 +38,11 @@ const lv_image_dsc_t icon_remote_gen_24 = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 24,
                  .h = 24,
-                 .stride = 48,
+                 .stride = 24,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_remote_gen_24_map),
@@ -20,34 +20,23 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_RESTART_ALT_24
     uint8_t icon_restart_alt_24_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0x94, 0x01, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0x92, 0x4f, 0x00, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x17, 0x11, 0x00, 0x01, 0x00, 0x0f,
-        0x30, 0x00, 0x15, 0x01, 0x2d, 0x00, 0x03, 0x02, 0x00, 0x0f, 0x34, 0x00, 0x0f, 0x03, 0x29,
-        0x00, 0x07, 0x02, 0x00, 0x0f, 0x34, 0x00, 0x07, 0x02, 0xb6, 0x00, 0x07, 0x2b, 0x00, 0x03,
-        0x02, 0x00, 0x0f, 0x32, 0x00, 0x03, 0x02, 0x1d, 0x00, 0x00, 0x90, 0x01, 0x0c, 0x0a, 0x00,
-        0x02, 0x16, 0x00, 0x0c, 0x02, 0x00, 0x06, 0x26, 0x00, 0x02, 0x0c, 0x00, 0x02, 0x20, 0x00,
-        0x08, 0x16, 0x00, 0x08, 0x02, 0x00, 0x0f, 0x18, 0x00, 0x05, 0x0f, 0x1a, 0x00, 0x05, 0x0f,
-        0x30, 0x00, 0xdd, 0x0f, 0xf2, 0x00, 0x05, 0x0f, 0x08, 0x01, 0x0d, 0x04, 0x78, 0x01, 0x02,
-        0x02, 0x00, 0x02, 0x2e, 0x00, 0x0a, 0x14, 0x00, 0x06, 0x02, 0x00, 0x04, 0x1e, 0x00, 0x02,
-        0x20, 0x00, 0x0a, 0x0e, 0x00, 0x0f, 0x02, 0x00, 0x03, 0x04, 0x24, 0x00, 0x06, 0xa0, 0x00,
-        0x02, 0x0c, 0x00, 0x0f, 0x02, 0x00, 0x09, 0x04, 0x24, 0x00, 0x04, 0x08, 0x00, 0x0f, 0x02,
-        0x00, 0x8b, 0x04, 0xe2, 0x00, 0x0f, 0x02, 0x00, 0x38, 0x2f, 0x75, 0x5b, 0x4d, 0x00, 0x02,
-        0x3f, 0x76, 0xff, 0x9f, 0x18, 0x00, 0x01, 0x6d, 0x76, 0xff, 0xec, 0x75, 0x58, 0x15, 0x1a,
-        0x00, 0x20, 0x0b, 0xda, 0x1a, 0x05, 0x39, 0xfd, 0xa2, 0x19, 0x1a, 0x00, 0xc7, 0x1e, 0x03,
-        0x00, 0x1b, 0xda, 0xef, 0x3f, 0x33, 0x8c, 0xf6, 0xe5, 0x30, 0x19, 0x00, 0xd7, 0x13, 0xde,
-        0x94, 0x00, 0x00, 0x1b, 0xda, 0xb9, 0x00, 0x00, 0x2d, 0xe2, 0xe5, 0x32, 0x00, 0xe5, 0x94,
-        0xf8, 0x30, 0x00, 0x00, 0x00, 0x1a, 0x0f, 0x00, 0x00, 0x00, 0x2d, 0xf6, 0xa1, 0x31, 0x00,
-        0x35, 0x0f, 0xf8, 0x90, 0x0c, 0x00, 0x44, 0x00, 0x8d, 0xfc, 0x14, 0x0d, 0x00, 0x34, 0x53,
-        0xff, 0x35, 0x0b, 0x00, 0x54, 0x00, 0x00, 0x34, 0xff, 0x56, 0x0d, 0x00, 0x34, 0x74, 0xff,
-        0x0c, 0x0b, 0x00, 0x54, 0x00, 0x00, 0x0b, 0xff, 0x74, 0x0d, 0x00, 0x34, 0x76, 0xff, 0x0a,
-        0x0b, 0x00, 0x36, 0x00, 0x00, 0x0c, 0x18, 0x00, 0x36, 0x57, 0xff, 0x34, 0x18, 0x00, 0x34,
-        0x36, 0xff, 0x55, 0x0d, 0x00, 0x34, 0x16, 0xfb, 0x8e, 0x0b, 0x00, 0x45, 0x00, 0x00, 0x92,
-        0xfa, 0x78, 0x00, 0x44, 0x00, 0xa1, 0xf7, 0x2c, 0x19, 0x00, 0x34, 0x32, 0xf9, 0x9c, 0x0b,
-        0x00, 0x62, 0x00, 0x00, 0x16, 0xe6, 0xe2, 0x2a, 0x0e, 0x00, 0x42, 0x33, 0xe8, 0xe3, 0x13,
-        0x0a, 0x00, 0x01, 0x02, 0x00, 0xc1, 0x2d, 0xe7, 0xf6, 0x8b, 0x33, 0x00, 0x00, 0x32, 0x92,
-        0xf9, 0xe3, 0x28, 0x11, 0x00, 0x04, 0x02, 0x00, 0x98, 0x17, 0xa2, 0xf9, 0xff, 0x00, 0x00,
-        0xff, 0xf8, 0x9b, 0x2e, 0x00, 0x01, 0x02, 0x00, 0x56, 0x15, 0x51, 0x00, 0x00, 0x54, 0x73,
-        0x00, 0x0f, 0x02, 0x00, 0x30, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0x3f, 0x2f, 0x75, 0x5b, 0x17, 0x00, 0x02, 0x3f, 0x76, 0xff, 0x9f, 0x17, 0x00, 0x03,
+        0x4d, 0xec, 0x75, 0x58, 0x15, 0x17, 0x00, 0x99, 0x0b, 0xda, 0xff, 0xff, 0xff, 0xff, 0xfd,
+        0xa2, 0x19, 0x16, 0x00, 0xc7, 0x1e, 0x03, 0x00, 0x1b, 0xda, 0xef, 0x3f, 0x33, 0x8c, 0xf6,
+        0xe5, 0x30, 0x17, 0x00, 0xd7, 0x13, 0xde, 0x94, 0x00, 0x00, 0x1b, 0xda, 0xb9, 0x00, 0x00,
+        0x2d, 0xe2, 0xe5, 0x32, 0x00, 0x20, 0x94, 0xf8, 0x26, 0x00, 0x85, 0x1a, 0x0f, 0x00, 0x00,
+        0x00, 0x2d, 0xf6, 0xa1, 0x17, 0x00, 0x36, 0x0f, 0xf8, 0x90, 0x24, 0x00, 0x34, 0x8d, 0xfc,
+        0x14, 0x0b, 0x00, 0x36, 0x53, 0xff, 0x35, 0x18, 0x00, 0x34, 0x34, 0xff, 0x56, 0x0b, 0x00,
+        0x36, 0x74, 0xff, 0x0c, 0x18, 0x00, 0x34, 0x0b, 0xff, 0x74, 0x0b, 0x00, 0x36, 0x76, 0xff,
+        0x0a, 0x18, 0x00, 0x16, 0x0c, 0x18, 0x00, 0x36, 0x57, 0xff, 0x34, 0x18, 0x00, 0x34, 0x36,
+        0xff, 0x55, 0x0b, 0x00, 0x36, 0x16, 0xfb, 0x8e, 0x18, 0x00, 0x25, 0x92, 0xfa, 0x78, 0x00,
+        0x44, 0x00, 0xa1, 0xf7, 0x2c, 0x0b, 0x00, 0x36, 0x32, 0xf9, 0x9c, 0x24, 0x00, 0x42, 0x16,
+        0xe6, 0xe2, 0x2a, 0x0a, 0x00, 0x46, 0x33, 0xe8, 0xe3, 0x13, 0x18, 0x00, 0xd7, 0x00, 0x2d,
+        0xe7, 0xf6, 0x8b, 0x33, 0x00, 0x00, 0x32, 0x92, 0xf9, 0xe3, 0x28, 0x17, 0x00, 0xb8, 0x00,
+        0x00, 0x17, 0xa2, 0xf9, 0xff, 0x00, 0x00, 0xff, 0xf8, 0x9b, 0x2e, 0x00, 0x01, 0x01, 0x00,
+        0x56, 0x15, 0x51, 0x00, 0x00, 0x54, 0x73, 0x00, 0x0f, 0x01, 0x00, 0x30, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x00,
 
 };
 
@@ -55,11 +44,11 @@ const lv_image_dsc_t icon_restart_alt_24 = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 24,
                  .h = 24,
-                 .stride = 48,
+                 .stride = 24,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_restart_alt_24_map),
@@ -20,32 +20,19 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_SAVE_24 uint8_t
     icon_save_24_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0x75, 0x01, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0x84, 0x1f, 0x00, 0x01, 0x00, 0x08, 0x0e, 0xb3, 0x00, 0x0f, 0x2d, 0x00, 0x08, 0x01,
-        0x02, 0x00, 0x0c, 0x32, 0x00, 0x01, 0x15, 0x00, 0x0d, 0x16, 0x00, 0x00, 0x0c, 0x01, 0x02,
-        0x1a, 0x00, 0x0c, 0x32, 0x00, 0x02, 0x12, 0x00, 0x04, 0x1c, 0x00, 0x06, 0x02, 0x00, 0x0f,
-        0x32, 0x00, 0x05, 0x0f, 0x30, 0x00, 0x09, 0x02, 0x1e, 0x00, 0x02, 0x3c, 0x00, 0x04, 0x02,
-        0x00, 0x02, 0x10, 0x00, 0x06, 0x58, 0x00, 0x04, 0x02, 0x00, 0x0a, 0x20, 0x00, 0x06, 0x02,
-        0x00, 0x0f, 0x30, 0x00, 0x23, 0x0f, 0x02, 0x00, 0x07, 0x02, 0x50, 0x00, 0x06, 0x02, 0x00,
-        0x0c, 0x10, 0x00, 0x0c, 0x02, 0x00, 0x0c, 0x20, 0x00, 0x0a, 0x10, 0x00, 0x0c, 0xbe, 0x00,
-        0x02, 0x12, 0x00, 0x08, 0x44, 0x00, 0x08, 0x30, 0x00, 0x04, 0x2e, 0x00, 0x0c, 0x14, 0x00,
-        0x0f, 0x30, 0x00, 0x95, 0x06, 0xc2, 0x00, 0x06, 0xb2, 0x00, 0x08, 0xcc, 0x00, 0x06, 0x22,
-        0x00, 0x02, 0x0c, 0x00, 0x0e, 0x02, 0x00, 0x0a, 0xfc, 0x00, 0x06, 0x30, 0x00, 0x0f, 0x02,
-        0x00, 0x0b, 0x02, 0x2a, 0x00, 0x04, 0x02, 0x00, 0x0f, 0x2c, 0x00, 0x0b, 0x0c, 0x2e, 0x00,
-        0x0f, 0x02, 0x00, 0x77, 0x0f, 0xb8, 0x00, 0x0d, 0x0f, 0x02, 0x00, 0x19, 0x26, 0x43, 0x77,
-        0x01, 0x00, 0x25, 0x73, 0x0a, 0x3a, 0x00, 0x19, 0x43, 0xee, 0x00, 0x15, 0xbf, 0x19, 0x00,
-        0x35, 0x7d, 0xff, 0x07, 0x24, 0x00, 0x35, 0x00, 0x5c, 0xfc, 0x19, 0x00, 0x52, 0x80, 0xff,
-        0x00, 0x5e, 0x99, 0x01, 0x00, 0x18, 0x5b, 0x19, 0x00, 0x43, 0x80, 0xff, 0x00, 0x9d, 0x4b,
-        0x00, 0x72, 0x98, 0x00, 0x00, 0x00, 0x5c, 0xff, 0x7a, 0x3f, 0x00, 0x0b, 0x18, 0x00, 0x35,
-        0x00, 0xff, 0x80, 0x18, 0x00, 0x22, 0x88, 0xdd, 0x01, 0x00, 0x11, 0x84, 0x83, 0x01, 0x06,
-        0x18, 0x00, 0x02, 0x21, 0x00, 0x03, 0x02, 0x00, 0x07, 0x30, 0x00, 0x03, 0x12, 0x00, 0x02,
-        0x02, 0x00, 0x0b, 0x18, 0x00, 0x41, 0x34, 0xa3, 0xa2, 0x33, 0x19, 0x00, 0x0a, 0x18, 0x00,
-        0x6e, 0x24, 0xf5, 0xff, 0xff, 0xf5, 0x23, 0x60, 0x00, 0x10, 0x70, 0xda, 0x05, 0x1e, 0x70,
-        0x18, 0x00, 0x10, 0x58, 0xf2, 0x05, 0x1e, 0x57, 0x18, 0x00, 0x6e, 0x03, 0xb2, 0xff, 0xff,
-        0xb2, 0x03, 0x18, 0x00, 0x59, 0x00, 0x01, 0x2d, 0x2c, 0x01, 0x78, 0x00, 0x09, 0x38, 0x01,
-        0x51, 0x00, 0x00, 0x07, 0xff, 0x7d, 0x1f, 0x00, 0x0b, 0x68, 0x01, 0x42, 0xff, 0xff, 0xff,
-        0x42, 0x18, 0x00, 0x47, 0x00, 0x42, 0x83, 0x88, 0x01, 0x00, 0x23, 0x83, 0x41, 0x17, 0x00,
-        0x0f, 0x02, 0x00, 0x2d, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0xb1, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0x38, 0x26, 0x43, 0x77, 0x01, 0x00, 0x26, 0x73, 0x0a, 0x17, 0x00, 0x18, 0xff, 0x01,
+        0x00, 0x15, 0xbf, 0x19, 0x00, 0x36, 0x7d, 0xff, 0x07, 0x3c, 0x00, 0x25, 0x5c, 0xfc, 0x19,
+        0x00, 0x52, 0x80, 0xff, 0x00, 0x5e, 0x99, 0x01, 0x00, 0x18, 0x5b, 0x19, 0x00, 0x43, 0x80,
+        0xff, 0x00, 0x9d, 0x45, 0x00, 0x10, 0x98, 0x32, 0x00, 0x2f, 0xff, 0x7a, 0x18, 0x00, 0x02,
+        0x35, 0x00, 0xff, 0x80, 0x18, 0x00, 0x22, 0x88, 0xdd, 0x01, 0x00, 0x1b, 0x84, 0x18, 0x00,
+        0x09, 0x01, 0x00, 0x0f, 0x18, 0x00, 0x14, 0x4f, 0x34, 0xa3, 0xa2, 0x33, 0x18, 0x00, 0x00,
+        0x6e, 0x24, 0xf5, 0xff, 0xff, 0xf5, 0x23, 0x18, 0x00, 0x10, 0x70, 0x90, 0x00, 0x1e, 0x70,
+        0x18, 0x00, 0x10, 0x58, 0x18, 0x00, 0x1e, 0x57, 0x18, 0x00, 0x6f, 0x03, 0xb2, 0xff, 0xff,
+        0xb2, 0x03, 0x78, 0x00, 0x00, 0x49, 0x01, 0x2d, 0x2c, 0x01, 0x78, 0x00, 0x09, 0x38, 0x01,
+        0x52, 0x00, 0x00, 0x07, 0xff, 0x7d, 0x09, 0x00, 0x0a, 0x68, 0x01, 0x43, 0xff, 0xff, 0xff,
+        0x42, 0x22, 0x00, 0x37, 0x42, 0x83, 0x88, 0x01, 0x00, 0x28, 0x83, 0x41, 0x3e, 0x00, 0x0f,
+        0x01, 0x00, 0x28, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
 
 };
 
@@ -53,11 +40,11 @@ const lv_image_dsc_t icon_save_24 = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 24,
                  .h = 24,
-                 .stride = 48,
+                 .stride = 24,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_save_24_map),
@@ -20,119 +20,64 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_SETTINGS uint8_t
     icon_settings_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0x92, 0x06, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0xff, 0xf3, 0x2e, 0xe3, 0x18, 0x02, 0x00, 0x0f, 0x19, 0x02, 0x39, 0x0e, 0x5e, 0x00,
-        0x0f, 0x60, 0x00, 0x99, 0x22, 0x04, 0x21, 0xc0, 0x00, 0x22, 0x00, 0x00, 0x14, 0x01, 0x02,
-        0x0e, 0x00, 0x22, 0x24, 0x21, 0x0e, 0x00, 0x0f, 0x02, 0x00, 0x2f, 0x02, 0x50, 0x00, 0x06,
-        0x12, 0x01, 0x04, 0x70, 0x00, 0x0f, 0x5a, 0x00, 0x23, 0x08, 0x4a, 0x00, 0x02, 0x02, 0x00,
-        0x0c, 0x60, 0x00, 0x0c, 0x10, 0x00, 0x02, 0x02, 0x00, 0x2f, 0x04, 0x21, 0x72, 0x00, 0x13,
-        0x04, 0x3e, 0x00, 0x20, 0x86, 0x31, 0x3c, 0x04, 0x24, 0x00, 0x00, 0x10, 0x00, 0x06, 0x3e,
-        0x00, 0x06, 0x12, 0x00, 0x02, 0x32, 0x01, 0x2f, 0x45, 0x29, 0xd2, 0x00, 0x17, 0x04, 0x2a,
-        0x00, 0x02, 0x02, 0x00, 0x08, 0x0e, 0x00, 0x15, 0x04, 0x70, 0x01, 0x08, 0x16, 0x00, 0x0a,
-        0x02, 0x00, 0x06, 0x24, 0x00, 0x0f, 0x02, 0x00, 0x03, 0x13, 0x24, 0xca, 0x01, 0x0f, 0x02,
-        0x00, 0x01, 0x06, 0x3c, 0x00, 0x0f, 0x1e, 0x00, 0x01, 0x04, 0x02, 0x00, 0x0f, 0xf6, 0x01,
-        0x0b, 0x0f, 0x9a, 0x00, 0x05, 0x0e, 0x36, 0x00, 0x2f, 0x24, 0x21, 0x2c, 0x00, 0x03, 0x06,
-        0x86, 0x00, 0x0e, 0x02, 0x00, 0x04, 0x84, 0x00, 0x28, 0x04, 0x21, 0x78, 0x01, 0x0f, 0x32,
-        0x00, 0x07, 0x06, 0x30, 0x00, 0x28, 0x00, 0x00, 0x9c, 0x00, 0x0e, 0x5a, 0x00, 0x02, 0x02,
-        0x00, 0x04, 0x92, 0x00, 0x02, 0xb6, 0x01, 0x00, 0x1a, 0x06, 0x0f, 0x2e, 0x00, 0x09, 0x02,
-        0x20, 0x00, 0x06, 0x7e, 0x00, 0x04, 0x0a, 0x02, 0x06, 0x12, 0x00, 0x0a, 0x02, 0x00, 0x04,
-        0x5e, 0x00, 0x0f, 0x52, 0x00, 0x0b, 0x0f, 0x02, 0x00, 0x09, 0x06, 0xd0, 0x00, 0x0f, 0x26,
-        0x00, 0x01, 0x04, 0x1e, 0x00, 0x0f, 0x62, 0x00, 0x03, 0x02, 0x18, 0x00, 0x04, 0x02, 0x00,
-        0x2e, 0xc3, 0x18, 0x42, 0x00, 0x06, 0xa0, 0x00, 0x0f, 0xa2, 0x00, 0x03, 0x04, 0xe0, 0x00,
-        0x06, 0x52, 0x01, 0x06, 0x02, 0x00, 0x1d, 0xc3, 0x40, 0x05, 0x0a, 0xa4, 0x00, 0x08, 0x3c,
-        0x00, 0x08, 0x60, 0x01, 0x0c, 0x02, 0x00, 0x08, 0x84, 0x00, 0x06, 0xa4, 0x00, 0x08, 0x16,
-        0x00, 0x06, 0x02, 0x00, 0x0f, 0x20, 0x00, 0x03, 0x0a, 0x78, 0x00, 0x0e, 0x02, 0x00, 0x06,
-        0x4c, 0x00, 0x06, 0x2a, 0x00, 0x06, 0x54, 0x00, 0x08, 0x02, 0x00, 0x0f, 0x20, 0x00, 0x01,
-        0x06, 0x14, 0x00, 0x0f, 0x02, 0x00, 0x07, 0x04, 0xec, 0x00, 0x06, 0xa0, 0x00, 0x08, 0x56,
-        0x00, 0x08, 0x02, 0x00, 0x04, 0x44, 0x00, 0x04, 0x94, 0x00, 0x06, 0x78, 0x02, 0x0f, 0x02,
-        0x00, 0x09, 0x22, 0x86, 0x31, 0x44, 0x00, 0x06, 0x8c, 0x00, 0x02, 0x10, 0x00, 0x0e, 0x02,
-        0x00, 0x04, 0x50, 0x00, 0x04, 0x9e, 0x01, 0x0f, 0x56, 0x00, 0x09, 0x06, 0x02, 0x00, 0x22,
-        0x45, 0x29, 0x4a, 0x00, 0x0f, 0x60, 0x00, 0x45, 0x04, 0x20, 0x01, 0x0f, 0x60, 0x00, 0x0f,
-        0x04, 0x94, 0x00, 0x0f, 0x20, 0x01, 0x19, 0x04, 0x2c, 0x00, 0x0f, 0x60, 0x00, 0x19, 0x02,
-        0xf0, 0x00, 0x0a, 0x34, 0x00, 0x0f, 0x02, 0x00, 0x03, 0x08, 0x5e, 0x00, 0x06, 0xd4, 0x04,
-        0x0f, 0x56, 0x05, 0x03, 0x06, 0x00, 0x02, 0x06, 0x36, 0x00, 0x0f, 0x50, 0x04, 0x09, 0x04,
-        0x18, 0x01, 0x02, 0x02, 0x00, 0x04, 0xbc, 0x01, 0x02, 0x02, 0x00, 0x04, 0xc2, 0x01, 0x06,
-        0x02, 0x00, 0x06, 0x3e, 0x01, 0x08, 0x14, 0x02, 0x02, 0x02, 0x00, 0x02, 0x14, 0x00, 0x0c,
-        0x02, 0x00, 0x02, 0x1c, 0x00, 0x02, 0x02, 0x00, 0x0c, 0x1c, 0x00, 0x59, 0xff, 0xff, 0x04,
-        0x21, 0x04, 0x92, 0x05, 0x0e, 0x22, 0x00, 0x02, 0x3a, 0x00, 0x02, 0x02, 0x00, 0x0e, 0x1e,
-        0x00, 0x08, 0xe6, 0x00, 0x0f, 0x1e, 0x00, 0x01, 0x0f, 0x02, 0x00, 0x11, 0x02, 0x5c, 0x00,
-        0x0f, 0x24, 0x01, 0x07, 0x02, 0x1c, 0x00, 0x08, 0x1c, 0x01, 0x08, 0x66, 0x01, 0x0f, 0x02,
-        0x00, 0x01, 0x08, 0xd4, 0x07, 0x0e, 0x38, 0x03, 0x0c, 0x02, 0x00, 0x04, 0x60, 0x00, 0x0f,
-        0x60, 0x06, 0x1d, 0x02, 0x92, 0x00, 0x06, 0xe6, 0x01, 0x0c, 0x58, 0x00, 0x06, 0x02, 0x00,
-        0x04, 0x62, 0x00, 0x0a, 0x02, 0x00, 0x08, 0x4c, 0x02, 0x04, 0x02, 0x00, 0x0c, 0xf2, 0x01,
-        0x0f, 0x5e, 0x00, 0x11, 0x08, 0x84, 0x00, 0x0f, 0x02, 0x00, 0x01, 0x04, 0x5c, 0x00, 0x06,
-        0x4c, 0x00, 0x0e, 0x02, 0x00, 0x0a, 0x78, 0x02, 0x0e, 0x02, 0x00, 0x0e, 0x32, 0x00, 0x06,
-        0x02, 0x00, 0x04, 0x2e, 0x00, 0x06, 0x12, 0x00, 0x02, 0x54, 0x03, 0x02, 0x08, 0x00, 0x02,
-        0x02, 0x00, 0x04, 0x24, 0x00, 0x0f, 0x02, 0x00, 0x07, 0x04, 0x34, 0x00, 0x02, 0x60, 0x03,
-        0x04, 0xb6, 0x01, 0x08, 0x16, 0x02, 0x06, 0x52, 0x00, 0x02, 0xae, 0x00, 0x02, 0x1e, 0x00,
-        0x08, 0x22, 0x00, 0x0f, 0x02, 0x00, 0x09, 0x2a, 0x04, 0x21, 0x3c, 0x03, 0x04, 0x40, 0x00,
-        0x06, 0x16, 0x00, 0x02, 0x4c, 0x00, 0x0c, 0xac, 0x00, 0x08, 0x22, 0x00, 0x0f, 0x02, 0x00,
-        0x1b, 0x04, 0xb0, 0x00, 0x04, 0x36, 0x00, 0x0f, 0x60, 0x00, 0x03, 0x0f, 0x02, 0x00, 0x27,
-        0x04, 0x80, 0x04, 0x02, 0x42, 0x00, 0x04, 0x48, 0x04, 0x02, 0x40, 0x01, 0x0f, 0x02, 0x00,
-        0x33, 0x04, 0xb2, 0x00, 0x08, 0x02, 0x00, 0x0f, 0x5a, 0x00, 0x33, 0x02, 0x02, 0x00, 0x08,
-        0x58, 0x00, 0x04, 0x02, 0x00, 0x02, 0x1a, 0x00, 0x0f, 0x02, 0x00, 0x33, 0x04, 0x54, 0x00,
-        0x08, 0x02, 0x00, 0x0f, 0x5a, 0x00, 0x33, 0x0f, 0x02, 0x00, 0xff, 0xae, 0x1f, 0x00, 0x01,
-        0x00, 0xef, 0x14, 0xae, 0xc4, 0x02, 0x1f, 0xad, 0x0c, 0x01, 0x13, 0x14, 0xcf, 0x30, 0x00,
-        0x1f, 0xcc, 0x30, 0x00, 0x13, 0x14, 0xef, 0x30, 0x00, 0x1f, 0xec, 0x30, 0x00, 0x12, 0xcf,
-        0x0f, 0xff, 0xff, 0xf6, 0x01, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x0d, 0x31, 0x00, 0x11,
-        0xcf, 0x31, 0xff, 0xff, 0xd7, 0x00, 0x00, 0x00, 0x00, 0xd2, 0xff, 0xff, 0x2d, 0x30, 0x00,
-        0x08, 0x14, 0x23, 0x1d, 0x00, 0xc3, 0x51, 0xff, 0xff, 0xb8, 0x00, 0x00, 0x00, 0x00, 0xb3,
-        0xff, 0xff, 0x4d, 0x30, 0x00, 0x23, 0x2e, 0x23, 0x09, 0x00, 0x07, 0x02, 0x00, 0xf7, 0x0f,
-        0xbb, 0xff, 0xc1, 0x56, 0x05, 0x00, 0x00, 0x04, 0x62, 0xda, 0xff, 0xff, 0x98, 0x00, 0x00,
-        0x00, 0x00, 0x95, 0xff, 0xff, 0xd6, 0x5c, 0x03, 0x00, 0x00, 0x06, 0x59, 0xc3, 0xff, 0xbb,
-        0x29, 0x00, 0x02, 0x02, 0x00, 0x10, 0x50, 0x49, 0x14, 0x40, 0xe5, 0x7e, 0x3e, 0xcb, 0x51,
-        0x14, 0xe0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x78, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x3c, 0x85,
-        0xe9, 0x63, 0x14, 0x12, 0x50, 0x26, 0x00, 0x05, 0x02, 0x00, 0x24, 0x07, 0xdc, 0x15, 0x01,
-        0xc6, 0xff, 0xff, 0xee, 0x9a, 0x27, 0x00, 0x00, 0x00, 0x00, 0x29, 0xa3, 0xf4, 0x14, 0x00,
-        0x25, 0xdc, 0x07, 0x2b, 0x00, 0x01, 0x02, 0x00, 0x60, 0x79, 0xff, 0xff, 0xeb, 0x7a, 0xde,
-        0xad, 0x14, 0x25, 0xf8, 0x7e, 0x16, 0x01, 0x30, 0x15, 0x90, 0xfd, 0xbf, 0x14, 0x61, 0xe0,
-        0x7b, 0xeb, 0xff, 0xff, 0x79, 0x27, 0x00, 0x04, 0x02, 0x00, 0xc4, 0x1a, 0xf3, 0xff, 0xff,
-        0x68, 0x00, 0x02, 0x4c, 0xb6, 0xfd, 0xe1, 0x2e, 0x14, 0x00, 0xf2, 0x01, 0x00, 0x00, 0x00,
-        0x00, 0x3d, 0xeb, 0xfe, 0xbb, 0x50, 0x03, 0x00, 0x68, 0xff, 0xff, 0xf3, 0x1a, 0x12, 0x00,
-        0x02, 0x02, 0x00, 0xb2, 0xa1, 0xff, 0xff, 0xd0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x23, 0x19,
-        0x11, 0x00, 0x04, 0x02, 0x00, 0xb4, 0x25, 0x28, 0x00, 0x00, 0x00, 0x00, 0x03, 0xd0, 0xff,
-        0xff, 0xa1, 0x13, 0x00, 0x81, 0x00, 0x00, 0x00, 0x38, 0xfe, 0xff, 0xff, 0x55, 0x0a, 0x00,
-        0x0f, 0x02, 0x00, 0x04, 0x56, 0x55, 0xff, 0xff, 0xfe, 0x38, 0x1c, 0x00, 0x65, 0x8e, 0xff,
-        0xff, 0xff, 0xeb, 0x49, 0x10, 0x00, 0x85, 0x09, 0x72, 0xcc, 0xf4, 0xf5, 0xce, 0x75, 0x0a,
-        0x11, 0x00, 0x65, 0x46, 0xea, 0xff, 0xff, 0xff, 0x8e, 0x0f, 0x00, 0x92, 0x00, 0x01, 0x7a,
-        0xfb, 0xff, 0xff, 0xfe, 0x89, 0x04, 0x12, 0x00, 0x22, 0x1c, 0xd1, 0x18, 0x01, 0x22, 0xd4,
-        0x1f, 0x10, 0x00, 0x82, 0x03, 0x82, 0xfd, 0xff, 0xff, 0xfb, 0x7a, 0x01, 0x0e, 0x00, 0x02,
-        0x02, 0x00, 0xd2, 0x3f, 0xe5, 0xff, 0xff, 0xff, 0xc5, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x08,
-        0xd0, 0x2f, 0x00, 0x31, 0xff, 0xff, 0xd5, 0x62, 0x00, 0x72, 0x18, 0xbe, 0xff, 0xff, 0xff,
-        0xe5, 0x3f, 0x28, 0x00, 0x05, 0x02, 0x00, 0x24, 0x16, 0xbb, 0x96, 0x01, 0x14, 0x6e, 0x2f,
-        0x00, 0x03, 0xb8, 0x01, 0x65, 0x65, 0xff, 0xff, 0xff, 0xbb, 0x16, 0x29, 0x00, 0x04, 0x02,
-        0x00, 0x41, 0x02, 0xf4, 0xff, 0xff, 0x60, 0x00, 0x16, 0xc7, 0x30, 0x00, 0xa4, 0xd1, 0x00,
-        0x00, 0x00, 0x00, 0x30, 0xff, 0xff, 0xe6, 0x02, 0x26, 0x00, 0x06, 0x02, 0x00, 0xa6, 0x05,
-        0xff, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0xee, 0x30, 0x00, 0x96, 0xf8, 0x01, 0x00,
-        0x00, 0x00, 0x1c, 0xff, 0xff, 0xf4, 0x27, 0x00, 0x05, 0x02, 0x00, 0x1f, 0x06, 0x30, 0x00,
-        0x08, 0x15, 0xf2, 0x26, 0x00, 0x06, 0x02, 0x00, 0xa6, 0x02, 0xf5, 0xff, 0xff, 0x1d, 0x00,
-        0x00, 0x00, 0x00, 0xc6, 0x60, 0x00, 0x13, 0xd0, 0x90, 0x00, 0x19, 0xdf, 0x1c, 0x01, 0x01,
-        0x02, 0x00, 0x0f, 0xf0, 0x00, 0x02, 0xb1, 0x77, 0x00, 0x00, 0x00, 0x00, 0x63, 0xff, 0xff,
-        0xff, 0xae, 0x10, 0x25, 0x00, 0x06, 0x02, 0x00, 0x01, 0x50, 0x01, 0x75, 0xba, 0x15, 0x00,
-        0x00, 0x00, 0x00, 0x07, 0xf0, 0x03, 0x11, 0xd4, 0x50, 0x01, 0x76, 0x1d, 0xc5, 0xff, 0xff,
-        0xff, 0xdd, 0x34, 0x2c, 0x00, 0x03, 0xb0, 0x01, 0x23, 0xfd, 0x7f, 0x06, 0x01, 0x04, 0xb0,
-        0x01, 0x13, 0xd3, 0xb0, 0x01, 0x77, 0x05, 0x8b, 0xfe, 0xff, 0xff, 0xf8, 0x6c, 0x31, 0x00,
-        0x65, 0x8e, 0xff, 0xff, 0xff, 0xe9, 0x45, 0x11, 0x00, 0x85, 0x08, 0x71, 0xca, 0xf4, 0xf4,
-        0xcb, 0x74, 0x09, 0x11, 0x00, 0x65, 0x4d, 0xed, 0xff, 0xff, 0xff, 0x7c, 0x0f, 0x00, 0x0f,
-        0x70, 0x02, 0x0f, 0x56, 0x5e, 0xff, 0xff, 0xfa, 0x2a, 0x30, 0x00, 0x24, 0x00, 0xa3, 0xd0,
-        0x02, 0x11, 0x2b, 0xb3, 0x01, 0x06, 0x02, 0x00, 0x11, 0x20, 0xea, 0x03, 0x56, 0x05, 0xd7,
-        0xff, 0xff, 0x91, 0x15, 0x00, 0xe8, 0x00, 0x00, 0x1b, 0xf4, 0xff, 0xff, 0x68, 0x00, 0x03,
-        0x51, 0xbd, 0xfe, 0xe2, 0x2f, 0x18, 0x00, 0xc8, 0x3a, 0xe8, 0xfd, 0xb6, 0x4a, 0x02, 0x00,
-        0x71, 0xff, 0xff, 0xec, 0x11, 0x18, 0x00, 0x70, 0x00, 0x7c, 0xff, 0xff, 0xeb, 0x7b, 0xe1,
-        0x3d, 0x18, 0x34, 0xf9, 0x80, 0x0e, 0x1a, 0x00, 0x30, 0x14, 0x8b, 0xfc, 0x4f, 0x18, 0x64,
-        0xdc, 0x79, 0xef, 0xff, 0xff, 0x6a, 0x15, 0x00, 0x02, 0x02, 0x00, 0x26, 0x08, 0xdf, 0xa6,
-        0x01, 0x97, 0xef, 0x9d, 0x25, 0x00, 0x00, 0x00, 0x00, 0x28, 0xa4, 0xf0, 0x03, 0x13, 0xd3,
-        0xec, 0x02, 0x05, 0x02, 0x00, 0x10, 0x54, 0x99, 0x18, 0x40, 0xea, 0x86, 0x43, 0xcd, 0xa1,
-        0x18, 0x60, 0x74, 0x00, 0x00, 0x00, 0x00, 0x77, 0xab, 0x18, 0x95, 0xc3, 0x3c, 0x88, 0xec,
-        0xff, 0xff, 0xff, 0xff, 0x43, 0x29, 0x00, 0x04, 0x02, 0x00, 0xf3, 0x03, 0xc0, 0xff, 0xca,
-        0x5e, 0x07, 0x00, 0x00, 0x05, 0x64, 0xd9, 0xff, 0xff, 0x93, 0x00, 0x00, 0x00, 0x00, 0x99,
-        0xb0, 0x04, 0x54, 0x09, 0x63, 0xcf, 0xff, 0xaf, 0x26, 0x00, 0x06, 0x02, 0x00, 0x23, 0x27,
-        0x37, 0x0c, 0x00, 0x96, 0x4e, 0xff, 0xff, 0xb2, 0x00, 0x00, 0x00, 0x00, 0xbb, 0x10, 0x05,
-        0x13, 0x3d, 0xba, 0x01, 0x0f, 0x02, 0x00, 0x02, 0x13, 0x2e, 0x68, 0x02, 0x1f, 0xde, 0x70,
-        0x05, 0x0b, 0x05, 0x02, 0x00, 0x9f, 0x0e, 0xff, 0xff, 0xef, 0x00, 0x00, 0x00, 0x04, 0xfb,
-        0xd0, 0x05, 0x14, 0x24, 0x00, 0xed, 0x2b, 0x01, 0x15, 0xec, 0x44, 0x00, 0x0f, 0x02, 0x00,
-        0x0a, 0x01, 0x23, 0x01, 0x00, 0xc8, 0x19, 0x0f, 0x90, 0x06, 0x14, 0x12, 0xad, 0x2e, 0x00,
-        0x0f, 0xf0, 0x06, 0x16, 0x0f, 0x02, 0x00, 0xc5, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0x55, 0x03, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0xef, 0x23, 0xae, 0xff, 0x01, 0x00, 0x1f, 0xad, 0x2d, 0x00, 0x10, 0x44, 0x00, 0x00,
+        0x00, 0xcf, 0x30, 0x00, 0x1f, 0xcc, 0x2d, 0x00, 0x10, 0x44, 0x00, 0x00, 0x00, 0xef, 0x30,
+        0x00, 0x1f, 0xec, 0x2d, 0x00, 0x10, 0xef, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf6, 0x01, 0x00,
+        0x00, 0x00, 0xf0, 0xff, 0xff, 0x0d, 0x2f, 0x00, 0x10, 0x50, 0x00, 0x31, 0xff, 0xff, 0xd7,
+        0x08, 0x00, 0x4f, 0xd2, 0xff, 0xff, 0x2d, 0x27, 0x00, 0x08, 0x14, 0x23, 0x1d, 0x00, 0x40,
+        0x51, 0xff, 0xff, 0xb8, 0x08, 0x00, 0x43, 0xb3, 0xff, 0xff, 0x4d, 0x13, 0x00, 0x2e, 0x2e,
+        0x23, 0x30, 0x00, 0xd0, 0xbb, 0xff, 0xc1, 0x56, 0x05, 0x00, 0x00, 0x04, 0x62, 0xda, 0xff,
+        0xff, 0x98, 0x11, 0x00, 0xdd, 0x95, 0xff, 0xff, 0xd6, 0x5c, 0x03, 0x00, 0x00, 0x06, 0x59,
+        0xc3, 0xff, 0xbb, 0x2f, 0x00, 0x10, 0x50, 0xe1, 0x00, 0x40, 0xe5, 0x7e, 0x3e, 0xcb, 0x08,
+        0x00, 0x10, 0x78, 0x12, 0x00, 0x10, 0x78, 0x0a, 0x00, 0x40, 0xc4, 0x3c, 0x85, 0xe9, 0x08,
+        0x00, 0x1b, 0x50, 0x2f, 0x00, 0x24, 0x07, 0xdc, 0x15, 0x01, 0x50, 0xff, 0xff, 0xee, 0x9a,
+        0x27, 0x13, 0x00, 0x36, 0x29, 0xa3, 0xf4, 0x14, 0x00, 0x2a, 0xdc, 0x07, 0x30, 0x00, 0x60,
+        0x79, 0xff, 0xff, 0xeb, 0x7a, 0xde, 0x1a, 0x00, 0x25, 0xf8, 0x7e, 0x16, 0x01, 0x30, 0x15,
+        0x90, 0xfd, 0x12, 0x00, 0x69, 0xe0, 0x7b, 0xeb, 0xff, 0xff, 0x79, 0x2f, 0x00, 0xc8, 0x1a,
+        0xf3, 0xff, 0xff, 0x68, 0x00, 0x02, 0x4c, 0xb6, 0xfd, 0xe1, 0x2e, 0x18, 0x00, 0xc8, 0x3d,
+        0xeb, 0xfe, 0xbb, 0x50, 0x03, 0x00, 0x68, 0xff, 0xff, 0xf3, 0x1a, 0x18, 0x00, 0x50, 0xa1,
+        0xff, 0xff, 0xd0, 0x03, 0x09, 0x00, 0x29, 0x23, 0x19, 0x48, 0x00, 0x30, 0x00, 0x25, 0x28,
+        0x06, 0x00, 0x57, 0x03, 0xd0, 0xff, 0xff, 0xa1, 0x16, 0x00, 0x5a, 0x38, 0xfe, 0xff, 0xff,
+        0x55, 0x29, 0x00, 0x0a, 0x01, 0x00, 0x56, 0x55, 0xff, 0xff, 0xfe, 0x38, 0x0f, 0x00, 0x65,
+        0x8e, 0xff, 0xff, 0xff, 0xeb, 0x49, 0x0f, 0x00, 0x85, 0x09, 0x72, 0xcc, 0xf4, 0xf5, 0xce,
+        0x75, 0x0a, 0x11, 0x00, 0x66, 0x46, 0xea, 0xff, 0xff, 0xff, 0x8e, 0x30, 0x00, 0x82, 0x01,
+        0x7a, 0xfb, 0xff, 0xff, 0xfe, 0x89, 0x04, 0x0e, 0x00, 0x22, 0x1c, 0xd1, 0x14, 0x01, 0x22,
+        0xd4, 0x1f, 0x10, 0x00, 0x70, 0x03, 0x82, 0xfd, 0xff, 0xff, 0xfb, 0x7a, 0x24, 0x02, 0x05,
+        0x01, 0x00, 0x70, 0x3f, 0xe5, 0xff, 0xff, 0xff, 0xc5, 0x1c, 0x0b, 0x00, 0x24, 0x08, 0xd0,
+        0x45, 0x01, 0x11, 0xd5, 0x62, 0x00, 0x20, 0x18, 0xbe, 0x9a, 0x01, 0x18, 0x3f, 0x2e, 0x00,
+        0x54, 0x00, 0x00, 0x00, 0x16, 0xbb, 0x96, 0x01, 0x16, 0x6e, 0x76, 0x01, 0x01, 0xb8, 0x01,
+        0x6b, 0x65, 0xff, 0xff, 0xff, 0xbb, 0x16, 0x2f, 0x00, 0x61, 0x00, 0x00, 0x02, 0xf4, 0xff,
+        0xff, 0x60, 0x00, 0x16, 0xc7, 0x30, 0x00, 0x10, 0xd1, 0x10, 0x00, 0x5d, 0x30, 0xff, 0xff,
+        0xe6, 0x02, 0x2f, 0x00, 0x60, 0x00, 0x05, 0xff, 0xff, 0xff, 0x08, 0x09, 0x00, 0x16, 0xee,
+        0x30, 0x00, 0x10, 0xf8, 0xb4, 0x00, 0x4e, 0x1c, 0xff, 0xff, 0xf4, 0x2f, 0x00, 0x2f, 0x00,
+        0x06, 0x30, 0x00, 0x08, 0x1f, 0xf2, 0x30, 0x00, 0x00, 0x50, 0x02, 0xf5, 0xff, 0xff, 0x1d,
+        0x09, 0x00, 0x16, 0xc6, 0x30, 0x00, 0x10, 0xd0, 0x10, 0x00, 0x49, 0x30, 0xff, 0xff, 0xdf,
+        0x1c, 0x01, 0x01, 0x01, 0x00, 0x0f, 0xf0, 0x00, 0x02, 0x10, 0x77, 0x10, 0x00, 0x6b, 0x63,
+        0xff, 0xff, 0xff, 0xae, 0x10, 0x2f, 0x00, 0x01, 0x50, 0x01, 0x20, 0xba, 0x15, 0x0b, 0x00,
+        0x15, 0x07, 0xf0, 0x03, 0x11, 0xd4, 0x50, 0x01, 0x78, 0x1d, 0xc5, 0xff, 0xff, 0xff, 0xdd,
+        0x34, 0x2e, 0x00, 0x01, 0xb0, 0x01, 0x23, 0xfd, 0x7f, 0x06, 0x01, 0x04, 0xb0, 0x01, 0x13,
+        0xd3, 0xb0, 0x01, 0x77, 0x05, 0x8b, 0xfe, 0xff, 0xff, 0xf8, 0x6c, 0x30, 0x00, 0x00, 0x10,
+        0x02, 0x25, 0xe9, 0x45, 0x0f, 0x00, 0x85, 0x08, 0x71, 0xca, 0xf4, 0xf4, 0xcb, 0x74, 0x09,
+        0x11, 0x00, 0x66, 0x4d, 0xed, 0xff, 0xff, 0xff, 0x7c, 0x30, 0x00, 0x0f, 0x70, 0x02, 0x0e,
+        0x57, 0x5e, 0xff, 0xff, 0xfa, 0x2a, 0x10, 0x00, 0x14, 0xa3, 0xd0, 0x02, 0x11, 0x2b, 0xb3,
+        0x01, 0x06, 0x01, 0x00, 0x11, 0x20, 0xea, 0x03, 0x58, 0x05, 0xd7, 0xff, 0xff, 0x91, 0x17,
+        0x00, 0x20, 0x1b, 0xf4, 0x30, 0x03, 0x68, 0x03, 0x51, 0xbd, 0xfe, 0xe2, 0x2f, 0x18, 0x00,
+        0xc9, 0x3a, 0xe8, 0xfd, 0xb6, 0x4a, 0x02, 0x00, 0x71, 0xff, 0xff, 0xec, 0x11, 0x48, 0x00,
+        0x60, 0x7c, 0xff, 0xff, 0xeb, 0x7b, 0xe1, 0xe6, 0x00, 0x34, 0xf9, 0x80, 0x0e, 0x15, 0x00,
+        0x30, 0x14, 0x8b, 0xfc, 0x12, 0x00, 0x69, 0xdc, 0x79, 0xef, 0xff, 0xff, 0x6a, 0x2f, 0x00,
+        0x36, 0x00, 0x08, 0xdf, 0x76, 0x01, 0x30, 0xef, 0x9d, 0x25, 0x13, 0x00, 0x27, 0x28, 0xa4,
+        0xf0, 0x03, 0x13, 0xd3, 0xec, 0x02, 0x05, 0x01, 0x00, 0x10, 0x54, 0x16, 0x00, 0x40, 0xea,
+        0x86, 0x43, 0xcd, 0x08, 0x00, 0x10, 0x74, 0x12, 0x00, 0x10, 0x77, 0x0a, 0x00, 0x40, 0xc3,
+        0x3c, 0x88, 0xec, 0x08, 0x00, 0x1b, 0x43, 0x2f, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xc0, 0xff,
+        0xca, 0x5e, 0x07, 0x00, 0x00, 0x05, 0x64, 0xd9, 0xff, 0xff, 0x93, 0x11, 0x00, 0x13, 0x99,
+        0xb0, 0x04, 0x5d, 0x09, 0x63, 0xcf, 0xff, 0xaf, 0x2f, 0x00, 0x33, 0x00, 0x27, 0x37, 0x09,
+        0x00, 0x40, 0x4e, 0xff, 0xff, 0xb2, 0x08, 0x00, 0x16, 0xbb, 0x10, 0x05, 0x13, 0x3d, 0xba,
+        0x01, 0x0f, 0x01, 0x00, 0x02, 0x13, 0x2e, 0x68, 0x02, 0x1f, 0xde, 0x70, 0x05, 0x0b, 0x05,
+        0x01, 0x00, 0x9f, 0x0e, 0xff, 0xff, 0xef, 0x00, 0x00, 0x00, 0x04, 0xfb, 0xd0, 0x05, 0x14,
+        0x10, 0x00, 0xfd, 0x01, 0x01, 0x01, 0x00, 0x0f, 0x30, 0x06, 0x13, 0x11, 0x00, 0x23, 0x01,
+        0x00, 0x01, 0x00, 0x0f, 0x90, 0x06, 0x14, 0x14, 0xad, 0x30, 0x00, 0x0f, 0xf0, 0x06, 0x14,
+        0x0f, 0x01, 0x00, 0xc5, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
 
 };
 
@@ -140,11 +85,11 @@ const lv_image_dsc_t icon_settings = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 48,
                  .h = 48,
-                 .stride = 96,
+                 .stride = 48,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_settings_map),
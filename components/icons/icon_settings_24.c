@@ -20,54 +20,30 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_SETTINGS_24 uint8_t
     icon_settings_24_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0xb8, 0x02, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0x5e, 0x26, 0xe3, 0x18, 0x02, 0x00, 0x0f, 0x7d, 0x00, 0x11, 0x2f, 0x04, 0x21, 0x30,
-        0x00, 0x1f, 0x00, 0xd6, 0x00, 0x22, 0xe3, 0x18, 0x08, 0x00, 0x0f, 0x02, 0x00, 0x03, 0x62,
-        0x04, 0x21, 0xe3, 0x18, 0x04, 0x21, 0x26, 0x00, 0x02, 0x28, 0x00, 0x04, 0x12, 0x00, 0x04,
-        0x08, 0x00, 0x08, 0x02, 0x00, 0x26, 0x00, 0x00, 0x84, 0x00, 0x04, 0x30, 0x00, 0x02, 0x0a,
-        0x00, 0x04, 0x02, 0x00, 0x28, 0x00, 0x00, 0x30, 0x00, 0x06, 0xb4, 0x00, 0x44, 0x04, 0x21,
-        0x04, 0x21, 0x1a, 0x00, 0x28, 0x04, 0x21, 0x18, 0x00, 0x04, 0x16, 0x00, 0x31, 0xff, 0xff,
-        0x24, 0xe2, 0x00, 0x75, 0x00, 0x00, 0xff, 0xff, 0x04, 0x21, 0x24, 0x2e, 0x00, 0x00, 0x9a,
-        0x01, 0x44, 0xc3, 0x18, 0xc3, 0x18, 0x7e, 0x00, 0x06, 0x1a, 0x00, 0x0a, 0x74, 0x00, 0x24,
-        0x45, 0x29, 0x10, 0x00, 0x02, 0x22, 0x00, 0x24, 0x00, 0x00, 0x66, 0x00, 0x02, 0x44, 0x00,
-        0x00, 0xe2, 0x01, 0x08, 0x12, 0x00, 0x04, 0x0c, 0x00, 0x04, 0x20, 0x01, 0x02, 0x0a, 0x00,
-        0x08, 0x90, 0x00, 0x00, 0x14, 0x02, 0x24, 0x00, 0x00, 0x14, 0x00, 0x02, 0x20, 0x00, 0x02,
-        0x02, 0x00, 0x04, 0x58, 0x01, 0x0a, 0xee, 0x00, 0x0f, 0x30, 0x00, 0x0f, 0x02, 0x24, 0x00,
-        0x06, 0x02, 0x00, 0x04, 0x84, 0x00, 0x08, 0x9c, 0x00, 0x04, 0x90, 0x00, 0x02, 0x1c, 0x00,
-        0x02, 0xcc, 0x00, 0x02, 0x02, 0x00, 0x02, 0x1c, 0x00, 0x22, 0x04, 0x21, 0x76, 0x00, 0x0e,
-        0xf0, 0x00, 0x04, 0x20, 0x00, 0x02, 0x2e, 0x00, 0x08, 0x50, 0x01, 0x26, 0xa2, 0x10, 0x16,
-        0x00, 0x04, 0xbc, 0x00, 0x02, 0xdc, 0x00, 0x42, 0xe3, 0x18, 0xa2, 0x10, 0x14, 0x00, 0x04,
-        0x18, 0x00, 0x04, 0x02, 0x00, 0x06, 0x32, 0x00, 0x04, 0x12, 0x00, 0x02, 0x02, 0x00, 0x02,
-        0x2a, 0x00, 0x02, 0x02, 0x00, 0x06, 0x74, 0x00, 0x06, 0x32, 0x00, 0x02, 0x26, 0x00, 0x04,
-        0x02, 0x00, 0x02, 0xac, 0x00, 0x06, 0x02, 0x00, 0x64, 0xe3, 0x18, 0x04, 0x21, 0xe3, 0x18,
-        0x26, 0x00, 0x04, 0x74, 0x00, 0x0a, 0x82, 0x02, 0x0f, 0x02, 0x00, 0x03, 0x02, 0x18, 0x01,
-        0x02, 0x72, 0x00, 0x0f, 0x22, 0x00, 0x03, 0x0a, 0x02, 0x00, 0x04, 0x82, 0x00, 0x02, 0x38,
-        0x00, 0x0f, 0x02, 0x00, 0x0f, 0x26, 0x04, 0x21, 0x02, 0x00, 0x0f, 0x2e, 0x00, 0x0f, 0x0f,
-        0x02, 0x00, 0x3d, 0x1f, 0x00, 0x01, 0x00, 0x25, 0x6e, 0x29, 0x77, 0x77, 0x77, 0x77, 0x29,
-        0x3e, 0x00, 0x10, 0x70, 0xd2, 0x04, 0x1e, 0x6e, 0x18, 0x00, 0x69, 0x91, 0xf3, 0x00, 0x00,
-        0xf0, 0x8d, 0x18, 0x00, 0xf3, 0x01, 0x38, 0x7b, 0x16, 0x00, 0x19, 0xcb, 0xd3, 0x00, 0x00,
-        0xd2, 0xc8, 0x18, 0x00, 0x18, 0x7c, 0x38, 0x1d, 0x00, 0xf2, 0x03, 0x02, 0xcb, 0xff, 0xf8,
-        0xae, 0xf2, 0xfe, 0x93, 0x00, 0x00, 0x96, 0xff, 0xf0, 0xaf, 0xf9, 0xff, 0xcb, 0x02, 0x19,
-        0x00, 0xf1, 0x03, 0x61, 0xff, 0x73, 0x8b, 0xec, 0xca, 0x26, 0x00, 0x00, 0x00, 0x00, 0x2e,
-        0xd2, 0xee, 0x8c, 0x73, 0xff, 0x61, 0x18, 0x00, 0x71, 0x0e, 0xe7, 0xc9, 0x01, 0x00, 0x08,
-        0x07, 0x0c, 0x00, 0xf1, 0x11, 0x00, 0x0a, 0x0a, 0x00, 0x01, 0xc9, 0xe7, 0x0e, 0x00, 0x00,
-        0x00, 0x00, 0x24, 0xdd, 0xfa, 0x73, 0x01, 0x00, 0x00, 0x06, 0x8b, 0xe7, 0xe8, 0x8c, 0x07,
-        0x00, 0x00, 0x01, 0x71, 0xfa, 0xdd, 0x24, 0x25, 0x00, 0x70, 0x10, 0xae, 0xff, 0x8c, 0x00,
-        0x00, 0x89, 0x7a, 0x05, 0x71, 0x8d, 0x00, 0x00, 0x8e, 0xff, 0xad, 0x0f, 0x17, 0x00, 0x80,
-        0x00, 0x00, 0x02, 0xfc, 0x88, 0x00, 0x00, 0xe4, 0x92, 0x05, 0x63, 0xe9, 0x00, 0x00, 0x92,
-        0xf6, 0x01, 0x17, 0x00, 0x47, 0x00, 0x02, 0xfc, 0x89, 0x18, 0x00, 0x14, 0xf4, 0x17, 0x00,
-        0x70, 0x10, 0xae, 0xff, 0x87, 0x00, 0x00, 0x88, 0xc2, 0x05, 0x71, 0x8c, 0x00, 0x00, 0x91,
-        0xff, 0xa7, 0x0d, 0x1a, 0x00, 0xf1, 0x10, 0x24, 0xdd, 0xfa, 0x70, 0x01, 0x00, 0x00, 0x06,
-        0x8a, 0xe6, 0xe7, 0x8b, 0x07, 0x00, 0x00, 0x01, 0x75, 0xfb, 0xd9, 0x1f, 0x00, 0x00, 0x00,
-        0x00, 0x0e, 0xe8, 0xc9, 0x01, 0x00, 0x0b, 0x08, 0x24, 0x00, 0x81, 0x00, 0x09, 0x09, 0x00,
-        0x01, 0xcd, 0xe3, 0x0b, 0x0d, 0x00, 0xf1, 0x03, 0x63, 0xff, 0x73, 0x8c, 0xef, 0xcb, 0x27,
-        0x00, 0x00, 0x00, 0x00, 0x2c, 0xcf, 0xec, 0x8a, 0x76, 0xff, 0x5a, 0x17, 0x00, 0xf4, 0x03,
-        0x00, 0x02, 0xcd, 0xff, 0xfa, 0xb2, 0xf3, 0xfe, 0x91, 0x00, 0x00, 0x95, 0xfe, 0xf0, 0xb0,
-        0xfa, 0xff, 0xc5, 0x91, 0x00, 0xf2, 0x01, 0x3a, 0x80, 0x19, 0x00, 0x1a, 0xc9, 0xd1, 0x00,
-        0x00, 0xd5, 0xc8, 0x17, 0x00, 0x1a, 0x83, 0x34, 0x2f, 0x00, 0x03, 0x02, 0x00, 0x5a, 0x8e,
-        0xef, 0x00, 0x01, 0xf5, 0x68, 0x01, 0x01, 0x02, 0x00, 0x1f, 0x6f, 0x98, 0x01, 0x04, 0x61,
-        0x2e, 0x88, 0x88, 0x88, 0x88, 0x2e, 0x23, 0x00, 0x0f, 0x02, 0x00, 0x1c, 0x50, 0x00, 0x00,
-        0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0x57, 0x01, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0x25, 0x6e, 0x29, 0x77, 0x77, 0x77, 0x77, 0x29, 0x18, 0x00, 0x6e, 0x70, 0xff, 0xff,
+        0xff, 0xff, 0x6e, 0x18, 0x00, 0x69, 0x91, 0xf3, 0x00, 0x00, 0xf0, 0x8d, 0x13, 0x00, 0xf3,
+        0x01, 0x38, 0x7b, 0x16, 0x00, 0x19, 0xcb, 0xd3, 0x00, 0x00, 0xd2, 0xc8, 0x18, 0x00, 0x18,
+        0x7c, 0x38, 0x17, 0x00, 0xf2, 0x03, 0x02, 0xcb, 0xff, 0xf8, 0xae, 0xf2, 0xfe, 0x93, 0x00,
+        0x00, 0x96, 0xff, 0xf0, 0xaf, 0xf9, 0xff, 0xcb, 0x02, 0x18, 0x00, 0x70, 0x61, 0xff, 0x73,
+        0x8b, 0xec, 0xca, 0x26, 0x0b, 0x00, 0x71, 0x2e, 0xd2, 0xee, 0x8c, 0x73, 0xff, 0x61, 0x17,
+        0x00, 0x72, 0x0e, 0xe7, 0xc9, 0x01, 0x00, 0x08, 0x07, 0x24, 0x00, 0x70, 0x0a, 0x0a, 0x00,
+        0x01, 0xc9, 0xe7, 0x0e, 0x0b, 0x00, 0xf1, 0x05, 0x24, 0xdd, 0xfa, 0x73, 0x01, 0x00, 0x00,
+        0x06, 0x8b, 0xe7, 0xe8, 0x8c, 0x07, 0x00, 0x00, 0x01, 0x71, 0xfa, 0xdd, 0x24, 0x24, 0x00,
+        0x70, 0x10, 0xae, 0xff, 0x8c, 0x00, 0x00, 0x89, 0xa8, 0x00, 0x74, 0x8d, 0x00, 0x00, 0x8e,
+        0xff, 0xad, 0x0f, 0x79, 0x00, 0x50, 0xfc, 0x88, 0x00, 0x00, 0xe4, 0x18, 0x00, 0x64, 0xe9,
+        0x00, 0x00, 0x92, 0xf6, 0x01, 0xa8, 0x00, 0x37, 0x02, 0xfc, 0x89, 0x18, 0x00, 0x14, 0xf4,
+        0x17, 0x00, 0x70, 0x10, 0xae, 0xff, 0x87, 0x00, 0x00, 0x88, 0x18, 0x00, 0x71, 0x8c, 0x00,
+        0x00, 0x91, 0xff, 0xa7, 0x0d, 0x17, 0x00, 0x40, 0x24, 0xdd, 0xfa, 0x70, 0x78, 0x00, 0x40,
+        0x8a, 0xe6, 0xe7, 0x8b, 0x78, 0x00, 0x41, 0x75, 0xfb, 0xd9, 0x1f, 0xa8, 0x00, 0x62, 0xe8,
+        0xc9, 0x01, 0x00, 0x0b, 0x08, 0x3c, 0x00, 0x71, 0x09, 0x09, 0x00, 0x01, 0xcd, 0xe3, 0x0b,
+        0x0c, 0x00, 0x70, 0x63, 0xff, 0x73, 0x8c, 0xef, 0xcb, 0x27, 0x0b, 0x00, 0x73, 0x2c, 0xcf,
+        0xec, 0x8a, 0x76, 0xff, 0x5a, 0x77, 0x00, 0xf4, 0x01, 0xcd, 0xff, 0xfa, 0xb2, 0xf3, 0xfe,
+        0x91, 0x00, 0x00, 0x95, 0xfe, 0xf0, 0xb0, 0xfa, 0xff, 0xc5, 0x91, 0x00, 0xf4, 0x01, 0x3a,
+        0x80, 0x19, 0x00, 0x1a, 0xc9, 0xd1, 0x00, 0x00, 0xd5, 0xc8, 0x17, 0x00, 0x1a, 0x83, 0x34,
+        0x91, 0x00, 0x01, 0x01, 0x00, 0x5a, 0x8e, 0xef, 0x00, 0x01, 0xf5, 0x68, 0x01, 0x01, 0x01,
+        0x00, 0x1f, 0x6f, 0x98, 0x01, 0x04, 0x6e, 0x2e, 0x88, 0x88, 0x88, 0x88, 0x2e, 0x18, 0x00,
+        0x0f, 0x01, 0x00, 0x0f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
 
 };
 
@@ -75,11 +51,11 @@ const lv_image_dsc_t icon_settings_24 = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 24,
                  .h = 24,
-                 .stride = 48,
+                 .stride = 24,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_settings_24_map),
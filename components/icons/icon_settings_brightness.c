@@ -20,72 +20,26 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_SETTINGS_BRIGHTNESS
     uint8_t icon_settings_brightness_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0xca, 0x03, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0xff, 0xff, 0xff, 0x5b, 0x2f, 0xe3, 0x18, 0x02, 0x00, 0x33, 0x0f, 0xb3, 0x03, 0x03,
-        0x0f, 0x5c, 0x00, 0x33, 0x02, 0x02, 0x00, 0x0f, 0x62, 0x00, 0x01, 0x02, 0x1a, 0x00, 0x0f,
-        0x02, 0x00, 0x33, 0x0f, 0x60, 0x00, 0x07, 0x2f, 0x04, 0x21, 0x1c, 0x00, 0x01, 0x0f, 0x02,
-        0x00, 0x15, 0x22, 0x04, 0x21, 0xa0, 0x00, 0x0f, 0x30, 0x00, 0x01, 0x0f, 0x1a, 0x00, 0x07,
-        0x0f, 0x02, 0x00, 0x19, 0x0f, 0x46, 0x00, 0x07, 0x0f, 0x1a, 0x00, 0x07, 0x06, 0x02, 0x00,
-        0x0f, 0x9c, 0x00, 0x05, 0x06, 0x02, 0x00, 0x0f, 0x46, 0x00, 0x07, 0x0f, 0x1a, 0x00, 0x07,
-        0x04, 0x02, 0x00, 0x0f, 0xfe, 0x00, 0x09, 0x04, 0x02, 0x00, 0x0f, 0x46, 0x00, 0x07, 0x0f,
-        0x1a, 0x00, 0x07, 0x02, 0x02, 0x00, 0x04, 0x5e, 0x00, 0x0f, 0xc4, 0x00, 0x0b, 0x0f, 0x20,
-        0x00, 0x07, 0x0f, 0x1a, 0x00, 0x05, 0x02, 0x18, 0x00, 0x0f, 0x02, 0x00, 0x03, 0x02, 0x7a,
-        0x00, 0x08, 0x02, 0x00, 0x02, 0x28, 0x00, 0x08, 0x12, 0x00, 0x04, 0x02, 0x00, 0x0f, 0x1a,
-        0x00, 0x05, 0x02, 0x18, 0x00, 0x0f, 0x02, 0x00, 0x03, 0x04, 0x3c, 0x00, 0x06, 0x02, 0x00,
-        0x02, 0x28, 0x00, 0x06, 0x10, 0x00, 0x06, 0x02, 0x00, 0x0f, 0x1a, 0x00, 0x05, 0x02, 0x18,
-        0x00, 0x04, 0x02, 0x00, 0x00, 0x50, 0x07, 0x04, 0x0c, 0x00, 0x02, 0x0e, 0x00, 0x0a, 0x02,
-        0x00, 0x02, 0x1c, 0x00, 0x0a, 0x14, 0x00, 0x02, 0x02, 0x00, 0x0f, 0x1a, 0x00, 0x05, 0x02,
-        0x18, 0x00, 0x04, 0x02, 0x00, 0x02, 0x2c, 0x00, 0x22, 0x45, 0x29, 0x10, 0x00, 0x02, 0x0e,
-        0x00, 0x08, 0x02, 0x00, 0x0f, 0x18, 0x00, 0x05, 0x0f, 0x1a, 0x00, 0x05, 0x02, 0x30, 0x00,
-        0x06, 0x02, 0x00, 0x04, 0x4c, 0x00, 0x04, 0x12, 0x00, 0x04, 0x10, 0x00, 0x04, 0x02, 0x00,
-        0x02, 0x18, 0x00, 0x04, 0x0e, 0x00, 0x08, 0x02, 0x00, 0x0f, 0x1a, 0x00, 0x01, 0x02, 0x14,
-        0x00, 0x08, 0x02, 0x00, 0x06, 0x32, 0x00, 0x04, 0x16, 0x00, 0x06, 0x12, 0x00, 0x0f, 0xa6,
-        0x00, 0x07, 0x0f, 0x1a, 0x00, 0x03, 0x08, 0x92, 0x02, 0x04, 0x02, 0x00, 0x02, 0x2c, 0x00,
-        0x06, 0x30, 0x00, 0x0c, 0x86, 0x01, 0x0e, 0x12, 0x00, 0x04, 0x02, 0x00, 0x0e, 0x1a, 0x00,
-        0x0f, 0x60, 0x00, 0x4d, 0x04, 0x74, 0x00, 0x08, 0x02, 0x00, 0x04, 0x8e, 0x00, 0x06, 0x1c,
-        0x00, 0x06, 0x12, 0x00, 0x06, 0x16, 0x00, 0x02, 0x0c, 0x00, 0x0a, 0x02, 0x00, 0x02, 0x46,
-        0x00, 0x0a, 0x14, 0x00, 0x04, 0x16, 0x00, 0x06, 0x02, 0x00, 0x04, 0x20, 0x00, 0x04, 0x12,
-        0x00, 0x04, 0x10, 0x00, 0x04, 0x02, 0x00, 0x02, 0x18, 0x00, 0x04, 0x0e, 0x00, 0x08, 0x02,
-        0x00, 0x0f, 0x1a, 0x00, 0x05, 0x02, 0x18, 0x00, 0x04, 0x02, 0x00, 0x02, 0x32, 0x00, 0x0f,
-        0xa0, 0x02, 0x37, 0x0f, 0x60, 0x00, 0x01, 0x04, 0x6c, 0x00, 0x04, 0x6e, 0x00, 0x08, 0x02,
-        0x00, 0x02, 0x1c, 0x00, 0x08, 0x12, 0x00, 0x04, 0x02, 0x00, 0x0f, 0x1a, 0x00, 0x05, 0x02,
-        0x18, 0x00, 0x0f, 0x02, 0x00, 0x03, 0x04, 0x3c, 0x00, 0x06, 0x02, 0x00, 0x02, 0x28, 0x00,
-        0x06, 0x10, 0x00, 0x06, 0x02, 0x00, 0x0f, 0x1a, 0x00, 0x05, 0x02, 0x18, 0x00, 0x0f, 0x02,
-        0x00, 0x03, 0x06, 0x3e, 0x00, 0x04, 0x02, 0x00, 0x02, 0x28, 0x00, 0x04, 0x0e, 0x00, 0x08,
-        0x02, 0x00, 0x0f, 0x1a, 0x00, 0x07, 0x02, 0x02, 0x00, 0x08, 0xae, 0x02, 0x02, 0x12, 0x00,
-        0x0f, 0x02, 0x00, 0x01, 0x0f, 0x46, 0x00, 0x07, 0x0f, 0x1a, 0x00, 0x07, 0x04, 0x02, 0x00,
-        0x04, 0x62, 0x00, 0x04, 0x10, 0x00, 0x0f, 0x02, 0x00, 0x01, 0x0f, 0x46, 0x00, 0x07, 0x0f,
-        0x1a, 0x00, 0x07, 0x06, 0x02, 0x00, 0x0f, 0xd4, 0x01, 0x03, 0x08, 0x02, 0x00, 0x0f, 0x46,
-        0x00, 0x07, 0x0f, 0x1a, 0x00, 0x07, 0x0f, 0x02, 0x00, 0x19, 0x0f, 0x46, 0x00, 0x07, 0x02,
-        0x1a, 0x00, 0x0f, 0xa0, 0x08, 0x4d, 0x0f, 0x02, 0x00, 0x33, 0x0f, 0xf2, 0x00, 0x01, 0x0f,
-        0x5a, 0x00, 0x33, 0x02, 0x02, 0x00, 0x0f, 0x60, 0x00, 0x01, 0x0f, 0x62, 0x00, 0x37, 0x0f,
-        0x5e, 0x00, 0x03, 0x0f, 0x02, 0x00, 0xff, 0xff, 0xff, 0x46, 0x1f, 0x00, 0x01, 0x00, 0xff,
-        0xa3, 0x3f, 0x42, 0xc7, 0xf6, 0x0f, 0x05, 0x0b, 0x37, 0xf6, 0xc6, 0x42, 0xd9, 0x01, 0x2f,
-        0x42, 0xfd, 0x2e, 0x00, 0x0b, 0x00, 0x05, 0x14, 0x17, 0xfd, 0x31, 0x00, 0x12, 0xc7, 0x13,
-        0x00, 0x0f, 0x02, 0x00, 0x0b, 0x16, 0xc6, 0x61, 0x00, 0x46, 0xf6, 0xff, 0xff, 0x1e, 0x0e,
-        0x00, 0x0f, 0x02, 0x00, 0x01, 0x46, 0x1e, 0xff, 0xff, 0xf6, 0x18, 0x00, 0x0f, 0x78, 0x02,
-        0x10, 0x09, 0x23, 0x00, 0x09, 0x0d, 0x00, 0x01, 0x02, 0x00, 0x21, 0x2a, 0x2a, 0x07, 0x00,
-        0x06, 0x02, 0x00, 0x09, 0x23, 0x00, 0x09, 0x0d, 0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0x28,
-        0xe6, 0xe9, 0x2c, 0x0a, 0x00, 0x04, 0x02, 0x00, 0x09, 0x23, 0x00, 0x09, 0x0d, 0x00, 0x01,
-        0x2f, 0x00, 0x2b, 0xff, 0xff, 0x31, 0x00, 0x09, 0x23, 0x00, 0x08, 0x0d, 0x00, 0x0a, 0x25,
-        0x01, 0x01, 0x3f, 0x00, 0x03, 0x17, 0x00, 0x02, 0x09, 0x00, 0x0c, 0x0d, 0x00, 0x03, 0x30,
-        0x00, 0x30, 0x8c, 0xb7, 0xf9, 0x7b, 0x15, 0x02, 0x20, 0x00, 0x0f, 0x30, 0x00, 0x10, 0x4b,
-        0x00, 0x00, 0x21, 0xc1, 0x77, 0x00, 0x01, 0x38, 0x00, 0x01, 0x02, 0x00, 0x0b, 0x19, 0x00,
-        0x03, 0x59, 0x00, 0x27, 0x06, 0xc1, 0x24, 0x00, 0x08, 0x23, 0x00, 0x08, 0x0d, 0x00, 0x12,
-        0x2a, 0x2f, 0x00, 0x85, 0xff, 0x00, 0x00, 0x00, 0x00, 0x22, 0xf9, 0xff, 0x57, 0x01, 0x03,
-        0x13, 0x00, 0x02, 0x02, 0x00, 0x06, 0x0d, 0x00, 0x27, 0x2a, 0xe8, 0x30, 0x00, 0x44, 0x00,
-        0xb8, 0xff, 0xe8, 0x31, 0x00, 0x06, 0x23, 0x00, 0x08, 0x60, 0x00, 0x23, 0x28, 0xe6, 0x2f,
-        0x00, 0x01, 0x60, 0x00, 0x26, 0x00, 0x8b, 0x57, 0x01, 0x04, 0x13, 0x00, 0x01, 0x02, 0x00,
-        0x05, 0x0d, 0x00, 0x1a, 0x27, 0x30, 0x00, 0x1f, 0x8d, 0x30, 0x00, 0x0d, 0x0b, 0x90, 0x00,
-        0x1f, 0xb9, 0x90, 0x00, 0x0d, 0x0b, 0xf0, 0x00, 0x1f, 0xfa, 0xf0, 0x00, 0x0e, 0x01, 0x9c,
-        0x00, 0x0f, 0x50, 0x01, 0x19, 0x12, 0x00, 0x2f, 0x00, 0x4f, 0xff, 0x00, 0x00, 0x22, 0xb0,
-        0x01, 0x1a, 0x2f, 0x8d, 0xb9, 0x10, 0x02, 0x1b, 0x03, 0x02, 0x00, 0x01, 0x3f, 0x01, 0x03,
-        0xa7, 0x00, 0x02, 0x09, 0x00, 0x0d, 0x0d, 0x00, 0x03, 0x57, 0x01, 0x0f, 0xd0, 0x02, 0x15,
-        0x01, 0x02, 0x00, 0x1f, 0x27, 0x30, 0x03, 0x1b, 0x0f, 0x90, 0x03, 0x1e, 0x0e, 0x02, 0x00,
-        0x01, 0x33, 0x01, 0x04, 0x02, 0x00, 0x0f, 0x50, 0x04, 0x1d, 0x0f, 0xb0, 0x04, 0x1d, 0x1f,
-        0x41, 0x10, 0x05, 0x11, 0x14, 0x41, 0x8e, 0x00, 0x63, 0x00, 0x00, 0x00, 0x42, 0xc6, 0xf6,
-        0x71, 0x01, 0x0f, 0x02, 0x00, 0x04, 0x28, 0xf6, 0xc6, 0x2f, 0x00, 0x0f, 0x02, 0x00, 0xff,
-        0x94, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0x1c, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0xff, 0xa3, 0x4f, 0x42, 0xc7, 0xf6, 0xff, 0x01, 0x00, 0x0a, 0x38, 0xf6, 0xc6, 0x42,
+        0x2f, 0x00, 0x1f, 0xfd, 0x2e, 0x00, 0x0b, 0x00, 0x01, 0x00, 0x17, 0xfd, 0x31, 0x00, 0x1f,
+        0xc7, 0x2f, 0x00, 0x0f, 0x36, 0xff, 0xff, 0xc6, 0x30, 0x00, 0x49, 0xf6, 0xff, 0xff, 0x1e,
+        0xa0, 0x00, 0x0d, 0x01, 0x00, 0x46, 0x1e, 0xff, 0xff, 0xf6, 0x0e, 0x00, 0x3f, 0xff, 0xff,
+        0xff, 0x2d, 0x00, 0x09, 0x0d, 0x23, 0x00, 0x0e, 0x30, 0x00, 0x2f, 0x2a, 0x2a, 0x30, 0x00,
+        0x1a, 0x4f, 0x28, 0xe6, 0xe9, 0x2c, 0x30, 0x00, 0x18, 0x4b, 0x28, 0xe6, 0xff, 0xff, 0x31,
+        0x00, 0x0f, 0x30, 0x00, 0x06, 0x0a, 0x15, 0x01, 0x0f, 0x30, 0x00, 0x16, 0x3f, 0x8c, 0xb7,
+        0xf9, 0x30, 0x00, 0x1a, 0x4f, 0x00, 0x00, 0x21, 0xc1, 0x30, 0x00, 0x1b, 0x3f, 0x00, 0x06,
+        0xc1, 0x30, 0x00, 0x10, 0x17, 0x2a, 0xb9, 0x00, 0x35, 0x22, 0xf9, 0xff, 0x57, 0x01, 0x0f,
+        0x30, 0x00, 0x04, 0x28, 0x2a, 0xe8, 0xe9, 0x00, 0x34, 0xb8, 0xff, 0xe8, 0x31, 0x00, 0x0f,
+        0x30, 0x00, 0x03, 0x00, 0x49, 0x01, 0x07, 0x30, 0x00, 0x16, 0x8b, 0x57, 0x01, 0x0f, 0x30,
+        0x00, 0x03, 0x1a, 0x27, 0x30, 0x00, 0x1f, 0x8d, 0x30, 0x00, 0x0d, 0x0b, 0x90, 0x00, 0x1f,
+        0xb9, 0x90, 0x00, 0x0d, 0x0b, 0xf0, 0x00, 0x1f, 0xfa, 0xf0, 0x00, 0x0e, 0x0f, 0x50, 0x01,
+        0x1e, 0x06, 0x30, 0x00, 0x1f, 0x22, 0xb0, 0x01, 0x1a, 0x2f, 0x8d, 0xb9, 0x10, 0x02, 0x1b,
+        0x08, 0xf7, 0x00, 0x0f, 0x30, 0x00, 0x0a, 0x00, 0x01, 0x00, 0x00, 0x57, 0x01, 0x0f, 0xd0,
+        0x02, 0x15, 0x03, 0x31, 0x00, 0x0f, 0x30, 0x03, 0x1a, 0x0f, 0x90, 0x03, 0x1e, 0x0e, 0x01,
+        0x00, 0x09, 0x23, 0x00, 0x0f, 0x50, 0x04, 0x1d, 0x0f, 0xb0, 0x04, 0x1d, 0x1f, 0x41, 0x10,
+        0x05, 0x11, 0x17, 0x41, 0x6f, 0x00, 0x2f, 0x42, 0xc6, 0x70, 0x05, 0x0e, 0x08, 0x2f, 0x00,
+        0x0f, 0x01, 0x00, 0xff, 0x94, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
 
 };
 
@@ -93,11 +47,11 @@ const lv_image_dsc_t icon_settings_brightness = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 48,
                  .h = 48,
-                 .stride = 96,
+                 .stride = 48,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_settings_brightness_map),
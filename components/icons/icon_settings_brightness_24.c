@@ -20,34 +20,18 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST
     LV_ATTRIBUTE_ICON_SETTINGS_BRIGHTNESS_24 uint8_t icon_settings_brightness_24_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0x8e, 0x01, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0xb2, 0x2f, 0xe3, 0x18, 0x02, 0x00, 0x0f, 0x06, 0xe9, 0x00, 0x0f, 0x2c, 0x00, 0x0f,
-        0x02, 0x02, 0x00, 0x04, 0x32, 0x00, 0x64, 0xe3, 0x18, 0xe3, 0x18, 0x04, 0x21, 0x0e, 0x00,
-        0x0f, 0x02, 0x00, 0x01, 0x28, 0x04, 0x21, 0x30, 0x00, 0x26, 0x04, 0x21, 0x0c, 0x00, 0x02,
-        0x02, 0x00, 0x2c, 0x04, 0x21, 0x40, 0x00, 0x08, 0x52, 0x00, 0x08, 0x30, 0x00, 0x02, 0x7a,
-        0x00, 0x06, 0x02, 0x00, 0x02, 0x40, 0x00, 0x0f, 0x30, 0x00, 0x07, 0x02, 0x7a, 0x00, 0x22,
-        0xe3, 0x18, 0x08, 0x00, 0x06, 0x66, 0x00, 0x08, 0x0c, 0x00, 0x0f, 0x60, 0x00, 0x01, 0x48,
-        0xff, 0xff, 0x00, 0x00, 0xb4, 0x00, 0x0f, 0x30, 0x00, 0x03, 0x0a, 0x88, 0x00, 0x26, 0x04,
-        0x21, 0x26, 0x00, 0x06, 0x0a, 0x00, 0x02, 0x18, 0x00, 0x02, 0xa8, 0x00, 0x0a, 0x30, 0x00,
-        0x02, 0x98, 0x00, 0x04, 0x1a, 0x00, 0x04, 0x0a, 0x00, 0x08, 0x30, 0x00, 0x02, 0x24, 0x00,
-        0x02, 0x88, 0x00, 0x0f, 0x90, 0x00, 0x11, 0x02, 0x3c, 0x00, 0x02, 0x58, 0x00, 0x02, 0x06,
-        0x00, 0x02, 0x5e, 0x00, 0x0f, 0x90, 0x00, 0x05, 0x02, 0x18, 0x00, 0x04, 0x2c, 0x00, 0x0a,
-        0x08, 0x01, 0x06, 0x3c, 0x00, 0x08, 0x18, 0x00, 0x02, 0x02, 0x00, 0x0f, 0xb0, 0x01, 0x0b,
-        0x0a, 0x7a, 0x00, 0x0f, 0x02, 0x00, 0x01, 0x02, 0x72, 0x00, 0x04, 0x1a, 0x00, 0x02, 0xb2,
-        0x00, 0x0f, 0x02, 0x00, 0x0f, 0x04, 0x30, 0x00, 0x02, 0x32, 0x00, 0x2f, 0x04, 0x21, 0x02,
-        0x00, 0x07, 0x02, 0x32, 0x01, 0x0f, 0x02, 0x00, 0xb1, 0x1f, 0x00, 0x01, 0x00, 0x4f, 0x2b,
-        0x43, 0x77, 0x01, 0x00, 0x11, 0x43, 0x74, 0x00, 0x1e, 0x43, 0x3f, 0x01, 0x81, 0x42, 0x00,
-        0x00, 0x00, 0x00, 0x7d, 0xff, 0x08, 0x20, 0x00, 0x05, 0x02, 0x00, 0x93, 0x08, 0xff, 0x7d,
-        0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x12, 0x00, 0x23, 0x4f, 0x4f, 0x09, 0x00, 0x26, 0xff,
-        0x80, 0x18, 0x00, 0x8c, 0x3c, 0x77, 0x84, 0xf9, 0xf9, 0x84, 0x77, 0x3c, 0x18, 0x00, 0x62,
-        0x80, 0xff, 0xff, 0xff, 0x58, 0xbf, 0x2a, 0x00, 0x02, 0x06, 0x00, 0x02, 0x48, 0x00, 0x8b,
-        0x8a, 0xff, 0xff, 0xff, 0x00, 0x02, 0xbf, 0x8a, 0x30, 0x00, 0xaa, 0x4a, 0xf8, 0xff, 0xff,
-        0xff, 0x00, 0x00, 0x59, 0xfa, 0x50, 0x48, 0x00, 0x03, 0x18, 0x00, 0x1c, 0x5a, 0x18, 0x00,
-        0x0f, 0x48, 0x00, 0x05, 0x72, 0x00, 0x80, 0xff, 0xff, 0xff, 0x59, 0xc0, 0x72, 0x00, 0x02,
-        0x06, 0x00, 0x02, 0x78, 0x00, 0x8b, 0x44, 0x88, 0x90, 0xf9, 0xf9, 0x90, 0x88, 0x44, 0x78,
-        0x00, 0x0f, 0xd8, 0x00, 0x00, 0x0f, 0x08, 0x01, 0x05, 0x0f, 0x38, 0x01, 0x05, 0x49, 0x00,
-        0x42, 0x83, 0x88, 0x01, 0x00, 0x22, 0x83, 0x41, 0x58, 0x00, 0x0f, 0x02, 0x00, 0x45, 0x50,
-        0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0x4f, 0x2b, 0x43, 0x77, 0x01, 0x00, 0x12, 0x43, 0x17, 0x00, 0x1d, 0xff, 0x01, 0x00,
+        0x10, 0x42, 0x18, 0x00, 0x3a, 0x7d, 0xff, 0x08, 0x40, 0x00, 0x30, 0x08, 0xff, 0x7d, 0x07,
+        0x00, 0x23, 0x80, 0xff, 0x10, 0x00, 0x23, 0x4f, 0x4f, 0x09, 0x00, 0x26, 0xff, 0x80, 0x18,
+        0x00, 0x8c, 0x3c, 0x77, 0x84, 0xf9, 0xf9, 0x84, 0x77, 0x3c, 0x18, 0x00, 0x62, 0x80, 0xff,
+        0xff, 0xff, 0x58, 0xbf, 0x12, 0x00, 0x08, 0x18, 0x00, 0x8b, 0x8a, 0xff, 0xff, 0xff, 0x00,
+        0x02, 0xbf, 0x8a, 0x18, 0x00, 0x20, 0x4a, 0xf8, 0x18, 0x00, 0x4f, 0x00, 0x59, 0xfa, 0x50,
+        0x18, 0x00, 0x02, 0x1c, 0x5a, 0x18, 0x00, 0x0f, 0x48, 0x00, 0x05, 0x01, 0x78, 0x00, 0x2e,
+        0x59, 0xc0, 0x78, 0x00, 0x8c, 0x44, 0x88, 0x90, 0xf9, 0xf9, 0x90, 0x88, 0x44, 0x18, 0x00,
+        0x0e, 0xd8, 0x00, 0x0f, 0x08, 0x01, 0x05, 0x0f, 0x38, 0x01, 0x05, 0x49, 0x00, 0x42, 0x83,
+        0x88, 0x01, 0x00, 0x2a, 0x83, 0x41, 0x40, 0x00, 0x0f, 0x01, 0x00, 0x3d, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x00,
 
 };
 
@@ -55,11 +39,11 @@ const lv_image_dsc_t icon_settings_brightness_24 = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 24,
                  .h = 24,
-                 .stride = 48,
+                 .stride = 24,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_settings_brightness_24_map),
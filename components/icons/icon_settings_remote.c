@@ -20,89 +20,35 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_SETTINGS_REMOTE
     uint8_t icon_settings_remote_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0xce, 0x04, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0x12, 0x82, 0xa2, 0x10, 0xe3, 0x18, 0x04, 0x21, 0xe3, 0x18, 0x02, 0x00, 0x6f, 0x04,
-        0x21, 0xe3, 0x18, 0xc3, 0x18, 0x39, 0x00, 0x12, 0x0f, 0x02, 0x00, 0x0e, 0x02, 0x52, 0x00,
-        0x0f, 0x02, 0x00, 0x07, 0x0f, 0x41, 0x00, 0x0e, 0x0f, 0x02, 0x00, 0x06, 0x2f, 0x00, 0x00,
-        0x56, 0x00, 0x07, 0x0a, 0x02, 0x00, 0x0f, 0x43, 0x00, 0x06, 0x0f, 0x02, 0x00, 0x08, 0x0a,
-        0x42, 0x00, 0x04, 0x02, 0x00, 0x26, 0x04, 0x21, 0x26, 0x01, 0x08, 0x02, 0x00, 0x2f, 0x04,
-        0x21, 0x4b, 0x00, 0x08, 0x0d, 0x02, 0x00, 0x28, 0x86, 0x31, 0x3c, 0x00, 0x0f, 0x40, 0x00,
-        0x03, 0x02, 0x18, 0x00, 0x06, 0x02, 0x00, 0x0f, 0x62, 0x00, 0x17, 0x06, 0x34, 0x00, 0x2f,
-        0xe3, 0x18, 0xc8, 0x01, 0x0d, 0x13, 0xc3, 0xf2, 0x01, 0x02, 0x84, 0x00, 0x2d, 0x86, 0x31,
-        0xab, 0x00, 0x0f, 0x02, 0x00, 0x00, 0x02, 0x2e, 0x00, 0x02, 0x32, 0x00, 0x0f, 0x1f, 0x00,
-        0x00, 0x0d, 0x02, 0x00, 0x08, 0x32, 0x01, 0x0d, 0x1d, 0x00, 0x0f, 0x02, 0x00, 0x00, 0x04,
-        0x94, 0x00, 0x2f, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x0f, 0x02, 0x00, 0x02, 0x04, 0x0a, 0x02,
-        0x0f, 0xb4, 0x02, 0x15, 0x2e, 0xa2, 0x10, 0xba, 0x00, 0x08, 0xda, 0x01, 0x2f, 0x04, 0x21,
-        0x20, 0x00, 0x01, 0x2f, 0xa2, 0x10, 0x7d, 0x00, 0x02, 0x0f, 0x02, 0x00, 0x10, 0x02, 0x2e,
-        0x01, 0x0e, 0x02, 0x00, 0x0f, 0x3b, 0x00, 0x10, 0x0f, 0x02, 0x00, 0x0e, 0x08, 0xb8, 0x00,
-        0x0e, 0x02, 0x00, 0x0e, 0xc8, 0x00, 0x0f, 0x02, 0x00, 0x1b, 0x0a, 0x52, 0x00, 0x02, 0xca,
-        0x01, 0x02, 0x06, 0x00, 0x06, 0x02, 0x00, 0x0f, 0x52, 0x00, 0x1b, 0x08, 0x02, 0x00, 0x15,
-        0x24, 0x72, 0x04, 0x0c, 0xaa, 0x00, 0x08, 0x64, 0x00, 0x1f, 0x24, 0x5c, 0x03, 0x1a, 0x0a,
-        0x02, 0x00, 0x02, 0xa6, 0x00, 0x0f, 0x06, 0x01, 0x03, 0x02, 0x1c, 0x00, 0x0f, 0xd6, 0x01,
-        0x27, 0x02, 0x02, 0x00, 0x2f, 0x04, 0x21, 0xa8, 0x02, 0x07, 0x2f, 0x00, 0x00, 0x7a, 0x00,
-        0x03, 0x0f, 0x02, 0x00, 0xff, 0x3c, 0x02, 0xc8, 0x01, 0x0f, 0x02, 0x00, 0x03, 0x0f, 0x6a,
-        0x01, 0x2f, 0x0f, 0x58, 0x00, 0x03, 0x06, 0x02, 0x00, 0x0f, 0x62, 0x00, 0x2d, 0x06, 0x4a,
-        0x00, 0x0f, 0x02, 0x00, 0x03, 0x0f, 0x60, 0x00, 0x2d, 0x04, 0x4a, 0x03, 0x2a, 0x04, 0x21,
-        0x02, 0x00, 0x02, 0x6e, 0x00, 0x0f, 0xa0, 0x02, 0x2f, 0x02, 0x4a, 0x00, 0x0e, 0x48, 0x00,
-        0x0f, 0x18, 0x00, 0x05, 0x0f, 0x02, 0x00, 0x1d, 0x0a, 0x48, 0x00, 0x24, 0x00, 0x00, 0x6e,
-        0x03, 0x0a, 0x18, 0x00, 0x0f, 0x02, 0x00, 0x27, 0x08, 0x48, 0x00, 0x02, 0x14, 0x01, 0x02,
-        0x74, 0x01, 0x08, 0x18, 0x00, 0x0f, 0x02, 0x00, 0x29, 0x06, 0x48, 0x00, 0x04, 0xa6, 0x06,
-        0x02, 0xda, 0x06, 0x06, 0x18, 0x00, 0x0f, 0x02, 0x00, 0x2b, 0x06, 0x48, 0x00, 0x0f, 0x60,
-        0x00, 0x4d, 0x0f, 0x20, 0x01, 0x4d, 0x00, 0xaa, 0x0a, 0x0f, 0xe0, 0x01, 0x4b, 0x08, 0x02,
-        0x00, 0x06, 0x38, 0x01, 0x0f, 0x02, 0x00, 0x2b, 0x0f, 0x48, 0x00, 0x05, 0x0f, 0x18, 0x00,
-        0x05, 0x0f, 0x02, 0x00, 0x1d, 0x0f, 0x48, 0x00, 0x05, 0x0f, 0x18, 0x00, 0x05, 0x0f, 0x02,
-        0x00, 0x1d, 0x0f, 0x48, 0x00, 0x05, 0x0f, 0x18, 0x00, 0x05, 0x0f, 0x02, 0x00, 0x1d, 0x0f,
-        0x48, 0x00, 0x05, 0x0f, 0x18, 0x00, 0x05, 0x0f, 0x02, 0x00, 0x1d, 0x0f, 0x48, 0x00, 0x05,
-        0x0f, 0x18, 0x00, 0x05, 0x0f, 0x02, 0x00, 0x1d, 0x0f, 0x48, 0x00, 0x05, 0x0f, 0x18, 0x00,
-        0x05, 0x0f, 0x02, 0x00, 0x1d, 0x0f, 0x48, 0x00, 0x05, 0x0f, 0x18, 0x00, 0x05, 0x0f, 0x02,
-        0x00, 0x1d, 0x0f, 0x48, 0x00, 0x05, 0x0f, 0x18, 0x00, 0x05, 0x0f, 0x02, 0x00, 0x1d, 0x0f,
-        0x48, 0x00, 0x05, 0x0f, 0x18, 0x00, 0x05, 0x0f, 0x02, 0x00, 0x1d, 0x0f, 0x48, 0x00, 0x05,
-        0x0f, 0x18, 0x00, 0x05, 0x0f, 0x02, 0x00, 0x1d, 0x0f, 0x48, 0x00, 0x05, 0x0f, 0x18, 0x00,
-        0x05, 0x0f, 0x02, 0x00, 0x1d, 0x0f, 0x48, 0x00, 0x05, 0x0f, 0x18, 0x00, 0x05, 0x0f, 0x02,
-        0x00, 0x1d, 0x02, 0x48, 0x00, 0x0f, 0x02, 0x00, 0x05, 0x0e, 0x98, 0x07, 0x0f, 0x02, 0x00,
-        0x1d, 0x0f, 0x5a, 0x00, 0x05, 0x04, 0x02, 0x00, 0x0f, 0x50, 0x00, 0x1d, 0x0c, 0x02, 0x00,
-        0x04, 0x48, 0x00, 0x0f, 0x02, 0x00, 0x05, 0x0c, 0x30, 0x00, 0x0f, 0x02, 0x00, 0x1f, 0x02,
-        0x5e, 0x0c, 0x0e, 0x02, 0x00, 0x04, 0xea, 0x07, 0x0f, 0x02, 0x00, 0xcb, 0x1e, 0x00, 0x01,
-        0x00, 0xae, 0x0b, 0x34, 0x58, 0x6e, 0x77, 0x77, 0x6e, 0x57, 0x33, 0x0a, 0x1c, 0x00, 0x0d,
-        0x02, 0x00, 0x44, 0x25, 0x7d, 0xc6, 0xfa, 0x22, 0x01, 0x4d, 0xfa, 0xc5, 0x7b, 0x22, 0x21,
-        0x00, 0x08, 0x02, 0x00, 0x34, 0x01, 0x4a, 0xbe, 0x2c, 0x00, 0x03, 0x02, 0x00, 0x38, 0xfe,
-        0xb9, 0x43, 0x21, 0x00, 0x0a, 0x02, 0x00, 0x21, 0x33, 0xc3, 0x26, 0x00, 0xa1, 0xfd, 0xd4,
-        0xad, 0x8f, 0x88, 0x88, 0x8f, 0xad, 0xd4, 0xfd, 0x0f, 0x00, 0x2a, 0xb8, 0x27, 0x26, 0x00,
-        0x04, 0x02, 0x00, 0xa4, 0x05, 0x82, 0xfc, 0xff, 0xff, 0xff, 0xfa, 0xad, 0x54, 0x10, 0x12,
-        0x00, 0x94, 0x11, 0x55, 0xad, 0xfa, 0xff, 0xff, 0xff, 0xf7, 0x69, 0x11, 0x00, 0x08, 0x02,
-        0x00, 0x88, 0x12, 0xc0, 0xff, 0xff, 0xff, 0xf9, 0x8e, 0x1c, 0x14, 0x00, 0xaa, 0x00, 0x00,
-        0x1c, 0x8f, 0xfa, 0xff, 0xff, 0xff, 0xa1, 0x05, 0x16, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x00,
-        0x98, 0xff, 0xff, 0xff, 0xc5, 0x7b, 0x00, 0x00, 0x62, 0x27, 0xc6, 0xff, 0xff, 0xff, 0x82,
-        0x24, 0x00, 0x08, 0x02, 0x00, 0x58, 0x0a, 0xbf, 0xff, 0x8c, 0x04, 0x11, 0x00, 0x04, 0x02,
-        0x00, 0x4f, 0x04, 0x8d, 0xff, 0xbf, 0x5a, 0x01, 0x01, 0x24, 0x0b, 0x58, 0x22, 0x00, 0x84,
-        0x08, 0x40, 0x5d, 0x73, 0x73, 0x5d, 0x40, 0x08, 0x10, 0x00, 0x24, 0x58, 0x0b, 0x0a, 0x00,
-        0x0f, 0x02, 0x00, 0x01, 0x31, 0x4c, 0xb4, 0xf5, 0x18, 0x01, 0x4f, 0xff, 0xf5, 0xb4, 0x4c,
-        0x20, 0x00, 0x01, 0x0a, 0x02, 0x00, 0x22, 0x38, 0xca, 0x2d, 0x00, 0x02, 0x02, 0x00, 0x2a,
-        0xc9, 0x37, 0x1e, 0x00, 0x0d, 0x02, 0x00, 0x20, 0x6b, 0xf9, 0x21, 0x14, 0x60, 0xd3, 0xa1,
-        0x8c, 0x8c, 0xa1, 0xd4, 0x2b, 0x14, 0x2d, 0xf9, 0x6b, 0x23, 0x00, 0x08, 0x02, 0x00, 0x72,
-        0x07, 0xbb, 0xff, 0xff, 0xf3, 0x8a, 0x1d, 0x13, 0x00, 0x72, 0x1d, 0x8a, 0xf3, 0xff, 0xff,
-        0xbb, 0x07, 0x0d, 0x00, 0x0f, 0x02, 0x00, 0x04, 0x46, 0x09, 0xbb, 0xc9, 0x20, 0x1b, 0x00,
-        0x3f, 0x1b, 0xc3, 0xc1, 0xeb, 0x00, 0x0a, 0x49, 0x00, 0x00, 0x00, 0x08, 0x54, 0x01, 0x15,
-        0x04, 0x24, 0x01, 0x0f, 0x02, 0x00, 0x96, 0x27, 0x45, 0x77, 0x01, 0x00, 0x1f, 0x45, 0xb7,
-        0x00, 0x0e, 0x12, 0x45, 0xa9, 0x01, 0x04, 0x02, 0x00, 0x0f, 0x31, 0x00, 0x0e, 0x14, 0x7e,
-        0x2a, 0x00, 0x02, 0x02, 0x00, 0x1f, 0x7e, 0x61, 0x00, 0x0d, 0x53, 0x80, 0xff, 0xff, 0xc4,
-        0x88, 0x01, 0x00, 0x4f, 0xc4, 0xff, 0xff, 0x80, 0x30, 0x00, 0x10, 0x05, 0x24, 0x00, 0x08,
-        0x0c, 0x00, 0x0f, 0x02, 0x00, 0x05, 0x03, 0x24, 0x00, 0x26, 0x04, 0x04, 0x0c, 0x00, 0x0f,
-        0x02, 0x00, 0x0a, 0x02, 0x30, 0x00, 0x44, 0x5e, 0xf4, 0xf4, 0x5e, 0x0c, 0x00, 0x0f, 0x02,
-        0x00, 0x0b, 0x01, 0x30, 0x00, 0x62, 0x04, 0xf4, 0xff, 0xff, 0xf4, 0x04, 0x0c, 0x00, 0x0f,
-        0x2f, 0x00, 0x0b, 0x02, 0x24, 0x00, 0x0f, 0x30, 0x00, 0x1d, 0x0f, 0x90, 0x00, 0x1d, 0x0f,
-        0xf0, 0x00, 0x1e, 0x02, 0x02, 0x00, 0x0f, 0xc0, 0x00, 0x16, 0x02, 0x2f, 0x00, 0x02, 0xcc,
-        0x00, 0x03, 0x0c, 0x00, 0x0f, 0x02, 0x00, 0x05, 0x08, 0x54, 0x00, 0x08, 0x0c, 0x00, 0x0f,
-        0x02, 0x00, 0x05, 0x08, 0x24, 0x00, 0x08, 0x0c, 0x00, 0x0f, 0x02, 0x00, 0x05, 0x08, 0x24,
-        0x00, 0x08, 0x0c, 0x00, 0x0f, 0x02, 0x00, 0x05, 0x08, 0x24, 0x00, 0x08, 0x0c, 0x00, 0x0f,
-        0x02, 0x00, 0x05, 0x08, 0x24, 0x00, 0x08, 0x0c, 0x00, 0x0f, 0x02, 0x00, 0x05, 0x08, 0x24,
-        0x00, 0x08, 0x0c, 0x00, 0x0f, 0x02, 0x00, 0x05, 0x08, 0x24, 0x00, 0x08, 0x0c, 0x00, 0x0f,
-        0x02, 0x00, 0x05, 0x08, 0x24, 0x00, 0x08, 0x0c, 0x00, 0x0f, 0x02, 0x00, 0x05, 0x08, 0x24,
-        0x00, 0x08, 0x0c, 0x00, 0x0f, 0x02, 0x00, 0x05, 0x08, 0x24, 0x00, 0x08, 0x0c, 0x00, 0x0f,
-        0x02, 0x00, 0x05, 0x08, 0x24, 0x00, 0x08, 0x0c, 0x00, 0x0f, 0x02, 0x00, 0x05, 0x44, 0x80,
-        0xff, 0xff, 0xbb, 0x81, 0x04, 0x1f, 0xbb, 0xc0, 0x03, 0x10, 0x0f, 0x50, 0x04, 0x1d, 0x0f,
-        0xb0, 0x04, 0x1d, 0x33, 0x00, 0x45, 0x83, 0x7e, 0x04, 0x4f, 0x88, 0x88, 0x88, 0x83, 0xdf,
-        0x04, 0x0e, 0x0f, 0x02, 0x00, 0x39, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0xa5, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x1e, 0x00, 0x01,
+        0x00, 0xaf, 0x0b, 0x34, 0x58, 0x6e, 0x77, 0x77, 0x6e, 0x57, 0x33, 0x0a, 0x1d, 0x00, 0x00,
+        0x0c, 0x01, 0x00, 0x53, 0x25, 0x7d, 0xc6, 0xfa, 0xff, 0x01, 0x00, 0x4f, 0xfa, 0xc5, 0x7b,
+        0x22, 0x2d, 0x00, 0x0a, 0x34, 0x01, 0x4a, 0xbe, 0x2c, 0x00, 0x03, 0x01, 0x00, 0x3f, 0xfe,
+        0xb9, 0x43, 0x2f, 0x00, 0x07, 0x21, 0x33, 0xc3, 0x24, 0x00, 0xa1, 0xfd, 0xd4, 0xad, 0x8f,
+        0x88, 0x88, 0x8f, 0xad, 0xd4, 0xfd, 0x0f, 0x00, 0x2f, 0xb8, 0x27, 0x2e, 0x00, 0x03, 0x30,
+        0x05, 0x82, 0xfc, 0x84, 0x00, 0x34, 0xad, 0x54, 0x10, 0x12, 0x00, 0x30, 0x11, 0x55, 0xad,
+        0x9c, 0x00, 0x2f, 0xf7, 0x69, 0x2f, 0x00, 0x01, 0x8a, 0x12, 0xc0, 0xff, 0xff, 0xff, 0xf9,
+        0x8e, 0x1c, 0x16, 0x00, 0x20, 0x1c, 0x8f, 0x32, 0x00, 0x2e, 0xa1, 0x05, 0x30, 0x00, 0x5f,
+        0x98, 0xff, 0xff, 0xff, 0xc5, 0x7b, 0x00, 0x00, 0x6e, 0x27, 0xc6, 0xff, 0xff, 0xff, 0x82,
+        0x18, 0x00, 0x5e, 0x0a, 0xbf, 0xff, 0x8c, 0x04, 0x17, 0x00, 0x6f, 0x00, 0x00, 0x04, 0x8d,
+        0xff, 0xbf, 0x5a, 0x01, 0x01, 0x24, 0x0b, 0x58, 0x0a, 0x00, 0x84, 0x08, 0x40, 0x5d, 0x73,
+        0x73, 0x5d, 0x40, 0x08, 0x10, 0x00, 0x2f, 0x58, 0x0b, 0x2f, 0x00, 0x00, 0x05, 0x01, 0x00,
+        0x32, 0x4c, 0xb4, 0xf5, 0x4c, 0x01, 0x3f, 0xf5, 0xb4, 0x4c, 0x28, 0x00, 0x09, 0x02, 0x01,
+        0x00, 0x28, 0x38, 0xca, 0x7f, 0x01, 0x2f, 0xc9, 0x37, 0x2f, 0x00, 0x0c, 0x20, 0x6b, 0xf9,
+        0x27, 0x00, 0x60, 0xd3, 0xa1, 0x8c, 0x8c, 0xa1, 0xd4, 0x0a, 0x00, 0x2f, 0xf9, 0x6b, 0x2f,
+        0x00, 0x0a, 0x72, 0x07, 0xbb, 0xff, 0xff, 0xf3, 0x8a, 0x1d, 0x0d, 0x00, 0x7f, 0x1d, 0x8a,
+        0xf3, 0xff, 0xff, 0xbb, 0x07, 0x31, 0x00, 0x0a, 0x46, 0x09, 0xbb, 0xc9, 0x20, 0x0e, 0x00,
+        0x3f, 0x1b, 0xc3, 0xc1, 0xeb, 0x00, 0x0a, 0x00, 0x1c, 0x01, 0x09, 0x54, 0x01, 0x15, 0x04,
+        0x24, 0x01, 0x0f, 0x01, 0x00, 0x96, 0x27, 0x45, 0x77, 0x01, 0x00, 0x1f, 0x45, 0x2f, 0x00,
+        0x0f, 0x0a, 0x30, 0x03, 0x0f, 0x31, 0x00, 0x0e, 0x1a, 0x7e, 0x30, 0x00, 0x1f, 0x7e, 0x30,
+        0x00, 0x0d, 0x53, 0x80, 0xff, 0xff, 0xc4, 0x88, 0x01, 0x00, 0x4f, 0xc4, 0xff, 0xff, 0x80,
+        0x30, 0x00, 0x10, 0x05, 0x24, 0x00, 0x08, 0x0c, 0x00, 0x0f, 0x01, 0x00, 0x05, 0x03, 0x24,
+        0x00, 0x10, 0x04, 0xb7, 0x01, 0x0f, 0x30, 0x00, 0x17, 0x4f, 0x5e, 0xf4, 0xf4, 0x5e, 0x30,
+        0x00, 0x18, 0x6f, 0x04, 0xf4, 0xff, 0xff, 0xf4, 0x04, 0x30, 0x00, 0x47, 0x0f, 0x90, 0x00,
+        0x1d, 0x0f, 0xf0, 0x00, 0x1e, 0x0e, 0x0c, 0x00, 0x0f, 0x01, 0x00, 0x05, 0x0f, 0x30, 0x00,
+        0xff, 0xff, 0x32, 0x14, 0xbb, 0x7e, 0x04, 0x1f, 0xbb, 0x30, 0x00, 0x10, 0x0f, 0x50, 0x04,
+        0x1d, 0x0f, 0xb0, 0x04, 0x1d, 0x34, 0x00, 0x45, 0x83, 0x7f, 0x04, 0x3f, 0x88, 0x88, 0x83,
+        0x2f, 0x00, 0x0f, 0x0f, 0x01, 0x00, 0x38, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
 
 };
 
@@ -110,11 +56,11 @@ const lv_image_dsc_t icon_settings_remote = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 48,
                  .h = 48,
-                 .stride = 96,
+                 .stride = 48,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_settings_remote_map),
@@ -20,44 +20,20 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_SETTINGS_REMOTE_24
     uint8_t icon_settings_remote_24_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0x2b, 0x02, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x1b, 0xff, 0x01,
-        0x00, 0x28, 0xe3, 0x18, 0x02, 0x00, 0x2b, 0x04, 0x21, 0x1f, 0x00, 0x09, 0x02, 0x00, 0x42,
-        0x04, 0x21, 0x04, 0x21, 0x2e, 0x00, 0x06, 0x0a, 0x00, 0x49, 0xe3, 0x18, 0xe3, 0x18, 0x25,
-        0x00, 0x03, 0x02, 0x00, 0x22, 0x00, 0x00, 0x1c, 0x00, 0x08, 0x20, 0x00, 0x02, 0x0e, 0x00,
-        0x63, 0xe3, 0x18, 0xe3, 0x18, 0x00, 0x00, 0x27, 0x00, 0x05, 0x02, 0x00, 0x02, 0x5a, 0x00,
-        0x25, 0xa2, 0x10, 0x11, 0x00, 0x03, 0x02, 0x00, 0x22, 0xa2, 0x10, 0x32, 0x00, 0x03, 0x0f,
-        0x00, 0x07, 0x02, 0x00, 0x04, 0x14, 0x00, 0x04, 0x8c, 0x00, 0x24, 0x04, 0x21, 0xbe, 0x00,
-        0x04, 0x1a, 0x00, 0x0e, 0x02, 0x00, 0x02, 0x4c, 0x00, 0x0a, 0x02, 0x00, 0x0e, 0x26, 0x00,
-        0x06, 0x02, 0x00, 0x02, 0x2a, 0x00, 0x11, 0x24, 0x16, 0x01, 0x13, 0x24, 0xfc, 0x00, 0x06,
-        0x1e, 0x00, 0x0f, 0x02, 0x00, 0x01, 0x0a, 0xda, 0x00, 0x0a, 0x0e, 0x00, 0x0f, 0x02, 0x00,
-        0x31, 0x02, 0x28, 0x01, 0x04, 0x02, 0x00, 0x04, 0xf2, 0x00, 0x0f, 0x02, 0x00, 0x07, 0x04,
-        0x2a, 0x00, 0x04, 0x02, 0x00, 0x0f, 0x2a, 0x00, 0x07, 0x02, 0x02, 0x00, 0x02, 0xd0, 0x01,
-        0x44, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0f, 0x02, 0x00, 0x0b, 0x02, 0xce, 0x01, 0x42,
-        0x04, 0x21, 0x04, 0x21, 0xf2, 0x01, 0x0f, 0x2e, 0x00, 0x0b, 0x06, 0x30, 0x00, 0x2f, 0xe3,
-        0x18, 0x30, 0x00, 0x17, 0x04, 0x48, 0x01, 0x02, 0x9c, 0x00, 0x0f, 0x02, 0x00, 0x0b, 0x08,
-        0x24, 0x00, 0x08, 0x0c, 0x00, 0x0f, 0x02, 0x00, 0x05, 0x08, 0x24, 0x00, 0x08, 0x0c, 0x00,
-        0x0f, 0x02, 0x00, 0x05, 0x08, 0x24, 0x00, 0x08, 0x0c, 0x00, 0x0f, 0x02, 0x00, 0x05, 0x08,
-        0x24, 0x00, 0x08, 0x0c, 0x00, 0x0f, 0x02, 0x00, 0x05, 0x08, 0x24, 0x00, 0x08, 0x0c, 0x00,
-        0x0f, 0x02, 0x00, 0x05, 0x08, 0x24, 0x00, 0x08, 0x0c, 0x00, 0x0f, 0x02, 0x00, 0x05, 0x04,
-        0x08, 0x02, 0x04, 0x02, 0x00, 0x0f, 0x28, 0x00, 0x05, 0x04, 0x02, 0x00, 0x0f, 0x70, 0x02,
-        0x1d, 0x0f, 0x02, 0x00, 0x0d, 0x13, 0x00, 0x01, 0x00, 0x83, 0x22, 0x6d, 0x9e, 0xb3, 0xb3,
-        0x9c, 0x6b, 0x20, 0x0f, 0x00, 0x03, 0x02, 0x00, 0xc3, 0x38, 0xba, 0xff, 0xff, 0xe4, 0xca,
-        0xca, 0xe4, 0xff, 0xff, 0xb6, 0x32, 0x13, 0x00, 0xf1, 0x04, 0x00, 0x00, 0x00, 0x03, 0x87,
-        0xfe, 0xe8, 0x75, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x75, 0xe8, 0xfc, 0x77, 0x01, 0x15,
-        0x00, 0x71, 0x00, 0x00, 0x00, 0x28, 0xef, 0x9d, 0x0b, 0x09, 0x00, 0x71, 0x00, 0x00, 0x00,
-        0x0b, 0x9e, 0xef, 0x22, 0x09, 0x00, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
-        0x40, 0x91, 0xb4, 0xb4, 0x91, 0x40, 0x0d, 0x00, 0x05, 0x02, 0x00, 0xa5, 0x1b, 0xbf, 0xff,
-        0xf4, 0xc9, 0xc9, 0xf4, 0xff, 0xbe, 0x1b, 0x13, 0x00, 0x01, 0x02, 0x00, 0xa1, 0x33, 0xe0,
-        0x65, 0x07, 0x00, 0x00, 0x07, 0x66, 0xe0, 0x33, 0x0f, 0x00, 0x06, 0x02, 0x00, 0x12, 0x03,
-        0x0b, 0x00, 0x03, 0x07, 0x00, 0x0f, 0x02, 0x00, 0x0f, 0x21, 0x57, 0xbb, 0x01, 0x00, 0x1c,
-        0x57, 0x2a, 0x00, 0x8c, 0xbe, 0xee, 0xbb, 0xbb, 0xbb, 0xbb, 0xee, 0xbe, 0x18, 0x00, 0x8e,
-        0xbf, 0xbf, 0x00, 0x01, 0x01, 0x00, 0xbf, 0xbf, 0x18, 0x00, 0x4f, 0x01, 0xd2, 0xd2, 0x01,
-        0x18, 0x00, 0x03, 0x1f, 0xd1, 0x18, 0x00, 0x02, 0x21, 0x00, 0x01, 0x4e, 0x00, 0x0b, 0x49,
-        0x00, 0x02, 0x42, 0x00, 0x02, 0x06, 0x00, 0x08, 0x02, 0x00, 0x02, 0x12, 0x00, 0x02, 0x06,
-        0x00, 0x08, 0x02, 0x00, 0x02, 0x12, 0x00, 0x02, 0x06, 0x00, 0x08, 0x02, 0x00, 0x02, 0x12,
-        0x00, 0x02, 0x06, 0x00, 0x08, 0x02, 0x00, 0x02, 0x12, 0x00, 0x02, 0x06, 0x00, 0x08, 0x02,
-        0x00, 0x02, 0x12, 0x00, 0x02, 0x06, 0x00, 0x08, 0x02, 0x00, 0x0f, 0x08, 0x01, 0x05, 0x0f,
-        0x38, 0x01, 0x05, 0x07, 0x02, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x13, 0x00, 0x01,
+        0x00, 0x84, 0x22, 0x6d, 0x9e, 0xb3, 0xb3, 0x9c, 0x6b, 0x20, 0x10, 0x00, 0x02, 0x01, 0x00,
+        0xc6, 0x38, 0xba, 0xff, 0xff, 0xe4, 0xca, 0xca, 0xe4, 0xff, 0xff, 0xb6, 0x32, 0x16, 0x00,
+        0x60, 0x03, 0x87, 0xfe, 0xe8, 0x75, 0x21, 0x0a, 0x00, 0x64, 0x21, 0x75, 0xe8, 0xfc, 0x77,
+        0x01, 0x18, 0x00, 0x44, 0x28, 0xef, 0x9d, 0x0b, 0x0c, 0x00, 0x45, 0x0b, 0x9e, 0xef, 0x22,
+        0x31, 0x00, 0xa3, 0x1a, 0x00, 0x00, 0x00, 0x40, 0x91, 0xb4, 0xb4, 0x91, 0x40, 0x0d, 0x00,
+        0x05, 0x01, 0x00, 0xa8, 0x1b, 0xbf, 0xff, 0xf4, 0xc9, 0xc9, 0xf4, 0xff, 0xbe, 0x1b, 0x16,
+        0x00, 0xca, 0x00, 0x00, 0x33, 0xe0, 0x65, 0x07, 0x00, 0x00, 0x07, 0x66, 0xe0, 0x33, 0x18,
+        0x00, 0x29, 0x00, 0x03, 0x07, 0x00, 0x0f, 0x01, 0x00, 0x0f, 0x21, 0x57, 0xbb, 0x01, 0x00,
+        0x1c, 0x57, 0x18, 0x00, 0x20, 0xbe, 0xee, 0x17, 0x00, 0x2c, 0xee, 0xbe, 0x18, 0x00, 0x50,
+        0xbf, 0xbf, 0x00, 0x01, 0x01, 0x06, 0x00, 0x0d, 0x18, 0x00, 0x4f, 0x01, 0xd2, 0xd2, 0x01,
+        0x18, 0x00, 0x03, 0x1f, 0xd1, 0x18, 0x00, 0x02, 0x21, 0x00, 0x01, 0x06, 0x00, 0x0e, 0x18,
+        0x00, 0x05, 0x06, 0x00, 0x0f, 0x18, 0x00, 0x71, 0x0f, 0x08, 0x01, 0x05, 0x0f, 0x38, 0x01,
+        0x05, 0x07, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
 
 };
 
@@ -65,11 +41,11 @@ const lv_image_dsc_t icon_settings_remote_24 = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 24,
                  .h = 24,
-                 .stride = 48,
+                 .stride = 24,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_settings_remote_24_map),
@@ -20,19 +20,12 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_SOUTH_EAST_20 uint8_t
     icon_south_east_20_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x00, 0x00, 0xb0, 0x04, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0x94, 0x4f, 0x00, 0x00, 0x00, 0x00, 0xab, 0x00, 0x11, 0x11, 0x00, 0x01, 0x00, 0x0f,
-        0x2a, 0x00, 0x73, 0x0f, 0xb4, 0x00, 0x09, 0x01, 0xa7, 0x00, 0x03, 0xd2, 0x00, 0x0f, 0x28,
-        0x00, 0x09, 0x02, 0x1e, 0x00, 0x02, 0xd2, 0x00, 0x04, 0x08, 0x00, 0x0f, 0x02, 0x00, 0x05,
-        0x04, 0x54, 0x00, 0x0f, 0x28, 0x00, 0x0d, 0x02, 0x22, 0x00, 0x02, 0x02, 0x00, 0x0f, 0x4c,
-        0x00, 0x05, 0x04, 0x02, 0x00, 0x02, 0x26, 0x00, 0x0f, 0x28, 0x00, 0x07, 0x04, 0x20, 0x00,
-        0x04, 0x02, 0x00, 0x04, 0x38, 0x00, 0x0c, 0x02, 0x00, 0x04, 0x20, 0x00, 0x04, 0x02, 0x00,
-        0x0c, 0x20, 0x00, 0x0f, 0x02, 0x00, 0x85, 0x04, 0xb0, 0x00, 0x0f, 0x02, 0x00, 0x39, 0x2e,
-        0x13, 0x43, 0x4e, 0x00, 0x3e, 0x43, 0xf2, 0x4c, 0x15, 0x00, 0x3f, 0x48, 0xf2, 0x4f, 0x15,
-        0x00, 0x1b, 0x28, 0xff, 0x15, 0x30, 0x00, 0x02, 0x3f, 0x00, 0x0a, 0x14, 0x00, 0x02, 0x15,
-        0x00, 0x0b, 0x14, 0x00, 0x01, 0x15, 0x00, 0x0c, 0x14, 0x00, 0x4d, 0x00, 0x48, 0xf2, 0x4f,
-        0x14, 0x00, 0x3a, 0x00, 0x4c, 0xf2, 0x14, 0x00, 0x03, 0xb8, 0x01, 0x09, 0x78, 0x00, 0x12,
-        0x11, 0x01, 0x00, 0x18, 0x01, 0x8c, 0x00, 0x0f, 0x02, 0x00, 0x30, 0x50, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x90, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0x40, 0x2e, 0x13, 0x43, 0x14, 0x00, 0x3e, 0x43, 0xf2, 0x4c, 0x15, 0x00, 0x3f, 0x48,
+        0xf2, 0x4f, 0x15, 0x00, 0x1b, 0x2e, 0xff, 0x15, 0x15, 0x00, 0x0a, 0x14, 0x00, 0x02, 0x15,
+        0x00, 0x0b, 0x14, 0x00, 0x01, 0x15, 0x00, 0x0c, 0x14, 0x00, 0x00, 0x15, 0x00, 0x0d, 0x14,
+        0x00, 0x3a, 0x00, 0x4c, 0xf2, 0x14, 0x00, 0x12, 0xff, 0x01, 0x00, 0x09, 0x14, 0x00, 0x12,
+        0x11, 0x01, 0x00, 0x1c, 0x01, 0x3c, 0x00, 0x0f, 0x01, 0x00, 0x2c, 0x50, 0x00, 0x00, 0x00,
         0x00, 0x00,
 
 };
@@ -41,11 +34,11 @@ const lv_image_dsc_t icon_south_east_20 = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 20,
                  .h = 20,
-                 .stride = 40,
+                 .stride = 20,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_south_east_20_map),
@@ -20,21 +20,14 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_SOUTH_WEST_20 uint8_t
     icon_south_west_20_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0xd5, 0x00, 0x00, 0x00, 0xb0, 0x04, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0xa8, 0x4f, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x0f, 0x11, 0x00, 0x01, 0x00, 0x0f,
-        0x28, 0x00, 0x0d, 0x01, 0x25, 0x00, 0x0f, 0x4e, 0x00, 0x0e, 0x0f, 0x26, 0x00, 0x07, 0x08,
-        0x8c, 0x00, 0x0f, 0x26, 0x00, 0x07, 0x02, 0x1c, 0x00, 0x02, 0x8c, 0x00, 0x0f, 0x26, 0x00,
-        0x09, 0x02, 0x1e, 0x00, 0x04, 0x08, 0x00, 0x02, 0x0a, 0x00, 0x0f, 0x02, 0x00, 0x03, 0x02,
-        0x1e, 0x00, 0x0f, 0x4c, 0x00, 0x0b, 0x06, 0x48, 0x00, 0x02, 0x2e, 0x00, 0x0f, 0x02, 0x00,
-        0x09, 0x02, 0x24, 0x00, 0x0f, 0x72, 0x00, 0x09, 0x02, 0x02, 0x00, 0x04, 0x28, 0x00, 0x04,
-        0x02, 0x00, 0x02, 0x16, 0x00, 0x0e, 0x02, 0x00, 0x04, 0x20, 0x00, 0x04, 0x02, 0x00, 0x0e,
-        0x22, 0x00, 0x0f, 0x02, 0x00, 0x8b, 0x04, 0xb8, 0x00, 0x0f, 0x02, 0x00, 0x43, 0x2d, 0x4b,
-        0x35, 0x58, 0x00, 0x3c, 0x4c, 0xf2, 0x4b, 0x14, 0x00, 0x3f, 0x49, 0xf2, 0x4e, 0x13, 0x00,
-        0x0a, 0x97, 0x3c, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xf2, 0x4c, 0x26, 0x00, 0x2e, 0x4b,
-        0xca, 0x39, 0x00, 0x2d, 0x4b, 0xca, 0x13, 0x00, 0x3e, 0x00, 0x4b, 0xca, 0x5f, 0x00, 0x2d,
-        0x4b, 0xca, 0x13, 0x00, 0x39, 0x00, 0x4b, 0xee, 0x5f, 0x00, 0x01, 0x02, 0x00, 0x71, 0x4b,
-        0xff, 0xee, 0xcc, 0xcc, 0xcc, 0xcc, 0x7e, 0x00, 0x04, 0x02, 0x00, 0x21, 0x14, 0x44, 0x01,
-        0x00, 0x14, 0x36, 0x10, 0x00, 0x0f, 0x02, 0x00, 0x38, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x90, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0x4a, 0x2d, 0x4b, 0x35, 0x13, 0x00, 0x3c, 0x4c, 0xf2, 0x4b, 0x13, 0x00, 0x3f, 0x49,
+        0xf2, 0x4e, 0x13, 0x00, 0x0a, 0x20, 0x3c, 0xa2, 0x06, 0x00, 0x37, 0x4c, 0xf2, 0x4c, 0x21,
+        0x00, 0x2e, 0x4b, 0xca, 0x39, 0x00, 0x00, 0x14, 0x00, 0x0c, 0x4c, 0x00, 0x2e, 0x4b, 0xca,
+        0x5f, 0x00, 0x2e, 0x4b, 0xca, 0x72, 0x00, 0x29, 0x4b, 0xee, 0x5f, 0x00, 0x02, 0x14, 0x00,
+        0x61, 0xff, 0xee, 0xcc, 0xcc, 0xcc, 0xcc, 0x7e, 0x00, 0x04, 0x01, 0x00, 0x21, 0x14, 0x44,
+        0x01, 0x00, 0x1c, 0x36, 0x2c, 0x00, 0x0f, 0x01, 0x00, 0x30, 0x50, 0x00, 0x00, 0x00, 0x00,
+        0x00,
 
 };
 
@@ -42,11 +35,11 @@ const lv_image_dsc_t icon_south_west_20 = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 20,
                  .h = 20,
-                 .stride = 40,
+                 .stride = 20,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_south_west_20_map),
@@ -20,97 +20,50 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_TIMER uint8_t
     icon_timer_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0x40, 0x05, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0xd0, 0x2f, 0xe3, 0x18, 0x02, 0x00, 0x03, 0x0f, 0xfb, 0x00, 0x35, 0x0f, 0x5e, 0x00,
-        0x03, 0x0f, 0x60, 0x00, 0x99, 0x2e, 0x04, 0x21, 0x02, 0x00, 0x0f, 0xc0, 0x00, 0x37, 0x0f,
-        0x02, 0x00, 0xff, 0x0e, 0x2c, 0x04, 0x21, 0x42, 0x02, 0x02, 0x12, 0x00, 0x0f, 0x38, 0x01,
-        0x31, 0x0c, 0x5a, 0x00, 0x0c, 0x02, 0x00, 0x04, 0x64, 0x00, 0x26, 0x00, 0x00, 0x0c, 0x00,
-        0x0f, 0x02, 0x00, 0x15, 0x02, 0xa6, 0x00, 0x0f, 0x02, 0x00, 0x0b, 0x42, 0x04, 0x21, 0xc3,
-        0x18, 0x5e, 0x00, 0x4f, 0xe3, 0x18, 0x04, 0x21, 0x5a, 0x00, 0x15, 0x00, 0x96, 0x04, 0x08,
-        0x58, 0x00, 0x04, 0x6a, 0x00, 0x42, 0xa2, 0x10, 0xa2, 0x10, 0x18, 0x00, 0x04, 0x12, 0x00,
-        0x0c, 0x02, 0x00, 0x02, 0x3c, 0x00, 0x0f, 0x02, 0x00, 0x0f, 0x06, 0x38, 0x00, 0x0f, 0xea,
-        0x02, 0x05, 0x2e, 0x04, 0x21, 0x64, 0x00, 0x2f, 0x00, 0x00, 0x5a, 0x00, 0x0f, 0x00, 0x52,
-        0x05, 0x06, 0x3a, 0x00, 0x0f, 0xf4, 0x00, 0x0b, 0x06, 0x86, 0x00, 0x0f, 0x5e, 0x00, 0x19,
-        0x02, 0x2e, 0x00, 0x62, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0x70, 0x00, 0x0f, 0x02, 0x00,
-        0x07, 0x17, 0xc3, 0xfc, 0x04, 0x0f, 0x26, 0x00, 0x07, 0x08, 0x02, 0x00, 0x06, 0xbc, 0x00,
-        0x28, 0x45, 0x29, 0x18, 0x00, 0x04, 0x28, 0x04, 0x0c, 0x48, 0x00, 0x22, 0x45, 0x29, 0x8c,
-        0x00, 0x0f, 0xf2, 0x04, 0x15, 0x02, 0x2a, 0x00, 0x0f, 0xbc, 0x00, 0x01, 0x02, 0x7a, 0x00,
-        0x0e, 0x32, 0x01, 0x04, 0xc4, 0x00, 0x0e, 0x1a, 0x00, 0x0e, 0x02, 0x00, 0x04, 0x5e, 0x00,
-        0x0f, 0x2c, 0x00, 0x01, 0x0f, 0x60, 0x00, 0x05, 0x0f, 0x36, 0x00, 0x0b, 0x0a, 0x02, 0x00,
-        0x04, 0x60, 0x00, 0x0a, 0x16, 0x00, 0x02, 0x02, 0x00, 0x0f, 0x60, 0x00, 0x07, 0x0f, 0x38,
-        0x00, 0x0b, 0x06, 0x02, 0x00, 0x02, 0x42, 0x00, 0x0f, 0xbe, 0x00, 0x03, 0x04, 0x1e, 0x00,
-        0x0f, 0xda, 0x00, 0x01, 0x04, 0x1c, 0x00, 0x0f, 0x84, 0x01, 0x0d, 0x02, 0x22, 0x00, 0x0f,
-        0xbe, 0x00, 0x03, 0x04, 0x44, 0x00, 0x0f, 0x60, 0x00, 0x03, 0x0f, 0x3c, 0x00, 0x0d, 0x02,
-        0x02, 0x00, 0x0f, 0x60, 0x00, 0xff, 0x14, 0x22, 0xa2, 0x10, 0x2e, 0x01, 0x0c, 0x02, 0x00,
-        0x02, 0xfe, 0x01, 0x0f, 0x80, 0x01, 0x05, 0x04, 0xfa, 0x04, 0x0c, 0x36, 0x00, 0x08, 0x02,
-        0x00, 0x02, 0x80, 0x01, 0x0f, 0x60, 0x00, 0x23, 0x13, 0x24, 0x86, 0x06, 0x08, 0x50, 0x00,
-        0x0c, 0x02, 0x00, 0x02, 0x60, 0x00, 0x0f, 0x24, 0x00, 0x05, 0x0f, 0x20, 0x04, 0x03, 0x04,
-        0x02, 0x00, 0x0f, 0x3c, 0x00, 0x0b, 0x02, 0x02, 0x00, 0x0f, 0x24, 0x00, 0x11, 0x0f, 0x02,
-        0x00, 0x05, 0x0f, 0x3c, 0x00, 0x11, 0x0f, 0x24, 0x00, 0x11, 0x0f, 0x02, 0x00, 0x05, 0x02,
-        0x9e, 0x01, 0x0f, 0xfc, 0x00, 0x05, 0x02, 0x02, 0x00, 0x0f, 0x60, 0x00, 0x29, 0x02, 0x3c,
-        0x00, 0x0f, 0xfe, 0x01, 0x05, 0x02, 0x02, 0x00, 0x04, 0x84, 0x00, 0x0f, 0x26, 0x00, 0x0b,
-        0x0f, 0x02, 0x00, 0x01, 0x0f, 0x3a, 0x00, 0x15, 0x0f, 0x86, 0x00, 0x11, 0x0f, 0x02, 0x00,
-        0x01, 0x02, 0x38, 0x00, 0x0f, 0x1e, 0x01, 0x0b, 0x08, 0x46, 0x04, 0x0f, 0x2a, 0x00, 0x0f,
-        0x08, 0x02, 0x00, 0x04, 0x5e, 0x00, 0x0f, 0xf8, 0x00, 0x11, 0x04, 0x2c, 0x00, 0x0f, 0x1c,
-        0x07, 0x0f, 0x04, 0x02, 0x00, 0x04, 0x60, 0x06, 0x0f, 0x94, 0x00, 0x13, 0x04, 0x4a, 0x01,
-        0x0e, 0x20, 0x07, 0x0f, 0x02, 0x00, 0x03, 0x06, 0x20, 0x07, 0x0f, 0xbe, 0x00, 0x11, 0x0a,
-        0x24, 0x01, 0x0f, 0xc4, 0x00, 0x0f, 0x06, 0xbc, 0x00, 0x0f, 0xbe, 0x00, 0x13, 0x02, 0x02,
-        0x00, 0x06, 0xc4, 0x00, 0x0f, 0x36, 0x00, 0x0b, 0x04, 0x4c, 0x01, 0x0f, 0x28, 0x00, 0x0d,
-        0x0e, 0x02, 0x00, 0x02, 0x34, 0x00, 0x02, 0xcc, 0x06, 0x0f, 0x64, 0x00, 0x03, 0x08, 0x60,
-        0x09, 0x0f, 0x1a, 0x01, 0x15, 0x08, 0x02, 0x00, 0x02, 0x5e, 0x00, 0x0a, 0x02, 0x00, 0x04,
-        0x20, 0x0a, 0x08, 0xe0, 0x00, 0x0f, 0xbc, 0x00, 0x1f, 0x04, 0x02, 0x00, 0x0c, 0x46, 0x00,
-        0x0f, 0x02, 0x00, 0x03, 0x0f, 0xbc, 0x00, 0x21, 0x06, 0x02, 0x00, 0x0f, 0x64, 0x00, 0x0b,
-        0x0f, 0x5c, 0x00, 0x2b, 0x04, 0x02, 0x00, 0x02, 0xdc, 0x0d, 0x08, 0xbe, 0x00, 0x02, 0x12,
-        0x00, 0x04, 0x20, 0x00, 0x0f, 0x02, 0x00, 0xff, 0xea, 0x1f, 0x00, 0x01, 0x00, 0x5e, 0x25,
-        0x49, 0x77, 0x01, 0x00, 0x1f, 0x49, 0x7d, 0x00, 0x11, 0x16, 0x9d, 0x9f, 0x02, 0x1f, 0x9d,
-        0x30, 0x00, 0x41, 0x25, 0x54, 0x88, 0x01, 0x00, 0x1f, 0x54, 0x60, 0x00, 0x11, 0x0f, 0x02,
-        0x00, 0x7d, 0xcf, 0x17, 0x63, 0xa2, 0xcd, 0xec, 0xfa, 0xf5, 0xdf, 0xc8, 0x99, 0x54, 0x12,
-        0x9c, 0x00, 0x0f, 0x36, 0x39, 0xb0, 0xfb, 0x50, 0x01, 0x9f, 0xfb, 0xa6, 0x31, 0x00, 0x00,
-        0x00, 0x00, 0x01, 0x4d, 0x38, 0x00, 0x05, 0x26, 0x1f, 0xb0, 0x2d, 0x00, 0x02, 0x02, 0x00,
-        0x7f, 0xb2, 0x1c, 0x00, 0x01, 0x9a, 0xff, 0x80, 0x31, 0x00, 0x03, 0xff, 0x0b, 0x56, 0xf1,
-        0xff, 0xff, 0xff, 0xfc, 0xc2, 0x75, 0x3a, 0x22, 0x0b, 0x0b, 0x22, 0x3b, 0x76, 0xc2, 0xfc,
-        0xff, 0xff, 0xff, 0xef, 0x5e, 0x9a, 0xff, 0xff, 0xff, 0x62, 0x00, 0x02, 0x76, 0x6f, 0xfe,
-        0xff, 0xff, 0xfd, 0xaa, 0x22, 0x4c, 0x00, 0x32, 0x1d, 0x99, 0xfc, 0x66, 0x00, 0x26, 0x9c,
-        0x02, 0x15, 0x00, 0x05, 0x02, 0x00, 0x65, 0x79, 0xff, 0xff, 0xff, 0xdb, 0x30, 0x0f, 0x00,
-        0x01, 0x02, 0x00, 0x20, 0x31, 0xdc, 0xc1, 0x14, 0x21, 0x9a, 0x01, 0x0d, 0x00, 0x0a, 0x02,
-        0x00, 0x6a, 0x56, 0xfe, 0xff, 0xff, 0xbf, 0x13, 0x14, 0x00, 0x8c, 0x00, 0x00, 0x13, 0xbf,
-        0xff, 0xff, 0xff, 0x5e, 0x16, 0x00, 0x91, 0x00, 0x00, 0x00, 0x1f, 0xf1, 0xff, 0xff, 0xbf,
-        0x06, 0x0b, 0x00, 0x54, 0x00, 0x00, 0x4d, 0x99, 0x99, 0xb2, 0x00, 0x63, 0x06, 0xbf, 0xff,
-        0xff, 0xef, 0x1b, 0x18, 0x00, 0x07, 0x02, 0x00, 0x45, 0xb0, 0xff, 0xff, 0xdb, 0x5e, 0x00,
-        0x26, 0x80, 0xff, 0x13, 0x01, 0x57, 0x13, 0xdc, 0xff, 0xff, 0xb2, 0x29, 0x00, 0x02, 0x02,
-        0x00, 0x46, 0x39, 0xff, 0xff, 0xfd, 0xbc, 0x00, 0x08, 0x30, 0x00, 0x56, 0x00, 0x31, 0xfd,
-        0xff, 0xff, 0x1b, 0x00, 0x03, 0x02, 0x00, 0x43, 0xb0, 0xff, 0xff, 0xa0, 0x0b, 0x00, 0x0c,
-        0x30, 0x00, 0x51, 0x00, 0xa2, 0xff, 0xff, 0xa6, 0x17, 0x00, 0x06, 0x02, 0x00, 0x56, 0x17,
-        0xfb, 0xff, 0xfc, 0x1e, 0x0f, 0x00, 0x09, 0x60, 0x00, 0x66, 0x00, 0x1f, 0xfc, 0xff, 0xfb,
-        0x11, 0x1d, 0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0x64, 0xff, 0xff, 0xc1, 0x0a, 0x00, 0x01,
-        0x02, 0x00, 0x0a, 0x30, 0x00, 0x51, 0x00, 0xc3, 0xff, 0xff, 0x53, 0x18, 0x00, 0x05, 0x02,
-        0x00, 0x45, 0xa2, 0xff, 0xff, 0x75, 0x0d, 0x00, 0x0d, 0x30, 0x00, 0x47, 0x77, 0xff, 0xff,
-        0x98, 0x1e, 0x00, 0x71, 0x00, 0x00, 0x00, 0xcd, 0xff, 0xff, 0x3a, 0x09, 0x00, 0x02, 0x02,
-        0x00, 0x0b, 0x60, 0x00, 0x42, 0x3c, 0xff, 0xff, 0xc7, 0x19, 0x00, 0x04, 0x02, 0x00, 0x37,
-        0xec, 0xff, 0xff, 0x08, 0x02, 0x0c, 0x30, 0x00, 0x44, 0x23, 0xff, 0xff, 0xde, 0x2a, 0x00,
-        0x02, 0x02, 0x00, 0x42, 0xf9, 0xff, 0xff, 0x0b, 0x0a, 0x00, 0x01, 0x02, 0x00, 0x0b, 0x30,
-        0x00, 0x41, 0x0b, 0xff, 0xff, 0xf5, 0x18, 0x00, 0x05, 0x02, 0x00, 0x0f, 0x30, 0x00, 0x0b,
-        0x45, 0x0d, 0xff, 0xff, 0xf8, 0x2b, 0x00, 0x01, 0x02, 0x00, 0x0b, 0x90, 0x00, 0x07, 0x10,
-        0x02, 0x03, 0x90, 0x00, 0x12, 0xea, 0x0a, 0x00, 0x04, 0x02, 0x00, 0x0b, 0xf0, 0x00, 0x0b,
-        0x02, 0x00, 0x4a, 0x3c, 0xff, 0xff, 0xcb, 0x13, 0x00, 0x4a, 0xa2, 0xff, 0xff, 0x76, 0x12,
-        0x00, 0x08, 0x02, 0x00, 0x19, 0x78, 0xfd, 0x01, 0x82, 0x00, 0x00, 0x00, 0x00, 0x63, 0xff,
-        0xff, 0xc3, 0x0a, 0x00, 0x0f, 0x02, 0x00, 0x01, 0x4a, 0xc5, 0xff, 0xff, 0x60, 0x18, 0x00,
-        0x5a, 0x17, 0xfb, 0xff, 0xfc, 0x1f, 0x13, 0x00, 0x06, 0x02, 0x00, 0x56, 0x20, 0xfc, 0xff,
-        0xfa, 0x16, 0x0f, 0x00, 0x01, 0x02, 0x00, 0x41, 0xb0, 0xff, 0xff, 0xa1, 0x09, 0x00, 0x0f,
-        0x02, 0x00, 0x00, 0x4c, 0xa3, 0xff, 0xff, 0xaf, 0x17, 0x00, 0x41, 0x39, 0xff, 0xff, 0xfd,
-        0x3d, 0x04, 0x0e, 0x02, 0x00, 0x5d, 0x32, 0xfd, 0xff, 0xff, 0x38, 0x17, 0x00, 0x45, 0xaf,
-        0xff, 0xff, 0xdc, 0x30, 0x03, 0x08, 0x02, 0x00, 0x58, 0x13, 0xdd, 0xff, 0xff, 0xad, 0x11,
-        0x00, 0x02, 0x02, 0x00, 0x27, 0x1e, 0xf0, 0x90, 0x03, 0x07, 0x02, 0x00, 0x57, 0x06, 0xbf,
-        0xff, 0xff, 0xf0, 0xeb, 0x02, 0x05, 0x02, 0x00, 0x1f, 0x54, 0xf0, 0x03, 0x06, 0x25, 0xfe,
-        0x52, 0x25, 0x00, 0x08, 0x02, 0x00, 0x5b, 0x78, 0xff, 0xff, 0xff, 0xdc, 0xc4, 0x00, 0x68,
-        0x32, 0xdc, 0xff, 0xff, 0xff, 0x77, 0x26, 0x00, 0x07, 0x02, 0x00, 0x5d, 0x6f, 0xfe, 0xff,
-        0xff, 0xfe, 0xb0, 0x04, 0x1f, 0xfe, 0x0d, 0x05, 0x04, 0xff, 0x09, 0x00, 0x00, 0x00, 0x53,
-        0xf0, 0xff, 0xff, 0xff, 0xfc, 0xc3, 0x77, 0x3c, 0x24, 0x0b, 0x0b, 0x24, 0x3c, 0x78, 0xc4,
-        0xfc, 0xff, 0xff, 0xff, 0xf0, 0x8d, 0x00, 0x03, 0x02, 0x02, 0x00, 0x22, 0x1e, 0xae, 0x00,
-        0x05, 0x06, 0x02, 0x00, 0x1f, 0xad, 0xeb, 0x00, 0x01, 0x07, 0x02, 0x00, 0x36, 0x38, 0xaf,
-        0xfa, 0x2d, 0x00, 0x2e, 0xfa, 0xaf, 0x78, 0x01, 0x0d, 0x02, 0x00, 0xcd, 0x16, 0x61, 0xa1,
-        0xcb, 0xeb, 0xf9, 0xf9, 0xea, 0xcb, 0xa1, 0x60, 0x16, 0x1d, 0x00, 0x0f, 0x02, 0x00, 0xd9,
-        0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0x83, 0x02, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0x5e, 0x25, 0x49, 0x77, 0x01, 0x00, 0x1f, 0x49, 0x2f, 0x00, 0x10, 0x35, 0x00, 0x9d,
+        0xff, 0x01, 0x00, 0x1f, 0x9d, 0x2f, 0x00, 0x10, 0x0f, 0x30, 0x00, 0x1e, 0x25, 0x54, 0x88,
+        0x01, 0x00, 0x1f, 0x54, 0x2f, 0x00, 0x10, 0x0f, 0x01, 0x00, 0x7e, 0xcf, 0x17, 0x63, 0xa2,
+        0xcd, 0xec, 0xfa, 0xf5, 0xdf, 0xc8, 0x99, 0x54, 0x12, 0x2e, 0x00, 0x0f, 0x36, 0x39, 0xb0,
+        0xfb, 0x20, 0x01, 0x30, 0xfb, 0xa6, 0x31, 0x14, 0x00, 0x2f, 0x01, 0x4d, 0x2e, 0x00, 0x05,
+        0x26, 0x1f, 0xb0, 0x2d, 0x00, 0x02, 0x01, 0x00, 0x7f, 0xb2, 0x1c, 0x00, 0x01, 0x9a, 0xff,
+        0x80, 0x2f, 0x00, 0x03, 0xff, 0x0b, 0x56, 0xf1, 0xff, 0xff, 0xff, 0xfc, 0xc2, 0x75, 0x3a,
+        0x22, 0x0b, 0x0b, 0x22, 0x3b, 0x76, 0xc2, 0xfc, 0xff, 0xff, 0xff, 0xef, 0x5e, 0x9a, 0xff,
+        0xff, 0xff, 0x62, 0x00, 0x02, 0x76, 0x6f, 0xfe, 0xff, 0xff, 0xfd, 0xaa, 0x22, 0x11, 0x00,
+        0x20, 0x1d, 0x99, 0x32, 0x00, 0x5f, 0xff, 0xff, 0xff, 0x9c, 0x02, 0x2f, 0x00, 0x00, 0x6a,
+        0x79, 0xff, 0xff, 0xff, 0xdb, 0x30, 0x14, 0x00, 0x20, 0x31, 0xdc, 0x2f, 0x00, 0x2f, 0x9a,
+        0x01, 0x2f, 0x00, 0x00, 0x6c, 0x56, 0xfe, 0xff, 0xff, 0xbf, 0x13, 0x16, 0x00, 0x6f, 0x13,
+        0xbf, 0xff, 0xff, 0xff, 0x5e, 0x2f, 0x00, 0x00, 0x63, 0x1f, 0xf1, 0xff, 0xff, 0xbf, 0x06,
+        0x0d, 0x00, 0x34, 0x4d, 0x99, 0x99, 0xb2, 0x00, 0x6e, 0x06, 0xbf, 0xff, 0xff, 0xef, 0x1b,
+        0x30, 0x00, 0x45, 0xb0, 0xff, 0xff, 0xdb, 0x5e, 0x00, 0x26, 0x80, 0xff, 0x13, 0x01, 0x5d,
+        0x13, 0xdc, 0xff, 0xff, 0xb2, 0x2f, 0x00, 0x46, 0x39, 0xff, 0xff, 0xfd, 0xbc, 0x00, 0x08,
+        0x30, 0x00, 0x5b, 0x00, 0x31, 0xfd, 0xff, 0xff, 0xd7, 0x00, 0x01, 0x5f, 0x00, 0x16, 0xa0,
+        0x0e, 0x00, 0x09, 0x30, 0x00, 0x5b, 0x00, 0xa2, 0xff, 0xff, 0xa6, 0x2f, 0x00, 0x5f, 0x17,
+        0xfb, 0xff, 0xfc, 0x1e, 0x30, 0x00, 0x05, 0x5a, 0x1f, 0xfc, 0xff, 0xfb, 0x11, 0x30, 0x00,
+        0x47, 0x64, 0xff, 0xff, 0xc1, 0x0f, 0x00, 0x0a, 0x30, 0x00, 0x5a, 0x00, 0xc3, 0xff, 0xff,
+        0x53, 0x30, 0x00, 0x4f, 0xa2, 0xff, 0xff, 0x75, 0x30, 0x00, 0x07, 0x4a, 0x77, 0xff, 0xff,
+        0x98, 0x30, 0x00, 0x4f, 0xcd, 0xff, 0xff, 0x3a, 0x30, 0x00, 0x07, 0x4a, 0x3c, 0xff, 0xff,
+        0xc7, 0x30, 0x00, 0x37, 0xec, 0xff, 0xff, 0x08, 0x02, 0x0c, 0x30, 0x00, 0x4a, 0x23, 0xff,
+        0xff, 0xde, 0x30, 0x00, 0x4f, 0xf9, 0xff, 0xff, 0x0b, 0x30, 0x00, 0x07, 0x4f, 0x0b, 0xff,
+        0xff, 0xf5, 0x30, 0x00, 0x19, 0x4a, 0x0d, 0xff, 0xff, 0xf8, 0x30, 0x00, 0x0b, 0x90, 0x00,
+        0x07, 0x10, 0x02, 0x00, 0x01, 0x00, 0x4a, 0x23, 0xff, 0xff, 0xea, 0x30, 0x00, 0x0b, 0xf0,
+        0x00, 0x0b, 0x01, 0x00, 0x4a, 0x3c, 0xff, 0xff, 0xcb, 0x12, 0x00, 0x4f, 0xa2, 0xff, 0xff,
+        0x76, 0x2e, 0x00, 0x05, 0x39, 0x00, 0x00, 0x78, 0xfd, 0x01, 0x00, 0x01, 0x00, 0x4f, 0x63,
+        0xff, 0xff, 0xc3, 0x2e, 0x00, 0x05, 0x6a, 0x00, 0x00, 0xc5, 0xff, 0xff, 0x60, 0x12, 0x00,
+        0x00, 0x10, 0x02, 0x1f, 0x1f, 0x2f, 0x00, 0x05, 0x5b, 0x20, 0xfc, 0xff, 0xfa, 0x16, 0x14,
+        0x00, 0x4f, 0xb0, 0xff, 0xff, 0xa1, 0x2f, 0x00, 0x04, 0x5c, 0x00, 0xa3, 0xff, 0xff, 0xaf,
+        0x14, 0x00, 0x00, 0xd0, 0x02, 0x01, 0x3d, 0x04, 0x0e, 0x01, 0x00, 0x5d, 0x32, 0xfd, 0xff,
+        0xff, 0x38, 0x16, 0x00, 0x4d, 0xaf, 0xff, 0xff, 0xdc, 0x8e, 0x03, 0x00, 0x01, 0x00, 0x5e,
+        0x13, 0xdd, 0xff, 0xff, 0xad, 0x17, 0x00, 0x27, 0x1e, 0xf0, 0x90, 0x03, 0x07, 0x01, 0x00,
+        0x00, 0x90, 0x03, 0x17, 0xf0, 0xeb, 0x02, 0x05, 0x01, 0x00, 0x1f, 0x54, 0xf0, 0x03, 0x06,
+        0x2f, 0xfe, 0x52, 0x2f, 0x00, 0x00, 0x01, 0x66, 0x01, 0x2b, 0xff, 0xdc, 0xc4, 0x00, 0x10,
+        0x32, 0x50, 0x04, 0x1f, 0x77, 0x2f, 0x00, 0x02, 0x02, 0xb0, 0x04, 0x1d, 0xfe, 0xb0, 0x04,
+        0x1f, 0xfe, 0x0d, 0x05, 0x04, 0x50, 0x00, 0x00, 0x00, 0x53, 0xf0, 0x10, 0x05, 0xa0, 0xc3,
+        0x77, 0x3c, 0x24, 0x0b, 0x0b, 0x24, 0x3c, 0x78, 0xc4, 0xde, 0x04, 0x1f, 0xf0, 0x8d, 0x00,
+        0x03, 0x02, 0x01, 0x00, 0x2c, 0x1e, 0xae, 0x70, 0x05, 0x1f, 0xad, 0xeb, 0x00, 0x01, 0x07,
+        0x01, 0x00, 0x36, 0x38, 0xaf, 0xfa, 0x2d, 0x00, 0x2e, 0xfa, 0xaf, 0x78, 0x01, 0x0d, 0x01,
+        0x00, 0xbc, 0x16, 0x61, 0xa1, 0xcb, 0xeb, 0xf9, 0xf9, 0xea, 0xcb, 0xa1, 0x60, 0x05, 0x02,
+        0x0f, 0x01, 0x00, 0xdb, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
 
 };
 
@@ -118,11 +71,11 @@ const lv_image_dsc_t icon_timer = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 48,
                  .h = 48,
-                 .stride = 96,
+                 .stride = 48,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_timer_map),
@@ -20,47 +20,26 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_TIMER_24 uint8_t
     icon_timer_24_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0x59, 0x02, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0x2e, 0x26, 0xe3, 0x18, 0x02, 0x00, 0x0f, 0x4d, 0x00, 0x11, 0x06, 0x2e, 0x00, 0x0f,
-        0x30, 0x00, 0x13, 0x0f, 0x02, 0x00, 0x1d, 0x44, 0x04, 0x21, 0x04, 0x21, 0x64, 0x00, 0x0f,
-        0x3c, 0x00, 0x0d, 0x06, 0x2a, 0x00, 0x06, 0x02, 0x00, 0x6f, 0xff, 0xff, 0xe3, 0x18, 0x04,
-        0x21, 0x3a, 0x00, 0x01, 0x06, 0x24, 0x00, 0x37, 0xc3, 0x18, 0xc3, 0xf6, 0x00, 0x0f, 0xca,
-        0x00, 0x03, 0x88, 0xe3, 0x18, 0xe3, 0x18, 0x04, 0x21, 0xa2, 0x10, 0x4a, 0x00, 0x2f, 0xa2,
-        0x10, 0x2e, 0x00, 0x05, 0x82, 0x04, 0x21, 0xe3, 0x18, 0x04, 0x21, 0x00, 0x00, 0x2e, 0x00,
-        0x24, 0x04, 0x21, 0x82, 0x00, 0x2f, 0x00, 0x00, 0x32, 0x00, 0x03, 0x46, 0xe3, 0x18, 0xe3,
-        0x18, 0x5c, 0x00, 0x08, 0x82, 0x00, 0x11, 0x24, 0xfe, 0x00, 0x02, 0x48, 0x00, 0x04, 0x02,
-        0x00, 0x02, 0xe8, 0x00, 0x04, 0x0e, 0x00, 0x0a, 0x30, 0x00, 0x0e, 0x1e, 0x00, 0x0e, 0x12,
-        0x00, 0x0e, 0x3e, 0x00, 0x04, 0xa0, 0x00, 0x02, 0x02, 0x00, 0x62, 0xe3, 0x18, 0xe3, 0x18,
-        0xc3, 0x18, 0x0c, 0x00, 0x0e, 0x60, 0x00, 0x02, 0xf6, 0x00, 0x02, 0x1a, 0x00, 0x02, 0x02,
-        0x00, 0x0a, 0xbe, 0x00, 0x08, 0xf0, 0x00, 0x00, 0x90, 0x02, 0x0e, 0x30, 0x00, 0x0c, 0xc0,
-        0x00, 0x0a, 0x02, 0x00, 0x0e, 0x22, 0x01, 0x0f, 0x30, 0x00, 0x0b, 0x02, 0x6c, 0x01, 0x0e,
-        0x44, 0x00, 0x06, 0x50, 0x01, 0x08, 0x02, 0x00, 0x0f, 0x50, 0x01, 0x01, 0x02, 0x44, 0x00,
-        0x24, 0xe3, 0x18, 0xb0, 0x01, 0x06, 0x02, 0x00, 0x02, 0xb0, 0x01, 0x0c, 0x5e, 0x00, 0x04,
-        0x14, 0x01, 0x39, 0xe3, 0x18, 0x24, 0x5a, 0x02, 0x02, 0x5c, 0x00, 0x0a, 0x1c, 0x01, 0x06,
-        0x02, 0x00, 0x02, 0xd8, 0x00, 0x86, 0x04, 0x21, 0xe3, 0x18, 0xa2, 0x10, 0xa2, 0x10, 0xd8,
-        0x02, 0x06, 0x22, 0x00, 0x0c, 0x02, 0x00, 0x02, 0xf8, 0x00, 0x08, 0x02, 0x00, 0x0f, 0x8a,
-        0x00, 0x01, 0x0a, 0x02, 0x00, 0x26, 0x04, 0x21, 0x02, 0x00, 0x0a, 0x1a, 0x00, 0x0f, 0x02,
-        0x00, 0x51, 0x1f, 0x00, 0x01, 0x00, 0x0d, 0x6e, 0x97, 0xbb, 0xbb, 0xbb, 0xbb, 0x97, 0x26,
-        0x00, 0x0f, 0x18, 0x00, 0x05, 0x0f, 0x02, 0x00, 0x05, 0x6c, 0x18, 0x58, 0x72, 0x74, 0x5a,
-        0x19, 0x1e, 0x00, 0x30, 0x2f, 0xb6, 0xfd, 0x02, 0x05, 0x66, 0xfe, 0xb6, 0x34, 0x00, 0x7a,
-        0x20, 0x1d, 0x00, 0xe5, 0x6b, 0xfb, 0xe6, 0x76, 0x2b, 0x0a, 0x0a, 0x2b, 0x77, 0xe7, 0xfb,
-        0xbe, 0xff, 0x7a, 0x18, 0x00, 0x42, 0x6b, 0xff, 0xaa, 0x0c, 0x0d, 0x00, 0x42, 0x0c, 0xab,
-        0xff, 0xbe, 0x0a, 0x00, 0xf1, 0x04, 0x00, 0x00, 0x00, 0x30, 0xfb, 0xaa, 0x01, 0x00, 0x00,
-        0x00, 0x99, 0x99, 0x00, 0x00, 0x00, 0x01, 0xac, 0xfb, 0x33, 0x15, 0x00, 0x51, 0x00, 0x00,
-        0x00, 0xb6, 0xe6, 0x2e, 0x00, 0x91, 0xbf, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xe8, 0xb5,
-        0x15, 0x00, 0x51, 0x00, 0x00, 0x18, 0xfd, 0x76, 0x0a, 0x00, 0x02, 0x18, 0x00, 0x41, 0x00,
-        0x78, 0xfe, 0x1a, 0x0f, 0x00, 0x41, 0x00, 0x58, 0xff, 0x2b, 0x09, 0x00, 0x03, 0x18, 0x00,
-        0x31, 0x2d, 0xff, 0x58, 0x0f, 0x00, 0x41, 0x00, 0x74, 0xff, 0x0a, 0x09, 0x00, 0x03, 0x18,
-        0x00, 0x31, 0x0b, 0xff, 0x75, 0x0f, 0x00, 0x41, 0x00, 0x73, 0xff, 0x0b, 0x09, 0x00, 0x01,
-        0x78, 0x00, 0x51, 0x00, 0x00, 0x0c, 0xff, 0x73, 0x0f, 0x00, 0x05, 0x48, 0x00, 0x03, 0x02,
-        0x00, 0x32, 0x2d, 0xff, 0x56, 0x0a, 0x00, 0x32, 0x18, 0xfd, 0x77, 0x09, 0x00, 0x02, 0x02,
-        0x00, 0x32, 0x79, 0xfd, 0x17, 0x09, 0x00, 0x31, 0x00, 0xb6, 0xe7, 0xa8, 0x00, 0x02, 0x02,
-        0x00, 0x06, 0xa8, 0x00, 0x52, 0x00, 0x2f, 0xfb, 0xab, 0x01, 0x15, 0x00, 0x64, 0x00, 0x00,
-        0x01, 0xac, 0xfa, 0x2e, 0x0c, 0x00, 0x52, 0x00, 0x6b, 0xff, 0xac, 0x0d, 0x0d, 0x00, 0x42,
-        0x0d, 0xac, 0xff, 0x6b, 0x0a, 0x00, 0x01, 0x02, 0x00, 0xc1, 0x6b, 0xfb, 0xe8, 0x78, 0x2d,
-        0x0b, 0x0b, 0x2e, 0x79, 0xe8, 0xfa, 0x6a, 0x11, 0x00, 0x04, 0x02, 0x00, 0x12, 0x2e, 0x68,
-        0x01, 0x26, 0xfd, 0xb6, 0x45, 0x00, 0x03, 0x02, 0x00, 0x63, 0x16, 0x57, 0x71, 0x71, 0x57,
-        0x16, 0x0d, 0x00, 0x0f, 0x02, 0x00, 0x1a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0x16, 0x01, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0x0d, 0x6f, 0x97, 0xbb, 0xbb, 0xbb, 0xbb, 0x97, 0x18, 0x00, 0x17, 0x0f, 0x01, 0x00,
+        0x05, 0x6c, 0x18, 0x58, 0x72, 0x74, 0x5a, 0x19, 0x16, 0x00, 0xd6, 0x2f, 0xb6, 0xfd, 0xff,
+        0xff, 0xff, 0xff, 0xfe, 0xb6, 0x34, 0x00, 0x7a, 0x20, 0x17, 0x00, 0xe6, 0x6b, 0xfb, 0xe6,
+        0x76, 0x2b, 0x0a, 0x0a, 0x2b, 0x77, 0xe7, 0xfb, 0xbe, 0xff, 0x7a, 0x17, 0x00, 0x32, 0xff,
+        0xaa, 0x0c, 0x0a, 0x00, 0x45, 0x0c, 0xab, 0xff, 0xbe, 0x17, 0x00, 0xf4, 0x01, 0x30, 0xfb,
+        0xaa, 0x01, 0x00, 0x00, 0x00, 0x99, 0x99, 0x00, 0x00, 0x00, 0x01, 0xac, 0xfb, 0x33, 0x18,
+        0x00, 0x21, 0xb6, 0xe6, 0x2e, 0x00, 0x20, 0xbf, 0xbf, 0x06, 0x00, 0x33, 0x0d, 0xe8, 0xb5,
+        0x17, 0x00, 0x31, 0x18, 0xfd, 0x76, 0x08, 0x00, 0x02, 0x18, 0x00, 0x42, 0x00, 0x78, 0xfe,
+        0x1a, 0x18, 0x00, 0x38, 0x58, 0xff, 0x2b, 0x18, 0x00, 0x32, 0x2d, 0xff, 0x58, 0x18, 0x00,
+        0x38, 0x74, 0xff, 0x0a, 0x18, 0x00, 0x32, 0x0b, 0xff, 0x75, 0x18, 0x00, 0x31, 0x73, 0xff,
+        0x0b, 0x08, 0x00, 0x01, 0x78, 0x00, 0x5a, 0x00, 0x00, 0x0c, 0xff, 0x73, 0x48, 0x00, 0x03,
+        0x01, 0x00, 0x32, 0x2d, 0xff, 0x56, 0x09, 0x00, 0x38, 0x18, 0xfd, 0x77, 0x18, 0x00, 0x33,
+        0x79, 0xfd, 0x17, 0x0a, 0x00, 0x23, 0xb6, 0xe7, 0xd6, 0x00, 0x00, 0x01, 0x00, 0x06, 0xa8,
+        0x00, 0x40, 0x00, 0x2f, 0xfb, 0xab, 0xd8, 0x00, 0x01, 0x01, 0x00, 0x45, 0x01, 0xac, 0xfa,
+        0x2e, 0x24, 0x00, 0x43, 0x6b, 0xff, 0xac, 0x0d, 0x2e, 0x00, 0x36, 0xac, 0xff, 0x6b, 0x3c,
+        0x00, 0xd7, 0x00, 0x6b, 0xfb, 0xe8, 0x78, 0x2d, 0x0b, 0x0b, 0x2e, 0x79, 0xe8, 0xfa, 0x6a,
+        0x17, 0x00, 0x32, 0x00, 0x00, 0x2e, 0x68, 0x01, 0x26, 0xfd, 0xb6, 0x45, 0x00, 0x03, 0x01,
+        0x00, 0x6c, 0x16, 0x57, 0x71, 0x71, 0x57, 0x16, 0x16, 0x00, 0x0f, 0x01, 0x00, 0x11, 0x50,
+        0x00, 0x00, 0x00, 0x00, 0x00,
 
 };
 
@@ -68,11 +47,11 @@ const lv_image_dsc_t icon_timer_24 = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 24,
                  .h = 24,
-                 .stride = 48,
+                 .stride = 24,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_timer_24_map),
@@ -20,30 +20,18 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_UNDO uint8_t
     icon_undo_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0x5a, 0x01, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0xbc, 0x4f, 0x04, 0x21, 0xe3, 0x18, 0xd3, 0x00, 0x17, 0x8f, 0x04, 0x21, 0xe3, 0x18,
-        0xe3, 0x18, 0x86, 0x31, 0x32, 0x00, 0x13, 0x22, 0x24, 0x21, 0x30, 0x00, 0x0f, 0x2e, 0x00,
-        0x41, 0x02, 0x5a, 0x00, 0x46, 0xe3, 0x18, 0x04, 0x21, 0x02, 0x00, 0x2f, 0xe3, 0x18, 0x6e,
-        0x00, 0x07, 0x02, 0x1c, 0x00, 0x0f, 0x02, 0x00, 0x03, 0x2f, 0x24, 0x21, 0xa2, 0x00, 0x01,
-        0x04, 0x2c, 0x00, 0x08, 0x1c, 0x00, 0x22, 0xa2, 0x10, 0x16, 0x00, 0x28, 0x00, 0x00, 0x16,
-        0x00, 0x04, 0x02, 0x00, 0x02, 0x1c, 0x00, 0x0a, 0x32, 0x00, 0x04, 0xaa, 0x00, 0x04, 0x24,
-        0x00, 0x0a, 0x02, 0x00, 0x02, 0x32, 0x00, 0x0a, 0x50, 0x01, 0x5f, 0x00, 0x00, 0xe3, 0x18,
-        0x04, 0x92, 0x00, 0x02, 0x00, 0x7c, 0x02, 0x0f, 0x1c, 0x00, 0x01, 0x0f, 0xc4, 0x01, 0x1b,
-        0x02, 0x36, 0x01, 0x02, 0x4e, 0x00, 0x0f, 0x02, 0x00, 0x11, 0x02, 0x58, 0x01, 0x0f, 0x2a,
-        0x00, 0x11, 0x02, 0xce, 0x00, 0x0e, 0x02, 0x01, 0x06, 0x02, 0x00, 0x02, 0x1e, 0x00, 0x0c,
-        0x02, 0x00, 0x0f, 0x4e, 0x01, 0x03, 0x04, 0xee, 0x00, 0x06, 0x02, 0x00, 0x0f, 0xba, 0x00,
-        0x1d, 0x0f, 0x02, 0x00, 0xc1, 0x1f, 0x00, 0x01, 0x00, 0x54, 0x2f, 0x16, 0x2a, 0x69, 0x00,
-        0x02, 0x4f, 0x16, 0xd3, 0xde, 0x05, 0x19, 0x00, 0x00, 0x4f, 0x15, 0xd2, 0xf5, 0x41, 0x17,
-        0x00, 0x17, 0x51, 0x16, 0xd3, 0xff, 0xd7, 0xaa, 0x01, 0x00, 0x37, 0xa6, 0x8a, 0x3c, 0x37,
-        0x00, 0x51, 0x2a, 0xe9, 0xff, 0xec, 0xdd, 0x01, 0x00, 0x56, 0xe1, 0xfd, 0xff, 0xae, 0x0d,
-        0x1a, 0x00, 0x42, 0x2c, 0xe9, 0xe2, 0x23, 0x0e, 0x00, 0x52, 0x0c, 0x82, 0xfa, 0xb8, 0x01,
-        0x0b, 0x00, 0x0a, 0x19, 0x00, 0x42, 0x00, 0x68, 0xff, 0x4e, 0x14, 0x00, 0x01, 0x02, 0x00,
-        0x33, 0x2c, 0xe9, 0xda, 0xa8, 0x00, 0x31, 0x03, 0xec, 0x99, 0x12, 0x00, 0x03, 0x02, 0x00,
-        0x23, 0x2c, 0x48, 0x09, 0x00, 0x34, 0x00, 0xd2, 0xad, 0x0a, 0x00, 0x09, 0x02, 0x00, 0x39,
-        0x09, 0xf3, 0x90, 0x10, 0x00, 0x04, 0x02, 0x00, 0x34, 0x89, 0xff, 0x3a, 0x0b, 0x00, 0x06,
-        0x02, 0x00, 0x56, 0x09, 0x35, 0xad, 0xff, 0x96, 0x0f, 0x00, 0x34, 0x00, 0x00, 0xcb, 0x74,
-        0x02, 0x38, 0xf8, 0x82, 0x03, 0x18, 0x00, 0x21, 0x6c, 0x88, 0x01, 0x00, 0x38, 0x7d, 0x5e,
-        0x18, 0x16, 0x00, 0x0f, 0x02, 0x00, 0x5b, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0x54, 0x2f, 0x16, 0x2a, 0x17, 0x00, 0x03, 0x3f, 0xd3, 0xde, 0x05, 0x17, 0x00, 0x00,
+        0x4f, 0x15, 0xd2, 0xf5, 0x41, 0x17, 0x00, 0x17, 0x51, 0x16, 0xd3, 0xff, 0xd7, 0xaa, 0x01,
+        0x00, 0x37, 0xa6, 0x8a, 0x3c, 0x18, 0x00, 0x51, 0x2a, 0xe9, 0xff, 0xec, 0xdd, 0x01, 0x00,
+        0x56, 0xe1, 0xfd, 0xff, 0xae, 0x0d, 0x19, 0x00, 0x42, 0x2c, 0xe9, 0xe2, 0x23, 0x0a, 0x00,
+        0x5f, 0x0c, 0x82, 0xfa, 0xb8, 0x01, 0x19, 0x00, 0x01, 0x47, 0x00, 0x68, 0xff, 0x4e, 0x4b,
+        0x00, 0x33, 0x2c, 0xe9, 0xda, 0xa8, 0x00, 0x37, 0x03, 0xec, 0x99, 0x18, 0x00, 0x34, 0x00,
+        0x2c, 0x48, 0x0a, 0x00, 0x28, 0xd2, 0xad, 0x18, 0x00, 0x05, 0x01, 0x00, 0x3f, 0x09, 0xf3,
+        0x90, 0x18, 0x00, 0x02, 0x3e, 0x89, 0xff, 0x3a, 0x15, 0x00, 0x58, 0x09, 0x35, 0xad, 0xff,
+        0x96, 0x11, 0x00, 0x23, 0xcb, 0xff, 0x01, 0x00, 0x38, 0xf8, 0x82, 0x03, 0x18, 0x00, 0x21,
+        0x6c, 0x88, 0x01, 0x00, 0x3d, 0x7d, 0x5e, 0x18, 0x44, 0x00, 0x0f, 0x01, 0x00, 0x56, 0x50,
+        0x00, 0x00, 0x00, 0x00, 0x00,
 
 };
 
@@ -51,11 +39,11 @@ const lv_image_dsc_t icon_undo = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 24,
                  .h = 24,
-                 .stride = 48,
+                 .stride = 24,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_undo_map),
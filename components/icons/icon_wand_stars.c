@@ -20,103 +20,53 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_WAND_STARS uint8_t
     icon_wand_stars_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0x9b, 0x05, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0xff, 0xf7, 0x4f, 0xe3, 0x18, 0x04, 0x21, 0x0d, 0x02, 0x49, 0x8f, 0x24, 0x21, 0xe3,
-        0x18, 0xe3, 0x18, 0x45, 0x29, 0x64, 0x00, 0x47, 0x22, 0xe3, 0x18, 0x02, 0x00, 0x0f, 0x62,
-        0x00, 0x07, 0x2f, 0x00, 0x00, 0x1c, 0x00, 0x07, 0x04, 0x02, 0x00, 0x2f, 0x04, 0x21, 0x08,
-        0x01, 0x05, 0x02, 0x5e, 0x00, 0x0f, 0x28, 0x01, 0x05, 0x4f, 0x04, 0x21, 0x04, 0x21, 0x7c,
-        0x00, 0x09, 0x02, 0x02, 0x00, 0x11, 0x04, 0x06, 0x01, 0x0f, 0x28, 0x00, 0x03, 0x04, 0x60,
-        0x00, 0x0e, 0x20, 0x00, 0x22, 0xe3, 0x18, 0x38, 0x00, 0x0f, 0x9a, 0x00, 0x05, 0x04, 0x02,
-        0x00, 0x02, 0x26, 0x00, 0x02, 0x02, 0x00, 0x04, 0x14, 0x00, 0x06, 0x02, 0x00, 0x02, 0x18,
-        0x00, 0x04, 0x02, 0x00, 0x02, 0x18, 0x00, 0x24, 0x24, 0x21, 0x5c, 0x00, 0x5f, 0xe3, 0x18,
-        0xe3, 0x18, 0x24, 0x02, 0x02, 0x0c, 0x02, 0x26, 0x00, 0x04, 0x02, 0x00, 0x02, 0x42, 0x00,
-        0x06, 0x02, 0x00, 0x08, 0x7e, 0x00, 0x02, 0x28, 0x01, 0x02, 0x08, 0x00, 0x06, 0x02, 0x00,
-        0x06, 0x2c, 0x00, 0x0f, 0x02, 0x00, 0x03, 0x08, 0x32, 0x00, 0x0e, 0xac, 0x01, 0x06, 0x48,
-        0x00, 0x0f, 0x02, 0x00, 0x05, 0x0f, 0x56, 0x00, 0x03, 0x08, 0x02, 0x00, 0x04, 0x3a, 0x00,
-        0x0e, 0x5e, 0x00, 0x06, 0x1c, 0x00, 0x24, 0xa2, 0x10, 0x26, 0x00, 0x02, 0xc6, 0x00, 0x04,
-        0x96, 0x00, 0x08, 0x48, 0x00, 0x0f, 0x02, 0x00, 0x07, 0x0f, 0x5e, 0x00, 0x05, 0x06, 0xde,
-        0x00, 0x42, 0xff, 0xff, 0x00, 0x00, 0x5c, 0x00, 0x02, 0x2c, 0x00, 0x02, 0x08, 0x00, 0x0f,
-        0xdc, 0x01, 0x0d, 0x0f, 0x02, 0x00, 0x0f, 0x0a, 0xa8, 0x00, 0x04, 0xce, 0x01, 0x02, 0x5e,
-        0x00, 0x04, 0x0e, 0x00, 0x0f, 0x02, 0x00, 0x25, 0x06, 0x06, 0x01, 0x0c, 0x08, 0x01, 0x02,
-        0x60, 0x00, 0x0f, 0xbe, 0x00, 0x2b, 0x02, 0x44, 0x00, 0x04, 0x02, 0x00, 0x08, 0xa4, 0x00,
-        0x04, 0x14, 0x00, 0x0a, 0x16, 0x00, 0x0f, 0x02, 0x00, 0x19, 0x04, 0x16, 0x01, 0x04, 0x02,
-        0x00, 0x0a, 0x3c, 0x00, 0x04, 0x16, 0x00, 0x0f, 0xc0, 0x00, 0x23, 0x04, 0xbc, 0x01, 0x04,
-        0x02, 0x00, 0x0f, 0x56, 0x02, 0x01, 0x06, 0x80, 0x00, 0x0a, 0x7a, 0x00, 0x0f, 0x02, 0x00,
-        0x0f, 0x06, 0x3a, 0x00, 0x06, 0x02, 0x00, 0x0e, 0x62, 0x00, 0x06, 0x84, 0x00, 0x0f, 0xc4,
-        0x00, 0x1b, 0x06, 0x54, 0x00, 0x0e, 0x02, 0x00, 0x0a, 0x9c, 0x00, 0x08, 0x10, 0x03, 0x0a,
-        0x1a, 0x00, 0x0f, 0x02, 0x00, 0x0d, 0x2f, 0x00, 0x00, 0xc4, 0x00, 0x01, 0x04, 0x46, 0x00,
-        0x04, 0x1c, 0x00, 0x08, 0x5c, 0x02, 0x0f, 0xc4, 0x00, 0x1b, 0x04, 0x02, 0x00, 0x06, 0x04,
-        0x01, 0x02, 0x02, 0x00, 0x08, 0xce, 0x03, 0x0c, 0x02, 0x00, 0x0f, 0x62, 0x00, 0x31, 0x2c,
-        0x04, 0x21, 0x72, 0x00, 0x06, 0x02, 0x00, 0x2e, 0x04, 0x21, 0xa4, 0x01, 0x0f, 0x02, 0x00,
-        0x0d, 0x0c, 0x4e, 0x00, 0x0a, 0x12, 0x01, 0x06, 0x5c, 0x00, 0x04, 0x02, 0x00, 0x0f, 0x50,
-        0x00, 0x0d, 0x0a, 0x02, 0x00, 0x0c, 0x5e, 0x00, 0x06, 0x02, 0x00, 0x0f, 0x0c, 0x01, 0x03,
-        0x0f, 0x06, 0x06, 0x0d, 0x0a, 0x02, 0x00, 0x08, 0x5e, 0x00, 0x0c, 0xf0, 0x01, 0x0f, 0x60,
-        0x00, 0x03, 0x0f, 0x02, 0x00, 0x19, 0x0a, 0x5e, 0x00, 0x0a, 0x10, 0x00, 0x0f, 0x08, 0x01,
-        0x1d, 0x0e, 0x02, 0x00, 0x0c, 0x5e, 0x00, 0x08, 0x38, 0x02, 0x0f, 0xbc, 0x00, 0x3f, 0x02,
-        0x02, 0x00, 0x04, 0x7e, 0x01, 0x0f, 0x60, 0x00, 0x2d, 0x0f, 0xbc, 0x00, 0x01, 0x0a, 0x66,
-        0x06, 0x0f, 0x02, 0x00, 0x29, 0x0f, 0x5e, 0x00, 0x05, 0x02, 0x1a, 0x00, 0x0f, 0xe4, 0x02,
-        0x21, 0x08, 0x02, 0x00, 0x0f, 0x5e, 0x00, 0x07, 0x04, 0xc2, 0x00, 0x02, 0x0a, 0x00, 0x0f,
-        0x02, 0x00, 0x23, 0x0f, 0x5e, 0x00, 0x0b, 0x2e, 0xff, 0xff, 0x5e, 0x00, 0x2e, 0x00, 0x00,
-        0x14, 0x00, 0x0f, 0x02, 0x00, 0x05, 0x0f, 0x5e, 0x00, 0x0d, 0x0e, 0x02, 0x00, 0x04, 0x32,
-        0x00, 0x0e, 0x1a, 0x00, 0x0e, 0x02, 0x00, 0x04, 0x2c, 0x00, 0x02, 0x1a, 0x08, 0x0e, 0x20,
-        0x00, 0x0e, 0x02, 0x00, 0x08, 0x32, 0x00, 0x0e, 0x1e, 0x00, 0x0a, 0x02, 0x00, 0x06, 0x2c,
-        0x00, 0x0f, 0xc2, 0x01, 0x17, 0x02, 0x8c, 0x00, 0x02, 0x02, 0x00, 0x0f, 0xb4, 0x02, 0x0d,
-        0x04, 0xac, 0x04, 0x0f, 0x5e, 0x00, 0x17, 0x0f, 0x60, 0x00, 0x1b, 0x02, 0x86, 0x00, 0x0f,
-        0x06, 0x07, 0x01, 0x0f, 0x02, 0x00, 0x09, 0x06, 0x96, 0x00, 0x0f, 0x26, 0x00, 0x09, 0x02,
-        0x02, 0x00, 0x0f, 0xbc, 0x00, 0x1b, 0x04, 0x02, 0x00, 0x02, 0x28, 0x0a, 0x04, 0x0e, 0x00,
-        0x0f, 0x02, 0x00, 0xff, 0xff, 0x9b, 0x1f, 0x00, 0x01, 0x00, 0xf1, 0x2f, 0x19, 0x80, 0x06,
-        0x01, 0x1b, 0x4f, 0x07, 0xff, 0x9d, 0x06, 0x32, 0x00, 0x1a, 0x49, 0xf4, 0xff, 0xbf, 0x12,
-        0x31, 0x00, 0x19, 0x02, 0x0e, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x79, 0x08, 0x00,
-        0x01, 0x02, 0x00, 0x51, 0xe2, 0xff, 0xff, 0xda, 0x26, 0x0a, 0x00, 0x01, 0x02, 0x00, 0x31,
-        0x16, 0x78, 0xad, 0x08, 0x00, 0x07, 0x02, 0x00, 0x46, 0x1d, 0xdc, 0xff, 0x8f, 0x0f, 0x00,
-        0x63, 0xcf, 0xff, 0xff, 0xff, 0xee, 0x42, 0x10, 0x00, 0x53, 0x33, 0x99, 0xf6, 0xff, 0x68,
-        0x0c, 0x00, 0x04, 0x02, 0x00, 0x47, 0x1d, 0xdc, 0xff, 0xff, 0x31, 0x00, 0x10, 0xbc, 0xf7,
-        0x13, 0xd4, 0xfb, 0x6b, 0x00, 0x00, 0x00, 0x0e, 0x66, 0xd2, 0xff, 0xff, 0xff, 0xf3, 0x0e,
-        0x29, 0x00, 0x03, 0x02, 0x00, 0x11, 0xbf, 0xc4, 0x04, 0x13, 0x54, 0x0e, 0x00, 0xc1, 0x00,
-        0xa9, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0x8c, 0x37, 0x9e, 0xf5, 0x19, 0x00, 0x14, 0x9b,
-        0x19, 0x00, 0x04, 0x02, 0x00, 0x65, 0x1f, 0xde, 0xff, 0xff, 0xff, 0x9b, 0xd6, 0x00, 0x51,
-        0x97, 0xff, 0xff, 0x7c, 0xcc, 0x2a, 0x00, 0x02, 0x02, 0x00, 0x14, 0x34, 0x28, 0x00, 0x05,
-        0x02, 0x00, 0x55, 0x22, 0xe2, 0xff, 0x97, 0x01, 0x0e, 0x00, 0x61, 0x84, 0xff, 0xff, 0x74,
-        0x0c, 0xb0, 0x2c, 0x00, 0x55, 0xca, 0xc2, 0xff, 0xff, 0xcd, 0x19, 0x00, 0x06, 0x02, 0x00,
-        0x26, 0x22, 0x83, 0x2f, 0x00, 0xf6, 0x02, 0x00, 0x71, 0xff, 0xff, 0x87, 0x00, 0x02, 0x87,
-        0xff, 0xf3, 0x9a, 0x33, 0x01, 0xda, 0xff, 0xff, 0x67, 0x27, 0x00, 0x0f, 0x02, 0x00, 0x03,
+        0x02, 0x00, 0x00, 0x00, 0xa7, 0x02, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0xf1, 0x2f, 0x19, 0x80, 0x25, 0x00, 0x10, 0x07, 0x01, 0x00, 0x4f, 0x07, 0xff, 0x9d,
+        0x06, 0x27, 0x00, 0x10, 0x06, 0x01, 0x00, 0x49, 0xf4, 0xff, 0xbf, 0x12, 0x11, 0x00, 0x1d,
+        0x02, 0x23, 0x00, 0x27, 0x1d, 0x79, 0x0d, 0x00, 0x56, 0xe2, 0xff, 0xff, 0xda, 0x26, 0x0f,
+        0x00, 0x3d, 0x16, 0x78, 0xad, 0x2f, 0x00, 0x36, 0xdc, 0xff, 0x8f, 0x0e, 0x00, 0x63, 0xcf,
+        0xff, 0xff, 0xff, 0xee, 0x42, 0x0d, 0x00, 0x5e, 0x33, 0x99, 0xf6, 0xff, 0x68, 0x2f, 0x00,
+        0x17, 0xff, 0x31, 0x00, 0xfb, 0x03, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x6b, 0x00, 0x00,
+        0x00, 0x0e, 0x66, 0xd2, 0xff, 0xff, 0xff, 0xf3, 0x0e, 0x30, 0x00, 0x10, 0xbf, 0x21, 0x00,
+        0x24, 0xff, 0x54, 0x0f, 0x00, 0xb1, 0xa9, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0x8c, 0x37,
+        0x9e, 0xf5, 0x19, 0x00, 0x1b, 0x9b, 0x2f, 0x00, 0x30, 0x00, 0x1f, 0xde, 0x16, 0x00, 0x05,
+        0xd6, 0x00, 0x51, 0x97, 0xff, 0xff, 0x7c, 0xcc, 0x2a, 0x00, 0x02, 0x01, 0x00, 0x1c, 0x34,
+        0x30, 0x00, 0x65, 0x00, 0x22, 0xe2, 0xff, 0x97, 0x01, 0x0e, 0x00, 0x61, 0x84, 0xff, 0xff,
+        0x74, 0x0c, 0xb0, 0x2b, 0x00, 0x5d, 0xca, 0xc2, 0xff, 0xff, 0xcd, 0x2f, 0x00, 0x46, 0x00,
+        0x00, 0x22, 0x83, 0x2f, 0x00, 0xff, 0x02, 0x00, 0x71, 0xff, 0xff, 0x87, 0x00, 0x02, 0x87,
+        0xff, 0xf3, 0x9a, 0x33, 0x01, 0xda, 0xff, 0xff, 0x67, 0x30, 0x00, 0x00, 0x09, 0x01, 0x00,
         0xff, 0x01, 0x69, 0xff, 0xff, 0x9a, 0x00, 0x00, 0x00, 0x3c, 0x0e, 0x00, 0x00, 0x44, 0xff,
-        0xff, 0xf3, 0x0d, 0x26, 0x00, 0x03, 0x04, 0x02, 0x00, 0x54, 0x08, 0x80, 0xf8, 0xff, 0xff,
-        0x72, 0x01, 0x44, 0xac, 0xff, 0xff, 0x99, 0x19, 0x00, 0x0f, 0x02, 0x00, 0x03, 0x72, 0x45,
-        0xdb, 0xff, 0xff, 0xff, 0xf7, 0x6b, 0x1d, 0x00, 0x52, 0x19, 0xfa, 0xff, 0xff, 0x35, 0x0b,
-        0x00, 0x0f, 0x02, 0x00, 0x03, 0x20, 0x17, 0xa5, 0x73, 0x15, 0x23, 0xbb, 0x25, 0x1e, 0x00,
-        0x53, 0x45, 0xff, 0xff, 0xff, 0x91, 0x0c, 0x00, 0x0f, 0x02, 0x00, 0x00, 0x86, 0x01, 0x5e,
-        0xec, 0xff, 0xff, 0xff, 0xed, 0x66, 0xfc, 0x00, 0x43, 0x88, 0xff, 0xff, 0xff, 0x6c, 0x00,
-        0x0e, 0x02, 0x00, 0x21, 0x2e, 0xc6, 0x44, 0x01, 0x35, 0xbb, 0x6d, 0x2c, 0x31, 0x00, 0x6e,
-        0x02, 0xae, 0xff, 0xff, 0xfb, 0x47, 0x2b, 0x00, 0x71, 0x00, 0x00, 0x00, 0x00, 0x19, 0xab,
-        0xec, 0x30, 0x00, 0x62, 0xff, 0xff, 0xff, 0xeb, 0xae, 0x3b, 0x14, 0x00, 0x73, 0x00, 0x0b,
-        0xce, 0xff, 0xff, 0xf0, 0x2b, 0x0d, 0x00, 0x0c, 0x02, 0x00, 0x51, 0x02, 0x2e, 0x6d, 0xac,
-        0xea, 0x31, 0x00, 0xfc, 0x01, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x80, 0xb9, 0xa6, 0x93, 0x80,
-        0x89, 0xfe, 0xff, 0xff, 0xde, 0x16, 0x2a, 0x00, 0x06, 0x02, 0x00, 0xc2, 0x01, 0x2b, 0x6c,
-        0xf4, 0xff, 0xff, 0xff, 0xe5, 0x00, 0x00, 0x31, 0xfc, 0x3b, 0x00, 0x56, 0xff, 0xff, 0xff,
-        0xc5, 0x08, 0x21, 0x00, 0x0c, 0x02, 0x00, 0x21, 0x02, 0xa0, 0x23, 0x00, 0x22, 0x26, 0x02,
-        0xce, 0x00, 0x02, 0x02, 0x00, 0x15, 0xaa, 0xd2, 0x00, 0x0c, 0x02, 0x00, 0xfc, 0x09, 0x02,
-        0x9f, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0x67, 0x68, 0xff, 0xff, 0xf8, 0x6a, 0x70, 0x82,
-        0x93, 0xa5, 0xb6, 0xc8, 0xd9, 0xeb, 0xfc, 0x7f, 0x28, 0x00, 0x03, 0x02, 0x00, 0x01, 0x2f,
-        0x00, 0x93, 0x96, 0x76, 0xff, 0xff, 0xbc, 0xee, 0xff, 0xff, 0x81, 0x15, 0x00, 0x3c, 0x00,
-        0x00, 0x00, 0x03, 0x03, 0x03, 0x02, 0x00, 0x81, 0x01, 0x98, 0xff, 0xff, 0xff, 0x9a, 0x01,
-        0x36, 0x86, 0x00, 0x1f, 0xda, 0xb6, 0x00, 0x08, 0x02, 0x02, 0x00, 0x02, 0x2f, 0x00, 0x40,
-        0x02, 0x00, 0x04, 0xf1, 0x5a, 0x17, 0x12, 0x43, 0x15, 0x00, 0x0f, 0x02, 0x00, 0x07, 0x04,
-        0x2f, 0x00, 0x7f, 0x00, 0x00, 0xb6, 0xff, 0xff, 0xff, 0xa1, 0x29, 0x00, 0x07, 0x02, 0x02,
-        0x00, 0x25, 0x01, 0x97, 0x67, 0x03, 0x4f, 0x77, 0xff, 0xff, 0xed, 0x75, 0x01, 0x08, 0x01,
-        0x02, 0x00, 0x07, 0x2f, 0x00, 0x51, 0x00, 0x38, 0xff, 0xff, 0x62, 0x15, 0x00, 0x0f, 0x02,
-        0x00, 0x07, 0x08, 0x2f, 0x00, 0x4f, 0x00, 0x04, 0xf2, 0xc2, 0x72, 0x01, 0x06, 0x02, 0x02,
-        0x00, 0x09, 0x2f, 0x00, 0x42, 0x00, 0x00, 0xb2, 0x2a, 0x17, 0x00, 0x0f, 0x02, 0x00, 0x05,
-        0x66, 0x02, 0x9c, 0xff, 0xff, 0xff, 0x98, 0x54, 0x00, 0x14, 0x1a, 0x29, 0x00, 0x24, 0x01,
-        0x53, 0x0a, 0x00, 0x08, 0x02, 0x00, 0x25, 0x01, 0x96, 0xeb, 0x00, 0x0a, 0x02, 0x00, 0x27,
-        0x01, 0x94, 0xc9, 0x04, 0x05, 0x02, 0x00, 0x01, 0x2f, 0x00, 0x15, 0x9c, 0x81, 0x04, 0x06,
-        0x02, 0x00, 0x29, 0x01, 0x94, 0xfa, 0x04, 0x03, 0x02, 0x00, 0x66, 0x02, 0x9b, 0xff, 0xff,
-        0xff, 0x99, 0x8d, 0x00, 0x06, 0x02, 0x00, 0x11, 0x83, 0xe9, 0x01, 0x16, 0x79, 0x11, 0x00,
-        0x01, 0x02, 0x00, 0x1f, 0x99, 0x2f, 0x00, 0x05, 0x81, 0x00, 0x22, 0xe2, 0xff, 0xff, 0xff,
-        0xdd, 0x1d, 0x26, 0x00, 0x06, 0x02, 0x00, 0x2f, 0x62, 0xfd, 0x8d, 0x00, 0x02, 0x92, 0x00,
-        0x00, 0x00, 0x00, 0x1f, 0xde, 0xff, 0xe0, 0x20, 0x0b, 0x00, 0x07, 0x02, 0x00, 0x1f, 0x65,
-        0x8d, 0x00, 0x02, 0x01, 0x02, 0x00, 0x2c, 0x22, 0xbf, 0x5e, 0x00, 0x0f, 0x02, 0x00, 0xff,
-        0x34, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xff, 0xf3, 0x0d, 0x2e, 0x00, 0x0b, 0x54, 0x08, 0x80, 0xf8, 0xff, 0xff, 0x72, 0x01, 0x4f,
+        0xac, 0xff, 0xff, 0x99, 0x2f, 0x00, 0x0b, 0x60, 0x45, 0xdb, 0xff, 0xff, 0xff, 0xf7, 0x4d,
+        0x01, 0x00, 0x4b, 0x02, 0x4f, 0xfa, 0xff, 0xff, 0x35, 0x2e, 0x00, 0x09, 0x20, 0x17, 0xa5,
+        0xe6, 0x00, 0x24, 0xbb, 0x25, 0x3d, 0x00, 0x4f, 0xff, 0xff, 0xff, 0x91, 0x2e, 0x00, 0x07,
+        0x86, 0x01, 0x5e, 0xec, 0xff, 0xff, 0xff, 0xed, 0x66, 0xfc, 0x00, 0x43, 0x88, 0xff, 0xff,
+        0xff, 0x6c, 0x00, 0x0e, 0x01, 0x00, 0x21, 0x2e, 0xc6, 0x44, 0x01, 0x35, 0xbb, 0x6d, 0x2c,
+        0x31, 0x00, 0x6f, 0x02, 0xae, 0xff, 0xff, 0xfb, 0x47, 0x2f, 0x00, 0x03, 0x20, 0x19, 0xab,
+        0x5e, 0x00, 0x01, 0x01, 0x00, 0x33, 0xeb, 0xae, 0x3b, 0x15, 0x00, 0x6f, 0x0b, 0xce, 0xff,
+        0xff, 0xf0, 0x2b, 0x31, 0x00, 0x03, 0x62, 0x00, 0x02, 0x2e, 0x6d, 0xac, 0xea, 0x32, 0x00,
+        0xff, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x80, 0xb9, 0xa6, 0x93, 0x80, 0x89, 0xfe, 0xff, 0xff,
+        0xde, 0x16, 0x31, 0x00, 0x04, 0x00, 0xc4, 0x00, 0xb5, 0x2b, 0x6c, 0xf4, 0xff, 0xff, 0xff,
+        0xe5, 0x00, 0x00, 0x31, 0xfc, 0x12, 0x02, 0x2f, 0xc5, 0x08, 0x31, 0x00, 0x07, 0x21, 0x02,
+        0xa0, 0x23, 0x00, 0x22, 0x26, 0x02, 0xce, 0x00, 0x02, 0x01, 0x00, 0x17, 0xaa, 0xff, 0x01,
+        0x0b, 0x2f, 0x00, 0xff, 0x08, 0x9f, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0x67, 0x68, 0xff,
+        0xff, 0xf8, 0x6a, 0x70, 0x82, 0x93, 0xa5, 0xb6, 0xc8, 0xd9, 0xeb, 0xfc, 0x7f, 0x2f, 0x00,
+        0x09, 0x96, 0x96, 0x76, 0xff, 0xff, 0xbc, 0xee, 0xff, 0xff, 0x81, 0x18, 0x00, 0x0c, 0x03,
+        0x03, 0x03, 0x01, 0x00, 0x81, 0x01, 0x98, 0xff, 0xff, 0xff, 0x9a, 0x01, 0x36, 0x85, 0x00,
+        0x1f, 0xda, 0xb6, 0x00, 0x08, 0x08, 0x2f, 0x00, 0x40, 0x02, 0x00, 0x04, 0xf1, 0x30, 0x00,
+        0x1f, 0x43, 0x2f, 0x00, 0x15, 0x7f, 0x00, 0x00, 0xb6, 0xff, 0xff, 0xff, 0xa1, 0x2f, 0x00,
+        0x0e, 0x15, 0x97, 0x67, 0x03, 0x4f, 0x77, 0xff, 0xff, 0xed, 0x75, 0x01, 0x08, 0x0c, 0x2f,
+        0x00, 0x5f, 0x00, 0x38, 0xff, 0xff, 0x62, 0x2f, 0x00, 0x18, 0x4f, 0x00, 0x04, 0xf2, 0xc2,
+        0x72, 0x01, 0x06, 0x0f, 0x2f, 0x00, 0x00, 0x4f, 0x00, 0x00, 0xb2, 0x2a, 0x2f, 0x00, 0x0b,
+        0x66, 0x02, 0x9c, 0xff, 0xff, 0xff, 0x98, 0x54, 0x00, 0x14, 0x1a, 0x09, 0x00, 0x2f, 0x01,
+        0x53, 0x2f, 0x00, 0x01, 0x29, 0x01, 0x96, 0x5e, 0x00, 0x07, 0x19, 0x00, 0x18, 0x94, 0xfa,
+        0x04, 0x09, 0x2f, 0x00, 0x1f, 0x9c, 0x2f, 0x00, 0x03, 0x08, 0xfa, 0x04, 0x03, 0x01, 0x00,
+        0x6f, 0x02, 0x9b, 0xff, 0xff, 0xff, 0x99, 0xe1, 0x00, 0x01, 0x11, 0x83, 0xe9, 0x01, 0x08,
+        0x8d, 0x05, 0x00, 0x01, 0x00, 0x1f, 0x99, 0x2f, 0x00, 0x05, 0x00, 0xc9, 0x04, 0x4b, 0xff,
+        0xff, 0xdd, 0x1d, 0x16, 0x00, 0x2f, 0x62, 0xfd, 0x8d, 0x00, 0x02, 0x00, 0x01, 0x00, 0x5d,
+        0x1f, 0xde, 0xff, 0xe0, 0x20, 0x16, 0x00, 0x1f, 0x65, 0x5e, 0x00, 0x03, 0x00, 0x01, 0x00,
+        0x2c, 0x22, 0xbf, 0x5e, 0x00, 0x0f, 0x01, 0x00, 0xff, 0x34, 0x50, 0x00, 0x00, 0x00, 0x00,
+        0x00,
 
 };
 
@@ -124,11 +74,11 @@ const lv_image_dsc_t icon_wand_stars = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 48,
                  .h = 48,
-                 .stride = 96,
+                 .stride = 48,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_wand_stars_map),
@@ -20,48 +20,25 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_WAND_STARS_24 uint8_t
     icon_wand_stars_24_map[] = {
 
-        0x02, 0x00, 0x00, 0x00, 0x60, 0x02, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x1f, 0xff, 0x01,
-        0x00, 0x60, 0x4f, 0x45, 0x29, 0x04, 0x21, 0x77, 0x00, 0x19, 0x4f, 0x00, 0x00, 0xe3, 0x18,
-        0x32, 0x00, 0x0d, 0x28, 0x04, 0x21, 0x22, 0x00, 0x62, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18,
-        0x64, 0x00, 0x26, 0x04, 0x21, 0x0c, 0x00, 0x04, 0x02, 0x00, 0x02, 0x14, 0x00, 0x06, 0x32,
-        0x00, 0x02, 0x30, 0x00, 0x22, 0xe3, 0x18, 0x18, 0x00, 0x08, 0x1a, 0x00, 0x02, 0x02, 0x00,
-        0x02, 0x18, 0x00, 0x0e, 0x30, 0x00, 0x04, 0x02, 0x00, 0x1d, 0x24, 0xd0, 0x00, 0x24, 0x04,
-        0x21, 0x80, 0x00, 0x00, 0x62, 0x01, 0x02, 0x82, 0x00, 0x68, 0x04, 0x21, 0x04, 0x21, 0x04,
-        0x21, 0x48, 0x00, 0x0f, 0x02, 0x00, 0x01, 0x04, 0x86, 0x00, 0x02, 0x1c, 0x00, 0x02, 0x7a,
-        0x00, 0x02, 0x0c, 0x00, 0x0f, 0x02, 0x00, 0x01, 0x04, 0x82, 0x00, 0x04, 0x24, 0x00, 0x02,
-        0x10, 0x00, 0x0f, 0x2a, 0x00, 0x01, 0x42, 0xff, 0xff, 0x45, 0x29, 0x1e, 0x00, 0x02, 0xe2,
-        0x00, 0x02, 0xce, 0x00, 0x22, 0x00, 0x00, 0x0e, 0x00, 0x0f, 0x32, 0x00, 0x03, 0x04, 0x80,
-        0x00, 0x02, 0x02, 0x00, 0x22, 0xa2, 0x10, 0x08, 0x00, 0x02, 0x02, 0x00, 0x0f, 0x32, 0x00,
-        0x05, 0x22, 0x00, 0x00, 0xb4, 0x00, 0x0c, 0x02, 0x00, 0x0f, 0x64, 0x00, 0x03, 0x0a, 0x2e,
-        0x00, 0x08, 0x24, 0x00, 0x2f, 0x00, 0x00, 0x62, 0x00, 0x01, 0x02, 0x5c, 0x00, 0x04, 0xe8,
-        0x00, 0x0f, 0x86, 0x00, 0x07, 0x02, 0x02, 0x00, 0x04, 0x2e, 0x00, 0x02, 0x30, 0x00, 0x08,
-        0x5e, 0x00, 0x0f, 0x02, 0x00, 0x01, 0x06, 0x2e, 0x00, 0x02, 0x18, 0x01, 0x0f, 0x24, 0x00,
-        0x01, 0x06, 0x02, 0x00, 0x02, 0xe0, 0x00, 0x06, 0x10, 0x00, 0x22, 0x45, 0x29, 0x0c, 0x00,
-        0x04, 0x5a, 0x01, 0x0a, 0x02, 0x00, 0x0c, 0x2e, 0x00, 0x04, 0x02, 0x00, 0x02, 0x18, 0x00,
-        0x0c, 0x9a, 0x00, 0x08, 0x8a, 0x00, 0x0a, 0x02, 0x00, 0x02, 0x1a, 0x00, 0x0c, 0x30, 0x00,
-        0x2e, 0xff, 0xff, 0x12, 0x00, 0x04, 0x02, 0x00, 0x0f, 0x90, 0x00, 0x03, 0x0f, 0x02, 0x00,
-        0x75, 0x1f, 0x00, 0x01, 0x00, 0x26, 0x2f, 0x06, 0x1d, 0x3b, 0x00, 0x03, 0x3b, 0x02, 0xe4,
-        0x36, 0x19, 0x00, 0x21, 0x46, 0x81, 0x11, 0x00, 0x91, 0xec, 0xf6, 0x55, 0x00, 0x00, 0x00,
-        0x10, 0x6e, 0xa3, 0x0e, 0x00, 0xf3, 0x04, 0x00, 0x00, 0x38, 0xf6, 0xff, 0x79, 0x00, 0x00,
-        0x00, 0x00, 0xd9, 0xff, 0xfe, 0x7c, 0x36, 0x9d, 0xf5, 0xff, 0x67, 0x18, 0x00, 0xf3, 0x02,
-        0x08, 0xb9, 0xe5, 0x26, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xbc, 0xa3, 0xff, 0xff, 0xf2, 0xf0,
-        0xf3, 0x0d, 0x18, 0x00, 0x31, 0x00, 0x08, 0x21, 0x0a, 0x00, 0x81, 0xb6, 0xc8, 0x00, 0x70,
-        0x67, 0x1e, 0xf6, 0x99, 0x0d, 0x00, 0x05, 0x02, 0x00, 0xa5, 0x11, 0x99, 0xfd, 0xc3, 0x00,
-        0x00, 0x00, 0x70, 0xff, 0x34, 0x13, 0x00, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xe9,
-        0xfa, 0x86, 0x09, 0x00, 0x00, 0x00, 0x74, 0xff, 0x7f, 0x11, 0x00, 0x01, 0x02, 0x00, 0xe1,
-        0x06, 0xa4, 0xff, 0xff, 0xee, 0xa5, 0x67, 0x0f, 0x00, 0x00, 0x01, 0xa2, 0xfe, 0x58, 0x13,
-        0x00, 0x03, 0x02, 0x00, 0xd3, 0x27, 0x66, 0xa5, 0xfd, 0xff, 0x63, 0x0c, 0xcc, 0xce, 0xc1,
-        0xfe, 0xf7, 0x39, 0x14, 0x00, 0x01, 0x02, 0x00, 0xd1, 0x01, 0x91, 0xff, 0xfc, 0xa3, 0x8d,
-        0xfd, 0xb6, 0xc5, 0xd6, 0xe8, 0xe3, 0x20, 0x12, 0x00, 0x01, 0x02, 0x00, 0x72, 0x01, 0x90,
-        0xff, 0x8b, 0xab, 0xee, 0xfb, 0x8d, 0x00, 0x11, 0x03, 0x13, 0x00, 0x01, 0x02, 0x00, 0x81,
-        0x88, 0xff, 0x8e, 0x00, 0x6c, 0xff, 0xe8, 0x11, 0x0d, 0x00, 0x06, 0x02, 0x00, 0x86, 0x88,
-        0xff, 0x8e, 0x00, 0x00, 0x2c, 0xff, 0x59, 0x12, 0x00, 0x01, 0x02, 0x00, 0x01, 0x17, 0x00,
-        0x24, 0x00, 0x01, 0x1a, 0x01, 0x04, 0x02, 0x00, 0x31, 0x8e, 0xff, 0x8c, 0x0b, 0x00, 0x51,
-        0x06, 0x00, 0x00, 0x00, 0x26, 0x2c, 0x01, 0x01, 0x02, 0x00, 0x31, 0x8e, 0xff, 0x8d, 0x08,
-        0x00, 0x72, 0x00, 0x00, 0x00, 0x00, 0x21, 0xe5, 0xff, 0x5e, 0x01, 0x37, 0x00, 0x00, 0x40,
-        0x17, 0x00, 0x52, 0x00, 0x08, 0xb9, 0xf6, 0x46, 0x22, 0x00, 0x34, 0x00, 0x00, 0x3f, 0x09,
-        0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x08, 0x37, 0x08, 0x00, 0x0f, 0x02, 0x00, 0x2f, 0x50,
-        0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0x0d, 0x01, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x1f, 0x00, 0x01,
+        0x00, 0x26, 0x2f, 0x06, 0x1d, 0x18, 0x00, 0x03, 0x3b, 0x02, 0xe4, 0x36, 0x12, 0x00, 0x21,
+        0x46, 0x81, 0x07, 0x00, 0x93, 0xec, 0xf6, 0x55, 0x00, 0x00, 0x00, 0x10, 0x6e, 0xa3, 0x17,
+        0x00, 0x40, 0x38, 0xf6, 0xff, 0x79, 0x08, 0x00, 0x93, 0xd9, 0xff, 0xfe, 0x7c, 0x36, 0x9d,
+        0xf5, 0xff, 0x67, 0x18, 0x00, 0x40, 0x08, 0xb9, 0xe5, 0x26, 0x08, 0x00, 0x94, 0xc6, 0xbc,
+        0xa3, 0xff, 0xff, 0xf2, 0xf0, 0xf3, 0x0d, 0x48, 0x00, 0x21, 0x08, 0x21, 0x07, 0x00, 0x8a,
+        0xb6, 0xc8, 0x00, 0x70, 0x67, 0x1e, 0xf6, 0x99, 0x65, 0x00, 0xa9, 0x11, 0x99, 0xfd, 0xc3,
+        0x00, 0x00, 0x00, 0x70, 0xff, 0x34, 0x17, 0x00, 0xb7, 0x5c, 0xe9, 0xfa, 0x86, 0x09, 0x00,
+        0x00, 0x00, 0x74, 0xff, 0x7f, 0x16, 0x00, 0xe8, 0x06, 0xa4, 0xff, 0xff, 0xee, 0xa5, 0x67,
+        0x0f, 0x00, 0x00, 0x01, 0xa2, 0xfe, 0x58, 0x30, 0x00, 0xd8, 0x27, 0x66, 0xa5, 0xfd, 0xff,
+        0x63, 0x0c, 0xcc, 0xce, 0xc1, 0xfe, 0xf7, 0x39, 0x19, 0x00, 0xd7, 0x01, 0x91, 0xff, 0xfc,
+        0xa3, 0x8d, 0xfd, 0xb6, 0xc5, 0xd6, 0xe8, 0xe3, 0x20, 0x17, 0x00, 0x62, 0x90, 0xff, 0x8b,
+        0xab, 0xee, 0xfb, 0x8d, 0x00, 0x16, 0x03, 0x18, 0x00, 0x88, 0x88, 0xff, 0x8e, 0x00, 0x6c,
+        0xff, 0xe8, 0x11, 0x43, 0x00, 0x03, 0x17, 0x00, 0x4f, 0x00, 0x2c, 0xff, 0x59, 0x17, 0x00,
+        0x01, 0x24, 0x00, 0x01, 0x1a, 0x01, 0x04, 0x01, 0x00, 0x31, 0x8e, 0xff, 0x8c, 0x08, 0x00,
+        0x51, 0x06, 0x00, 0x00, 0x00, 0x26, 0x2c, 0x01, 0x03, 0x17, 0x00, 0x15, 0x8d, 0x0c, 0x00,
+        0x32, 0x21, 0xe5, 0xff, 0x5e, 0x01, 0x37, 0x00, 0x00, 0x40, 0x17, 0x00, 0x54, 0x00, 0x08,
+        0xb9, 0xf6, 0x46, 0x0c, 0x00, 0x16, 0x3f, 0x17, 0x00, 0x48, 0x00, 0x00, 0x08, 0x37, 0x0e,
+        0x00, 0x0f, 0x01, 0x00, 0x29, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
 
 };
 
@@ -69,11 +46,11 @@ const lv_image_dsc_t icon_wand_stars_24 = {
     .header =
         {
                  .magic = LV_IMAGE_HEADER_MAGIC,
-                 .cf = LV_COLOR_FORMAT_RGB565A8,
+                 .cf = LV_COLOR_FORMAT_A8,
                  .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
                  .w = 24,
                  .h = 24,
-                 .stride = 48,
+                 .stride = 24,
                  .reserved_2 = 0,
                  },
     .data_size = sizeof(icon_wand_stars_24_map),
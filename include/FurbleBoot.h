@@ -0,0 +1,83 @@
+#ifndef FURBLE_BOOT_H
+#define FURBLE_BOOT_H
+
+#include <array>
+#include <cstdint>
+
+#include "Preferences.h"
+
+namespace Furble {
+/**
+ * Boot timeline from reset to the first rendered frame.
+ *
+ * Each startup phase is marked as it completes from the main task, the first
+ * frame once its last area is flushed to the display. Marking only records the
+ * time, so it is safe from the flush callback. The UI task then completes the
+ * profile outside of LVGL: the timeline is logged, checked against BUDGET_MS
+ * and persisted to NVS, so the About page can show this and the previous boot.
+ */
+class BootProfile {
+ public:
+  typedef enum {
+    /** IDF startup up to app_main(), as counted by esp_timer. */
+    STARTUP,
+    PLATFORM,
+    SETTINGS,
+    DEVICE,
+    CONTROL,
+    TRIGGER,
+    GPS,
+    UI,
+    FIRST_FRAME,
+    PHASES,
+  } phase_t;
+
+  /** Blob identifier and format version, 'FBP1'. */
+  static constexpr uint32_t MAGIC = 0x31504246;
+
+  /** Reset to first frame, a warning is logged beyond this. */
+  static constexpr uint32_t BUDGET_MS = 2000;
+
+  /** Persisted profile, little endian. */
+  typedef struct {
+    uint32_t magic;
+    /** Phase end, microseconds since reset, 0 if not reached. */
+    std::array<uint32_t, PHASES> end;
+  } profile_t;
+
+  /** Mark the end of a phase, records the time only. */
+  static void mark(phase_t phase);
+
+  /** Log and persist the profile once FIRST_FRAME is marked, then a no-op. */
+  static void complete(void);
+
+  /** Profile of this boot, complete once the first frame is drawn. */
+  static const profile_t &getProfile(void);
+
+  /** Profile of the previous boot, magic is 0 if there is none. */
+  static const profile_t &getPrevious(void);
+
+  /** Duration of a phase in milliseconds, 0 if not reached. */
+  static uint32_t getPhaseMs(const profile_t &profile, phase_t phase);
+
+  /** Reset to first frame in milliseconds, 0 if not reached. */
+  static uint32_t getTotalMs(const profile_t &profile);
+
+  static const char *getName(phase_t phase);
+
+ private:
+  static constexpr const char *m_Key = "bootprof";
+
+  /** Swap the previous profile out of NVS for this one. */
+  static void save(void);
+
+  static void log(void);
+
+  static Preferences m_Prefs;
+  static profile_t m_Profile;
+  static profile_t m_Previous;
+  static bool m_Complete;
+};
+}  // namespace Furble
+
+#endif
@@ -0,0 +1,98 @@
+#ifndef FURBLE_CLOCK_H
+#define FURBLE_CLOCK_H
+
+#include <cstdint>
+
+namespace Furble {
+/**
+ * Discipline the local microsecond clock to GPS time from PPS edges.
+ *
+ * Each PPS edge is fed in with its local timestamp and the UTC second it
+ * marks. The loop tracks the local clock phase and frequency error against
+ * UTC with a proportional-integral update, rejecting edges that disagree
+ * with the model by more than MAX_ERROR_US, and stepping to a new model
+ * after MAX_OUTLIERS consecutive rejections. The model extrapolates between
+ * edges and holds over without them.
+ *
+ * No platform dependencies, so edge sequences with synthetic jitter can be
+ * replayed on a host, see tools/pps_sim.cpp.
+ */
+class PPSDiscipline {
+ public:
+  typedef struct {
+    /** Local time of the anchor, esp_timer microseconds. */
+    int64_t local;
+    /** UTC of the anchor, microseconds since the epoch. */
+    int64_t utc;
+    /** Local clock frequency error, UTC elapsed is local elapsed * (1 + rate). */
+    double rate;
+    /** Model has been anchored to at least one edge. */
+    bool valid;
+    /** Frequency estimated and the last LOCK_PULSES edges accepted. */
+    bool locked;
+  } model_t;
+
+  typedef struct {
+    /** Edges accepted. */
+    uint32_t pulses;
+    /** Edges rejected. */
+    uint32_t outliers;
+    /** Model steps, including the first edge. */
+    uint32_t steps;
+    /** Error of the last accepted edge against the model, microseconds. */
+    int32_t error;
+    /** Average absolute error, microseconds. */
+    uint32_t jitter;
+  } stats_t;
+
+  static constexpr const int64_t SECOND_US = 1000000;
+  static constexpr const int64_t MAX_ERROR_US = 1000;
+  static constexpr const unsigned int MAX_OUTLIERS = 3;
+  static constexpr const unsigned int LOCK_PULSES = 4;
+  // a crystal is well within this
+  static constexpr const double MAX_RATE = 500e-6;
+  // edges further apart restart the frequency estimate
+  static constexpr const int64_t MAX_GAP_US = 16 * SECOND_US;
+  // locked state is kept this long without an edge
+  static constexpr const int64_t HOLDOVER_US = 60 * SECOND_US;
+
+  /**
+   * Feed a PPS edge.
+   *
+   * @param[in] local Edge time, esp_timer microseconds.
+   * @param[in] utc UTC the edge marks, microseconds since the epoch.
+   *
+   * @return true if the edge was accepted.
+   */
+  bool pulse(int64_t local, int64_t utc);
+
+  /** Forget the model. */
+  void reset(void);
+
+  const model_t &getModel(void) const;
+  const stats_t &getStats(void) const;
+
+  /** UTC microseconds at a local time, model must be valid. */
+  static int64_t toUTC(const model_t &model, int64_t local);
+
+  /** Local time of a UTC instant, model must be valid. */
+  static int64_t toLocal(const model_t &model, int64_t utc);
+
+  /** Is the model locked and an edge seen within HOLDOVER_US of local? */
+  static bool isLocked(const model_t &model, int64_t local);
+
+ private:
+  // loop gains per edge, phase settles in a few seconds, frequency in a minute
+  static constexpr const double PHASE_GAIN = 0.25;
+  static constexpr const double FREQUENCY_GAIN = 1.0 / 64;
+
+  void step(int64_t local, int64_t utc);
+
+  model_t m_Model = {};
+  stats_t m_Stats = {};
+  unsigned int m_Pulses = 0;
+  unsigned int m_Outliers = 0;
+};
+}  // namespace Furble
+
+#endif
@@ -1,11 +1,17 @@
 #ifndef FURBLE_CONTROL_H
 #define FURBLE_CONTROL_H
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 
+#include <esp_timer.h>
+
 #include <Camera.h>
 
+#include "FurbleGeotag.h"
+#include "FurbleSeqLock.h"
+
 namespace Furble {
 
 class Control {
@@ -16,6 +22,8 @@ class Control {
     CMD_FOCUS_PRESS,
     CMD_FOCUS_RELEASE,
     CMD_GPS_UPDATE,
+    CMD_LOW_POWER_ENTER,
+    CMD_LOW_POWER_EXIT,
     CMD_CONNECT,
     CMD_DISCONNECT,
     CMD_ERROR
@@ -44,9 +52,30 @@ class Control {
     ~Target();
 
     Camera *getCamera(void) const;
-    cmd_t getCommand(void);
     void sendCommand(cmd_t cmd);
-    void updateGPS(const Camera::gps_t &gps, const Camera::timesync_t &timesync);
+
+    /**
+     * Send shutter command to be executed at base plus the target offset.
+     *
+     * @param[in] base Common trigger time, esp_timer microseconds.
+     */
+    void sendShutter(cmd_t cmd, int64_t base);
+
+    /** Number of shutter presses written to the camera. */
+    uint32_t getShutterCount(void) const;
+
+    /** Trigger offset from the common trigger time, in microseconds. */
+    uint32_t getOffset(void) const;
+    void setOffset(uint32_t offset);
+
+    /** Trigger time to the last shutter press write complete, in microseconds. */
+    int32_t getAchievedOffset(void) const;
+
+    /** Duration of the last shutter press write, in microseconds. */
+    int32_t getWriteLatency(void) const;
+
+    /** Camera has reported the capture of the last shutter press complete. */
+    bool isReady(void) const;
 
     void task(void);
 
@@ -54,12 +83,35 @@ class Control {
     volatile bool m_Stopped = false;
 
    private:
+    typedef struct {
+      cmd_t cmd;
+      /** Common trigger time, 0 for immediate. */
+      int64_t base;
+    } command_t;
+
     static constexpr UBaseType_t m_QueueLength = 8;
+    /**
+     * Busy wait the final stretch, FreeRTOS ticks are too coarse. vTaskDelay()
+     * wakes on a 1ms tick boundary, so this costs 1-2ms of CPU per target per
+     * timed command, during which lower priority tasks on the core are held
+     * off.
+     */
+    static constexpr int64_t m_SpinUs = 1000;
+
+    command_t getCommand(void);
+
+    /** Block until the trigger time, returns actual time. */
+    int64_t waitUntil(int64_t base);
 
     QueueHandle_t m_Queue = NULL;
     Furble::Camera *m_Camera = NULL;
-    Camera::gps_t m_GPS;
-    Camera::timesync_t m_Timesync;
+    Geotag m_Geotag;
+    std::atomic<uint32_t> m_ShutterCount = 0;
+    std::atomic<uint32_t> m_Offset = 0;
+    std::atomic<int32_t> m_AchievedOffset = 0;
+    std::atomic<int32_t> m_WriteLatency = 0;
+    // camera capture count when the last press was sent
+    std::atomic<uint32_t> m_CaptureBase = 0;
   };
 
   static Control &getInstance();
@@ -84,10 +136,66 @@ class Control {
   BaseType_t sendCommand(cmd_t cmd);
 
   /**
-   * Update GPS and timesync values.
+   * Update GPS and timesync values, only one task may call this.
    */
   BaseType_t updateGPS(const Camera::gps_t &gps, const Camera::timesync_t &timesync);
 
+  /**
+   * Send shutter command directly to each linked target.
+   *
+   * Bypasses the control task, so cameras still connected keep firing while
+   * others reconnect.
+   *
+   * @return Bitmask of targets sent the command.
+   */
+  uint32_t sendShutter(cmd_t cmd);
+
+  /**
+   * Send shutter command directly to each linked target against a common
+   * trigger time.
+   *
+   * @param[in] base Common trigger time, esp_timer microseconds.
+   *
+   * @return Bitmask of targets sent the command.
+   */
+  uint32_t sendShutter(cmd_t cmd, int64_t base);
+
+  /**
+   * Fire all linked targets at an absolute UTC instant, so units sharing GPS
+   * time shoot together. The instant is converted to a trigger time against
+   * the latest clock model just before it is due.
+   *
+   * @param[in] utc UTC microseconds since the epoch.
+   *
+   * @return false if UTC is unknown or the instant has passed.
+   */
+  bool scheduleShutter(int64_t utc);
+
+  /** Cancel a scheduled shutter. */
+  void cancelShutter(void);
+
+  /**
+   * Set the trigger offset of a target and persist it against the camera.
+   *
+   * @param[in] index Target index.
+   * @param[in] offset Delay from the common trigger time, in microseconds.
+   */
+  void setOffset(size_t index, uint32_t offset);
+
+  /**
+   * Get bitmask of targets with a live link, without waiting on connections
+   * in progress.
+   */
+  uint32_t getLinked(void);
+
+  /**
+   * Are all linked cameras ready for the next frame?
+   *
+   * Only true if every linked camera reports capture completion and has
+   * completed its last capture.
+   */
+  bool isReady(void);
+
   /**
    * Are all active cameras still connected?
    */
@@ -95,9 +203,18 @@ class Control {
 
   /**
    * Get list of connected targets.
+   *
+   * UI task only, the task that adds and removes targets. Other tasks use
+   * getTargetCount() and getShutterCount().
    */
   const std::vector<std::unique_ptr<Control::Target>> &getTargets(void);
 
+  /** Number of connected targets. */
+  size_t getTargetCount(void);
+
+  /** Shutter presses written by a target, 0 if there is no such target. */
+  uint32_t getShutterCount(size_t index);
+
   /**
    * Connect to all active cameras.
    */
@@ -132,10 +249,32 @@ class Control {
   /** Iterate over cameras and attempt connection. */
   state_t connectAll(void);
 
+  /** Change state, posting the change to the UI. */
+  void setState(state_t state);
+
   static constexpr UBaseType_t m_QueueLength = 32;
+  /** Convert and dispatch a scheduled shutter this far ahead. */
+  static constexpr int64_t m_ScheduleLeadUs = 20 * 1000;
+  /** Shutter hold of a scheduled shot. */
+  static constexpr int64_t m_ScheduleHoldUs = 50 * 1000;
+
+  /** Dispatch the scheduled shutter, esp_timer task. */
+  void fireSchedule(void);
+
+  typedef struct {
+    Camera::gps_t gps;
+    Camera::timesync_t timesync;
+  } geodata_t;
+
+  /** Latest geodata, read by each target task on CMD_GPS_UPDATE. */
+  static SeqLock<geodata_t> m_GeoData;
 
   QueueHandle_t m_Queue = NULL;
   std::mutex m_Mutex;
+  // guards m_Targets against removal whilst other tasks iterate it, held
+  // briefly so shots are not blocked by a connection attempt holding m_Mutex,
+  // taken after m_Mutex
+  std::mutex m_TargetsMutex;
   std::vector<std::unique_ptr<Control::Target>> m_Targets;
 
   bool m_InfiniteReconnect = false;
@@ -144,6 +283,10 @@ class Control {
   // Camera connects are serialised, the following tracks the last attempt
   Camera *m_ConnectCamera = nullptr;
   esp_power_level_t m_Power = ESP_PWR_LVL_P3;
+
+  esp_timer_handle_t m_Schedule = NULL;
+  // written by the UI task whilst a fired callback may be reading it
+  std::atomic<int64_t> m_ScheduleUTC = 0;
 };
 
 };  // namespace Furble
@@ -0,0 +1,65 @@
+#ifndef FURBLE_EDGE_H
+#define FURBLE_EDGE_H
+
+#include <cstdint>
+
+namespace Furble {
+/**
+ * Debounced edge detector for a digital input.
+ *
+ * Raw edges are fed in as (time, level) pairs, from an interrupt, a periodic
+ * sample or a simulated source. A change of state is only accepted once the
+ * previous accepted edge is at least the debounce period old. A change
+ * rejected inside the debounce period is left pending, the caller must
+ * sample the input again once the period expires to settle it.
+ *
+ * No platform dependencies, so edge sequences can be replayed on a host.
+ */
+class EdgeFilter {
+ public:
+  typedef enum {
+    EDGE_NONE,
+    EDGE_ASSERT,
+    EDGE_DEASSERT,
+  } edge_t;
+
+  /**
+   * @param[in] debounce Debounce period in microseconds.
+   * @param[in] activeLow Input is asserted when the level is low.
+   */
+  EdgeFilter(int64_t debounce, bool activeLow);
+
+  /**
+   * Feed a raw level.
+   *
+   * @param[in] time Microseconds, monotonic.
+   * @param[in] level Input level, 0 or 1.
+   *
+   * @return Accepted edge, if any.
+   */
+  edge_t update(int64_t time, int level);
+
+  /** Is the raw input different to the debounced state? */
+  bool isPending(void) const;
+
+  /** Debounced input state. */
+  bool isAsserted(void) const;
+
+  /** Time of the raw edge behind the last accepted edge. */
+  int64_t getEdgeTime(void) const;
+
+  /** Reset the debounced state to the given level. */
+  void reset(int64_t time, int level);
+
+ private:
+  const int64_t m_Debounce;
+  const bool m_ActiveLow;
+
+  bool m_Asserted = false;
+  bool m_Raw = false;
+  int64_t m_RawTime;
+  int64_t m_EdgeTime;
+};
+}  // namespace Furble
+
+#endif
@@ -1,15 +1,84 @@
 #ifndef FURBLE_GPS_H
 #define FURBLE_GPS_H
 
+#include <array>
+#include <atomic>
+
+#include <driver/gpio.h>
 #include <driver/uart.h>
 
 #include <lvgl.h>
 
+#include <Camera.h>
 #include <TinyGPS++.h>
 
+#include "FurbleClock.h"
+#include "FurbleNMEA.h"
+#include "FurbleSeqLock.h"
+#include "FurbleSettings.h"
+#include "FurbleTrack.h"
+#include "FurbleUBX.h"
+
 namespace Furble {
+/**
+ * GPS unit on the Grove port.
+ *
+ * The GPS task is the only user of the NMEA decoder, it publishes a
+ * versioned snapshot of fix, time and quality that the UI and camera
+ * targets read without locking. Each complete RMC/GGA pair is published as
+ * it is decoded, valid fixes are forwarded to the cameras at the configured
+ * rate, independent of the display.
+ *
+ * The receive buffer is drained in bulk on each data event, only RMC and
+ * GGA sentences reach the decoder. Optionally, a u-blox receiver is switched
+ * to binary UBX NAV-PVT output only, falling back to NMEA if it does not
+ * acknowledge the configuration.
+ *
+ * The last live fix is kept in NVS, and the RTC is set to UTC from it. On
+ * power on a u-blox receiver is aided with them, and optionally they are
+ * offered to the cameras as a stale fix until a live fix arrives.
+ *
+ * Optionally, live fixes are recorded to the track log in flash.
+ *
+ * Where the board has a free input, the receiver PPS output disciplines a
+ * UTC microsecond clock against esp_timer, each edge is paired with the
+ * whole second fix that follows it. Without PPS the clock falls back to the
+ * system time set from the first live fix.
+ */
 class GPS {
  public:
+  typedef struct {
+    Camera::gps_t gps;
+    Camera::timesync_t timesync;
+    /** Location, date and time are all valid. */
+    bool valid;
+    /** TinyGPSLocation::Quality fix quality. */
+    char quality;
+    /** Horizontal dilution of precision. */
+    double hdop;
+    /** Time of the oldest of location, date and time, esp_timer microseconds. */
+    int64_t time;
+    /** Last fix from a previous session, time is the current UTC. */
+    bool stale;
+  } snapshot_t;
+
+  typedef struct {
+    /** Received bytes per second. */
+    uint32_t bytes;
+    /** Decoded NMEA sentences or UBX solutions per second. */
+    uint32_t sentences;
+    /** Microseconds per second spent filtering and decoding. */
+    uint32_t parseUs;
+    /** Total sentences rejected on checksum or length. */
+    uint32_t errors;
+    /** Total receive overflows. */
+    uint32_t overflows;
+    /** Clock is disciplined by PPS. */
+    bool ppsLocked;
+    /** Average PPS edge error against the clock, microseconds. */
+    uint32_t ppsJitter;
+  } stats_t;
+
   static GPS &getInstance();
 
   GPS(GPS const &) = delete;
@@ -24,7 +93,47 @@ class GPS {
   void reloadSetting(void);
   void startService(void);
 
-  TinyGPSPlus &get(void);
+  /** Reflect the published fix in the status icon, UI task only. */
+  void updateIcon(void);
+
+  /** Latest published snapshot, safe from any task. */
+  snapshot_t getSnapshot(void) const;
+
+  /** Is the snapshot a valid fix younger than MAX_AGE_MS? */
+  static bool hasFix(const snapshot_t &snapshot);
+
+  /** Receive statistics over the last STATS_MS, safe from any task. */
+  stats_t getStats(void) const;
+
+  /** Dump the track log to the console from the GPS task. */
+  void exportTrack(void);
+
+  /** Does the board have an input for the receiver PPS output? */
+  static bool isPPSAvailable(void);
+
+  /** Is the clock disciplined by PPS, safe from any task? */
+  bool isPPSLocked(void) const;
+
+  /**
+   * UTC at a local time, safe from any task.
+   *
+   * @param[in] local esp_timer microseconds.
+   *
+   * @return UTC microseconds since the epoch, 0 if UTC is unknown.
+   */
+  int64_t toUTC(int64_t local) const;
+
+  /**
+   * Local time of a UTC instant, safe from any task.
+   *
+   * @param[in] utc UTC microseconds since the epoch.
+   *
+   * @return esp_timer microseconds, 0 if UTC is unknown.
+   */
+  int64_t toLocal(int64_t utc) const;
+
+  /** Current UTC microseconds since the epoch, 0 if unknown. */
+  int64_t getUTC(void) const;
 
   void reset(void);
   void task(void);
@@ -32,15 +141,57 @@ class GPS {
  private:
   GPS() {};
 
-  static constexpr const size_t BUFFER_SIZE = 256;
+  // 10Hz multi-constellation output at 115200 baud is over 5KiB/s
+  static constexpr const size_t BUFFER_SIZE = 2048;
+  static constexpr const size_t READ_SIZE = 512;
   static constexpr const int QUEUE_SIZE = 32;
   static constexpr const uint16_t SERVICE_MS = 1000;
   static constexpr const uint32_t MAX_AGE_MS = 30 * 1000;
+  // fixes arrive with jitter around the configured rate
+  static constexpr const uint32_t RATE_SLACK_MS = 100;
+  static constexpr const uint32_t STATS_MS = 1000;
+  static constexpr const uint32_t ACK_MS = 250;
+  // the receiver may still be booting after power on
+  static constexpr const unsigned int ACK_RETRIES = 4;
+  static constexpr const uint32_t FIX_SAVE_MS = 10 * 60 * 1000;
+  // the receiver may have moved while off
+  static constexpr const uint32_t AID_POS_ACC_M = 100 * 1000;
+  static constexpr const uint16_t AID_TIME_ACC_S = 2;
+
+  typedef enum {
+    ACK_PENDING,
+    ACK_ACK,
+    ACK_NAK,
+  } ack_t;
+
+  // sentences seen since the last publish
+  static constexpr const uint8_t SENTENCE_RMC = (1 << 0);
+  static constexpr const uint8_t SENTENCE_GGA = (1 << 1);
 
   void enable(void);
   void disable(void);
   void serviceSerial(void);
-  void update(void);
+  void receive(size_t bytes);
+  void decode(const char *sentence, size_t length);
+  void decode(const UBXParser::frame_t &frame);
+  void updateStats(void);
+  void publish(const snapshot_t &snapshot);
+  snapshot_t getNMEASnapshot(void);
+  void configure(void);
+  void aid(void);
+  void writeUBX(uint8_t cls, uint8_t id, const uint8_t *payload, uint16_t length);
+  bool sendUBX(uint8_t cls, uint8_t id, const uint8_t *payload, uint16_t length);
+  bool isOfferingLastFix(void) const;
+  void serviceLastFix(void);
+  void saveFix(const snapshot_t &snapshot);
+  bool setMessageRate(uint8_t cls, uint8_t id, uint8_t rate);
+  void serviceTrack(void);
+  void record(const snapshot_t &snapshot);
+  static time_t getEpoch(const Camera::timesync_t &timesync);
+  static gpio_num_t getPPSPin(void);
+  static void ppsISR(void *param);
+  void attachPPS(bool enable);
+  void discipline(const snapshot_t &snapshot);
 
   uart_port_t m_UART = UART_NUM_2;
 
@@ -50,9 +201,61 @@ class GPS {
   TaskHandle_t m_Task = NULL;
   QueueHandle_t m_Queue = NULL;
 
-  bool m_Enabled = false;
-  bool m_HasFix = false;
+  std::atomic<bool> m_Enabled = false;
+  std::atomic<uint32_t> m_RateMs = SERVICE_MS;
+  const void *m_IconSrc = NULL;
   TinyGPSPlus m_GPS;
+  SeqLock<snapshot_t> m_Snapshot;
+  uint8_t m_Sentences = 0;
+  int64_t m_LastSent = 0;
+
+  std::array<char, READ_SIZE> m_Buffer;
+  NMEAFilter m_NMEA;
+  UBXParser m_UBXParser;
+  std::atomic<bool> m_Configure = false;
+  std::atomic<bool> m_UBXWanted = false;
+  std::atomic<bool> m_UBX = false;
+  ack_t m_Ack = ACK_PENDING;
+  uint8_t m_AckClass = 0;
+  uint8_t m_AckID = 0;
+
+  uint32_t m_Overflows = 0;
+  uint32_t m_RxBytes = 0;
+  uint32_t m_Decoded = 0;
+  int64_t m_ParseUs = 0;
+  int64_t m_StatsTime = 0;
+
+  // last fix, loaded on power on before m_PowerOn is raised
+  bool m_Powered = false;
+  std::atomic<bool> m_PowerOn = false;
+  int64_t m_PowerOnTime = 0;
+  Settings::gps_fix_t m_LastFix = {};
+  std::atomic<bool> m_OfferLastFix = false;
+  std::atomic<bool> m_UTCKnown = false;
+  std::atomic<bool> m_Live = false;
+  // fix status last posted to the UI, GPS task only
+  const void *m_PostedIcon = NULL;
+  bool m_Aided = false;
+  int64_t m_FirstGeotag = 0;
+  bool m_ClockSet = false;
+  int64_t m_FixSaved = 0;
+  SeqLock<stats_t> m_Stats;
+
+  // flash access stays in the GPS task
+  TrackLog m_Track;
+  bool m_TrackReady = false;
+  std::atomic<bool> m_TrackEnabled = false;
+  std::atomic<bool> m_TrackFlush = false;
+  std::atomic<bool> m_TrackExport = false;
+  // GPS task only
+  bool m_TrackExporting = false;
+
+  // latest PPS edge, overwritten from the interrupt
+  QueueHandle_t m_PPSQueue = NULL;
+  bool m_PPSAttached = false;
+  int64_t m_PPSEdge = 0;
+  PPSDiscipline m_Discipline;
+  SeqLock<PPSDiscipline::model_t> m_Clock;
 };
 }  // namespace Furble
 
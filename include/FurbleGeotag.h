@@ -0,0 +1,70 @@
+#ifndef FURBLE_GEOTAG_H
+#define FURBLE_GEOTAG_H
+
+#include <atomic>
+#include <cstdint>
+
+#include <Camera.h>
+
+namespace Furble {
+/**
+ * Per-camera geotag throttle.
+ *
+ * Applied by the control task before a GPS update is queued to a target, so
+ * suppressed updates cost no airtime and never queue ahead of shutter
+ * commands. Each camera type has a policy of minimum interval, refresh
+ * interval and minimum movement, some only accept a position on request.
+ */
+class Geotag {
+ public:
+  typedef struct {
+    /** Camera accepts geotags at all. */
+    bool enabled;
+    /** Only send when the camera has asked for a position. */
+    bool onRequest;
+    /** Never send more often than this. */
+    uint32_t minIntervalMs;
+    /** Resend an unchanged position this often. */
+    uint32_t refreshMs;
+    /** Movement that sends ahead of the refresh interval. */
+    double minDeltaDeg;
+    double minDeltaAltM;
+  } policy_t;
+
+  Geotag(Camera::Type type);
+
+  static const policy_t &getPolicy(Camera::Type type);
+
+  /**
+   * Decide whether an update is sent, counting the outcome.
+   *
+   * @param[in] gps Position to send.
+   * @param[in] now Current time in microseconds.
+   * @param[in] requested Camera has asked for a position.
+   *
+   * @return true if the update should be sent.
+   */
+  bool dispatch(const Camera::gps_t &gps, int64_t now, bool requested);
+
+  /** Forget the last sent position, the next update is sent immediately. */
+  void reset(void);
+
+  /** Number of updates sent. */
+  uint32_t getSent(void) const;
+
+  /** Number of updates suppressed. */
+  uint32_t getSuppressed(void) const;
+
+ private:
+  const policy_t &m_Policy;
+
+  bool m_HasSent = false;
+  Camera::gps_t m_Last = {};
+  int64_t m_LastTime = 0;
+
+  std::atomic<uint32_t> m_Sent = 0;
+  std::atomic<uint32_t> m_Suppressed = 0;
+};
+}  // namespace Furble
+
+#endif
@@ -0,0 +1,88 @@
+#ifndef FURBLE_NMEA_H
+#define FURBLE_NMEA_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Furble {
+/**
+ * NMEA sentence filter for bulk receive buffers.
+ *
+ * Frames sentences out of arbitrarily sized chunks and only accepts the ones
+ * the decoder uses (RMC and GGA, from any talker) with a valid checksum.
+ * Other sentences are skipped on their header without being checksummed. An
+ * accepted sentence is returned in place when it lies within one chunk, only
+ * a sentence split across chunks is assembled in a small carry buffer.
+ *
+ * No platform dependencies, so recorded logs can be replayed on a host.
+ */
+class NMEAFilter {
+ public:
+  typedef struct {
+    /** Bytes consumed. */
+    uint32_t bytes;
+    /** Sentences accepted. */
+    uint32_t sentences;
+    /** Sentences skipped on their header. */
+    uint32_t ignored;
+    /** Wanted sentences with a missing or bad checksum. */
+    uint32_t checksum;
+    /** Wanted sentences longer than MAX_SENTENCE. */
+    uint32_t oversize;
+  } stats_t;
+
+  /** Longest sentence accepted, NMEA 0183 allows 82 including the line end. */
+  static constexpr const size_t MAX_SENTENCE = 96;
+
+  /**
+   * Consume input up to the end of the next accepted sentence.
+   *
+   * @param[in,out] data Input, advanced past the consumed bytes.
+   * @param[in,out] len Input length, reduced by the consumed bytes.
+   * @param[out] length Length of the accepted sentence.
+   *
+   * @return Accepted sentence, from '$' up to and including the line end,
+   * valid until the next call. NULL once the input is exhausted.
+   */
+  const char *next(const char *&data, size_t &len, size_t &length);
+
+  /** Drop any partial sentence, eg. after receive data has been lost. */
+  void resync(void);
+
+  const stats_t &getStats(void) const;
+
+ private:
+  typedef enum {
+    STATE_IDLE,
+    STATE_HEADER,
+    STATE_BODY,
+    STATE_CHECKSUM,
+    STATE_END,
+    STATE_SKIP,
+  } state_t;
+
+  // '$' plus talker and sentence type
+  static constexpr const size_t HEADER_SIZE = 6;
+
+  static bool isWanted(const char *header);
+  static int hexValue(char c);
+
+  void append(const char *data, size_t len);
+
+  state_t m_State = STATE_IDLE;
+  uint8_t m_Parity = 0;
+  uint8_t m_Checksum = 0;
+  uint8_t m_Digits = 0;
+  size_t m_Length = 0;
+
+  // sentence split across chunks
+  bool m_Carrying = false;
+  size_t m_CarryLength = 0;
+  std::array<char, MAX_SENTENCE> m_Carry;
+
+  stats_t m_Stats = {};
+};
+}  // namespace Furble
+
+#endif
@@ -0,0 +1,84 @@
+#ifndef FURBLE_SCHEDULE_H
+#define FURBLE_SCHEDULE_H
+
+#include <cstdint>
+
+#include "program.h"
+
+namespace Furble {
+/**
+ * Frame deadlines of an intervalometer program.
+ *
+ * Every press is held as an offset from the start of the run, so rounding
+ * and late wakeups never accumulate as drift. Ramps are applied as a
+ * precomputed per-frame step or ratio, so each advance is O(1).
+ *
+ * Time is passed in by the caller rather than read from a clock, so whole
+ * runs can be replayed on a host against a virtual clock, see
+ * tools/sequencer_sim.cpp.
+ */
+class Schedule {
+ public:
+  static constexpr int64_t MIN_PERIOD_US = (10 * 1000);
+
+  /**
+   * Start a program, the first press is due wait after start.
+   *
+   * @param[in] start Start of the run, microseconds.
+   *
+   * @return false if the program has no or too many segments, or a ramp
+   *         that cannot be run.
+   */
+  bool begin(const program_t &program, int64_t start);
+
+  /**
+   * Can the segment ramp be run?
+   *
+   * An exponential ramp cannot start or end at zero, unless the value is
+   * held constant.
+   */
+  static bool isValid(const segment_t &segment);
+
+  /** Advance to the next frame, returns false if the program is complete. */
+  bool advance(void);
+
+  /** Move the remaining schedule, eg. to slip it by a camera outage. */
+  void shift(int64_t delta);
+
+  /** Absolute press deadline of the current frame. */
+  int64_t getPress(void) const;
+
+  /** Press of the current frame relative to the start. */
+  int64_t getElapsed(void) const;
+
+  /** Shutter open time of the current frame. */
+  int64_t getShutter(void) const;
+
+  /** Interval to the next frame, at least MIN_PERIOD_US. */
+  int64_t getInterval(void) const;
+
+  /** Total frames in the program, 0 if infinite. */
+  uint32_t getTotal(void) const;
+
+ private:
+  /** Load the segment and its ramp steps. */
+  void loadSegment(uint8_t index);
+
+  program_t m_Program = {};
+  uint8_t m_Segment = 0;
+  uint32_t m_SegmentFrame = 0;
+  ramp_t m_Ramp = RAMP_NONE;
+
+  // all in microseconds
+  int64_t m_Start = 0;
+  // press of the current frame relative to m_Start
+  double m_Scheduled = 0.0;
+  double m_Interval = 0.0;
+  double m_Shutter = 0.0;
+  // per-frame ramp, added for linear, multiplied for exponential
+  double m_IntervalStep = 0.0;
+  double m_ShutterStep = 0.0;
+};
+}  // namespace Furble
+
+#endif
@@ -0,0 +1,94 @@
+#ifndef FURBLE_SEQLOCK_H
+#define FURBLE_SEQLOCK_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace Furble {
+/**
+ * Single writer, multiple reader versioned snapshot.
+ *
+ * The writer bumps the sequence to odd, copies the value in and bumps the
+ * sequence to even. Readers copy the value out and retry if the sequence was
+ * odd or changed underneath them, so they never block the writer and never
+ * see a torn value. The value is held as relaxed atomic words so concurrent
+ * access is well defined.
+ *
+ * Readers spin while a store is in progress, so the writer must not be
+ * preempted mid-store by a reader on the same core.
+ */
+template <typename T>
+class SeqLock {
+  static_assert(std::is_trivially_copyable<T>::value, "SeqLock requires trivially copyable T");
+
+ public:
+  /** Initial value is all zero, at version 0. */
+  SeqLock() = default;
+
+  SeqLock(SeqLock const &) = delete;
+  SeqLock &operator=(SeqLock const &) = delete;
+
+  /** Publish a new value, only one writer may call this. */
+  void store(const T &value) {
+    std::array<uint32_t, WORDS> words = {};
+    std::memcpy(words.data(), &value, sizeof(T));
+
+    const uint32_t sequence = m_Sequence.load(std::memory_order_relaxed);
+    m_Sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (size_t i = 0; i < WORDS; i++) {
+      m_Words[i].store(words[i], std::memory_order_relaxed);
+    }
+
+    m_Sequence.store(sequence + 2, std::memory_order_release);
+  }
+
+  /** Read a consistent copy of the latest value. */
+  T load(void) const {
+    T value;
+    (void)load(value);
+    return value;
+  }
+
+  /**
+   * Read a consistent copy of the latest value.
+   *
+   * @return Version of the value read, incremented on every store.
+   */
+  uint32_t load(T &value) const {
+    std::array<uint32_t, WORDS> words;
+    uint32_t before;
+    uint32_t after;
+
+    do {
+      before = m_Sequence.load(std::memory_order_acquire);
+      for (size_t i = 0; i < WORDS; i++) {
+        words[i] = m_Words[i].load(std::memory_order_relaxed);
+      }
+      std::atomic_thread_fence(std::memory_order_acquire);
+      after = m_Sequence.load(std::memory_order_relaxed);
+    } while ((before & 1) || (before != after));
+
+    std::memcpy(&value, words.data(), sizeof(T));
+
+    return before / 2;
+  }
+
+  /** Version of the latest value, incremented on every store. */
+  uint32_t getVersion(void) const {
+    return m_Sequence.load(std::memory_order_acquire) / 2;
+  }
+
+ private:
+  static constexpr size_t WORDS = (sizeof(T) + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+
+  std::atomic<uint32_t> m_Sequence = 0;
+  std::array<std::atomic<uint32_t>, WORDS> m_Words = {};
+};
+}  // namespace Furble
+
+#endif
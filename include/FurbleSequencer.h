@@ -0,0 +1,196 @@
+#ifndef FURBLE_SEQUENCER_H
+#define FURBLE_SEQUENCER_H
+
+#include <mutex>
+#include <vector>
+
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include "FurbleSchedule.h"
+#include "FurbleShotLog.h"
+#include "interval.h"
+#include "program.h"
+
+namespace Furble {
+/**
+ * Intervalometer timing engine.
+ *
+ * Runs in a dedicated high priority task woken by a one-shot high resolution
+ * timer. Every phase is scheduled against an absolute deadline measured from
+ * the start of the sequence, so late wakeups do not accumulate as drift.
+ *
+ * Sequences are programs of one or more segments, the deadlines of which
+ * are kept by Schedule.
+ *
+ * In low power mode long gaps between phases relax the camera connection
+ * interval, restoring it shortly before the next deadline.
+ *
+ * Shutter commands go directly to each linked camera, a camera dropping out
+ * does not stall the others. Frames no camera can take are handled according
+ * to the dropout policy.
+ *
+ * In fire when ready mode the next frame fires as soon as every linked camera
+ * reports its capture complete, the schedule pulled forward to match. The
+ * programmed interval remains the upper bound, so cameras without capture
+ * reporting fall back to the fixed schedule.
+ *
+ * Camera commands are decided under the sequencer lock and sent after it
+ * is released, Control is never called with it held. The shot log is
+ * likewise copied under the lock and written to NVS after it.
+ *
+ * Frames are logged against the local timer and stamped with UTC from the
+ * GPS clock.
+ *
+ * The UI only observes the state.
+ */
+class Sequencer {
+ public:
+  typedef enum {
+    STATE_IDLE,
+    STATE_WAIT,
+    STATE_SHUTTER_OPEN,
+    STATE_DELAY,
+    STATE_FINISHED,
+  } state_t;
+
+  /**
+   * Handling of frames due whilst no camera is connected.
+   *
+   * Value is serialised to non-volatile storage, do not change ordering.
+   */
+  typedef enum {
+    /** Count the frame as missed and continue the schedule. */
+    DROPOUT_SKIP = 0,
+    /** Fire as soon as a camera reconnects, keep the schedule. */
+    DROPOUT_CATCH_UP = 1,
+    /** Fire as soon as a camera reconnects, delay the schedule to match. */
+    DROPOUT_SHIFT = 2,
+  } dropout_t;
+
+  static Sequencer &getInstance();
+
+  Sequencer(Sequencer const &) = delete;
+  Sequencer(Sequencer &&) = delete;
+  Sequencer &operator=(Sequencer const &) = delete;
+  Sequencer &operator=(Sequencer &&) = delete;
+
+  /** Start a new single segment sequence. */
+  void start(const interval_t &interval);
+
+  /** Start a new program sequence. */
+  void start(const program_t &program);
+
+  /** Convert a single interval setting to a one segment program. */
+  static program_t toProgram(const interval_t &interval);
+
+  /** Stop the sequence, releasing the shutter. */
+  void stop(void);
+
+  /** Retrieve current sequence state. */
+  state_t getState(void) const;
+
+  /** Number of frames fired in this sequence. */
+  uint32_t getCount(void) const;
+
+  /** Total frames in this sequence, 0 if infinite. */
+  uint32_t getTotal(void) const;
+
+  /** Is a low power sequence in progress? */
+  bool isLowPower(void) const;
+
+  /** Milliseconds remaining until the next phase. */
+  uint32_t getRemaining(void) const;
+
+  /** Timing summary of this sequence. */
+  ShotLog::header_t getSummary(void) const;
+
+  /**
+   * FreeRTOS sequencer task function.
+   */
+  void task(void);
+
+ private:
+  Sequencer() {};
+
+  static constexpr UBaseType_t PRIORITY = 5;
+  // restore the connection interval this far ahead of a deadline
+  static constexpr int64_t WAKE_LEAD_US = (5 * 1000 * 1000);
+  // only relax the connection interval for gaps longer than this
+  static constexpr int64_t RELAX_MIN_US = (15 * 1000 * 1000);
+  // reconnect poll period whilst holding a frame
+  static constexpr int64_t HOLD_POLL_US = (50 * 1000);
+  // camera ready poll period in fire when ready mode
+  static constexpr int64_t READY_POLL_US = (5 * 1000);
+
+  /** Work decided under the lock, done once it is released. */
+  typedef struct {
+    bool exitLowPower;
+    bool press;
+    bool release;
+    bool enterLowPower;
+    /** Serialised shot log to persist, empty if none. */
+    std::vector<uint8_t> log;
+  } action_t;
+
+  /** Send the decided commands and persist the log, the lock must not be held. */
+  void perform(const action_t &action);
+
+  /** Arm the timer to wake the task at the absolute deadline. */
+  void arm(int64_t deadline);
+
+  /** Arm the timer for m_Next, relaxing the connection if low power. */
+  void schedule(int64_t now, action_t &action);
+
+  /** Snapshot per-camera shutter counts at press, sequencer task only. */
+  void snapshotShutterCounts(void);
+
+  /** Bitmask of cameras the press was written to since the snapshot. */
+  uint32_t getDispatched(void) const;
+
+  /** Hand the shot log over to be persisted if any frames were fired. */
+  void finish(action_t &action);
+
+  /** Advance to the next frame or finish. */
+  void next(int64_t now);
+
+  /** Fire or hold the frame due at m_Next. */
+  void press(int64_t now, uint32_t linked, action_t &action);
+
+  /** Step the sequence on a wakeup, given the camera state sampled before it. */
+  action_t step(int64_t now, uint32_t linked, bool ready, uint32_t dispatched);
+
+  /** Is the next frame waiting on camera readiness? */
+  bool pacing(void) const;
+
+  TaskHandle_t m_Task = NULL;
+  esp_timer_handle_t m_Timer = NULL;
+  mutable std::mutex m_Mutex;
+  // held from deciding commands until they are sent, so a stop cannot be
+  // overtaken by a press decided before it, taken before m_Mutex
+  std::mutex m_CommandMutex;
+
+  state_t m_State = STATE_IDLE;
+  uint32_t m_Count = 0;
+  uint32_t m_Total = 0;
+  bool m_LowPower = false;
+  bool m_Relaxed = false;
+  dropout_t m_Dropout = DROPOUT_SKIP;
+  bool m_Holding = false;
+  bool m_WhenReady = false;
+
+  Schedule m_Schedule;
+  // next phase deadline, microseconds
+  int64_t m_Next = 0;
+
+  ShotLog m_Log;
+  std::vector<uint32_t> m_ShutterCounts;
+};
+}  // namespace Furble
+
+extern "C" {
+void sequencer_task(void *param);
+}
+
+#endif
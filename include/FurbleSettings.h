@@ -6,6 +6,8 @@
 #include "Preferences.h"
 
 #include "interval.h"
+#include "offsets.h"
+#include "program.h"
 
 namespace Furble {
 class Settings {
@@ -26,6 +28,19 @@ class Settings {
     FAUXNY,
     TOUCH_CALIBRATION,
     AUTOCONNECT,
+    PROGRAM,
+    LOW_POWER,
+    DROPOUT,
+    OFFSETS,
+    WHEN_READY,
+    TRIGGER_INPUT,
+    TRIGGER_DELAY,
+    GPS_RATE,
+    GPS_UBX,
+    GPS_FIX,
+    GPS_LAST_FIX,
+    GPS_TRACK,
+    GPS_PPS,
   } type_t;
 
   typedef struct {
@@ -52,6 +67,15 @@ class Settings {
     bool calibrated;
   } calibration_t;
 
+  typedef struct {
+    double latitude;
+    double longitude;
+    double altitude;
+    bool valid;
+    /** The RTC was set to UTC from this fix. */
+    bool utc;
+  } gps_fix_t;
+
   typedef struct {
     type_t type;
     const char *name;
@@ -146,6 +170,58 @@ template <>
 struct Settings::storage_type<Settings::AUTOCONNECT> {
   using type = bool;
 };
+template <>
+struct Settings::storage_type<Settings::PROGRAM> {
+  using type = program_t;
+};
+template <>
+struct Settings::storage_type<Settings::LOW_POWER> {
+  using type = bool;
+};
+template <>
+struct Settings::storage_type<Settings::DROPOUT> {
+  using type = uint8_t;
+};
+template <>
+struct Settings::storage_type<Settings::OFFSETS> {
+  using type = offsets_t;
+};
+template <>
+struct Settings::storage_type<Settings::WHEN_READY> {
+  using type = bool;
+};
+template <>
+struct Settings::storage_type<Settings::TRIGGER_INPUT> {
+  using type = bool;
+};
+template <>
+struct Settings::storage_type<Settings::TRIGGER_DELAY> {
+  using type = uint32_t;
+};
+template <>
+struct Settings::storage_type<Settings::GPS_RATE> {
+  using type = uint32_t;
+};
+template <>
+struct Settings::storage_type<Settings::GPS_UBX> {
+  using type = bool;
+};
+template <>
+struct Settings::storage_type<Settings::GPS_FIX> {
+  using type = Settings::gps_fix_t;
+};
+template <>
+struct Settings::storage_type<Settings::GPS_LAST_FIX> {
+  using type = bool;
+};
+template <>
+struct Settings::storage_type<Settings::GPS_TRACK> {
+  using type = bool;
+};
+template <>
+struct Settings::storage_type<Settings::GPS_PPS> {
+  using type = bool;
+};
 
 }  // namespace Furble
 
@@ -0,0 +1,143 @@
+#ifndef FURBLE_SHOTLOG_H
+#define FURBLE_SHOTLOG_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Preferences.h"
+
+namespace Furble {
+/**
+ * Bounded per-frame record of an intervalometer run.
+ *
+ * The most recent frames are kept in a ring buffer, statistics cover the
+ * whole run, including frames missed or delayed by camera dropouts. Each
+ * frame is stamped with UTC from the GPS clock, so logs from several units
+ * can be lined up. At the end of a run the log is persisted to NVS as a
+ * single binary blob, which can be exported over serial and decoded on a
+ * host with tools/shotlog.py.
+ */
+class ShotLog {
+ public:
+  /** Maximum number of frames retained. */
+  static constexpr size_t CAPACITY = 128;
+
+  /** Press error beyond which a frame is considered late, in microseconds. */
+  static constexpr int32_t LATE_US = (20 * 1000);
+
+  /** Blob identifier and format version, 'FSL3'. */
+  static constexpr uint32_t MAGIC = 0x334c5346;
+
+  /** Cameras representable in the per-frame bitmasks. */
+  static constexpr size_t MAX_TARGETS = 16;
+
+  /** Persisted header, little endian. */
+  typedef struct {
+    uint32_t magic;
+    /** Total frames fired. */
+    uint32_t frames;
+    /** Frames pressed later than LATE_US. */
+    uint32_t late;
+    /** Frames not fired as no camera was connected. */
+    uint32_t missed;
+    /** Frames held until a camera reconnected. */
+    uint32_t delayed;
+    /** Frames stamped against a PPS locked clock. */
+    uint32_t locked;
+    /** Press error mean, standard deviation and worst case, in microseconds. */
+    int32_t mean;
+    int32_t stddev;
+    int32_t max;
+    /** Number of shot entries following the header. */
+    uint16_t count;
+    /** Number of connected cameras. */
+    uint8_t targets;
+    uint8_t reserved;
+  } header_t;
+
+  /** Persisted per-frame entry, little endian. */
+  typedef struct {
+    /** Scheduled press, milliseconds since start of run. */
+    uint32_t scheduled;
+    /** Press error relative to schedule, in microseconds. */
+    int32_t press;
+    /** Release error relative to schedule, in microseconds. */
+    int32_t release;
+    /** Bitmask of cameras connected and sent the press, 0 if missed. */
+    uint16_t sent;
+    /**
+     * Bitmask of cameras the press was written to by the release. This is
+     * dispatch, not a capture confirmation from the camera.
+     */
+    uint16_t dispatched;
+    /** UTC of the press, or the missed deadline, microseconds since the epoch, 0 if unknown. */
+    int64_t utc;
+  } shot_t;
+
+  /** Reset the log for a new run. */
+  void begin(uint8_t targets);
+
+  /**
+   * Record a shutter press.
+   *
+   * @param[in] sent Control target bitmask.
+   * @param[in] utc UTC of the press, 0 if unknown.
+   * @param[in] locked UTC is from a PPS locked clock.
+   */
+  void press(int64_t scheduled,
+             int64_t error,
+             uint32_t sent,
+             bool delayed,
+             int64_t utc,
+             bool locked);
+
+  /** Record the matching shutter release. */
+  void release(int64_t error, uint32_t dispatched);
+
+  /** Record a frame that could not be fired at the UTC deadline. */
+  void missed(int64_t scheduled, int64_t utc);
+
+  /** Retrieve the current run summary. */
+  header_t getSummary(void) const;
+
+  /** Copy the summary and retained frames into a blob, oldest first. */
+  std::vector<uint8_t> serialise(void) const;
+
+  /** Persist a serialised log to NVS. */
+  static void save(const std::vector<uint8_t> &blob);
+
+  /** Dump the persisted log to the console as hex lines. */
+  static void dump(void);
+
+ private:
+  static constexpr const char *m_Key = "shotlog";
+  static constexpr size_t LINE_BYTES = 32;
+
+  /** Most recently recorded frame. */
+  shot_t &current(void);
+
+  /** Claim the next ring entry. */
+  shot_t &next(int64_t scheduled, int64_t utc);
+
+  static Preferences m_Prefs;
+
+  std::array<shot_t, CAPACITY> m_Shots;
+  size_t m_Head = 0;
+  size_t m_Count = 0;
+  uint8_t m_Targets = 0;
+
+  // run statistics
+  uint32_t m_Frames = 0;
+  uint32_t m_Late = 0;
+  uint32_t m_Missed = 0;
+  uint32_t m_Delayed = 0;
+  uint32_t m_Locked = 0;
+  double m_Mean = 0.0;
+  double m_M2 = 0.0;
+  int64_t m_Max = 0;
+};
+}  // namespace Furble
+
+#endif
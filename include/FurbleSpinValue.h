@@ -2,6 +2,7 @@
 #define FURBLE_SPINVALUE_H
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
 
 namespace Furble {
@@ -13,11 +14,12 @@ class SpinValue {
    * Value is serialised to non-volatile storage, do not change ordering.
    */
   typedef enum {
-    UNIT_NIL = 0,  // no units
-    UNIT_INF = 1,  // ignore value, assume infinity
-    UNIT_MS = 2,   // milliseconds
-    UNIT_SEC = 3,  // seconds
-    UNIT_MIN = 4,  // minutes
+    UNIT_NIL = 0,   // no units
+    UNIT_INF = 1,   // ignore value, assume infinity
+    UNIT_MS = 2,    // milliseconds
+    UNIT_SEC = 3,   // seconds
+    UNIT_MIN = 4,   // minutes
+    UNIT_HOUR = 5,  // hours
   } unit_t;
 
   typedef struct {
@@ -26,31 +28,63 @@ class SpinValue {
     uint32_t seconds;
   } hms_t;
 
+  /**
+   * Version 1 of the NVS spin value, whole units only.
+   */
   typedef struct __attribute__((packed)) {
     uint16_t value;
     unit_t unit;
+  } nvs_v1_t;
+
+  /**
+   * Current version of the NVS spin value.
+   *
+   * Time units are stored in thousandths of the unit (ie. 1.5 secs is 1500),
+   * covering 1us (0.001 msec) to 4294967.295 hours. Unitless values are whole
+   * numbers.
+   */
+  typedef struct __attribute__((packed)) {
+    uint32_t value;
+    unit_t unit;
   } nvs_t;
 
-  SpinValue(nvs_t &nvs);
+  /** Number of decimal places of time units. */
+  static constexpr uint32_t DECIMALS = 3;
+  static constexpr uint32_t SCALE = 1000;
+
+  SpinValue(const nvs_t &nvs);
+
+  /** Migrate version 1 value. */
+  static nvs_t fromV1(const nvs_v1_t &nvs);
 
   /** Convert to packed format suitable for non-volatile storage. */
   nvs_t toNVS(void);
 
-  /** Convert SpinValue to milliseconds. */
-  uint32_t toMilliseconds(void);
+  /** Is this a time value with decimal places? */
+  bool isTime(void) const;
+
+  /** Convert SpinValue to microseconds. */
+  uint64_t toMicroseconds(void) const;
+
+  /** Convert SpinValue to milliseconds, rounded to nearest. */
+  uint64_t toMilliseconds(void) const;
 
   /** Convert unit enumeration to string. */
   const char *getUnitString(void);
 
+  /** Format value with trailing zero decimals removed, excluding units. */
+  int toString(char *buffer, size_t length) const;
+
   /** Convert milliseconds to hours:minutes:seconds. */
   static hms_t toHMS(uint32_t ms);
 
-  uint16_t m_Value;
+  uint32_t m_Value;
   unit_t m_Unit;
 
  private:
   // Relies on the unit_t enumeration order
-  static constexpr std::array<const char *, 5> m_UnitMap = {"NIL", "INF", "msec", "secs", "mins"};
+  static constexpr std::array<const char *, 6> m_UnitMap = {"NIL",  "INF",  "msec",
+                                                            "secs", "mins", "hrs"};
 };
 }  // namespace Furble
 
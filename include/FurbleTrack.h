@@ -0,0 +1,148 @@
+#ifndef FURBLE_TRACK_H
+#define FURBLE_TRACK_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <esp_partition.h>
+
+namespace Furble {
+/**
+ * Delta encoder for GPS track points.
+ *
+ * A keyframe holds an absolute point, following points are held as the
+ * difference to the previous one: a single byte time step, then latitude,
+ * longitude and altitude as zigzag varints. At walking or driving speed a
+ * 1Hz point costs 4 to 7 bytes.
+ *
+ * Erased flash (0xff) never starts a record, so the end of a partially
+ * written sector is found by decoding up to the first 0xff.
+ */
+class TrackEncoder {
+ public:
+  typedef struct {
+    /** UTC, seconds since the epoch. */
+    uint32_t time;
+    /** Degrees scaled by 1e6, about 0.1m. */
+    int32_t latitude;
+    int32_t longitude;
+    /** Metres. */
+    int32_t altitude;
+  } point_t;
+
+  static constexpr const size_t KEYFRAME_SIZE = 15;
+  static constexpr const size_t MAX_RECORD = 16;
+
+  /**
+   * Encode a point.
+   *
+   * @param[in] point Point, later than the previous one.
+   * @param[out] buffer At least MAX_RECORD bytes.
+   *
+   * @return Bytes written.
+   */
+  size_t encode(const point_t &point, uint8_t *buffer);
+
+  /** Encode the next point as a keyframe. */
+  void reset(void);
+
+  /**
+   * Length of the record at the start of the buffer.
+   *
+   * @return Record length, 0 for erased flash, a corrupt or truncated record.
+   */
+  static size_t length(const uint8_t *buffer, size_t size);
+
+ private:
+  static constexpr const uint8_t KEYFRAME = 0x00;
+  // time step held in 6 bits
+  static constexpr const uint32_t MAX_STEP = 63;
+
+  bool m_HasLast = false;
+  point_t m_Last = {};
+};
+
+/**
+ * GPS track log in the 'track' flash partition.
+ *
+ * For cameras that do not accept live location, photos can be geotagged
+ * afterwards from the track. The partition is a ring of sectors, each
+ * starting with a header and a keyframe so it decodes on its own. Points
+ * are buffered in RAM and appended in batches; the oldest sector is erased
+ * as the ring wraps. Stationary points are thinned to one per HEARTBEAT_S.
+ *
+ * Export writes the sectors holding points as hex lines to the console,
+ * oldest first, converted to GPX on a host with tools/tracklog.py. It runs a
+ * chunk at a time, so the caller keeps servicing the receiver in between.
+ */
+class TrackLog {
+ public:
+  /** Sector header identifier and format version, 'FTK1'. */
+  static constexpr const uint32_t MAGIC = 0x314b5446;
+
+  typedef struct {
+    uint32_t magic;
+    /** Incremented for each sector written. */
+    uint32_t sequence;
+  } header_t;
+
+  /** Locate the partition and resume after the newest sector. */
+  bool begin(void);
+
+  /** Add a point, dropped if too soon or not moved. */
+  void add(const TrackEncoder::point_t &point);
+
+  /** Write any buffered points. */
+  void flush(void);
+
+  /** Start dumping the track to the console as hex lines. */
+  void beginDump(void);
+
+  /**
+   * Dump the next chunk of the track.
+   *
+   * @return true whilst more of the track remains.
+   */
+  bool dumpNext(void);
+
+ private:
+  static constexpr const uint32_t SECTOR_SIZE = 4096;
+  static constexpr const size_t BATCH_SIZE = 512;
+  static constexpr const uint32_t FLUSH_S = 5 * 60;
+  static constexpr const uint32_t HEARTBEAT_S = 60;
+  // about 3m
+  static constexpr const int32_t MIN_MOVE = 30;
+  static constexpr const size_t LINE_BYTES = 32;
+  // about 0.2s of console output at 115200 baud
+  static constexpr const size_t DUMP_CHUNK = 1024;
+
+  /** Bytes used in a sector read into buffer, header included. */
+  static size_t getUsed(const uint8_t *buffer);
+  void nextSector(void);
+
+  const esp_partition_t *m_Partition = NULL;
+  uint32_t m_Sectors = 0;
+  uint32_t m_Sector = 0;
+  uint32_t m_Sequence = 0;
+  uint32_t m_Offset = 0;
+
+  TrackEncoder m_Encoder;
+  bool m_HasLast = false;
+  TrackEncoder::point_t m_Last = {};
+  uint32_t m_Flushed = 0;
+
+  std::array<uint8_t, BATCH_SIZE> m_Batch;
+  size_t m_Pending = 0;
+
+  // export in progress, the sector being dumped is held until complete
+  std::vector<uint8_t> m_Dump;
+  uint32_t m_DumpFirst = 0;
+  uint32_t m_DumpIndex = 0;
+  size_t m_DumpOffset = 0;
+  size_t m_DumpUsed = 0;
+};
+}  // namespace Furble
+
+#endif
@@ -0,0 +1,138 @@
+#ifndef FURBLE_TRIGGER_H
+#define FURBLE_TRIGGER_H
+
+#include <array>
+#include <atomic>
+
+#include <driver/gpio.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+
+#include "FurbleEdge.h"
+
+namespace Furble {
+/**
+ * Low latency hardware shutter path.
+ *
+ * The shutter button raises a GPIO interrupt that timestamps the edge and
+ * wakes a dedicated high priority task, which sends the shutter command
+ * directly to each linked camera. The edge timestamp is the common trigger
+ * time, so per-camera offsets and edge to write latency are measured from
+ * the physical press.
+ *
+ * The UI still sees the button through the polled input device and only
+ * updates its state, it must not send the shutter command itself whilst the
+ * trigger is armed.
+ *
+ * An external sync source (strobe sync out, sound or light trigger, another
+ * controller) on the Grove port A input can also fire the cameras, after a
+ * configurable delay. The input shares the pin with the GPS UART, so GPS is
+ * disabled whilst the trigger input is enabled.
+ */
+class Trigger {
+ public:
+  static Trigger &getInstance();
+
+  Trigger(Trigger const &) = delete;
+  Trigger(Trigger &&) = delete;
+  Trigger &operator=(Trigger const &) = delete;
+  Trigger &operator=(Trigger &&) = delete;
+
+  /**
+   * Attach the interrupt to the board shutter button, if it has one, and
+   * the external trigger input, if enabled.
+   */
+  void begin(void);
+
+  /** Does this board have a hardware shutter path? */
+  bool isAvailable(void) const;
+
+  /**
+   * Arm or disarm the shutter path.
+   *
+   * Edges are only forwarded to the cameras whilst armed.
+   */
+  void setArmed(bool armed);
+
+  /** Is the shutter path armed? */
+  bool isArmed(void) const;
+
+  /** Refresh the trigger input settings from NVS. */
+  void reloadSetting(void);
+
+  /** Is the external trigger input enabled? */
+  bool isInputEnabled(void) const;
+
+  /**
+   * FreeRTOS trigger task function.
+   */
+  void task(void);
+
+ private:
+  Trigger();
+
+  typedef enum {
+    SOURCE_BUTTON,
+    SOURCE_INPUT,
+    SOURCE_MAX,
+  } source_t;
+
+  typedef struct {
+    source_t source;
+    /** Edge time, esp_timer microseconds. */
+    int64_t time;
+    /** Pin level after the edge. */
+    int level;
+  } edge_t;
+
+  typedef struct {
+    Trigger *trigger;
+    source_t source;
+    gpio_num_t pin;
+    EdgeFilter filter;
+  } input_t;
+
+  static constexpr UBaseType_t PRIORITY = 6;
+  static constexpr UBaseType_t QUEUE_LENGTH = 8;
+  // contact bounce settles well within this
+  static constexpr uint32_t DEBOUNCE_MS = 5;
+  static constexpr int64_t DEBOUNCE_US = (DEBOUNCE_MS * 1000);
+  // minimum shutter hold for short external sync pulses
+  static constexpr int64_t INPUT_HOLD_US = (50 * 1000);
+
+  /** Shutter button GPIO for this board, GPIO_NUM_NC if none. */
+  static gpio_num_t getShutterPin(void);
+
+  static void isr(void *param);
+
+  /** Attach an input pin, return false on failure. */
+  bool attach(input_t &input, gpio_num_t pin);
+
+  /** Detach an input pin. */
+  void detach(input_t &input);
+
+  /** Filter a raw edge and forward accepted edges to the cameras. */
+  void handle(input_t &input, int64_t time, int level);
+
+  /** Is any input waiting for its debounce period to expire? */
+  bool isPending(void) const;
+
+  TaskHandle_t m_Task = NULL;
+  QueueHandle_t m_Queue = NULL;
+  std::array<input_t, SOURCE_MAX> m_Input;
+  bool m_ServiceInstalled = false;
+
+  std::atomic<bool> m_Armed = false;
+
+  std::atomic<uint32_t> m_Delay = 0;
+  uint32_t m_InputCount = 0;
+  int64_t m_InputPress = 0;
+};
+}  // namespace Furble
+
+extern "C" {
+void trigger_task(void *param);
+}
+
+#endif
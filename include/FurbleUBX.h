@@ -0,0 +1,182 @@
+#ifndef FURBLE_UBX_H
+#define FURBLE_UBX_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace Furble {
+/**
+ * u-blox UBX binary protocol framing.
+ *
+ * Frames are located by their sync characters in arbitrarily sized chunks,
+ * so interleaved NMEA text is skipped, and returned once the checksum
+ * verifies. Only the messages furble uses are decoded.
+ *
+ * No platform dependencies, so captured frames can be replayed on a host.
+ */
+class UBXParser {
+ public:
+  typedef struct {
+    uint8_t cls;
+    uint8_t id;
+    uint16_t length;
+    /** Valid until the next call to next(). */
+    const uint8_t *payload;
+  } frame_t;
+
+  typedef struct {
+    /** Bytes consumed. */
+    uint32_t bytes;
+    /** Frames accepted. */
+    uint32_t frames;
+    /** Frames with a bad checksum. */
+    uint32_t checksum;
+    /** Frames longer than MAX_PAYLOAD. */
+    uint32_t oversize;
+  } stats_t;
+
+  /** Navigation position velocity time solution, UBX-NAV-PVT. */
+  typedef struct {
+    /** GPS time of week of the navigation epoch, milliseconds. */
+    uint32_t iTOW;
+    /** UTC date and time, truncated to the second. */
+    uint16_t year;
+    uint8_t month;
+    uint8_t day;
+    uint8_t hour;
+    uint8_t minute;
+    uint8_t second;
+    /** VALID_* flags. */
+    uint8_t valid;
+    /** Time accuracy estimate, nanoseconds. */
+    uint32_t tAcc;
+    /** Fraction of second, 0..1e9 nanoseconds. */
+    int32_t nano;
+    /** FIX_* type. */
+    uint8_t fixType;
+    /** FLAGS_* flags. */
+    uint8_t flags;
+    uint8_t numSV;
+    /** Degrees scaled by 1e-7. */
+    int32_t lon;
+    int32_t lat;
+    /** Height above mean sea level, millimetres. */
+    int32_t hMSL;
+    /** Horizontal and vertical accuracy estimate, millimetres. */
+    uint32_t hAcc;
+    uint32_t vAcc;
+    /** Position dilution of precision, scaled by 0.01. */
+    uint16_t pDOP;
+  } pvt_t;
+
+  static constexpr const uint8_t CLASS_NAV = 0x01;
+  static constexpr const uint8_t CLASS_ACK = 0x05;
+  static constexpr const uint8_t CLASS_CFG = 0x06;
+  static constexpr const uint8_t CLASS_MGA = 0x13;
+  static constexpr const uint8_t CLASS_NMEA = 0xf0;
+
+  static constexpr const uint8_t ID_NAV_PVT = 0x07;
+  static constexpr const uint8_t ID_ACK_NAK = 0x00;
+  static constexpr const uint8_t ID_ACK_ACK = 0x01;
+  static constexpr const uint8_t ID_CFG_MSG = 0x01;
+  static constexpr const uint8_t ID_CFG_RATE = 0x08;
+  static constexpr const uint8_t ID_MGA_INI = 0x40;
+
+  static constexpr const uint8_t MGA_INI_POS_LLH = 0x01;
+  static constexpr const uint8_t MGA_INI_TIME_UTC = 0x10;
+  static constexpr const uint16_t MGA_INI_POS_LLH_LENGTH = 20;
+  static constexpr const uint16_t MGA_INI_TIME_UTC_LENGTH = 24;
+
+  static constexpr const uint8_t VALID_DATE = (1 << 0);
+  static constexpr const uint8_t VALID_TIME = (1 << 1);
+  static constexpr const uint8_t FLAGS_GNSS_FIX_OK = (1 << 0);
+  static constexpr const uint8_t FIX_2D = 2;
+  static constexpr const uint8_t FIX_3D = 3;
+  static constexpr const uint8_t FIX_GNSS_DR = 4;
+
+  /** Largest payload accepted, NAV-PVT is the largest message used. */
+  static constexpr const size_t MAX_PAYLOAD = 100;
+  /** Sync, class, id, length and checksum. */
+  static constexpr const size_t OVERHEAD = 8;
+  static constexpr const uint16_t PVT_LENGTH = 92;
+
+  /**
+   * Consume input up to the end of the next valid frame.
+   *
+   * @param[in,out] data Input, advanced past the consumed bytes.
+   * @param[in,out] len Input length, reduced by the consumed bytes.
+   * @param[out] frame Frame found.
+   *
+   * @return true if a frame was found, false once the input is exhausted.
+   */
+  bool next(const uint8_t *&data, size_t &len, frame_t &frame);
+
+  /** Drop any partial frame, eg. after receive data has been lost. */
+  void resync(void);
+
+  const stats_t &getStats(void) const;
+
+  /**
+   * Build a frame.
+   *
+   * @return Frame length, 0 if it does not fit.
+   */
+  static size_t encode(uint8_t *buffer,
+                       size_t size,
+                       uint8_t cls,
+                       uint8_t id,
+                       const uint8_t *payload,
+                       uint16_t length);
+
+  /** Write a little endian payload field. */
+  template <typename T>
+  static void put(uint8_t *payload, size_t offset, T value) {
+    std::memcpy(&payload[offset], &value, sizeof(T));
+  }
+
+  /**
+   * Decode a NAV-PVT frame, false if it is not one.
+   *
+   * The receiver rounds the time to the nearest second with a signed
+   * fraction, the time is moved back a second where needed so the fraction
+   * is always positive.
+   */
+  static bool decodePVT(const frame_t &frame, pvt_t &pvt);
+
+  /** Is the solution a usable 2D or 3D fix? */
+  static bool hasFix(const pvt_t &pvt);
+
+ private:
+  typedef enum {
+    STATE_SYNC1,
+    STATE_SYNC2,
+    STATE_CLASS,
+    STATE_ID,
+    STATE_LENGTH1,
+    STATE_LENGTH2,
+    STATE_PAYLOAD,
+    STATE_CK_A,
+    STATE_CK_B,
+  } state_t;
+
+  static constexpr const uint8_t SYNC1 = 0xb5;
+  static constexpr const uint8_t SYNC2 = 0x62;
+
+  void checksum(uint8_t c);
+
+  state_t m_State = STATE_SYNC1;
+  uint8_t m_Class = 0;
+  uint8_t m_ID = 0;
+  uint16_t m_Length = 0;
+  uint16_t m_Offset = 0;
+  uint8_t m_CkA = 0;
+  uint8_t m_CkB = 0;
+  std::array<uint8_t, MAX_PAYLOAD> m_Payload;
+
+  stats_t m_Stats = {};
+};
+}  // namespace Furble
+
+#endif
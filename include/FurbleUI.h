@@ -1,6 +1,7 @@
 #ifndef FURBLE_UI_H
 #define FURBLE_UI_H
 
+#include <atomic>
 #include <initializer_list>
 #include <mutex>
 #include <unordered_map>
@@ -12,6 +13,7 @@
 #include "FurbleGPS.h"
 #include "FurbleSettings.h"
 #include "interval.h"
+#include "program.h"
 
 namespace Furble {
 class UI {
@@ -23,10 +25,33 @@ class UI {
    */
   enum class ControlMode { MENU, SHUTTER, SLIDER, REVERT };
 
+  /** Status changes published to the UI task. */
+  typedef enum {
+    /** Control state or connecting camera changed. */
+    EVENT_CONNECT = (1 << 0),
+    /** GPS enabled or fix status changed. */
+    EVENT_GPS = (1 << 1),
+    /** Screen lock toggled. */
+    EVENT_LOCK = (1 << 2),
+  } event_t;
+
   UI(const interval_t &interval);
 
+  /**
+   * UI task, sleeps until the next LVGL timer deadline, capped by the input
+   * poll period for the current display state.
+   */
   void task(void);
 
+  /** Wake the UI task ahead of its next deadline, safe from any task. */
+  static void wake(void);
+
+  /**
+   * Publish a status change, the UI task refreshes the affected objects on
+   * its next iteration, safe from any task.
+   */
+  static void post(event_t event);
+
   /** Set inactivity timeout in multiples of 30s. */
   void setInactivityTimeout(uint8_t timeout);
 
@@ -62,6 +87,11 @@ class UI {
     lv_obj_t *page;
     lv_obj_t *button;
     grid_position_t grid;
+    /** Builds the page contents on first load, NULL if built with the menu. */
+    void (UI::*build)(lv_obj_t *page);
+    /** Page contents are deleted when the page is left. */
+    bool transient;
+    bool built;
   } menu_t;
 
   typedef struct {
@@ -71,9 +101,30 @@ class UI {
     lv_obj_t *reconnectIcon;
     lv_obj_t *gpsBaud;
     lv_obj_t *gpsData;
+    lv_obj_t *gpsRate;
+    lv_obj_t *gpsUBX;
+    lv_obj_t *gpsLastFix;
+    lv_obj_t *gpsTrack;
+    lv_obj_t *gpsPPS;
+    lv_obj_t *triggerDelay;
     bool screenLocked;
   } status_t;
 
+  /** 'GPS Data' page labels and refresh timer, NULL whilst the page is not shown. */
+  typedef struct {
+    lv_timer_t *timer;
+    lv_obj_t *age;
+    lv_obj_t *satellites;
+    lv_obj_t *latitude;
+    lv_obj_t *longitude;
+    lv_obj_t *altitude;
+    lv_obj_t *date;
+    lv_obj_t *time;
+    lv_obj_t *rx;
+    lv_obj_t *errors;
+    lv_obj_t *pps;
+  } gps_data_t;
+
   class Intervalometer {
    public:
     class Spinner {
@@ -81,8 +132,11 @@ class UI {
       Spinner(Intervalometer *intervalometer, SpinValue::nvs_t nvs, bool infinite = false)
           : m_Intervalometer {intervalometer}, m_SpinValue {nvs}, m_Infinite {infinite} {};
 
-      static constexpr const char *m_SpinDigitRoller = "0\n1\n2\n3\n4\n5\n6\n7\n8\n9";
-      static constexpr const char *m_SpinUnitsRoller = "msec\nsecs\nmins";
+      static constexpr const char *m_SpinUnitsRoller = "msec\nsecs\nmins\nhrs";
+      // unitless counts, whole numbers only
+      static constexpr uint32_t m_CountDigits = 4;
+      // time values, thousandths of the selected unit
+      static constexpr uint32_t m_TimeDigits = 6;
 
       void update(void);
       void updateLabels(void);
@@ -93,28 +147,39 @@ class UI {
       lv_obj_t *m_Label;
       lv_obj_t *m_Value;
       const bool m_Infinite;  // Can support infinite?
-      lv_obj_t *m_RowInfinite;
-      lv_obj_t *m_SwitchInfinite;
+      // spinner page objects, NULL whilst the page is not shown
+      lv_obj_t *m_RowInfinite = nullptr;
+      lv_obj_t *m_SwitchInfinite = nullptr;
 
-      lv_obj_t *m_RowSpinners;
-      // array of rollers, 0 = hundred, 1 = ten, 2 = one
-      std::array<lv_obj_t *, 3> m_Roller = {nullptr, nullptr, nullptr};
+      lv_obj_t *m_RowSpinners = nullptr;
+      lv_obj_t *m_Spinbox = nullptr;
       lv_obj_t *m_RollerUnit = nullptr;
     };
 
-    typedef enum {
-      STATE_IDLE,
-      STATE_WAIT,
-      STATE_SHUTTER_OPEN,
-      STATE_DELAY,
-      STATE_FINISHED,
-    } state_t;
-
     Intervalometer(const interval_t &interval);
 
+    /** Convert spinner values to interval setting. */
+    interval_t toInterval(void);
+
     void save(void);
 
-    state_t m_State;
+    /**
+     * Append spinner values as a program segment.
+     *
+     * Ramps start from the end of the previous segment, or for the first
+     * segment from the spinner values when the program was last cleared.
+     *
+     * @return false if the program is full, ends in an infinite segment or
+     *         the ramp cannot be run.
+     */
+    bool appendSegment(ramp_t ramp);
+
+    /** Remove all program segments, the spinner values start the next ramp. */
+    void clearProgram(void);
+
+    /** Refresh the program summary label and Start button. */
+    void updateProgramLabel(void);
+
     Spinner m_Count;
     Spinner m_Delay;
     Spinner m_Shutter;
@@ -123,6 +188,17 @@ class UI {
     lv_obj_t *m_StateLabel;
     lv_obj_t *m_CountLabel;
     lv_obj_t *m_RemainingLabel;
+    lv_obj_t *m_SummaryLabel;
+
+    program_t m_Program;
+    // program page objects, NULL until the page is first shown
+    lv_obj_t *m_ProgramLabel = nullptr;
+    lv_obj_t *m_ProgramStart = nullptr;
+    /** Interval and shutter the next ramp starts from. */
+    segment_t m_RampFrom;
+
+    /** Start ramps of an empty program from the spinner values. */
+    void resetRamp(void);
   };
 
   typedef enum { MODE_SCAN, MODE_DELETE, MODE_CONNECT, MODE_MULTICONNECT } CameraListMode_t;
@@ -134,6 +210,8 @@ class UI {
     lv_obj_t *bar;
     lv_obj_t *cancel;
     const char *menuName;
+    /** Connection in progress or established, from doConnect() until doDisconnect(). */
+    bool active;
   } ConnectContext_t;
 
   static std::mutex m_Mutex;
@@ -189,8 +267,16 @@ class UI {
   static constexpr const char *m_IntervalDelayStr = "Delay";
   static constexpr const char *m_IntervalShutterStr = "Shutter";
   static constexpr const char *m_IntervalWaitStr = "Wait";
+  static constexpr const char *m_IntervalProgramStr = "Program";
+  static constexpr const char *m_IntervalOffsetsStr = "Offsets";
 
-  static constexpr uint8_t BYTES_PER_PIXEL = (LV_COLOR_FORMAT_GET_SIZE(LV_COLOR_FORMAT_RGB565));
+#if LV_DRAW_SW_SUPPORT_RGB565_SWAPPED
+  // render in panel byte order, so flushing is DMA only
+  static constexpr lv_color_format_t COLOR_FORMAT = LV_COLOR_FORMAT_RGB565_SWAPPED;
+#else
+  static constexpr lv_color_format_t COLOR_FORMAT = LV_COLOR_FORMAT_RGB565;
+#endif
+  static constexpr uint8_t BYTES_PER_PIXEL = (LV_COLOR_FORMAT_GET_SIZE(COLOR_FORMAT));
   static constexpr int32_t MAX_WIDTH = 320;
   static constexpr int32_t MAX_HEIGHT = 240;
   static constexpr size_t BUFFER_SIZE = (UI::MAX_WIDTH * (MAX_HEIGHT / 15) * UI::BYTES_PER_PIXEL);
@@ -203,14 +289,15 @@ class UI {
 
   static constexpr int32_t ICON_HEADER_SIZE = 24;
 
+  // synchronised shots are at least this far ahead, so every unit can be armed
+  static constexpr int64_t SYNC_LEAD_US = (5 * 1000 * 1000);
+
   LV_ATTRIBUTE_MEM_ALIGN void *m_Buffer1;
   LV_ATTRIBUTE_MEM_ALIGN void *m_Buffer2;
 
   static lv_timer_t *m_ConnectTimer;
   static lv_timer_t *m_IntervalPageRefresh;
-  static uint32_t m_IntervalNext;
 
-  lv_timer_t *m_IntervalTimer;
   lv_timer_t *m_InactivityTimer;
   lv_timer_t *m_IconTimer;
 
@@ -246,14 +333,54 @@ class UI {
   ControlMode m_ControlMode = ControlMode::MENU;
 
   lv_obj_t *m_IntervalStart = nullptr;
+  lv_obj_t *m_OffsetsButton = nullptr;
+  lv_obj_t *m_SyncShotButton = nullptr;
   Intervalometer m_Intervalometer;
 
-  status_t m_Status;
+  status_t m_Status = {};
+  gps_data_t m_GPSData = {};
   bool m_FocusPressed = false;
   bool m_ShutterLock = false;
   uint32_t m_InactivityTimeout;
   uint32_t m_MainCount = 0;
 
+  // low power intervalometer display blanking
+  static constexpr uint32_t LOW_POWER_BLANK_MS = (10 * 1000);
+  static constexpr uint32_t LOW_POWER_POLL_MS = 100;
+  bool m_Blanked = false;
+
+  // input poll periods, short presses must still be seen whilst dimmed
+  static constexpr uint32_t ACTIVE_POLL_MS = 20;
+  static constexpr uint32_t INACTIVE_POLL_MS = 50;
+  static constexpr int64_t WAKEUP_REPORT_US = (10 * 1000 * 1000);
+  static TaskHandle_t m_Task;
+  static std::atomic<uint32_t> m_Events;
+  bool m_Inactive = false;
+  uint32_t m_Wakeups = 0;
+  int64_t m_WakeupTime = 0;
+
+  /** Set the LVGL input device read period. */
+  void setInputPeriod(uint32_t period);
+
+  /** Log UI task wakeups per second and battery current per display state. */
+  void reportWakeups(bool blanked);
+
+  /** Refresh the objects affected by posted status changes. */
+  void handleEvents(uint32_t events);
+
+  // battery level has no change event, sample it slowly
+#if FURBLE_BATTERY_DEBUG == 1
+  static constexpr uint32_t BATTERY_POLL_MS = 250;
+#else
+  static constexpr uint32_t BATTERY_POLL_MS = (5 * 1000);
+#endif
+
+  /** Refresh the battery icon if the level changed. */
+  static void updateBattery(status_t *status);
+
+  /** Show or close the screen locked message box. */
+  static void updateLockScreen(status_t *status);
+
   static menu_t m_MainMenu;
 
   static std::unordered_map<const char *, menu_t> m_Menu;
@@ -272,6 +399,23 @@ class UI {
   /** Flush display. */
   static void displayFlush(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map);
 
+#if FURBLE_FLUSH_PROFILE == 1
+  typedef struct {
+    int64_t renderStart;
+    int64_t renderUs;
+    int64_t flushUs;
+    uint64_t pixels;
+    uint32_t frames;
+    int64_t reported;
+  } flush_profile_t;
+
+  static constexpr int64_t FLUSH_PROFILE_US = (5 * 1000 * 1000);
+  static flush_profile_t m_FlushProfile;
+
+  /** Time each frame render, logging CPU time per flushed pixel. */
+  static void profileRender(lv_event_t *e);
+#endif
+
   /** LVGL tick function. */
   static uint32_t tick(void);
 
@@ -322,6 +466,18 @@ class UI {
   /** Add 'GPS Data' page. */
   void addGPSMenu(const menu_t &parent);
 
+  /** Build the 'GPS Data' page contents and start its refresh. */
+  void buildGPSDataPage(lv_obj_t *page);
+
+  /** Refresh the 'GPS Data' page labels. */
+  static void updateGPSData(lv_timer_t *timer);
+
+  /** Add the GPS camera update rate menu item. */
+  void addGPSRateItem(lv_obj_t *page);
+
+  /** Add the trigger input delay menu item. */
+  void addTriggerDelayItem(lv_obj_t *page);
+
   /** Add the 'Features' menu entry. */
   void addFeaturesMenu(const menu_t &parent);
 
@@ -334,13 +490,44 @@ class UI {
   /** Add the spinner page menu entry. */
   void addSpinnerPage(const menu_t &parent, const char *item, Intervalometer::Spinner &spinner);
 
+  /** Add the intervalometer dropout policy menu item. */
+  void addDropoutItem(lv_obj_t *page);
+
+  /** Add the menu item firing all cameras at the next whole UTC minute. */
+  void addSyncShotItem(lv_obj_t *page);
+
+  /** Add the intervalometer program page menu entry. */
+  void addProgramPage(const menu_t &parent);
+  void buildProgramPage(lv_obj_t *page);
+
+  /** Add the multi-connect trigger offsets page menu entry. */
+  void addOffsetsPage(const menu_t &parent);
+  void buildOffsetsPage(lv_obj_t *page);
+
+  /** Build the spinner page contents. */
+  void buildSpinnerPage(lv_obj_t *page);
+
   void addDisplayMenu(const menu_t &parent);
+  void buildDisplayPage(lv_obj_t *page);
 
   void addThemeMenu(const menu_t &parent);
+  void buildThemePage(lv_obj_t *page);
 
   void addTransmitPowerMenu(const menu_t &parent);
+  void buildTransmitPowerPage(lv_obj_t *page);
 
   void addAboutMenu(const menu_t &parent);
+  void buildAboutPage(lv_obj_t *page);
+
+  /**
+   * Defer building the menu page until it is first loaded.
+   *
+   * @param[in] transient Delete the page contents again when it is left.
+   */
+  static void setPageBuilder(menu_t &menu, void (UI::*build)(lv_obj_t *page), bool transient);
+
+  /** Build the page about to be shown and drop any transient page left. */
+  void loadPage(lv_obj_t *page);
 
   /** Add the 'Settings' menu entry. */
   void addSettingsMenu(void);
@@ -351,8 +538,8 @@ class UI {
   /** Update entries in connect page. */
   static void updateItems(const menu_t &menu);
 
-  /** Stop GPS Data timer. */
-  static void gpsDataStop(lv_event_t *e);
+  /** Show the GPS items only while GPS is enabled. */
+  static void updateGPSItems(const status_t *status);
 
   /** Handle connection request. */
   static void doConnect(lv_event_t *e);
@@ -363,10 +550,16 @@ class UI {
   /** Refresh deletion items. */
   static void refreshDelete(void);
 
-  /** Connection timer handler. */
+  // connection progress has no change event, follow it only whilst connecting
+  static constexpr uint32_t CONNECT_PROGRESS_MS = 50;
+
+  /** Connection progress timer handler. */
   static void connectTimerHandler(lv_timer_t *timer);
 
-  /** Intervalometer timer handler. */
+  /** Reflect the control state in the connection message box. */
+  static void updateConnect(ConnectContext_t *ctx);
+
+  /** Intervalometer page refresh handler. */
   static void intervalometer(lv_timer_t *timer);
 
   /** Handle shutter event. */
@@ -387,8 +580,18 @@ class UI {
   /** Configure slider control. */
   void configSliderControl(void);
 
+  /** Arm the hardware shutter path whilst the shutter is directly controlled. */
+  void updateTrigger(bool active);
+
   /** Check lock screen activity. */
   void handleLockScreen(void);
+
+  /**
+   * Blank the display during low power intervalometer runs.
+   *
+   * @return true if rendering is suspended.
+   */
+  bool handleLowPower(void);
 };
 }  // namespace Furble
 
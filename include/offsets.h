@@ -0,0 +1,31 @@
+#ifndef OFFSETS_H
+#define OFFSETS_H
+
+#include <cstdint>
+
+namespace Furble {
+
+constexpr uint8_t OFFSETS_MAX = 8;
+
+/**
+ * Trigger offset of a single camera.
+ */
+typedef struct __attribute__((packed)) {
+  /** Camera BLE address. */
+  uint64_t address;
+  /** Delay from the common trigger time, in microseconds. */
+  uint32_t offset;
+} offset_t;
+
+/**
+ * NVS multi-connect trigger offsets, one entry per camera with a non-zero
+ * offset.
+ */
+typedef struct __attribute__((packed)) {
+  uint8_t count;
+  offset_t entry[OFFSETS_MAX];
+} offsets_t;
+
+}  // namespace Furble
+
+#endif
@@ -0,0 +1,76 @@
+#ifndef PROGRAM_H
+#define PROGRAM_H
+
+#include <cstdint>
+
+namespace Furble {
+
+constexpr uint8_t PROGRAM_VERSION = 2;
+constexpr uint8_t PROGRAM_MAX_SEGMENTS = 8;
+
+/**
+ * Segment ramp type.
+ *
+ * Value is serialised to non-volatile storage, do not change ordering.
+ */
+typedef enum : uint8_t {
+  RAMP_NONE = 0,         // constant interval and shutter
+  RAMP_LINEAR = 1,       // fixed step per frame
+  RAMP_EXPONENTIAL = 2,  // fixed ratio per frame
+} ramp_t;
+
+/**
+ * Version 1 of the program segment, in milliseconds.
+ */
+typedef struct __attribute__((packed)) {
+  uint16_t count;
+  ramp_t ramp;
+  uint32_t interval;
+  uint32_t intervalEnd;
+  uint32_t shutter;
+  uint32_t shutterEnd;
+} segment_v1_t;
+
+/**
+ * Version 1 of the NVS intervalometer program setting.
+ */
+typedef struct __attribute__((packed)) {
+  uint8_t version;
+  uint8_t count;
+  uint32_t wait;
+  segment_v1_t segment[PROGRAM_MAX_SEGMENTS];
+} program_v1_t;
+
+/**
+ * Intervalometer program segment.
+ *
+ * Interval is measured shutter press to shutter press. With a ramp, interval
+ * and shutter move from the start value on the first frame to the end value
+ * on the last frame of the segment.
+ */
+typedef struct __attribute__((packed)) {
+  /** Number of frames, 0 is infinite and only valid as the last segment. */
+  uint16_t count;
+  ramp_t ramp;
+  /** Microseconds, as edited in the spinners. */
+  uint64_t interval;
+  uint64_t intervalEnd;
+  uint64_t shutter;
+  uint64_t shutterEnd;
+} segment_t;
+
+/**
+ * Current version of the NVS intervalometer program setting.
+ */
+typedef struct __attribute__((packed)) {
+  uint8_t version;
+  /** Number of valid segments. */
+  uint8_t count;
+  /** Microseconds before the first frame. */
+  uint64_t wait;
+  segment_t segment[PROGRAM_MAX_SEGMENTS];
+} program_t;
+
+}  // namespace Furble
+
+#endif
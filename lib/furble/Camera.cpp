@@ -21,6 +21,7 @@ void Camera::onConnect(NimBLEClient *pClient) {
 void Camera::onDisconnect(NimBLEClient *pClient, int reason) {
   ESP_LOGI(LOG_TAG, "Disconnected");
   m_Connected = false;
+  m_ReportsCapture = false;
   m_Progress = 0;
 }
 
@@ -65,6 +66,10 @@ void Camera::disconnect(void) {
   this->_disconnect();
 }
 
+bool Camera::isLinked(void) const {
+  return m_Connected;
+}
+
 bool Camera::isActive(void) const {
   return m_Active;
 }
@@ -89,6 +94,40 @@ uint8_t Camera::getConnectProgress(void) const {
   return m_Progress.load();
 }
 
+void Camera::setLowPower(bool enable) {
+  const std::lock_guard<std::mutex> lock(m_Mutex);
+  if (m_Type == Type::FAUXNY || m_Client == nullptr || !m_Client->isConnected()) {
+    return;
+  }
+
+  bool ok = enable ? m_Client->updateConnParams(m_LowPowerMinInterval, m_LowPowerMaxInterval, 0,
+                                                m_LowPowerTimeout)
+                   : m_Client->updateConnParams(m_MinInterval, m_MaxInterval, m_Latency, m_Timeout);
+  if (!ok) {
+    ESP_LOGW(LOG_TAG, "Failed to update connection parameters.");
+  }
+}
+
+bool Camera::isGeoRequested(void) const {
+  return true;
+}
+
+bool Camera::reportsCapture(void) const {
+  return m_ReportsCapture;
+}
+
+uint32_t Camera::getCaptureCount(void) const {
+  return m_CaptureCount;
+}
+
+void Camera::setReportsCapture(bool reports) {
+  m_ReportsCapture = reports;
+}
+
+void Camera::onCapture(void) {
+  m_CaptureCount++;
+}
+
 bool Camera::isConnected(void) const {
   const std::lock_guard<std::mutex> lock(m_Mutex);
   if (m_Type == Type::FAUXNY) {
@@ -110,6 +110,12 @@ class Camera: public NimBLEClientCallbacks {
    */
   virtual void updateGeoData(const gps_t &gps, const timesync_t &timesync) = 0;
 
+  /**
+   * Camera has asked for a position, for cameras that only accept geotags
+   * on request.
+   */
+  virtual bool isGeoRequested(void) const;
+
   virtual size_t getSerialisedBytes(void) const = 0;
   virtual bool serialise(void *buffer, size_t bytes) const = 0;
 
@@ -118,6 +124,11 @@ class Camera: public NimBLEClientCallbacks {
    */
   virtual bool isConnected(void) const;
 
+  /**
+   * Last known link state, does not wait on a connection in progress.
+   */
+  bool isLinked(void) const;
+
   /**
    * Camera is active (ie. connect() has succeeded previously).
    */
@@ -137,6 +148,21 @@ class Camera: public NimBLEClientCallbacks {
   /** Get connection progress percentage (0-100). */
   uint8_t getConnectProgress(void) const;
 
+  /**
+   * Request a long connection interval to save power, or restore the default.
+   */
+  void setLowPower(bool enable);
+
+  /**
+   * Camera reports capture completion (ie. ready for the next frame).
+   */
+  bool reportsCapture(void) const;
+
+  /**
+   * Number of captures the camera has reported complete.
+   */
+  uint32_t getCaptureCount(void) const;
+
  protected:
   Camera(Type type, PairType pairType);
   std::atomic<uint8_t> m_Progress;
@@ -167,9 +193,15 @@ class Camera: public NimBLEClientCallbacks {
   NimBLEAddress m_Address = NimBLEAddress {};
   NimBLEClient *m_Client = nullptr;
   std::string m_Name;
-  bool m_Connected = false;
+  std::atomic<bool> m_Connected = false;
   bool m_Paired = false;
 
+  /** Enable or disable capture completion reporting. */
+  void setReportsCapture(bool reports);
+
+  /** Called by the camera driver when a capture completes. */
+  void onCapture(void);
+
  private:
   /** Called on connection success. */
   void onConnect(NimBLEClient *pDevice) override final;
@@ -183,12 +215,19 @@ class Camera: public NimBLEClientCallbacks {
   const uint16_t m_Latency = 1;
   // double the disconnect timeout
   const uint16_t m_Timeout = (2 * BLE_GAP_INITIAL_SUPERVISION_TIMEOUT);
+  // low power, 400-500ms interval (1.25ms units) with 6s timeout (10ms units)
+  const uint16_t m_LowPowerMinInterval = 320;
+  const uint16_t m_LowPowerMaxInterval = 400;
+  const uint16_t m_LowPowerTimeout = 600;
   const Type m_Type;
 
   static constexpr SecurityMode m_SecurityModeDefault = SecurityMode::SECURE_DISPLAY_YESNO;
 
   mutable std::mutex m_Mutex;
 
+  std::atomic<bool> m_ReportsCapture = false;
+  std::atomic<uint32_t> m_CaptureCount = 0;
+
   esp_power_level_t m_Power = ESP_PWR_LVL_P3;
   bool m_FromScan = false;
   bool m_Active = false;
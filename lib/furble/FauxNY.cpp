@@ -36,6 +36,8 @@ bool FauxNY::_connect(void) {
 
   m_Connected = true;
   m_Progress = 100;
+  // simulate a camera that is ready immediately after release
+  setReportsCapture(true);
 
   return true;
 }
@@ -46,6 +48,7 @@ void FauxNY::shutterPress(void) {
 
 void FauxNY::shutterRelease(void) {
   ESP_LOGI(m_FauxNYStr, "shutterRelease()");
+  onCapture();
 }
 
 void FauxNY::focusPress(void) {
@@ -63,6 +66,7 @@ void FauxNY::updateGeoData(const gps_t &gps, const timesync_t &timesync) {
 void FauxNY::_disconnect(void) {
   ESP_LOGI(m_FauxNYStr, "Disconnecting");
   m_Connected = false;
+  setReportsCapture(false);
 }
 
 size_t FauxNY::getSerialisedBytes(void) const {
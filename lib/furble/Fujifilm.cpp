@@ -129,6 +129,10 @@ void Fujifilm::sendGeoData(const gps_t &gps, const timesync_t &timesync) {
   }
 }
 
+bool Fujifilm::isGeoRequested(void) const {
+  return m_GeoRequested;
+}
+
 void Fujifilm::updateGeoData(const gps_t &gps, const timesync_t &timesync) {
   if (m_GeoRequested) {
     sendGeoData(gps, timesync);
@@ -22,6 +22,7 @@ class Fujifilm: public Camera {
   void focusPress(void) override final;
   void focusRelease(void) override final;
   void updateGeoData(const gps_t &gps, const timesync_t &timesync) override final;
+  bool isGeoRequested(void) const override final;
 
  protected:
   /**
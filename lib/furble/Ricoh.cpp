@@ -11,7 +11,6 @@
 #include <NimBLERemoteCharacteristic.h>
 #include <NimBLERemoteService.h>
 #include <NimBLEUtils.h>
-#include <esp_timer.h>
 
 #include "Ricoh.h"
 
@@ -42,10 +41,6 @@ const NimBLEUUID Ricoh::LOCATION_CONTROL_CHR_UUID {0x9111CDD0, 0x9F01, 0x45C4, 0
 
 namespace {
 
-constexpr uint32_t GPS_MIN_INTERVAL_MS = 10 * 1000;
-constexpr double GPS_MIN_DELTA_DEG = 0.00001;
-constexpr double GPS_MIN_DELTA_ALT_M = 1.0;
-
 double bswapd64(double x) {
   uint64_t t;
   std::memcpy(&t, &x, sizeof(x));
@@ -272,7 +267,7 @@ bool Ricoh::_connect(void) {
   logChr(m_PairedDeviceName, "PairedDeviceName");
   ESP_LOGI(LOG_TAG, "Ricoh state probe end");
 
-  subscribeCharacteristic(m_CaptureStatus, "CaptureStatus");
+  setReportsCapture(subscribeCharacteristic(m_CaptureStatus, "CaptureStatus"));
   subscribeCharacteristic(m_SelfTimer, "SelfTimer");
   subscribeCharacteristic(m_Power, "CameraPower");
   subscribeCharacteristic(m_OperationMode, "OperationMode");
@@ -298,8 +293,9 @@ void Ricoh::clearRemoteState(void) {
   m_PairedDeviceName = nullptr;
   m_GpsInfo = nullptr;
   m_LocationControl = nullptr;
-  m_LastGpsWriteMs = 0;
+  m_Capturing = false;
   m_HasGpsWrite = false;
+  setReportsCapture(false);
 }
 
 bool Ricoh::writeByte(NimBLERemoteCharacteristic *pChr, uint8_t value, const char *label) {
@@ -339,16 +335,35 @@ bool Ricoh::subscribeCharacteristic(NimBLERemoteCharacteristic *pChr, const char
   }
   bool rc = pChr->subscribe(
       true,
-      [](NimBLERemoteCharacteristic *chr, uint8_t *data, size_t len, bool isNotify) {
+      [this](NimBLERemoteCharacteristic *chr, uint8_t *data, size_t len, bool isNotify) {
         ESP_LOGI(LOG_TAG, "Ricoh notify %s (%s): %s", chr->getUUID().toString().c_str(),
                  isNotify ? "notify" : "indicate",
                  NimBLEUtils::dataToHexString(data, static_cast<uint8_t>(len)).c_str());
+        if (chr->getUUID() == CAPTURE_STATUS_CHR_UUID) {
+          this->captureStatus(data, len);
+        }
       },
       true);
   ESP_LOGI(LOG_TAG, "Ricoh subscribe %s => %s", label, rc ? "ok" : "failed");
   return rc;
 }
 
+/**
+ * CaptureStatus is {countdown, capturing}, capture is complete when capturing
+ * returns to zero.
+ */
+void Ricoh::captureStatus(const uint8_t *data, size_t len) {
+  if (len < 2) {
+    return;
+  }
+
+  bool capturing = (data[1] != 0x00);
+  if (m_Capturing && !capturing) {
+    onCapture();
+  }
+  m_Capturing = capturing;
+}
+
 bool Ricoh::setShootingFlavor(ShootingFlavor flavor) {
   return writeByte(m_ShootingFlavor, static_cast<uint8_t>(flavor), "ShootingFlavor");
 }
@@ -396,17 +411,7 @@ void Ricoh::updateGeoData(const gps_t &gps, const timesync_t &timesync) {
     return;
   }
 
-  const uint32_t nowMs = static_cast<uint32_t>(esp_timer_get_time() / 1000ULL);
-  const bool moved = !m_HasGpsWrite
-                     || std::fabs(gps.latitude - m_LastGps.latitude) >= GPS_MIN_DELTA_DEG
-                     || std::fabs(gps.longitude - m_LastGps.longitude) >= GPS_MIN_DELTA_DEG
-                     || std::fabs(gps.altitude - m_LastGps.altitude) >= GPS_MIN_DELTA_ALT_M;
-  const bool intervalElapsed =
-      !m_HasGpsWrite || static_cast<uint32_t>(nowMs - m_LastGpsWriteMs) >= GPS_MIN_INTERVAL_MS;
-
-  if (!moved && !intervalElapsed)
-    return;
-
+  // rate and movement throttling is applied by the control task
   if (!m_HasGpsWrite)
     setLocationControl(true);
 
@@ -431,10 +436,7 @@ void Ricoh::updateGeoData(const gps_t &gps, const timesync_t &timesync) {
       timesync.hour, timesync.minute, timesync.second, timesync.centisecond, rc ? "ok" : "failed");
 
   if (rc) {
-    m_LastGpsWriteMs = nowMs;
     m_HasGpsWrite = true;
-    m_LastGps = gps;
-    m_LastTimesync = timesync;
   }
 }
 
@@ -110,10 +110,10 @@ class Ricoh: public Camera {
   NimBLERemoteCharacteristic *m_GpsInfo = nullptr;
   NimBLERemoteCharacteristic *m_LocationControl = nullptr;
 
-  uint32_t m_LastGpsWriteMs = 0;
+  // CaptureStatus capturing byte, non-zero whilst shooting
+  bool m_Capturing = false;
+
   bool m_HasGpsWrite = false;
-  gps_t m_LastGps = {};
-  timesync_t m_LastTimesync = {};
 
   bool _connect(void) override final;
   void _disconnect(void) override final;
@@ -128,6 +128,7 @@ class Ricoh: public Camera {
   bool writeByte(NimBLERemoteCharacteristic *pChr, uint8_t value, const char *label);
   bool writeOperation(OperationCode code, OperationParameter parameter);
   bool subscribeCharacteristic(NimBLERemoteCharacteristic *pChr, const char *label);
+  void captureStatus(const uint8_t *data, size_t len);
   bool setShootingFlavor(ShootingFlavor flavor);
   bool setLocationControl(bool enabled);
 };
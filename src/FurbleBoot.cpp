@@ -0,0 +1,108 @@
+#include <cstdio>
+
+#include <esp_heap_caps.h>
+#include <esp_log.h>
+#include <esp_timer.h>
+
+#include "FurbleBoot.h"
+#include "FurbleTypes.h"
+
+namespace Furble {
+
+Preferences BootProfile::m_Prefs;
+BootProfile::profile_t BootProfile::m_Profile = {};
+BootProfile::profile_t BootProfile::m_Previous = {};
+bool BootProfile::m_Complete = false;
+
+static const char *const PHASE_NAMES[BootProfile::PHASES] = {
+    "startup", "platform", "settings", "device", "control", "trigger", "gps", "ui", "frame",
+};
+
+void BootProfile::mark(phase_t phase) {
+  if ((phase >= PHASES) || (m_Profile.end[phase] != 0)) {
+    return;
+  }
+
+  m_Profile.end[phase] = static_cast<uint32_t>(esp_timer_get_time());
+}
+
+void BootProfile::complete(void) {
+  if (m_Complete || (m_Profile.end[FIRST_FRAME] == 0)) {
+    return;
+  }
+
+  m_Complete = true;
+  m_Profile.magic = MAGIC;
+  save();
+  log();
+}
+
+const BootProfile::profile_t &BootProfile::getProfile(void) {
+  return m_Profile;
+}
+
+const BootProfile::profile_t &BootProfile::getPrevious(void) {
+  return m_Previous;
+}
+
+uint32_t BootProfile::getPhaseMs(const profile_t &profile, phase_t phase) {
+  if ((phase >= PHASES) || (profile.end[phase] == 0)) {
+    return 0;
+  }
+
+  // phases may be skipped, measure from the last one reached
+  uint32_t start = 0;
+  for (int i = phase - 1; i >= 0; i--) {
+    if (profile.end[i] != 0) {
+      start = profile.end[i];
+      break;
+    }
+  }
+
+  return (profile.end[phase] - start) / 1000;
+}
+
+uint32_t BootProfile::getTotalMs(const profile_t &profile) {
+  return profile.end[FIRST_FRAME] / 1000;
+}
+
+const char *BootProfile::getName(phase_t phase) {
+  return (phase < PHASES) ? PHASE_NAMES[phase] : "unknown";
+}
+
+void BootProfile::save(void) {
+  m_Prefs.begin(FURBLE_STR, false);
+  if ((m_Prefs.get(m_Key, &m_Previous, sizeof(m_Previous)) != sizeof(m_Previous))
+      || (m_Previous.magic != MAGIC)) {
+    m_Previous = {};
+  }
+  if (m_Prefs.put(m_Key, &m_Profile, sizeof(m_Profile)) != sizeof(m_Profile)) {
+    ESP_LOGE(LOG_TAG, "Failed to save boot profile.");
+  }
+  m_Prefs.end();
+}
+
+void BootProfile::log(void) {
+  char line[160];
+  int len = 0;
+
+  for (int i = 0; i < PHASES; i++) {
+    phase_t phase = static_cast<phase_t>(i);
+    len += std::snprintf(&line[len], sizeof(line) - len, " %s %lums", getName(phase),
+                         getPhaseMs(m_Profile, phase));
+    if (len >= static_cast<int>(sizeof(line))) {
+      break;
+    }
+  }
+
+  const uint32_t total = getTotalMs(m_Profile);
+  ESP_LOGI(LOG_TAG, "boot%s", line);
+  ESP_LOGI(LOG_TAG, "boot %lums (previous %lums), heap %u free, %u largest", total,
+           getTotalMs(m_Previous), heap_caps_get_free_size(MALLOC_CAP_8BIT),
+           heap_caps_get_largest_free_block(MALLOC_CAP_8BIT));
+  if (total > BUDGET_MS) {
+    ESP_LOGW(LOG_TAG, "boot %lums over budget of %lums", total, BUDGET_MS);
+  }
+}
+
+}  // namespace Furble
@@ -0,0 +1,97 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+#include "FurbleClock.h"
+
+namespace Furble {
+
+static double clampRate(double rate) {
+  return std::min(std::max(rate, -PPSDiscipline::MAX_RATE), PPSDiscipline::MAX_RATE);
+}
+
+bool PPSDiscipline::pulse(int64_t local, int64_t utc) {
+  const int64_t elapsed = local - m_Model.local;
+
+  if (!m_Model.valid || (elapsed <= 0) || (elapsed > MAX_GAP_US) || (utc <= m_Model.utc)) {
+    step(local, utc);
+    return true;
+  }
+
+  const int64_t error = utc - toUTC(m_Model, local);
+  if (std::llabs(error) > MAX_ERROR_US) {
+    m_Stats.outliers++;
+    if (++m_Outliers > MAX_OUTLIERS) {
+      // the model is wrong, not the edges
+      step(local, utc);
+      return true;
+    }
+    return false;
+  }
+  m_Outliers = 0;
+
+  if (m_Pulses == 1) {
+    // measure the frequency error directly from the first pair
+    m_Model.rate = clampRate((double)(utc - m_Model.utc - elapsed) / elapsed);
+    m_Model.utc = utc;
+  } else {
+    m_Model.rate = clampRate(m_Model.rate + (FREQUENCY_GAIN * error / elapsed));
+    m_Model.utc = utc - error + std::lround(PHASE_GAIN * error);
+  }
+  m_Model.local = local;
+
+  m_Pulses++;
+  m_Model.locked = (m_Pulses >= LOCK_PULSES);
+
+  m_Stats.pulses++;
+  m_Stats.error = error;
+  m_Stats.jitter += ((int64_t)std::llabs(error) - (int64_t)m_Stats.jitter) / 8;
+
+  return true;
+}
+
+void PPSDiscipline::step(int64_t local, int64_t utc) {
+  // keep any frequency estimate, the crystal has not changed
+  m_Model.local = local;
+  m_Model.utc = utc;
+  m_Model.valid = true;
+  m_Model.locked = false;
+  m_Pulses = 1;
+  m_Outliers = 0;
+
+  m_Stats.pulses++;
+  m_Stats.steps++;
+  m_Stats.error = 0;
+}
+
+void PPSDiscipline::reset(void) {
+  m_Model = {};
+  m_Pulses = 0;
+  m_Outliers = 0;
+}
+
+const PPSDiscipline::model_t &PPSDiscipline::getModel(void) const {
+  return m_Model;
+}
+
+const PPSDiscipline::stats_t &PPSDiscipline::getStats(void) const {
+  return m_Stats;
+}
+
+int64_t PPSDiscipline::toUTC(const model_t &model, int64_t local) {
+  const int64_t elapsed = local - model.local;
+
+  return model.utc + elapsed + std::llround(elapsed * model.rate);
+}
+
+int64_t PPSDiscipline::toLocal(const model_t &model, int64_t utc) {
+  const int64_t elapsed = utc - model.utc;
+
+  return model.local + std::llround(elapsed / (1.0 + model.rate));
+}
+
+bool PPSDiscipline::isLocked(const model_t &model, int64_t local) {
+  return model.valid && model.locked && ((local - model.local) < HOLDOVER_US);
+}
+
+}  // namespace Furble
@@ -1,12 +1,33 @@
+#include <algorithm>
+
+#include <esp_rom_sys.h>
+#include <esp_timer.h>
+
 #include "FurbleControl.h"
+#include "FurbleGPS.h"
+#include "FurbleSettings.h"
+#include "FurbleUI.h"
 
 namespace Furble {
-Control::Target::Target(Camera *camera) {
+SeqLock<Control::geodata_t> Control::m_GeoData;
+
+Control::Target::Target(Camera *camera) : m_Geotag {camera->getType()} {
   m_Camera = camera;
-  m_Queue = xQueueCreate(m_QueueLength, sizeof(cmd_t));
+  m_Queue = xQueueCreate(m_QueueLength, sizeof(command_t));
+
+  const offsets_t offsets = Settings::load<Settings::OFFSETS>();
+  const uint64_t address = (uint64_t)camera->getAddress();
+  for (uint8_t i = 0; i < offsets.count; i++) {
+    if (offsets.entry[i].address == address) {
+      m_Offset = offsets.entry[i].offset;
+      break;
+    }
+  }
 }
 
 Control::Target::~Target() {
+  ESP_LOGI(LOG_TAG, "geotag(%s) sent = %lu, suppressed = %lu", m_Camera->getName().c_str(),
+           m_Geotag.getSent(), m_Geotag.getSuppressed());
   vQueueDelete(m_Queue);
   m_Queue = NULL;
   m_Camera->disconnect();
@@ -18,39 +39,101 @@ Camera *Control::Target::getCamera(void) const {
 }
 
 void Control::Target::sendCommand(cmd_t cmd) {
-  BaseType_t ret = xQueueSend(m_Queue, &cmd, 0);
+  sendShutter(cmd, 0);
+}
+
+void Control::Target::sendShutter(cmd_t cmd, int64_t base) {
+  command_t command = {cmd, base};
+  if (cmd == CMD_SHUTTER_PRESS) {
+    m_CaptureBase = m_Camera->getCaptureCount();
+  }
+  BaseType_t ret = xQueueSend(m_Queue, &command, 0);
   if (ret != pdTRUE) {
     ESP_LOGE(LOG_TAG, "Failed to send command to target.");
   }
 }
 
-Control::cmd_t Control::Target::getCommand(void) {
-  cmd_t cmd = CMD_ERROR;
-  BaseType_t ret = xQueueReceive(m_Queue, &cmd, pdMS_TO_TICKS(50));
+Control::Target::command_t Control::Target::getCommand(void) {
+  command_t command = {CMD_ERROR, 0};
+  BaseType_t ret = xQueueReceive(m_Queue, &command, pdMS_TO_TICKS(50));
   if (ret != pdTRUE) {
-    return CMD_ERROR;
+    return {CMD_ERROR, 0};
+  }
+  return command;
+}
+
+int64_t Control::Target::waitUntil(int64_t base) {
+  int64_t now = esp_timer_get_time();
+  if (base == 0) {
+    return now;
   }
-  return cmd;
+
+  const int64_t due = base + m_Offset;
+  if ((due - now) > m_SpinUs) {
+    vTaskDelay(pdMS_TO_TICKS((due - now - m_SpinUs) / 1000));
+  }
+
+  // busy wait, nothing at or below this priority runs on the core until due
+  now = esp_timer_get_time();
+  if (now < due) {
+    esp_rom_delay_us(due - now);
+    now = esp_timer_get_time();
+  }
+
+  return now;
+}
+
+uint32_t Control::Target::getShutterCount(void) const {
+  return m_ShutterCount;
+}
+
+uint32_t Control::Target::getOffset(void) const {
+  return m_Offset;
+}
+
+void Control::Target::setOffset(uint32_t offset) {
+  m_Offset = offset;
+}
+
+int32_t Control::Target::getAchievedOffset(void) const {
+  return m_AchievedOffset;
+}
+
+int32_t Control::Target::getWriteLatency(void) const {
+  return m_WriteLatency;
 }
 
-void Control::Target::updateGPS(const Camera::gps_t &gps, const Camera::timesync_t &timesync) {
-  m_GPS = gps;
-  m_Timesync = timesync;
+bool Control::Target::isReady(void) const {
+  return m_Camera->reportsCapture() && (m_Camera->getCaptureCount() != m_CaptureBase);
 }
 
 void Control::Target::task(void) {
   const char *name = m_Camera->getName().c_str();
 
   while (true) {
-    cmd_t cmd = this->getCommand();
+    command_t command = this->getCommand();
+    cmd_t cmd = command.cmd;
     switch (cmd) {
       case CMD_SHUTTER_PRESS:
-        ESP_LOGI(LOG_TAG, "shutterPress(%s)", name);
+      {
+        int64_t now = waitUntil(command.base);
         m_Camera->shutterPress();
-        break;
+        m_ShutterCount++;
+        if (command.base != 0) {
+          // measured at the write, not the wakeup
+          const int64_t written = esp_timer_get_time();
+          m_AchievedOffset = written - command.base;
+          m_WriteLatency = written - now;
+          ESP_LOGI(LOG_TAG, "shutterPress(%s) offset = %ldus, write = %ldus", name,
+                   (int32_t)m_AchievedOffset, (int32_t)m_WriteLatency);
+        } else {
+          ESP_LOGI(LOG_TAG, "shutterPress(%s)", name);
+        }
+      } break;
       case CMD_SHUTTER_RELEASE:
-        ESP_LOGI(LOG_TAG, "shutterRelease(%s)", name);
+        (void)waitUntil(command.base);
         m_Camera->shutterRelease();
+        ESP_LOGI(LOG_TAG, "shutterRelease(%s)", name);
         break;
       case CMD_FOCUS_PRESS:
         ESP_LOGI(LOG_TAG, "focusPress(%s)", name);
@@ -61,8 +144,18 @@ void Control::Target::task(void) {
         m_Camera->focusRelease();
         break;
       case CMD_GPS_UPDATE:
+      {
+        const geodata_t geodata = m_GeoData.load();
         ESP_LOGI(LOG_TAG, "updateGeoData(%s)", name);
-        m_Camera->updateGeoData(m_GPS, m_Timesync);
+        m_Camera->updateGeoData(geodata.gps, geodata.timesync);
+      } break;
+      case CMD_LOW_POWER_ENTER:
+        ESP_LOGI(LOG_TAG, "setLowPower(%s, true)", name);
+        m_Camera->setLowPower(true);
+        break;
+      case CMD_LOW_POWER_EXIT:
+        ESP_LOGI(LOG_TAG, "setLowPower(%s, false)", name);
+        m_Camera->setLowPower(false);
         break;
       case CMD_DISCONNECT:
         m_Camera->setActive(false);
@@ -87,6 +180,19 @@ Control &Control::getInstance(void) {
       ESP_LOGE(LOG_TAG, "Failed to create control queue.");
       abort();
     }
+
+    const esp_timer_create_args_t args = {
+        .callback =
+            [](void *arg) {
+              auto *control = static_cast<Control *>(arg);
+              control->fireSchedule();
+            },
+        .arg = &instance,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "schedule",
+        .skip_unhandled_events = false,
+    };
+    ESP_ERROR_CHECK(esp_timer_create(&args, &instance.m_Schedule));
   }
 
   return instance;
@@ -103,6 +209,7 @@ Control::state_t Control::connectAll(void) {
     camera = target->getCamera();
     if (!camera->isConnected()) {
       m_ConnectCamera = camera;
+      UI::post(UI::EVENT_CONNECT);
       if (!camera->connect(m_Power, timeout)) {
         failcount++;
         break;
@@ -141,15 +248,15 @@ void Control::task(void) {
       case STATE_IDLE:
         if (ret == pdTRUE) {
           if (cmd == CMD_CONNECT) {
-            m_State = STATE_CONNECT;
+            setState(STATE_CONNECT);
             continue;
           }
         }
         break;
 
       case STATE_CONNECT:
-        m_State = STATE_CONNECTING;
-        m_State = connectAll();
+        setState(STATE_CONNECTING);
+        setState(connectAll());
         break;
 
       case STATE_CONNECTING:
@@ -158,18 +265,35 @@ void Control::task(void) {
 
       case STATE_ACTIVE:
         if (!allConnected()) {
-          m_State = STATE_CONNECT;
+          setState(STATE_CONNECT);
           continue;
         }
 
         if (ret == pdTRUE) {
+          const int64_t base = esp_timer_get_time();
+          const geodata_t geodata = m_GeoData.load();
+          const std::lock_guard<std::mutex> lock(m_TargetsMutex);
           for (const auto &target : m_Targets) {
             switch (cmd) {
               case CMD_SHUTTER_PRESS:
               case CMD_SHUTTER_RELEASE:
+                target->sendShutter(cmd, base);
+                break;
+              case CMD_GPS_UPDATE:
+              {
+                // throttle before queueing, ahead of any shutter commands
+                Camera *camera = target->getCamera();
+                if (!camera->isLinked()) {
+                  target->m_Geotag.reset();
+                } else if (target->m_Geotag.dispatch(geodata.gps, base,
+                                                     camera->isGeoRequested())) {
+                  target->sendCommand(cmd);
+                }
+              } break;
               case CMD_FOCUS_PRESS:
               case CMD_FOCUS_RELEASE:
-              case CMD_GPS_UPDATE:
+              case CMD_LOW_POWER_ENTER:
+              case CMD_LOW_POWER_EXIT:
                 target->sendCommand(cmd);
                 break;
               default:
@@ -191,15 +315,135 @@ BaseType_t Control::sendCommand(cmd_t cmd) {
 }
 
 BaseType_t Control::updateGPS(const Camera::gps_t &gps, const Camera::timesync_t &timesync) {
-  for (const auto &target : m_Targets) {
-    target->updateGPS(gps, timesync);
-  }
+  // target tasks spin on a store in progress, do not let them preempt it
+  vTaskSuspendAll();
+  m_GeoData.store({gps, timesync});
+  xTaskResumeAll();
 
   cmd_t cmd = CMD_GPS_UPDATE;
   return xQueueSend(m_Queue, &cmd, 0);
 }
 
+uint32_t Control::sendShutter(cmd_t cmd) {
+  return sendShutter(cmd, esp_timer_get_time());
+}
+
+uint32_t Control::sendShutter(cmd_t cmd, int64_t base) {
+  const std::lock_guard<std::mutex> lock(m_TargetsMutex);
+  uint32_t sent = 0;
+
+  for (size_t i = 0; i < m_Targets.size(); i++) {
+    const auto &target = m_Targets[i];
+    if (target->getCamera()->isLinked()) {
+      target->sendShutter(cmd, base);
+      sent |= (1UL << i);
+    }
+  }
+
+  return sent;
+}
+
+bool Control::scheduleShutter(int64_t utc) {
+  const int64_t now = esp_timer_get_time();
+  const int64_t local = GPS::getInstance().toLocal(utc);
+
+  if ((local == 0) || (local <= now)) {
+    ESP_LOGW(LOG_TAG, "Cannot schedule shutter, UTC %s", (local == 0) ? "unknown" : "passed");
+    return false;
+  }
+
+  esp_timer_stop(m_Schedule);
+  m_ScheduleUTC = utc;
+  esp_timer_start_once(m_Schedule, std::max<int64_t>(local - now - m_ScheduleLeadUs, 0));
+  ESP_LOGI(LOG_TAG, "Shutter scheduled in %lldms%s", (local - now) / 1000,
+           GPS::getInstance().isPPSLocked() ? ", PPS locked" : "");
+
+  return true;
+}
+
+void Control::cancelShutter(void) {
+  esp_timer_stop(m_Schedule);
+}
+
+void Control::fireSchedule(void) {
+  // the clock model may have moved since the shot was scheduled
+  const int64_t base = GPS::getInstance().toLocal(m_ScheduleUTC.load());
+  if (base == 0) {
+    ESP_LOGW(LOG_TAG, "Scheduled shutter dropped, UTC unknown");
+    return;
+  }
+
+  uint32_t sent = sendShutter(CMD_SHUTTER_PRESS, base);
+  sendShutter(CMD_SHUTTER_RELEASE, base + m_ScheduleHoldUs);
+  ESP_LOGI(LOG_TAG, "Scheduled shutter dispatched %lldus ahead, sent = 0x%lx",
+           base - esp_timer_get_time(), sent);
+}
+
+void Control::setOffset(size_t index, uint32_t offset) {
+  uint64_t address;
+  {
+    const std::lock_guard<std::mutex> lock(m_TargetsMutex);
+    if (index >= m_Targets.size()) {
+      return;
+    }
+    m_Targets[index]->setOffset(offset);
+    address = (uint64_t)m_Targets[index]->getCamera()->getAddress();
+  }
+
+  // rebuild the persisted table, dropping the entry if zero
+  offsets_t offsets = Settings::load<Settings::OFFSETS>();
+  uint8_t count = 0;
+  for (uint8_t i = 0; i < offsets.count; i++) {
+    if (offsets.entry[i].address != address) {
+      offsets.entry[count++] = offsets.entry[i];
+    }
+  }
+
+  if (offset > 0) {
+    if (count == OFFSETS_MAX) {
+      // evict the oldest
+      std::copy(&offsets.entry[1], &offsets.entry[OFFSETS_MAX], &offsets.entry[0]);
+      count--;
+    }
+    offsets.entry[count++] = {address, offset};
+  }
+  offsets.count = count;
+
+  Settings::save<Settings::OFFSETS>(offsets);
+}
+
+uint32_t Control::getLinked(void) {
+  const std::lock_guard<std::mutex> lock(m_TargetsMutex);
+  uint32_t linked = 0;
+
+  for (size_t i = 0; i < m_Targets.size(); i++) {
+    if (m_Targets[i]->getCamera()->isLinked()) {
+      linked |= (1UL << i);
+    }
+  }
+
+  return linked;
+}
+
+bool Control::isReady(void) {
+  const std::lock_guard<std::mutex> lock(m_TargetsMutex);
+  bool linked = false;
+
+  for (const auto &target : m_Targets) {
+    if (target->getCamera()->isLinked()) {
+      if (!target->isReady()) {
+        return false;
+      }
+      linked = true;
+    }
+  }
+
+  return linked;
+}
+
 bool Control::allConnected(void) {
+  const std::lock_guard<std::mutex> lock(m_TargetsMutex);
+
   for (const auto &target : m_Targets) {
     if (!target->getCamera()->isConnected()) {
       return false;
@@ -213,6 +457,16 @@ const std::vector<std::unique_ptr<Control::Target>> &Control::getTargets(void) {
   return m_Targets;
 }
 
+size_t Control::getTargetCount(void) {
+  const std::lock_guard<std::mutex> lock(m_TargetsMutex);
+  return m_Targets.size();
+}
+
+uint32_t Control::getShutterCount(size_t index) {
+  const std::lock_guard<std::mutex> lock(m_TargetsMutex);
+  return (index < m_Targets.size()) ? m_Targets[index]->getShutterCount() : 0;
+}
+
 void Control::connectAll(bool infiniteReconnect) {
   m_InfiniteReconnect = infiniteReconnect;
 
@@ -220,7 +474,8 @@ void Control::connectAll(bool infiniteReconnect) {
 }
 
 void Control::disconnect(void) {
-  m_State = STATE_DISCONNECTING;
+  cancelShutter();
+  setState(STATE_DISCONNECTING);
 
   // Force cancel any active connection attempts
   ble_gap_conn_cancel();
@@ -239,8 +494,11 @@ void Control::disconnect(void) {
     } while (!target.get()->m_Stopped);
   }
 
-  m_Targets.clear();
-  m_State = STATE_IDLE;
+  {
+    const std::lock_guard<std::mutex> targets(m_TargetsMutex);
+    m_Targets.clear();
+  }
+  setState(STATE_IDLE);
 }
 
 void Control::addActive(Camera *camera) {
@@ -258,6 +516,7 @@ void Control::addActive(Camera *camera) {
   if (ret != pdPASS) {
     ESP_LOGE(LOG_TAG, "Failed to create task for '%s'.", camera->getName().c_str());
   } else {
+    const std::lock_guard<std::mutex> targets(m_TargetsMutex);
     m_Targets.push_back(std::move(target));
   }
 }
@@ -270,6 +529,13 @@ Control::state_t Control::getState(void) const {
   return m_State;
 }
 
+void Control::setState(state_t state) {
+  if (state != m_State) {
+    m_State = state;
+    UI::post(UI::EVENT_CONNECT);
+  }
+}
+
 void Control::setPower(esp_power_level_t power) {
   m_Power = power;
 }
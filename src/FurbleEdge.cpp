@@ -0,0 +1,49 @@
+#include "FurbleEdge.h"
+
+namespace Furble {
+
+EdgeFilter::EdgeFilter(int64_t debounce, bool activeLow)
+    : m_Debounce {debounce},
+      m_ActiveLow {activeLow},
+      m_RawTime {-debounce},
+      m_EdgeTime {-debounce} {}
+
+EdgeFilter::edge_t EdgeFilter::update(int64_t time, int level) {
+  bool raw = m_ActiveLow ? (level == 0) : (level != 0);
+
+  if (raw != m_Raw) {
+    m_Raw = raw;
+    m_RawTime = time;
+  }
+
+  if ((m_Raw == m_Asserted) || ((time - m_EdgeTime) < m_Debounce)) {
+    return EDGE_NONE;
+  }
+
+  // timestamp with the raw edge, not when it was settled
+  m_Asserted = m_Raw;
+  m_EdgeTime = m_RawTime;
+
+  return m_Asserted ? EDGE_ASSERT : EDGE_DEASSERT;
+}
+
+bool EdgeFilter::isPending(void) const {
+  return m_Raw != m_Asserted;
+}
+
+bool EdgeFilter::isAsserted(void) const {
+  return m_Asserted;
+}
+
+int64_t EdgeFilter::getEdgeTime(void) const {
+  return m_EdgeTime;
+}
+
+void EdgeFilter::reset(int64_t time, int level) {
+  m_Raw = m_ActiveLow ? (level == 0) : (level != 0);
+  m_Asserted = m_Raw;
+  m_RawTime = time;
+  m_EdgeTime = time - m_Debounce;
+}
+
+}  // namespace Furble
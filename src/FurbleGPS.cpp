@@ -1,5 +1,12 @@
+#include <algorithm>
+#include <cmath>
+#include <ctime>
+
+#include <sys/time.h>
+
 #include <M5Unified.h>
 #include <TinyGPS++.h>
+#include <esp_timer.h>
 #include <lvgl.h>
 
 #include "icons.h"
@@ -8,6 +15,7 @@
 #include "FurbleGPS.h"
 #include "FurblePlatform.h"
 #include "FurbleSettings.h"
+#include "FurbleUI.h"
 
 void gps_task(void *param) {
   Furble::GPS *gps = static_cast<Furble::GPS *>(param);
@@ -43,10 +51,14 @@ GPS &GPS::getInstance() {
                         ESP_INTR_FLAG_IRAM);
     uart_param_config(instance.m_UART, &uart_config);
     uart_set_pin(instance.m_UART, tx, rx, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE);
-    uart_enable_pattern_det_baud_intr(instance.m_UART, '\n', 1, 9, 0, 0);
-    uart_pattern_queue_reset(instance.m_UART, QUEUE_SIZE);
     uart_flush(instance.m_UART);
 
+    instance.m_PPSQueue = xQueueCreate(1, sizeof(int64_t));
+    if (instance.m_PPSQueue == NULL) {
+      ESP_LOGE(LOG_TAG, "Failed to create PPS queue.");
+      abort();
+    }
+
     BaseType_t err = xTaskCreate(gps_task, LOG_TAG, 4096, &instance, 3, &instance.m_Task);
     if (err != pdTRUE) {
       ESP_LOGE(LOG_TAG, "Failed to create gps task.");
@@ -68,25 +80,41 @@ void GPS::setIcon(lv_obj_t *icon) {
 void GPS::reset(void) {
   uart_flush(m_UART);
   xQueueReset(m_Queue);
+  m_NMEA.resync();
 }
 
 void GPS::task(void) {
   while (true) {
     uart_event_t event;
+    serviceTrack();
+    // keep exporting the track between servicing the receiver
+    const TickType_t wait = m_TrackExporting ? 0 : pdMS_TO_TICKS(100);
     if (!m_Enabled) {
-      vTaskDelay(pdMS_TO_TICKS(100));
+      vTaskDelay(std::max<TickType_t>(wait, 1));
       continue;
-    } else if (xQueueReceive(m_Queue, &event, pdMS_TO_TICKS(100))) {
+    }
+
+    if (m_Configure.exchange(false)) {
+      configure();
+    }
+
+    if (xQueueReceive(m_Queue, &event, wait)) {
       switch (event.type) {
         case UART_DATA:
+          serviceSerial();
           break;
         case UART_FIFO_OVF:
+          // the FIFO was discarded, keep what was already buffered
           ESP_LOGW(LOG_TAG, "GPS HW FIFO overflow");
-          reset();
+          m_Overflows++;
+          serviceSerial();
+          m_NMEA.resync();
           break;
         case UART_BUFFER_FULL:
+          // reception resumes once drained, nothing lost yet
           ESP_LOGW(LOG_TAG, "GPS ring buffer full");
-          reset();
+          m_Overflows++;
+          serviceSerial();
           break;
         case UART_BREAK:
           ESP_LOGW(LOG_TAG, "GPS rx break");
@@ -97,23 +125,39 @@ void GPS::task(void) {
         case UART_FRAME_ERR:
           ESP_LOGE(LOG_TAG, "GPS frame error");
           break;
-        case UART_PATTERN_DET:
-          serviceSerial();
-          break;
         default:
           ESP_LOGW(LOG_TAG, "unknown uart event type: %d", event.type);
           break;
       }
     }
+    serviceLastFix();
+    updateStats();
   }
 }
 
 void GPS::enable(void) {
   const uint32_t baud = Settings::load<Settings::GPS_BAUD>();
 
+  // reclaim the pins from the trigger input
+  uart_set_pin(m_UART, M5.getPin(m5::port_a_pin2), M5.getPin(m5::port_a_pin1),
+               UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE);
   uart_set_baudrate(m_UART, baud);
   reset();
 
+  if (!m_Powered) {
+    m_LastFix = Settings::load<Settings::GPS_FIX>();
+    // only trust the RTC if it was set from a fix
+    if (!m_UTCKnown && m_LastFix.utc && M5.Rtc.isEnabled()) {
+      M5.Rtc.setSystemTimeFromRtc();
+      m_UTCKnown = true;
+    }
+    m_Live = false;
+    m_PowerOnTime = esp_timer_get_time();
+    m_PowerOn = true;
+    m_Powered = true;
+  }
+  m_Configure = true;
+
   // power on
   M5.Power.setExtOutput(true, m5::ext_PA);
 
@@ -124,8 +168,12 @@ void GPS::enable(void) {
 }
 
 void GPS::disable(void) {
-  // power off
+  // power off, the receiver returns to its default NMEA output
   M5.Power.setExtOutput(false, m5::ext_PA);
+  m_Configure = false;
+  m_UBX = false;
+  m_Powered = false;
+  m_TrackFlush = true;
 
 #if defined(FURBLE_M5STICKS3)
   Platform::getInstance().setSleep(true);
@@ -134,12 +182,22 @@ void GPS::disable(void) {
 
 /** Refresh the setting from NVS. */
 void GPS::reloadSetting(void) {
-  m_Enabled = Settings::load<Settings::GPS>();
+  m_RateMs = Settings::load<Settings::GPS_RATE>();
+  m_UBXWanted = Settings::load<Settings::GPS_UBX>();
+  m_OfferLastFix = Settings::load<Settings::GPS_LAST_FIX>();
+  m_TrackEnabled = Settings::load<Settings::GPS_TRACK>();
+  if (!m_TrackEnabled) {
+    m_TrackFlush = true;
+  }
+  // port A is shared with the trigger input
+  m_Enabled = Settings::load<Settings::GPS>() && !Settings::load<Settings::TRIGGER_INPUT>();
   if (m_Enabled) {
     enable();
   } else {
     disable();
   }
+  attachPPS(m_Enabled && Settings::load<Settings::GPS_PPS>());
+  UI::post(UI::EVENT_GPS);
 }
 
 /** Is GPS enabled? */
@@ -147,66 +205,663 @@ bool GPS::isEnabled(void) const {
   return m_Enabled;
 }
 
-/** Start timer event to service/update GPS. */
+/** Start timer event to refresh the GPS status icon. */
 void GPS::startService(void) {
   m_Timer = lv_timer_create(
       [](lv_timer_t *timer) {
         auto *gps = static_cast<GPS *>(lv_timer_get_user_data(timer));
-        gps->update();
+        gps->updateIcon();
       },
       SERVICE_MS, this);
 }
 
-/** Send GPS data updates to the control task. */
-void GPS::update(void) {
+bool GPS::hasFix(const snapshot_t &snapshot) {
+  return snapshot.valid && (snapshot.quality != TinyGPSLocation::Quality::Invalid)
+         && ((esp_timer_get_time() - snapshot.time) < (MAX_AGE_MS * 1000LL));
+}
+
+/** Status icon for a snapshot. */
+static const void *getIcon(const GPS::snapshot_t &snapshot, bool enabled) {
+  if (!enabled || !GPS::hasFix(snapshot)) {
+    return &icon_location_disabled;
+  }
+
+  return snapshot.stale ? &icon_location_searching : &icon_my_location;
+}
+
+void GPS::updateIcon(void) {
+  const snapshot_t snapshot = m_Snapshot.load();
+  const bool fix = m_Enabled && hasFix(snapshot);
+  const void *src = getIcon(snapshot, m_Enabled);
+
+  if ((m_Icon != NULL) && (src != m_IconSrc)) {
+    lv_image_set_src(m_Icon, src);
+  }
+  m_IconSrc = src;
+
+  if (fix && !snapshot.stale) {
+    saveFix(snapshot);
+  }
+}
+
+/**
+ * Set the clock from the first live fix and keep the fix in NVS, UI task
+ * only as it owns the settings.
+ */
+void GPS::saveFix(const snapshot_t &snapshot) {
+  const int64_t now = esp_timer_get_time();
+  const bool rtc = M5.Rtc.isEnabled();
+
+  if (!m_ClockSet) {
+    const struct timeval tv = {
+        getEpoch(snapshot.timesync),
+        (suseconds_t)(snapshot.timesync.centisecond * 10000),
+    };
+    settimeofday(&tv, NULL);
+    if (rtc) {
+      struct tm utc;
+      gmtime_r(&tv.tv_sec, &utc);
+      M5.Rtc.setDateTime(&utc);
+    }
+    m_ClockSet = true;
+    m_UTCKnown = true;
+  }
+
+  if ((m_FixSaved != 0) && ((now - m_FixSaved) < (FIX_SAVE_MS * 1000LL))) {
+    return;
+  }
+  m_FixSaved = now;
+
+  const Settings::gps_fix_t fix = {
+      snapshot.gps.latitude, snapshot.gps.longitude, snapshot.gps.altitude, true, rtc,
+  };
+  Settings::save<Settings::GPS_FIX>(fix);
+}
+
+/** Drain the receive buffer, decoding the sentences we use. */
+void GPS::serviceSerial(void) {
   if (!m_Enabled) {
     return;
   }
 
-  if ((m_GPS.location.age() < MAX_AGE_MS) && m_GPS.location.isValid()
-      && (m_GPS.date.age() < MAX_AGE_MS) && m_GPS.date.isValid() && (m_GPS.time.age() < MAX_AGE_MS)
-      && m_GPS.time.isValid()) {
-    m_HasFix = (m_GPS.location.FixQuality() != TinyGPSLocation::Quality::Invalid);
-  } else {
-    m_HasFix = false;
+  while (true) {
+    size_t buffered = 0;
+    uart_get_buffered_data_len(m_UART, &buffered);
+    if (buffered == 0) {
+      break;
+    }
+
+    int bytes = uart_read_bytes(m_UART, m_Buffer.data(), std::min(buffered, m_Buffer.size()), 0);
+    if (bytes <= 0) {
+      break;
+    }
+
+    receive(bytes);
   }
+}
 
-  if (m_HasFix) {
-    Camera::gps_t dgps = {
-        m_GPS.location.lat(),
-        m_GPS.location.lng(),
-        m_GPS.altitude.meters(),
-        m_GPS.satellites.value(),
-    };
-    Camera::timesync_t timesync = {
-        m_GPS.date.year(),   m_GPS.date.month(),  m_GPS.date.day(),         m_GPS.time.hour(),
-        m_GPS.time.minute(), m_GPS.time.second(), m_GPS.time.centisecond(),
-    };
+/** Decode a chunk of received data in m_Buffer. */
+void GPS::receive(size_t bytes) {
+  const int64_t start = esp_timer_get_time();
 
-    Control::getInstance().updateGPS(dgps, timesync);
+  m_RxBytes += bytes;
+
+  // NMEA is switched off at the receiver in UBX mode
+  if (!m_UBX) {
+    const char *data = m_Buffer.data();
+    size_t len = bytes;
+    size_t length;
+    while (const char *sentence = m_NMEA.next(data, len, length)) {
+      decode(sentence, length);
+    }
   }
 
-  if (m_Icon != NULL) {
-    lv_image_set_src(m_Icon, m_HasFix ? &icon_my_location : &icon_location_disabled);
+  // always look for UBX, acknowledgements arrive while still in NMEA mode
+  const uint8_t *data = reinterpret_cast<const uint8_t *>(m_Buffer.data());
+  size_t len = bytes;
+  UBXParser::frame_t frame;
+  while (m_UBXParser.next(data, len, frame)) {
+    decode(frame);
   }
+
+  m_ParseUs += esp_timer_get_time() - start;
 }
 
-/** Read and decode the GPS data from serial port. */
-void GPS::serviceSerial(void) {
-  std::array<uint8_t, BUFFER_SIZE> buffer;
+/** Decode a single RMC or GGA sentence, publishing each complete fix. */
+void GPS::decode(const char *sentence, size_t length) {
+  m_Decoded++;
+  for (size_t i = 0; i < length; i++) {
+    m_GPS.encode(sentence[i]);
+  }
 
-  if (!m_Enabled) {
+  // date only comes from RMC, altitude only from GGA, reading clears them
+  const bool rmc = m_GPS.date.isUpdated();
+  const bool gga = m_GPS.altitude.isUpdated();
+  (void)m_GPS.date.value();
+  (void)m_GPS.altitude.value();
+
+  // a repeated RMC means the unit is not sending GGA, publish without it
+  bool complete = rmc && (m_Sentences & SENTENCE_RMC);
+  m_Sentences |= (rmc ? SENTENCE_RMC : 0) | (gga ? SENTENCE_GGA : 0);
+  complete |= (m_Sentences == (SENTENCE_RMC | SENTENCE_GGA));
+  if (!complete) {
+    return;
+  }
+  m_Sentences = 0;
+
+  publish(getNMEASnapshot());
+}
+
+/** Decode a UBX frame, acknowledgements and NAV-PVT. */
+void GPS::decode(const UBXParser::frame_t &frame) {
+  if (frame.cls == UBXParser::CLASS_ACK) {
+    if ((m_Ack == ACK_PENDING) && (frame.length == 2) && (frame.payload[0] == m_AckClass)
+        && (frame.payload[1] == m_AckID)) {
+      m_Ack = (frame.id == UBXParser::ID_ACK_ACK) ? ACK_ACK : ACK_NAK;
+    }
+    return;
+  }
+
+  UBXParser::pvt_t pvt;
+  if (!UBXParser::decodePVT(frame, pvt)) {
+    return;
+  }
+  m_Decoded++;
+
+  const bool fix = UBXParser::hasFix(pvt);
+  snapshot_t snapshot;
+
+  snapshot.gps = {
+      pvt.lat * 1e-7,
+      pvt.lon * 1e-7,
+      pvt.hMSL / 1000.0,
+      pvt.numSV,
+  };
+  snapshot.timesync = {
+      pvt.year, pvt.month, pvt.day, pvt.hour, pvt.minute, pvt.second,
+      (unsigned int)(pvt.nano / 10000000),
+  };
+  snapshot.valid =
+      fix && (pvt.valid & UBXParser::VALID_DATE) && (pvt.valid & UBXParser::VALID_TIME);
+  snapshot.quality = fix ? TinyGPSLocation::Quality::GPS : TinyGPSLocation::Quality::Invalid;
+  // NAV-PVT only reports position dilution of precision
+  snapshot.hdop = pvt.pDOP * 0.01;
+  snapshot.time = snapshot.valid ? esp_timer_get_time() : 0;
+  snapshot.stale = false;
+
+  publish(snapshot);
+}
+
+/** Publish a decoded fix and forward it at the configured rate, GPS task only. */
+void GPS::publish(const snapshot_t &snapshot) {
+  const bool fix = hasFix(snapshot);
+  const int64_t now = esp_timer_get_time();
+
+  if (!snapshot.stale) {
+    if (fix && !m_Live) {
+      m_Live = true;
+      ESP_LOGI(LOG_TAG, "GPS first fix after %lums, %s", (uint32_t)((now - m_PowerOnTime) / 1000),
+               m_Aided ? "aided" : "unaided");
+    } else if (!fix && isOfferingLastFix()) {
+      return;
+    }
+
+    if (fix) {
+      record(snapshot);
+      discipline(snapshot);
+    }
+  }
+
+  // readers spin on a store in progress, do not let them preempt it
+  vTaskSuspendAll();
+  m_Snapshot.store(snapshot);
+  xTaskResumeAll();
+
+  // only wake the UI when the status icon would change
+  const void *icon = getIcon(snapshot, m_Enabled);
+  if (icon != m_PostedIcon) {
+    m_PostedIcon = icon;
+    UI::post(UI::EVENT_GPS);
+  }
+
+  if (fix && ((now - m_LastSent) >= ((m_RateMs - RATE_SLACK_MS) * 1000LL))) {
+    if (m_FirstGeotag == 0) {
+      m_FirstGeotag = now;
+      ESP_LOGI(LOG_TAG, "GPS first geotag after %lums, %s fix",
+               (uint32_t)((now - m_PowerOnTime) / 1000), snapshot.stale ? "last" : "live");
+    }
+    m_LastSent = now;
+    Control::getInstance().updateGPS(snapshot.gps, snapshot.timesync);
+  }
+}
+
+bool GPS::isOfferingLastFix(void) const {
+  return m_OfferLastFix && !m_Live && m_LastFix.valid && m_UTCKnown;
+}
+
+/** Republish the last fix at the configured rate until a live fix arrives. */
+void GPS::serviceLastFix(void) {
+  const int64_t now = esp_timer_get_time();
+
+  if (!isOfferingLastFix() || ((now - m_LastSent) < ((m_RateMs - RATE_SLACK_MS) * 1000LL))) {
+    return;
+  }
+
+  const time_t t = time(NULL);
+  struct tm utc;
+  gmtime_r(&t, &utc);
+
+  snapshot_t snapshot;
+  snapshot.gps = {
+      m_LastFix.latitude,
+      m_LastFix.longitude,
+      m_LastFix.altitude,
+      0,
+  };
+  snapshot.timesync = {
+      (unsigned int)utc.tm_year + 1900,
+      (unsigned int)utc.tm_mon + 1,
+      (unsigned int)utc.tm_mday,
+      (unsigned int)utc.tm_hour,
+      (unsigned int)utc.tm_min,
+      (unsigned int)utc.tm_sec,
+      0,
+  };
+  snapshot.valid = true;
+  snapshot.quality = TinyGPSLocation::Quality::Manual;
+  snapshot.hdop = 0.0;
+  snapshot.time = now;
+  snapshot.stale = true;
+
+  publish(snapshot);
+}
+
+/** Snapshot of the NMEA decoder state. */
+GPS::snapshot_t GPS::getNMEASnapshot(void) {
+  snapshot_t snapshot;
+
+  snapshot.gps = {
+      m_GPS.location.lat(),
+      m_GPS.location.lng(),
+      m_GPS.altitude.meters(),
+      m_GPS.satellites.value(),
+  };
+  snapshot.timesync = {
+      m_GPS.date.year(),   m_GPS.date.month(),  m_GPS.date.day(),         m_GPS.time.hour(),
+      m_GPS.time.minute(), m_GPS.time.second(), m_GPS.time.centisecond(),
+  };
+  snapshot.valid = m_GPS.location.isValid() && m_GPS.date.isValid() && m_GPS.time.isValid();
+  snapshot.quality = m_GPS.location.FixQuality();
+  snapshot.hdop = m_GPS.hdop.hdop();
+  snapshot.time = 0;
+
+  if (snapshot.valid) {
+    const uint32_t age = std::max({m_GPS.location.age(), m_GPS.date.age(), m_GPS.time.age()});
+    snapshot.time = esp_timer_get_time() - (age * 1000LL);
+  }
+  snapshot.stale = false;
+
+  return snapshot;
+}
+
+/**
+ * Send a UBX message and wait for the receiver to acknowledge it.
+ *
+ * @return true if acknowledged, false if rejected or unanswered.
+ */
+void GPS::writeUBX(uint8_t cls, uint8_t id, const uint8_t *payload, uint16_t length) {
+  std::array<uint8_t, UBXParser::OVERHEAD + 32> frame;
+  const size_t size = UBXParser::encode(frame.data(), frame.size(), cls, id, payload, length);
+
+  uart_write_bytes(m_UART, frame.data(), size);
+}
+
+bool GPS::sendUBX(uint8_t cls, uint8_t id, const uint8_t *payload, uint16_t length) {
+  for (unsigned int attempt = 0; attempt < ACK_RETRIES; attempt++) {
+    m_AckClass = cls;
+    m_AckID = id;
+    m_Ack = ACK_PENDING;
+    writeUBX(cls, id, payload, length);
+
+    const int64_t deadline = esp_timer_get_time() + (ACK_MS * 1000LL);
+    while ((m_Ack == ACK_PENDING) && (esp_timer_get_time() < deadline)) {
+      int bytes = uart_read_bytes(m_UART, m_Buffer.data(), m_Buffer.size(), pdMS_TO_TICKS(10));
+      if (bytes > 0) {
+        receive(bytes);
+      }
+    }
+
+    if (m_Ack != ACK_PENDING) {
+      break;
+    }
+  }
+
+  return (m_Ack == ACK_ACK);
+}
+
+/** Set the output rate of a message on the current port. */
+bool GPS::setMessageRate(uint8_t cls, uint8_t id, uint8_t rate) {
+  const uint8_t payload[] = {cls, id, rate};
+
+  return sendUBX(UBXParser::CLASS_CFG, UBXParser::ID_CFG_MSG, payload, sizeof(payload));
+}
+
+/**
+ * Switch the receiver between NAV-PVT only at the configured rate and its
+ * default NMEA output. A receiver that does not answer stays on NMEA.
+ */
+void GPS::configure(void) {
+  static constexpr uint8_t nmea[] = {
+      0x00,  // GGA
+      0x01,  // GLL
+      0x02,  // GSA
+      0x03,  // GSV
+      0x04,  // RMC
+      0x05,  // VTG
+  };
+  const bool ubx = m_UBXWanted;
+  const bool powerOn = m_PowerOn.exchange(false);
+
+  if (powerOn) {
+    m_Aided = false;
+    m_FirstGeotag = 0;
+  }
+
+  if (!ubx && !m_UBX) {
+    return;
+  }
+
+  if (ubx) {
+    const uint16_t rate = std::min(m_RateMs.load(), (uint32_t)UINT16_MAX);
+    // measurement rate, one solution per measurement, aligned to UTC
+    const uint8_t payload[] = {(uint8_t)(rate & 0xff), (uint8_t)(rate >> 8), 1, 0, 0, 0};
+
+    if (!sendUBX(UBXParser::CLASS_CFG, UBXParser::ID_CFG_RATE, payload, sizeof(payload))) {
+      ESP_LOGW(LOG_TAG, "GPS did not accept UBX configuration, using NMEA");
+      return;
+    }
+  }
+
+  auto output = [this](bool pvt) {
+    bool ok = setMessageRate(UBXParser::CLASS_NAV, UBXParser::ID_NAV_PVT, pvt ? 1 : 0);
+    for (const auto id : nmea) {
+      ok &= setMessageRate(UBXParser::CLASS_NMEA, id, pvt ? 0 : 1);
+    }
+    return ok;
+  };
+
+  const bool ok = output(ubx);
+  if (ubx && !ok) {
+    // some sentences may already be off, put the receiver back on NMEA
+    ESP_LOGW(LOG_TAG, "GPS did not accept UBX output, restoring NMEA");
+    (void)output(false);
+  }
+
+  m_UBX = ubx && ok;
+  m_NMEA.resync();
+  m_Sentences = 0;
+  ESP_LOGI(LOG_TAG, "GPS output %s", m_UBX ? "UBX NAV-PVT" : "NMEA");
+
+  if (m_UBX && powerOn) {
+    aid();
+  }
+}
+
+/** Hot start a u-blox receiver with the last fix and the current UTC. */
+void GPS::aid(void) {
+  if (!m_LastFix.valid) {
+    return;
+  }
+
+  std::array<uint8_t, UBXParser::MGA_INI_POS_LLH_LENGTH> pos = {};
+  pos[0] = UBXParser::MGA_INI_POS_LLH;
+  UBXParser::put<int32_t>(pos.data(), 4, std::lround(m_LastFix.latitude * 1e7));
+  UBXParser::put<int32_t>(pos.data(), 8, std::lround(m_LastFix.longitude * 1e7));
+  UBXParser::put<int32_t>(pos.data(), 12, std::lround(m_LastFix.altitude * 100));
+  UBXParser::put<uint32_t>(pos.data(), 16, AID_POS_ACC_M * 100);
+  writeUBX(UBXParser::CLASS_MGA, UBXParser::ID_MGA_INI, pos.data(), pos.size());
+
+  if (m_UTCKnown) {
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    struct tm utc;
+    gmtime_r(&tv.tv_sec, &utc);
+
+    std::array<uint8_t, UBXParser::MGA_INI_TIME_UTC_LENGTH> time = {};
+    time[0] = UBXParser::MGA_INI_TIME_UTC;
+    // valid on receipt, leap seconds unknown
+    time[2] = 0;
+    time[3] = 0x80;
+    UBXParser::put<uint16_t>(time.data(), 4, utc.tm_year + 1900);
+    time[6] = utc.tm_mon + 1;
+    time[7] = utc.tm_mday;
+    time[8] = utc.tm_hour;
+    time[9] = utc.tm_min;
+    time[10] = utc.tm_sec;
+    UBXParser::put<uint32_t>(time.data(), 12, tv.tv_usec * 1000);
+    UBXParser::put<uint16_t>(time.data(), 16, AID_TIME_ACC_S);
+    writeUBX(UBXParser::CLASS_MGA, UBXParser::ID_MGA_INI, time.data(), time.size());
+  }
+
+  m_Aided = true;
+  ESP_LOGI(LOG_TAG, "GPS aided with last fix%s", m_UTCKnown ? " and time" : "");
+}
+
+GPS::snapshot_t GPS::getSnapshot(void) const {
+  return m_Snapshot.load();
+}
+
+/** Publish the receive statistics once per STATS_MS, GPS task only. */
+void GPS::updateStats(void) {
+  const int64_t now = esp_timer_get_time();
+  const int64_t elapsed = now - m_StatsTime;
+  if (elapsed < (STATS_MS * 1000LL)) {
+    return;
+  }
+
+  const NMEAFilter::stats_t &nmea = m_NMEA.getStats();
+  const UBXParser::stats_t &ubx = m_UBXParser.getStats();
+  const stats_t stats = {
+      (uint32_t)(m_RxBytes * 1000000LL / elapsed),
+      (uint32_t)(m_Decoded * 1000000LL / elapsed),
+      (uint32_t)(m_ParseUs * 1000000LL / elapsed),
+      nmea.checksum + nmea.oversize + ubx.checksum + ubx.oversize,
+      m_Overflows,
+      PPSDiscipline::isLocked(m_Discipline.getModel(), now),
+      m_Discipline.getStats().jitter,
+  };
+  m_RxBytes = 0;
+  m_Decoded = 0;
+  m_ParseUs = 0;
+  m_StatsTime = now;
+
+  vTaskSuspendAll();
+  m_Stats.store(stats);
+  xTaskResumeAll();
+
+  ESP_LOGD(LOG_TAG, "%lu B/s, %lu sentences/s, parse %luus/s, errors = %lu, overflows = %lu",
+           stats.bytes, stats.sentences, stats.parseUs, stats.errors, stats.overflows);
+}
+
+GPS::stats_t GPS::getStats(void) const {
+  return m_Stats.load();
+}
+
+void GPS::exportTrack(void) {
+  m_TrackExport = true;
+}
+
+/** Service track log requests, GPS task only. */
+void GPS::serviceTrack(void) {
+  const bool flush = m_TrackFlush.exchange(false);
+  const bool dump = m_TrackExport.exchange(false);
+
+  if (!m_TrackReady && (m_TrackEnabled || dump)) {
+    m_TrackReady = m_Track.begin();
+  }
+  if (!m_TrackReady) {
+    return;
+  }
+
+  if (flush) {
+    m_Track.flush();
+  }
+
+  // one chunk per pass, buffered points are included in the export
+  if (dump && !m_TrackExporting) {
+    m_Track.beginDump();
+    m_TrackExporting = true;
+  }
+  if (m_TrackExporting) {
+    m_TrackExporting = m_Track.dumpNext();
+  }
+}
+
+/** Add a live fix to the track log, GPS task only. */
+void GPS::record(const snapshot_t &snapshot) {
+  if (!m_TrackEnabled || !m_TrackReady) {
     return;
   }
 
-  int bytes = uart_read_bytes(m_UART, buffer.data(), buffer.size(), 1);
-  if (bytes > 0) {
-    m_GPS.encode(reinterpret_cast<char *>(buffer.data()), bytes);
+  const TrackEncoder::point_t point = {
+      (uint32_t)getEpoch(snapshot.timesync),
+      (int32_t)std::lround(snapshot.gps.latitude * 1e6),
+      (int32_t)std::lround(snapshot.gps.longitude * 1e6),
+      (int32_t)std::lround(snapshot.gps.altitude),
+  };
+  m_Track.add(point);
+}
+
+/** Seconds since the epoch of a GPS date and time. */
+time_t GPS::getEpoch(const Camera::timesync_t &timesync) {
+  struct tm utc = {};
+  utc.tm_year = timesync.year - 1900;
+  utc.tm_mon = timesync.month - 1;
+  utc.tm_mday = timesync.day;
+  utc.tm_hour = timesync.hour;
+  utc.tm_min = timesync.minute;
+  utc.tm_sec = timesync.second;
+
+  // no time zone is set, mktime() is UTC
+  return mktime(&utc);
+}
+
+/** PPS input on the port B input pin, where the board has one. */
+gpio_num_t GPS::getPPSPin(void) {
+  const int8_t pin = M5.getPin(m5::port_b_pin1);
+
+  return (pin < 0) ? GPIO_NUM_NC : static_cast<gpio_num_t>(pin);
+}
+
+bool GPS::isPPSAvailable(void) {
+  return getPPSPin() != GPIO_NUM_NC;
+}
+
+void IRAM_ATTR GPS::ppsISR(void *param) {
+  auto *gps = static_cast<GPS *>(param);
+  BaseType_t woken = pdFALSE;
+
+  const int64_t time = esp_timer_get_time();
+  xQueueOverwriteFromISR(gps->m_PPSQueue, &time, &woken);
+  portYIELD_FROM_ISR(woken);
+}
+
+/** Attach or detach the PPS interrupt, UI task only. */
+void GPS::attachPPS(bool enable) {
+  const gpio_num_t pin = getPPSPin();
+
+  if ((pin == GPIO_NUM_NC) || (enable == m_PPSAttached)) {
+    return;
+  }
+
+  if (!enable) {
+    gpio_isr_handler_remove(pin);
+    gpio_set_intr_type(pin, GPIO_INTR_DISABLE);
+    m_PPSAttached = false;
+    return;
+  }
+
+  esp_err_t err = gpio_install_isr_service(0);
+  if ((err != ESP_OK) && (err != ESP_ERR_INVALID_STATE)) {
+    ESP_LOGE(LOG_TAG, "Failed to install GPIO ISR service: %s", esp_err_to_name(err));
+    return;
   }
+
+  gpio_set_direction(pin, GPIO_MODE_INPUT);
+  // the receiver pulse leads each UTC second
+  ESP_ERROR_CHECK(gpio_set_intr_type(pin, GPIO_INTR_POSEDGE));
+  ESP_ERROR_CHECK(gpio_isr_handler_add(pin, ppsISR, this));
+  m_PPSAttached = true;
+  ESP_LOGI(LOG_TAG, "GPS PPS on GPIO%d.", pin);
+}
+
+/**
+ * Pair the last PPS edge with a live fix, GPS task only.
+ *
+ * The receiver reports a whole second solution after the edge that marks
+ * it, so an edge less than a second old belongs to the fix.
+ */
+void GPS::discipline(const snapshot_t &snapshot) {
+  int64_t edge;
+  if (xQueueReceive(m_PPSQueue, &edge, 0) == pdTRUE) {
+    m_PPSEdge = edge;
+  }
+
+  const int64_t age = esp_timer_get_time() - m_PPSEdge;
+  if ((m_PPSEdge == 0) || (snapshot.timesync.centisecond != 0) || (age <= 0)
+      || (age >= PPSDiscipline::SECOND_US)) {
+    return;
+  }
+
+  const int64_t utc = getEpoch(snapshot.timesync) * PPSDiscipline::SECOND_US;
+  if (!m_Discipline.pulse(m_PPSEdge, utc)) {
+    ESP_LOGD(LOG_TAG, "PPS edge rejected");
+  }
+  m_PPSEdge = 0;
+
+  vTaskSuspendAll();
+  m_Clock.store(m_Discipline.getModel());
+  xTaskResumeAll();
+}
+
+bool GPS::isPPSLocked(void) const {
+  return PPSDiscipline::isLocked(m_Clock.load(), esp_timer_get_time());
+}
+
+int64_t GPS::toUTC(int64_t local) const {
+  const PPSDiscipline::model_t model = m_Clock.load();
+  if (PPSDiscipline::isLocked(model, esp_timer_get_time())) {
+    return PPSDiscipline::toUTC(model, local);
+  }
+
+  if (!m_UTCKnown) {
+    return 0;
+  }
+
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  const int64_t now = esp_timer_get_time();
+
+  return (tv.tv_sec * 1000000LL) + tv.tv_usec + (local - now);
+}
+
+int64_t GPS::toLocal(int64_t utc) const {
+  const PPSDiscipline::model_t model = m_Clock.load();
+  if (PPSDiscipline::isLocked(model, esp_timer_get_time())) {
+    return PPSDiscipline::toLocal(model, utc);
+  }
+
+  const int64_t now = esp_timer_get_time();
+  const int64_t current = toUTC(now);
+  if (current == 0) {
+    return 0;
+  }
+
+  return now + (utc - current);
 }
 
-TinyGPSPlus &GPS::get(void) {
-  return m_GPS;
+int64_t GPS::getUTC(void) const {
+  return toUTC(esp_timer_get_time());
 }
 
 }  // namespace Furble
@@ -0,0 +1,70 @@
+#include <cmath>
+
+#include "FurbleGeotag.h"
+
+namespace Furble {
+
+static const Geotag::policy_t POLICY_DISABLED = {false, false, 0, 0, 0.0, 0.0};
+// camera asks for a position when it wants one
+static const Geotag::policy_t POLICY_FUJIFILM = {true, true, 0, 0, 0.0, 0.0};
+// each update reads two characteristics before the write
+static const Geotag::policy_t POLICY_SONY = {true, false, 5000, 30000, 0.0001, 10.0};
+static const Geotag::policy_t POLICY_RICOH = {true, false, 0, 10000, 0.00001, 1.0};
+static const Geotag::policy_t POLICY_DEFAULT = {true, false, 1000, 10000, 0.00005, 5.0};
+
+Geotag::Geotag(Camera::Type type) : m_Policy {getPolicy(type)} {}
+
+const Geotag::policy_t &Geotag::getPolicy(Camera::Type type) {
+  switch (type) {
+    case Camera::Type::FUJIFILM_BASIC:
+    case Camera::Type::FUJIFILM_SECURE:
+      return POLICY_FUJIFILM;
+    case Camera::Type::SONY:
+      return POLICY_SONY;
+    case Camera::Type::RICOH:
+      return POLICY_RICOH;
+    case Camera::Type::CANON_EOS_REMOTE:
+    case Camera::Type::MOBILE_DEVICE:
+      return POLICY_DISABLED;
+    default:
+      return POLICY_DEFAULT;
+  }
+}
+
+bool Geotag::dispatch(const Camera::gps_t &gps, int64_t now, bool requested) {
+  bool send = m_Policy.enabled && (!m_Policy.onRequest || requested);
+
+  if (send && m_HasSent) {
+    const int64_t elapsed = (now - m_LastTime) / 1000;
+    const bool moved = (std::fabs(gps.latitude - m_Last.latitude) >= m_Policy.minDeltaDeg)
+                       || (std::fabs(gps.longitude - m_Last.longitude) >= m_Policy.minDeltaDeg)
+                       || (std::fabs(gps.altitude - m_Last.altitude) >= m_Policy.minDeltaAltM);
+
+    send = (elapsed >= m_Policy.minIntervalMs) && (moved || (elapsed >= m_Policy.refreshMs));
+  }
+
+  if (send) {
+    m_HasSent = true;
+    m_Last = gps;
+    m_LastTime = now;
+    m_Sent++;
+  } else {
+    m_Suppressed++;
+  }
+
+  return send;
+}
+
+void Geotag::reset(void) {
+  m_HasSent = false;
+}
+
+uint32_t Geotag::getSent(void) const {
+  return m_Sent;
+}
+
+uint32_t Geotag::getSuppressed(void) const {
+  return m_Suppressed;
+}
+
+}  // namespace Furble
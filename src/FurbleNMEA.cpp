@@ -0,0 +1,167 @@
+#include <algorithm>
+#include <cstring>
+
+#include "FurbleNMEA.h"
+
+namespace Furble {
+
+bool NMEAFilter::isWanted(const char *header) {
+  const char *type = &header[3];
+
+  return (std::memcmp(type, "RMC", 3) == 0) || (std::memcmp(type, "GGA", 3) == 0);
+}
+
+int NMEAFilter::hexValue(char c) {
+  if ((c >= '0') && (c <= '9')) {
+    return c - '0';
+  }
+  if ((c >= 'A') && (c <= 'F')) {
+    return c - 'A' + 10;
+  }
+  if ((c >= 'a') && (c <= 'f')) {
+    return c - 'a' + 10;
+  }
+  return -1;
+}
+
+void NMEAFilter::append(const char *data, size_t len) {
+  len = std::min(len, m_Carry.size() - m_CarryLength);
+  std::memcpy(&m_Carry[m_CarryLength], data, len);
+  m_CarryLength += len;
+}
+
+const char *NMEAFilter::next(const char *&data, size_t &len, size_t &length) {
+  const char *end = data + len;
+  const char *p = data;
+  // start of the sentence, or of its uncopied tail when carrying
+  const char *start = data;
+  const char *sentence = NULL;
+
+  while ((sentence == NULL) && (p < end)) {
+    const char c = *p++;
+
+    if (c == '$') {
+      if ((m_State == STATE_BODY) || (m_State == STATE_CHECKSUM) || (m_State == STATE_END)) {
+        // truncated
+        m_Stats.checksum++;
+      }
+      m_State = STATE_HEADER;
+      m_Carrying = false;
+      m_Length = 0;
+      m_Parity = 0;
+      start = p - 1;
+    }
+
+    if ((m_State == STATE_IDLE) || (m_State == STATE_SKIP)) {
+      if (c == '\n') {
+        m_State = STATE_IDLE;
+      }
+      continue;
+    }
+
+    if (++m_Length > MAX_SENTENCE) {
+      m_Stats.oversize++;
+      m_State = STATE_SKIP;
+      continue;
+    }
+
+    switch (m_State) {
+      case STATE_HEADER:
+        if (c != '$') {
+          m_Parity ^= c;
+        }
+        if (m_Length == HEADER_SIZE) {
+          const char *header = start;
+          if (m_Carrying) {
+            append(start, p - start);
+            start = p;
+            header = m_Carry.data();
+          }
+          if (isWanted(header)) {
+            m_State = STATE_BODY;
+          } else {
+            m_Stats.ignored++;
+            m_State = STATE_SKIP;
+          }
+        }
+        break;
+
+      case STATE_BODY:
+        if (c == '*') {
+          m_Checksum = 0;
+          m_Digits = 0;
+          m_State = STATE_CHECKSUM;
+        } else if ((c == '\r') || (c == '\n')) {
+          // no checksum
+          m_Stats.checksum++;
+          m_State = (c == '\n') ? STATE_IDLE : STATE_SKIP;
+        } else {
+          m_Parity ^= c;
+        }
+        break;
+
+      case STATE_CHECKSUM:
+      {
+        const int value = hexValue(c);
+        if (value < 0) {
+          m_Stats.checksum++;
+          m_State = (c == '\n') ? STATE_IDLE : STATE_SKIP;
+        } else {
+          m_Checksum = (m_Checksum << 4) | value;
+          if (++m_Digits == 2) {
+            m_State = STATE_END;
+          }
+        }
+      } break;
+
+      case STATE_END:
+        if (c == '\r') {
+          break;
+        }
+        if ((c != '\n') || (m_Checksum != m_Parity)) {
+          m_Stats.checksum++;
+          m_State = (c == '\n') ? STATE_IDLE : STATE_SKIP;
+          break;
+        }
+        m_State = STATE_IDLE;
+        m_Stats.sentences++;
+        length = m_Length;
+        sentence = start;
+        if (m_Carrying) {
+          append(start, p - start);
+          sentence = m_Carry.data();
+        }
+        m_Carrying = false;
+        break;
+
+      default:
+        break;
+    }
+  }
+
+  // input exhausted part way through a candidate sentence, carry it over
+  if ((sentence == NULL) && (m_State != STATE_IDLE) && (m_State != STATE_SKIP)) {
+    if (!m_Carrying) {
+      m_CarryLength = 0;
+      m_Carrying = true;
+    }
+    append(start, p - start);
+  }
+
+  m_Stats.bytes += p - data;
+  len -= p - data;
+  data = p;
+
+  return sentence;
+}
+
+void NMEAFilter::resync(void) {
+  m_State = STATE_SKIP;
+  m_Carrying = false;
+}
+
+const NMEAFilter::stats_t &NMEAFilter::getStats(void) const {
+  return m_Stats;
+}
+
+}  // namespace Furble
@@ -0,0 +1,131 @@
+#include <algorithm>
+#include <cmath>
+
+#include "FurbleSchedule.h"
+
+namespace Furble {
+
+/** Per-frame ratio of an exponential ramp, a value held constant may be zero. */
+static double ratio(uint64_t start, uint64_t end, double steps) {
+  return (start == end) ? 1.0 : std::pow((double)end / start, 1.0 / steps);
+}
+
+bool Schedule::isValid(const segment_t &segment) {
+  auto valid = [](uint64_t start, uint64_t end) {
+    return (start == end) || ((start > 0) && (end > 0));
+  };
+
+  return (segment.ramp != RAMP_EXPONENTIAL)
+         || (valid(segment.interval, segment.intervalEnd)
+             && valid(segment.shutter, segment.shutterEnd));
+}
+
+bool Schedule::begin(const program_t &program, int64_t start) {
+  if ((program.count == 0) || (program.count > PROGRAM_MAX_SEGMENTS)) {
+    return false;
+  }
+
+  for (uint8_t i = 0; i < program.count; i++) {
+    if (!isValid(program.segment[i])) {
+      return false;
+    }
+  }
+
+  m_Program = program;
+  loadSegment(0);
+  m_Start = start;
+  m_Scheduled = m_Program.wait;
+
+  return true;
+}
+
+void Schedule::loadSegment(uint8_t index) {
+  const segment_t &segment = m_Program.segment[index];
+
+  m_Segment = index;
+  m_SegmentFrame = 0;
+  m_Interval = segment.interval;
+  m_Shutter = segment.shutter;
+  m_Ramp = (segment.count > 1) ? segment.ramp : RAMP_NONE;
+
+  double steps = segment.count - 1;
+  switch (m_Ramp) {
+    case RAMP_LINEAR:
+      m_IntervalStep = ((double)segment.intervalEnd - segment.interval) / steps;
+      m_ShutterStep = ((double)segment.shutterEnd - segment.shutter) / steps;
+      break;
+    case RAMP_EXPONENTIAL:
+      m_IntervalStep = ratio(segment.interval, segment.intervalEnd, steps);
+      m_ShutterStep = ratio(segment.shutter, segment.shutterEnd, steps);
+      break;
+    default:
+      m_IntervalStep = 0.0;
+      m_ShutterStep = 0.0;
+      break;
+  }
+}
+
+bool Schedule::advance(void) {
+  m_Scheduled += std::max({m_Interval, m_Shutter, (double)MIN_PERIOD_US});
+  m_SegmentFrame++;
+
+  const segment_t &segment = m_Program.segment[m_Segment];
+  if ((segment.count != 0) && (m_SegmentFrame >= segment.count)) {
+    if ((m_Segment + 1) >= m_Program.count) {
+      return false;
+    }
+    loadSegment(m_Segment + 1);
+    return true;
+  }
+
+  switch (m_Ramp) {
+    case RAMP_LINEAR:
+      m_Interval += m_IntervalStep;
+      m_Shutter += m_ShutterStep;
+      break;
+    case RAMP_EXPONENTIAL:
+      m_Interval *= m_IntervalStep;
+      m_Shutter *= m_ShutterStep;
+      break;
+    default:
+      break;
+  }
+
+  return true;
+}
+
+void Schedule::shift(int64_t delta) {
+  m_Start += delta;
+}
+
+int64_t Schedule::getPress(void) const {
+  return m_Start + getElapsed();
+}
+
+int64_t Schedule::getElapsed(void) const {
+  return std::llround(m_Scheduled);
+}
+
+int64_t Schedule::getShutter(void) const {
+  return std::llround(m_Shutter);
+}
+
+int64_t Schedule::getInterval(void) const {
+  return std::max<int64_t>(std::llround(m_Interval), MIN_PERIOD_US);
+}
+
+uint32_t Schedule::getTotal(void) const {
+  uint32_t total = 0;
+
+  for (uint8_t i = 0; i < m_Program.count; i++) {
+    if (m_Program.segment[i].count == 0) {
+      // infinite
+      return 0;
+    }
+    total += m_Program.segment[i].count;
+  }
+
+  return total;
+}
+
+}  // namespace Furble
@@ -0,0 +1,378 @@
+#include <algorithm>
+
+#include "FurbleControl.h"
+#include "FurbleGPS.h"
+#include "FurbleSequencer.h"
+#include "FurbleSettings.h"
+
+void sequencer_task(void *param) {
+  Furble::Sequencer *sequencer = static_cast<Furble::Sequencer *>(param);
+  sequencer->task();
+}
+
+namespace Furble {
+
+Sequencer &Sequencer::getInstance(void) {
+  static Sequencer instance;
+
+  if (instance.m_Task == NULL) {
+    const esp_timer_create_args_t args = {
+        .callback =
+            [](void *arg) {
+              auto *sequencer = static_cast<Sequencer *>(arg);
+              xTaskNotifyGive(sequencer->m_Task);
+            },
+        .arg = &instance,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "sequencer",
+        .skip_unhandled_events = false,
+    };
+    ESP_ERROR_CHECK(esp_timer_create(&args, &instance.m_Timer));
+
+    BaseType_t ret =
+        xTaskCreate(sequencer_task, "sequencer", 4096, &instance, PRIORITY, &instance.m_Task);
+    if (ret != pdPASS) {
+      ESP_LOGE(LOG_TAG, "Failed to create sequencer task.");
+      abort();
+    }
+  }
+
+  return instance;
+}
+
+void Sequencer::start(const interval_t &interval) {
+  start(toProgram(interval));
+}
+
+void Sequencer::start(const program_t &program) {
+  const std::lock_guard<std::mutex> command(m_CommandMutex);
+  const size_t targets = Control::getInstance().getTargetCount();
+  action_t action = {};
+
+  {
+    const std::lock_guard<std::mutex> lock(m_Mutex);
+    const int64_t now = esp_timer_get_time();
+
+    if (!m_Schedule.begin(program, now)) {
+      ESP_LOGE(LOG_TAG, "Invalid program of %u segments.", program.count);
+      return;
+    }
+
+    m_Count = 0;
+    m_Total = m_Schedule.getTotal();
+    m_Log.begin(targets);
+    m_LowPower = Settings::load<Settings::LOW_POWER>();
+    m_Relaxed = false;
+    m_Dropout = static_cast<dropout_t>(Settings::load<Settings::DROPOUT>());
+    m_Holding = false;
+    m_WhenReady = Settings::load<Settings::WHEN_READY>();
+
+    m_Next = m_Schedule.getPress();
+    m_State = STATE_WAIT;
+
+    schedule(now, action);
+  }
+
+  perform(action);
+}
+
+program_t Sequencer::toProgram(const interval_t &interval) {
+  SpinValue count(interval.count);
+  SpinValue delay(interval.delay);
+  SpinValue shutter(interval.shutter);
+  SpinValue wait(interval.wait);
+
+  program_t program = {
+      .version = PROGRAM_VERSION,
+      .count = 1,
+      .wait = wait.toMicroseconds(),
+      .segment = {},
+  };
+
+  segment_t &segment = program.segment[0];
+  segment.count = (count.m_Unit == SpinValue::UNIT_INF)
+                      ? 0
+                      : std::clamp<uint32_t>(count.m_Value, 1, UINT16_MAX);
+  segment.ramp = RAMP_NONE;
+  segment.shutter = shutter.toMicroseconds();
+  segment.shutterEnd = segment.shutter;
+  segment.interval = shutter.toMicroseconds() + delay.toMicroseconds();
+  segment.intervalEnd = segment.interval;
+
+  return program;
+}
+
+void Sequencer::stop(void) {
+  const std::lock_guard<std::mutex> command(m_CommandMutex);
+  action_t action = {};
+
+  {
+    const std::lock_guard<std::mutex> lock(m_Mutex);
+
+    esp_timer_stop(m_Timer);
+    if ((m_State != STATE_IDLE) && (m_State != STATE_FINISHED)) {
+      action.exitLowPower = m_Relaxed;
+      action.release = true;
+      m_Relaxed = false;
+      finish(action);
+    }
+    m_State = STATE_IDLE;
+  }
+
+  perform(action);
+}
+
+Sequencer::state_t Sequencer::getState(void) const {
+  const std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_State;
+}
+
+uint32_t Sequencer::getCount(void) const {
+  const std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_Count;
+}
+
+uint32_t Sequencer::getTotal(void) const {
+  const std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_Total;
+}
+
+bool Sequencer::isLowPower(void) const {
+  const std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_LowPower && (m_State != STATE_IDLE) && (m_State != STATE_FINISHED);
+}
+
+uint32_t Sequencer::getRemaining(void) const {
+  const std::lock_guard<std::mutex> lock(m_Mutex);
+
+  if ((m_State == STATE_IDLE) || (m_State == STATE_FINISHED)) {
+    return 0;
+  }
+
+  int64_t remaining = m_Next - esp_timer_get_time();
+  return remaining > 0 ? (remaining / 1000LL) : 0;
+}
+
+ShotLog::header_t Sequencer::getSummary(void) const {
+  const std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_Log.getSummary();
+}
+
+void Sequencer::perform(const action_t &action) {
+  auto &control = Control::getInstance();
+
+  if (action.exitLowPower) {
+    control.sendCommand(Control::CMD_LOW_POWER_EXIT);
+  }
+  if (action.press) {
+    snapshotShutterCounts();
+    control.sendShutter(Control::CMD_SHUTTER_PRESS);
+  }
+  if (action.release) {
+    control.sendShutter(Control::CMD_SHUTTER_RELEASE);
+  }
+  if (action.enterLowPower) {
+    control.sendCommand(Control::CMD_LOW_POWER_ENTER);
+  }
+  if (!action.log.empty()) {
+    ShotLog::save(action.log);
+  }
+}
+
+void Sequencer::arm(int64_t deadline) {
+  esp_timer_stop(m_Timer);
+
+  int64_t timeout = deadline - esp_timer_get_time();
+  if (timeout > 0) {
+    esp_timer_start_once(m_Timer, timeout);
+  } else {
+    xTaskNotifyGive(m_Task);
+  }
+}
+
+bool Sequencer::pacing(void) const {
+  return m_WhenReady && (m_State == STATE_DELAY);
+}
+
+void Sequencer::schedule(int64_t now, action_t &action) {
+  if (pacing()) {
+    // poll for readiness, the connection must stay responsive
+    arm(std::min(m_Next, now + READY_POLL_US));
+    return;
+  }
+
+  if (m_LowPower && !m_Relaxed && ((m_Next - now) > RELAX_MIN_US)) {
+    action.enterLowPower = true;
+    m_Relaxed = true;
+  }
+
+  arm(m_Relaxed ? (m_Next - WAKE_LEAD_US) : m_Next);
+}
+
+void Sequencer::snapshotShutterCounts(void) {
+  auto &control = Control::getInstance();
+
+  m_ShutterCounts.resize(control.getTargetCount());
+  for (size_t i = 0; i < m_ShutterCounts.size(); i++) {
+    m_ShutterCounts[i] = control.getShutterCount(i);
+  }
+}
+
+uint32_t Sequencer::getDispatched(void) const {
+  auto &control = Control::getInstance();
+  uint32_t dispatched = 0;
+
+  for (size_t i = 0; (i < m_ShutterCounts.size()) && (i < 32); i++) {
+    if (control.getShutterCount(i) != m_ShutterCounts[i]) {
+      dispatched |= (1UL << i);
+    }
+  }
+
+  return dispatched;
+}
+
+void Sequencer::finish(action_t &action) {
+  if (m_Count > 0) {
+    action.log = m_Log.serialise();
+  }
+}
+
+void Sequencer::next(int64_t now) {
+  while (m_Schedule.advance()) {
+    m_Next = m_Schedule.getPress();
+
+    // frames overdue by a whole interval, eg. after catching up from a
+    // dropout, are missed rather than fired back to back
+    if ((now - m_Next) <= m_Schedule.getInterval()) {
+      m_State = STATE_DELAY;
+      return;
+    }
+
+    m_Count++;
+    m_Log.missed(m_Schedule.getElapsed(), GPS::getInstance().toUTC(m_Next));
+  }
+
+  m_State = STATE_FINISHED;
+}
+
+void Sequencer::press(int64_t now, uint32_t linked, action_t &action) {
+  if (linked == 0) {
+    if (m_Dropout == DROPOUT_SKIP) {
+      m_Count++;
+      m_Log.missed(m_Schedule.getElapsed(), GPS::getInstance().toUTC(m_Next));
+      next(now);
+      return;
+    }
+
+    // hold the frame, poll for reconnect
+    m_Holding = true;
+    arm(now + HOLD_POLL_US);
+    return;
+  }
+
+  bool delayed = m_Holding;
+  int64_t error = now - m_Next;
+  if (m_Holding && (m_Dropout == DROPOUT_SHIFT)) {
+    // slip the remaining schedule by the outage
+    m_Schedule.shift(error);
+    m_Next = now;
+  }
+  m_Holding = false;
+
+  // sent to the cameras linked at wakeup
+  action.press = true;
+  m_Count++;
+  const GPS &gps = GPS::getInstance();
+  m_Log.press(m_Schedule.getElapsed(), error, linked, delayed, gps.toUTC(now), gps.isPPSLocked());
+  m_Next += m_Schedule.getShutter();
+  m_State = STATE_SHUTTER_OPEN;
+}
+
+Sequencer::action_t Sequencer::step(int64_t now, uint32_t linked, bool ready, uint32_t dispatched) {
+  action_t action = {};
+
+  if ((m_State == STATE_IDLE) || (m_State == STATE_FINISHED)) {
+    return action;
+  }
+
+  if (m_Relaxed) {
+    if (now < (m_Next - WAKE_LEAD_US)) {
+      // stale wakeup
+      arm(m_Next - WAKE_LEAD_US);
+      return action;
+    }
+
+    // restore the connection interval ahead of the deadline
+    action.exitLowPower = true;
+    m_Relaxed = false;
+  }
+
+  if (now < m_Next) {
+    if (pacing()) {
+      if (!ready) {
+        schedule(now, action);
+        return action;
+      }
+
+      // every camera is ready, pull the schedule forward
+      m_Schedule.shift(now - m_Next);
+      m_Next = now;
+    } else {
+      // stale wakeup, eg. from a restarted sequence, or waking from low power
+      arm(m_Next);
+      return action;
+    }
+  }
+
+  switch (m_State) {
+    case STATE_WAIT:
+    case STATE_DELAY:
+      press(now, linked, action);
+      if (m_Holding) {
+        // already armed to poll for reconnect
+        return action;
+      }
+      break;
+
+    case STATE_SHUTTER_OPEN:
+      action.release = true;
+      m_Log.release(now - m_Next, dispatched);
+      next(now);
+      break;
+
+    default:
+      break;
+  }
+
+  if (m_State == STATE_FINISHED) {
+    finish(action);
+  } else {
+    schedule(now, action);
+  }
+
+  return action;
+}
+
+void Sequencer::task(void) {
+  auto &control = Control::getInstance();
+
+  while (true) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    const std::lock_guard<std::mutex> command(m_CommandMutex);
+    // sampled before taking the lock, Control is never called with it held
+    const uint32_t linked = control.getLinked();
+    const bool ready = control.isReady();
+    const uint32_t dispatched = getDispatched();
+    action_t action;
+
+    {
+      const std::lock_guard<std::mutex> lock(m_Mutex);
+      action = step(esp_timer_get_time(), linked, ready, dispatched);
+    }
+
+    perform(action);
+  }
+}
+
+}  // namespace Furble
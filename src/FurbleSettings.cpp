@@ -21,6 +21,19 @@ const std::unordered_map<Settings::type_t, Settings::setting_t> Settings::m_Sett
     {FAUXNY,            {FAUXNY, "FauxNY", "fauxNY", FURBLE_STR}                       },
     {TOUCH_CALIBRATION, {TOUCH_CALIBRATION, "Touch Calibration", "t_calib", FURBLE_STR}},
     {AUTOCONNECT,       {AUTOCONNECT, "Auto-Connect", "autoconnect", FURBLE_STR}       },
+    {PROGRAM,           {PROGRAM, "Program", "program", FURBLE_STR}                    },
+    {LOW_POWER,         {LOW_POWER, "Low Power", "low_power", FURBLE_STR}              },
+    {DROPOUT,           {DROPOUT, "Dropout", "dropout", FURBLE_STR}                    },
+    {OFFSETS,           {OFFSETS, "Offsets", "offsets", FURBLE_STR}                    },
+    {WHEN_READY,        {WHEN_READY, "Fire When Ready", "when_ready", FURBLE_STR}      },
+    {TRIGGER_INPUT,     {TRIGGER_INPUT, "Trigger Input", "trig_input", FURBLE_STR}     },
+    {TRIGGER_DELAY,     {TRIGGER_DELAY, "Trigger Delay", "trig_delay", FURBLE_STR}     },
+    {GPS_RATE,          {GPS_RATE, "GPS Rate", "gps_rate", FURBLE_STR}                 },
+    {GPS_UBX,           {GPS_UBX, "GPS UBX", "gps_ubx", FURBLE_STR}                    },
+    {GPS_FIX,           {GPS_FIX, "GPS Fix", "gps_fix", FURBLE_STR}                    },
+    {GPS_LAST_FIX,      {GPS_LAST_FIX, "GPS Last Fix", "gps_last", FURBLE_STR}         },
+    {GPS_TRACK,         {GPS_TRACK, "GPS Track", "gps_track", FURBLE_STR}              },
+    {GPS_PPS,           {GPS_PPS, "GPS PPS", "gps_pps", FURBLE_STR}                    },
 };
 
 const Settings::setting_t &Settings::get(type_t type) {
@@ -68,18 +81,39 @@ template <>
 interval_t Settings::load<interval_t>(type_t type) {
   const auto &setting = get(type);
   interval_t interval;
+  union {
+    interval_v1_t v1;
+    interval_v2_t v2;
+    interval_t v3;
+  } buffer;
 
   m_Prefs.begin(setting.nvs_namespace, true);
-  size_t len = m_Prefs.get(setting.key, &interval, sizeof(interval_t));
-  if (len == sizeof(interval_v1_t)) {
-    // migrate v1 interval settings
-    interval.wait = INTERVAL_DEFAULT_WAIT;
-  } else if (len != sizeof(interval_t)) {
-    // default values
-    interval.count = INTERVAL_DEFAULT_COUNT;
-    interval.delay = INTERVAL_DEFAULT_DELAY;
-    interval.shutter = INTERVAL_DEFAULT_SHUTTER;
-    interval.wait = INTERVAL_DEFAULT_WAIT;
+  size_t len = m_Prefs.get(setting.key, &buffer, sizeof(buffer));
+  switch (len) {
+    case sizeof(interval_t):
+      interval = buffer.v3;
+      break;
+    case sizeof(interval_v2_t):
+      // migrate v2 whole unit values
+      interval.count = SpinValue::fromV1(buffer.v2.count);
+      interval.delay = SpinValue::fromV1(buffer.v2.delay);
+      interval.shutter = SpinValue::fromV1(buffer.v2.shutter);
+      interval.wait = SpinValue::fromV1(buffer.v2.wait);
+      break;
+    case sizeof(interval_v1_t):
+      // migrate v1 interval settings
+      interval.count = SpinValue::fromV1(buffer.v1.count);
+      interval.delay = SpinValue::fromV1(buffer.v1.delay);
+      interval.shutter = SpinValue::fromV1(buffer.v1.shutter);
+      interval.wait = INTERVAL_DEFAULT_WAIT;
+      break;
+    default:
+      // default values
+      interval.count = INTERVAL_DEFAULT_COUNT;
+      interval.delay = INTERVAL_DEFAULT_DELAY;
+      interval.shutter = INTERVAL_DEFAULT_SHUTTER;
+      interval.wait = INTERVAL_DEFAULT_WAIT;
+      break;
   }
 
   m_Prefs.end();
@@ -87,6 +121,78 @@ interval_t Settings::load<interval_t>(type_t type) {
   return interval;
 }
 
+template <>
+program_t Settings::load<program_t>(type_t type) {
+  const auto &setting = get(type);
+  program_t program;
+  union {
+    program_v1_t v1;
+    program_t v2;
+  } buffer;
+
+  m_Prefs.begin(setting.nvs_namespace, true);
+  size_t len = m_Prefs.get(setting.key, &buffer, sizeof(buffer));
+  switch (len) {
+    case sizeof(program_t):
+      program = buffer.v2;
+      break;
+    case sizeof(program_v1_t):
+      // migrate v1 milliseconds
+      program.version = (buffer.v1.version == 1) ? PROGRAM_VERSION : 0;
+      program.count = buffer.v1.count;
+      program.wait = buffer.v1.wait * 1000ULL;
+      for (uint8_t i = 0; i < PROGRAM_MAX_SEGMENTS; i++) {
+        const segment_v1_t &v1 = buffer.v1.segment[i];
+        program.segment[i] = {
+            .count = v1.count,
+            .ramp = v1.ramp,
+            .interval = v1.interval * 1000ULL,
+            .intervalEnd = v1.intervalEnd * 1000ULL,
+            .shutter = v1.shutter * 1000ULL,
+            .shutterEnd = v1.shutterEnd * 1000ULL,
+        };
+      }
+      break;
+    default:
+      program.version = 0;
+      break;
+  }
+
+  if ((program.version != PROGRAM_VERSION) || (program.count > PROGRAM_MAX_SEGMENTS)) {
+    // default empty program
+    program = {
+        .version = PROGRAM_VERSION,
+        .count = 0,
+        .wait = 0,
+        .segment = {},
+    };
+  }
+
+  m_Prefs.end();
+
+  return program;
+}
+
+template <>
+offsets_t Settings::load<offsets_t>(type_t type) {
+  const auto &setting = get(type);
+  offsets_t offsets;
+
+  m_Prefs.begin(setting.nvs_namespace, true);
+  size_t len = m_Prefs.get(setting.key, &offsets, sizeof(offsets_t));
+  if ((len != sizeof(offsets_t)) || (offsets.count > OFFSETS_MAX)) {
+    // no offsets
+    offsets = {
+        .count = 0,
+        .entry = {},
+    };
+  }
+
+  m_Prefs.end();
+
+  return offsets;
+}
+
 template <>
 esp_power_level_t Settings::load<esp_power_level_t>(type_t type) {
   const auto &setting = get(type);
@@ -130,6 +236,23 @@ Settings::calibration_t Settings::load<Settings::calibration_t>(type_t type) {
   return calibration;
 }
 
+template <>
+Settings::gps_fix_t Settings::load<Settings::gps_fix_t>(type_t type) {
+  const auto &setting = get(type);
+  gps_fix_t fix;
+
+  m_Prefs.begin(setting.nvs_namespace, true);
+  size_t len = m_Prefs.get(setting.key, &fix, sizeof(gps_fix_t));
+  if (len != sizeof(gps_fix_t)) {
+    // no fix
+    fix = {};
+  }
+
+  m_Prefs.end();
+
+  return fix;
+}
+
 template <>
 void Settings::save<bool>(const type_t type, const bool &value) {
   saveValue<bool>(type, value);
@@ -153,6 +276,22 @@ void Settings::save<interval_t>(const type_t type, const interval_t &value) {
   m_Prefs.end();
 }
 
+template <>
+void Settings::save<program_t>(const type_t type, const program_t &value) {
+  const auto &setting = get(type);
+  m_Prefs.begin(setting.nvs_namespace, false);
+  m_Prefs.put(setting.key, &value, sizeof(value));
+  m_Prefs.end();
+}
+
+template <>
+void Settings::save<offsets_t>(const type_t type, const offsets_t &value) {
+  const auto &setting = get(type);
+  m_Prefs.begin(setting.nvs_namespace, false);
+  m_Prefs.put(setting.key, &value, sizeof(value));
+  m_Prefs.end();
+}
+
 template <>
 void Settings::save<std::string>(const type_t type, const std::string &value) {
   saveValue<std::string>(type, value);
@@ -166,6 +305,14 @@ void Settings::save<Settings::calibration_t>(const type_t type, const calibratio
   m_Prefs.end();
 }
 
+template <>
+void Settings::save<Settings::gps_fix_t>(const type_t type, const gps_fix_t &value) {
+  const auto &setting = get(type);
+  m_Prefs.begin(setting.nvs_namespace, false);
+  m_Prefs.put(setting.key, &value, sizeof(value));
+  m_Prefs.end();
+}
+
 void Settings::init(void) {
   // Initialize NVS
   esp_err_t ret = nvs_flash_init();
@@ -194,6 +341,7 @@ void Settings::init(void) {
           save<std::string>(setting.type, "Default");
           break;
         case TX_POWER:
+        case DROPOUT:
           save<uint8_t>(setting.type, 0);
           break;
         case INTERVAL:
@@ -211,11 +359,24 @@ void Settings::init(void) {
         case RECONNECT:
         case FAUXNY:
         case AUTOCONNECT:
+        case LOW_POWER:
+        case WHEN_READY:
+        case TRIGGER_INPUT:
+        case GPS_UBX:
+        case GPS_LAST_FIX:
+        case GPS_TRACK:
+        case GPS_PPS:
           save<bool>(setting.type, false);
           break;
         case GPS_BAUD:
           save<uint32_t>(setting.type, BAUD_9600);
           break;
+        case TRIGGER_DELAY:
+          save<uint32_t>(setting.type, 0);
+          break;
+        case GPS_RATE:
+          save<uint32_t>(setting.type, 1000);
+          break;
         case TOUCH_CALIBRATION:
         {
           calibration_t calibration = {
@@ -224,6 +385,27 @@ void Settings::init(void) {
           };
           save<calibration_t>(setting.type, calibration);
         } break;
+        case GPS_FIX:
+          save<gps_fix_t>(setting.type, gps_fix_t {});
+          break;
+        case PROGRAM:
+        {
+          program_t program = {
+              .version = PROGRAM_VERSION,
+              .count = 0,
+              .wait = 0,
+              .segment = {},
+          };
+          save<program_t>(setting.type, program);
+        } break;
+        case OFFSETS:
+        {
+          offsets_t offsets = {
+              .count = 0,
+              .entry = {},
+          };
+          save<offsets_t>(setting.type, offsets);
+        } break;
       }
     }
   }
@@ -0,0 +1,196 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include <esp_log.h>
+#include <sdkconfig.h>
+
+#include "FurbleShotLog.h"
+#include "FurbleTypes.h"
+
+namespace Furble {
+
+// Control target bitmasks are stored as is
+static_assert(CONFIG_BT_NIMBLE_MAX_CONNECTIONS <= ShotLog::MAX_TARGETS,
+              "Shot log bitmasks narrower than the camera connection limit");
+// shot entries follow the header in the blob
+static_assert((sizeof(ShotLog::header_t) % alignof(ShotLog::shot_t)) == 0,
+              "Shot log entries misaligned after the header");
+
+Preferences ShotLog::m_Prefs;
+
+static int32_t clamp32(int64_t value) {
+  return std::clamp<int64_t>(value, std::numeric_limits<int32_t>::min(),
+                             std::numeric_limits<int32_t>::max());
+}
+
+void ShotLog::begin(uint8_t targets) {
+  m_Head = 0;
+  m_Count = 0;
+  m_Targets = targets;
+
+  m_Frames = 0;
+  m_Late = 0;
+  m_Missed = 0;
+  m_Delayed = 0;
+  m_Locked = 0;
+  m_Mean = 0.0;
+  m_M2 = 0.0;
+  m_Max = 0;
+}
+
+ShotLog::shot_t &ShotLog::current(void) {
+  return m_Shots[(m_Head + CAPACITY - 1) % CAPACITY];
+}
+
+ShotLog::shot_t &ShotLog::next(int64_t scheduled, int64_t utc) {
+  shot_t &shot = m_Shots[m_Head];
+  shot.scheduled = scheduled / 1000LL;
+  shot.press = 0;
+  shot.release = 0;
+  shot.sent = 0;
+  shot.dispatched = 0;
+  shot.utc = utc;
+
+  m_Head = (m_Head + 1) % CAPACITY;
+  m_Count = std::min(m_Count + 1, CAPACITY);
+
+  return shot;
+}
+
+void ShotLog::press(int64_t scheduled,
+                    int64_t error,
+                    uint32_t sent,
+                    bool delayed,
+                    int64_t utc,
+                    bool locked) {
+  shot_t &shot = next(scheduled, utc);
+  shot.press = clamp32(error);
+  shot.sent = sent;
+
+  if (delayed) {
+    m_Delayed++;
+  }
+  if (locked) {
+    m_Locked++;
+  }
+
+  // running statistics (Welford)
+  m_Frames++;
+  double delta = error - m_Mean;
+  m_Mean += delta / m_Frames;
+  m_M2 += delta * (error - m_Mean);
+  m_Max = std::max(m_Max, error);
+  if (error > LATE_US) {
+    m_Late++;
+  }
+}
+
+void ShotLog::missed(int64_t scheduled, int64_t utc) {
+  (void)next(scheduled, utc);
+  m_Missed++;
+}
+
+void ShotLog::release(int64_t error, uint32_t dispatched) {
+  if (m_Count == 0) {
+    return;
+  }
+
+  shot_t &shot = current();
+  shot.release = clamp32(error);
+  shot.dispatched = dispatched;
+}
+
+ShotLog::header_t ShotLog::getSummary(void) const {
+  header_t header = {
+      .magic = MAGIC,
+      .frames = m_Frames,
+      .late = m_Late,
+      .missed = m_Missed,
+      .delayed = m_Delayed,
+      .locked = m_Locked,
+      .mean = 0,
+      .stddev = 0,
+      .max = clamp32(m_Max),
+      .count = static_cast<uint16_t>(m_Count),
+      .targets = m_Targets,
+      .reserved = 0,
+  };
+
+  if (m_Frames > 0) {
+    header.mean = clamp32(std::llround(m_Mean));
+    header.stddev = clamp32(std::llround(std::sqrt(m_M2 / m_Frames)));
+  }
+
+  return header;
+}
+
+std::vector<uint8_t> ShotLog::serialise(void) const {
+  const header_t header = getSummary();
+  std::vector<uint8_t> blob(sizeof(header_t) + (m_Count * sizeof(shot_t)));
+
+  std::memcpy(blob.data(), &header, sizeof(header_t));
+
+  // store oldest first
+  shot_t *shots = reinterpret_cast<shot_t *>(blob.data() + sizeof(header_t));
+  size_t oldest = (m_Head + CAPACITY - m_Count) % CAPACITY;
+  for (size_t i = 0; i < m_Count; i++) {
+    shots[i] = m_Shots[(oldest + i) % CAPACITY];
+  }
+
+  return blob;
+}
+
+void ShotLog::save(const std::vector<uint8_t> &blob) {
+  if (blob.size() < sizeof(header_t)) {
+    return;
+  }
+
+  header_t header;
+  std::memcpy(&header, blob.data(), sizeof(header_t));
+
+  m_Prefs.begin(FURBLE_STR, false);
+  if (m_Prefs.put(m_Key, blob.data(), blob.size()) != blob.size()) {
+    ESP_LOGE(LOG_TAG, "Failed to save shot log.");
+  }
+  m_Prefs.end();
+
+  ESP_LOGI(LOG_TAG,
+           "Saved %u frames of %lu, late = %lu, missed = %lu, delayed = %lu, locked = %lu, "
+           "mean = %ldus, max = %ldus, sd = %ldus",
+           header.count, header.frames, header.late, header.missed, header.delayed, header.locked,
+           header.mean, header.max, header.stddev);
+}
+
+void ShotLog::dump(void) {
+  m_Prefs.begin(FURBLE_STR, true);
+  size_t bytes = m_Prefs.getBytesLength(m_Key);
+  std::vector<uint8_t> blob(bytes);
+  if (bytes > 0) {
+    m_Prefs.get(m_Key, blob.data(), bytes);
+  }
+  m_Prefs.end();
+
+  if (bytes < sizeof(header_t)) {
+    ESP_LOGW(LOG_TAG, "No shot log to export.");
+    return;
+  }
+
+  // Raw hex lines, prefixed so the host decoder can pick them out of a
+  // console capture.
+  printf("shotlog: begin %u\n", bytes);
+  for (size_t i = 0; i < bytes; i += LINE_BYTES) {
+    printf("shotlog: ");
+    for (size_t j = i; j < std::min(i + LINE_BYTES, bytes); j++) {
+      printf("%02x", blob[j]);
+    }
+    printf("\n");
+  }
+  printf("shotlog: end\n");
+  fflush(stdout);
+}
+
+}  // namespace Furble
@@ -1,20 +1,47 @@
+#include <cstdio>
+
 #include "FurbleSpinValue.h"
 
 namespace Furble {
-constexpr std::array<const char *, 5> SpinValue::m_UnitMap;
+constexpr std::array<const char *, 6> SpinValue::m_UnitMap;
+
+SpinValue::SpinValue(const nvs_t &nvs) : m_Value(nvs.value), m_Unit(nvs.unit) {};
+
+SpinValue::nvs_t SpinValue::fromV1(const nvs_v1_t &nvs) {
+  SpinValue value({nvs.value, nvs.unit});
 
-SpinValue::SpinValue(nvs_t &nvs) : m_Value(nvs.value), m_Unit(nvs.unit) {};
+  if (value.isTime()) {
+    value.m_Value *= SCALE;
+  }
+
+  return value.toNVS();
+}
 
 SpinValue::nvs_t SpinValue::toNVS(void) {
   return (nvs_t) {m_Value, m_Unit};
 }
 
-uint32_t SpinValue::toMilliseconds(void) {
+bool SpinValue::isTime(void) const {
+  switch (m_Unit) {
+    case UNIT_MS:
+    case UNIT_SEC:
+    case UNIT_MIN:
+    case UNIT_HOUR:
+      return true;
+    default:
+      return false;
+  }
+}
+
+uint64_t SpinValue::toMicroseconds(void) const {
+  // m_Value is in thousandths of the unit
   switch (m_Unit) {
+    case UNIT_HOUR:
+      return (m_Value * 60ULL * 60ULL * 1000ULL);
     case UNIT_MIN:
-      return (m_Value * 60 * 1000);
+      return (m_Value * 60ULL * 1000ULL);
     case UNIT_SEC:
-      return (m_Value * 1000);
+      return (m_Value * 1000ULL);
     case UNIT_MS:
       return (m_Value);
     default:
@@ -23,10 +50,35 @@ uint32_t SpinValue::toMilliseconds(void) {
   return 0;
 }
 
+uint64_t SpinValue::toMilliseconds(void) const {
+  return ((toMicroseconds() + 500ULL) / 1000ULL);
+}
+
 const char *SpinValue::getUnitString(void) {
   return m_UnitMap[m_Unit];
 }
 
+int SpinValue::toString(char *buffer, size_t length) const {
+  if (!isTime()) {
+    return snprintf(buffer, length, "%lu", (unsigned long)m_Value);
+  }
+
+  uint32_t whole = m_Value / SCALE;
+  uint32_t fraction = m_Value % SCALE;
+  if (fraction == 0) {
+    return snprintf(buffer, length, "%lu", (unsigned long)whole);
+  }
+
+  int digits = DECIMALS;
+  while ((fraction % 10) == 0) {
+    fraction /= 10;
+    digits--;
+  }
+
+  return snprintf(buffer, length, "%lu.%0*lu", (unsigned long)whole, digits,
+                  (unsigned long)fraction);
+}
+
 SpinValue::hms_t SpinValue::toHMS(uint32_t ms) {
   return (hms_t) {(ms / 1000) / (60 * 60), ((ms / 1000) / 60) % 60, (ms / 1000) % 60};
 }
@@ -0,0 +1,269 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include <esp_log.h>
+
+#include "FurbleTrack.h"
+#include "FurbleTypes.h"
+
+namespace Furble {
+
+static size_t putVarint(uint8_t *buffer, int32_t value) {
+  // zigzag, small magnitudes of either sign stay small
+  uint32_t zigzag = (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31);
+  size_t len = 0;
+
+  while (zigzag >= 0x80) {
+    buffer[len++] = (zigzag & 0x7f) | 0x80;
+    zigzag >>= 7;
+  }
+  buffer[len++] = zigzag;
+
+  return len;
+}
+
+static size_t skipVarint(const uint8_t *buffer, size_t size) {
+  for (size_t i = 0; (i < size) && (i < 5); i++) {
+    if ((buffer[i] & 0x80) == 0) {
+      return i + 1;
+    }
+  }
+  return 0;
+}
+
+size_t TrackEncoder::encode(const point_t &point, uint8_t *buffer) {
+  const uint32_t step = point.time - m_Last.time;
+
+  if (m_HasLast && (step >= 1) && (step <= MAX_STEP)) {
+    size_t len = 0;
+    buffer[len++] = (step << 1) | 1;
+    len += putVarint(&buffer[len], point.latitude - m_Last.latitude);
+    len += putVarint(&buffer[len], point.longitude - m_Last.longitude);
+    len += putVarint(&buffer[len], point.altitude - m_Last.altitude);
+    m_Last = point;
+    return len;
+  }
+
+  const int16_t altitude = std::clamp<int32_t>(point.altitude, INT16_MIN, INT16_MAX);
+  buffer[0] = KEYFRAME;
+  std::memcpy(&buffer[1], &point.time, sizeof(point.time));
+  std::memcpy(&buffer[5], &point.latitude, sizeof(point.latitude));
+  std::memcpy(&buffer[9], &point.longitude, sizeof(point.longitude));
+  std::memcpy(&buffer[13], &altitude, sizeof(altitude));
+
+  m_HasLast = true;
+  m_Last = point;
+  m_Last.altitude = altitude;
+
+  return KEYFRAME_SIZE;
+}
+
+void TrackEncoder::reset(void) {
+  m_HasLast = false;
+}
+
+size_t TrackEncoder::length(const uint8_t *buffer, size_t size) {
+  if (size == 0) {
+    return 0;
+  }
+
+  if (buffer[0] == KEYFRAME) {
+    return (size >= KEYFRAME_SIZE) ? KEYFRAME_SIZE : 0;
+  }
+
+  // delta, erased flash has the top bit set
+  if (((buffer[0] & 0x01) == 0) || (buffer[0] & 0x80)) {
+    return 0;
+  }
+
+  size_t len = 1;
+  for (unsigned int i = 0; i < 3; i++) {
+    size_t field = skipVarint(&buffer[len], size - len);
+    if (field == 0) {
+      return 0;
+    }
+    len += field;
+  }
+
+  return len;
+}
+
+size_t TrackLog::getUsed(const uint8_t *buffer) {
+  size_t used = sizeof(header_t);
+
+  while (used < SECTOR_SIZE) {
+    size_t len = TrackEncoder::length(&buffer[used], SECTOR_SIZE - used);
+    if (len == 0) {
+      break;
+    }
+    used += len;
+  }
+
+  return used;
+}
+
+bool TrackLog::begin(void) {
+  m_Partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                         static_cast<esp_partition_subtype_t>(0x40), "track");
+  if (m_Partition == NULL) {
+    ESP_LOGE(LOG_TAG, "No track partition.");
+    return false;
+  }
+  m_Sectors = m_Partition->size / SECTOR_SIZE;
+
+  // resume in the newest sector
+  bool found = false;
+  for (uint32_t i = 0; i < m_Sectors; i++) {
+    header_t header;
+    if (esp_partition_read(m_Partition, i * SECTOR_SIZE, &header, sizeof(header)) != ESP_OK) {
+      continue;
+    }
+    if ((header.magic == MAGIC) && (!found || (header.sequence > m_Sequence))) {
+      found = true;
+      m_Sector = i;
+      m_Sequence = header.sequence;
+    }
+  }
+
+  if (found) {
+    std::vector<uint8_t> buffer(SECTOR_SIZE);
+    esp_partition_read(m_Partition, m_Sector * SECTOR_SIZE, buffer.data(), buffer.size());
+    m_Offset = getUsed(buffer.data());
+    // do not delta encode against a point from a previous session
+    m_Encoder.reset();
+  } else {
+    m_Sector = m_Sectors - 1;
+    nextSector();
+  }
+
+  m_HasLast = false;
+  m_Pending = 0;
+  ESP_LOGI(LOG_TAG, "Track sector %lu of %lu, sequence %lu, %lu bytes used", m_Sector, m_Sectors,
+           m_Sequence, m_Offset);
+
+  return true;
+}
+
+void TrackLog::nextSector(void) {
+  m_Sector = (m_Sector + 1) % m_Sectors;
+  m_Sequence++;
+
+  const header_t header = {MAGIC, m_Sequence};
+  esp_partition_erase_range(m_Partition, m_Sector * SECTOR_SIZE, SECTOR_SIZE);
+  esp_partition_write(m_Partition, m_Sector * SECTOR_SIZE, &header, sizeof(header));
+  m_Offset = sizeof(header);
+  m_Encoder.reset();
+}
+
+void TrackLog::add(const TrackEncoder::point_t &point) {
+  if (m_Partition == NULL) {
+    return;
+  }
+
+  if (m_HasLast) {
+    const uint32_t elapsed = point.time - m_Last.time;
+    const int32_t moved = std::abs(point.latitude - m_Last.latitude)
+                          + std::abs(point.longitude - m_Last.longitude);
+    if ((point.time <= m_Last.time) || ((moved < MIN_MOVE) && (elapsed < HEARTBEAT_S))) {
+      return;
+    }
+  } else {
+    m_Flushed = point.time;
+  }
+  m_HasLast = true;
+  m_Last = point;
+
+  if ((m_Offset + m_Pending + TrackEncoder::MAX_RECORD) > SECTOR_SIZE) {
+    flush();
+    nextSector();
+  }
+  if ((m_Pending + TrackEncoder::MAX_RECORD) > m_Batch.size()) {
+    flush();
+  }
+
+  m_Pending += m_Encoder.encode(point, &m_Batch[m_Pending]);
+
+  if ((point.time - m_Flushed) >= FLUSH_S) {
+    flush();
+  }
+}
+
+void TrackLog::flush(void) {
+  if ((m_Partition == NULL) || (m_Pending == 0)) {
+    return;
+  }
+
+  esp_partition_write(m_Partition, (m_Sector * SECTOR_SIZE) + m_Offset, m_Batch.data(),
+                      m_Pending);
+  m_Offset += m_Pending;
+  m_Pending = 0;
+  m_Flushed = m_Last.time;
+}
+
+void TrackLog::beginDump(void) {
+  if (m_Partition == NULL) {
+    ESP_LOGW(LOG_TAG, "No track to export.");
+    return;
+  }
+  flush();
+
+  // oldest first, the sector after the newest is the oldest once wrapped
+  m_Dump.resize(SECTOR_SIZE);
+  m_DumpFirst = m_Sector;
+  m_DumpIndex = 0;
+  m_DumpOffset = 0;
+  m_DumpUsed = 0;
+  printf("tracklog: begin\n");
+}
+
+bool TrackLog::dumpNext(void) {
+  if (m_Dump.empty()) {
+    return false;
+  }
+
+  // load the next sector holding points, checking the header first
+  while (m_DumpOffset >= m_DumpUsed) {
+    if (m_DumpIndex >= m_Sectors) {
+      printf("tracklog: end\n");
+      fflush(stdout);
+      std::vector<uint8_t>().swap(m_Dump);
+      return false;
+    }
+
+    const uint32_t sector = (m_DumpFirst + ++m_DumpIndex) % m_Sectors;
+    header_t header;
+    if ((esp_partition_read(m_Partition, sector * SECTOR_SIZE, &header, sizeof(header)) != ESP_OK)
+        || (header.magic != MAGIC)) {
+      continue;
+    }
+    if (esp_partition_read(m_Partition, sector * SECTOR_SIZE, m_Dump.data(), m_Dump.size())
+        != ESP_OK) {
+      continue;
+    }
+
+    const size_t used = getUsed(m_Dump.data());
+    if (used <= sizeof(header_t)) {
+      continue;
+    }
+    m_DumpUsed = used;
+    m_DumpOffset = 0;
+    printf("tracklog: sector %lu %u\n", header.sequence, used);
+  }
+
+  const size_t end = std::min(m_DumpOffset + DUMP_CHUNK, m_DumpUsed);
+  for (size_t j = m_DumpOffset; j < end; j += LINE_BYTES) {
+    printf("tracklog: ");
+    for (size_t k = j; k < std::min(j + LINE_BYTES, end); k++) {
+      printf("%02x", m_Dump[k]);
+    }
+    printf("\n");
+  }
+  m_DumpOffset = end;
+  fflush(stdout);
+
+  return true;
+}
+
+}  // namespace Furble
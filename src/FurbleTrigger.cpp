@@ -0,0 +1,242 @@
+#include <algorithm>
+
+#include <esp_timer.h>
+
+#include <M5Unified.h>
+
+#include "FurbleControl.h"
+#include "FurbleSettings.h"
+#include "FurbleTrigger.h"
+#include "FurbleUI.h"
+
+void trigger_task(void *param) {
+  Furble::Trigger *trigger = static_cast<Furble::Trigger *>(param);
+  trigger->task();
+}
+
+namespace Furble {
+
+Trigger::Trigger()
+    : m_Input {{
+          {this, SOURCE_BUTTON, GPIO_NUM_NC, EdgeFilter(DEBOUNCE_US, true)},
+          {this, SOURCE_INPUT, GPIO_NUM_NC, EdgeFilter(DEBOUNCE_US, true)},
+      }} {}
+
+Trigger &Trigger::getInstance(void) {
+  static Trigger instance;
+
+  if (instance.m_Queue == NULL) {
+    instance.m_Queue = xQueueCreate(QUEUE_LENGTH, sizeof(edge_t));
+    if (instance.m_Queue == NULL) {
+      ESP_LOGE(LOG_TAG, "Failed to create trigger queue.");
+      abort();
+    }
+
+    BaseType_t ret =
+        xTaskCreate(trigger_task, "trigger", 4096, &instance, PRIORITY, &instance.m_Task);
+    if (ret != pdPASS) {
+      ESP_LOGE(LOG_TAG, "Failed to create trigger task.");
+      abort();
+    }
+  }
+
+  return instance;
+}
+
+gpio_num_t Trigger::getShutterPin(void) {
+  // the button mapped to shutter in remote control mode
+  switch (M5.getBoard()) {
+    case m5::board_t::board_M5StickC:
+    case m5::board_t::board_M5StickCPlus:
+    case m5::board_t::board_M5StickCPlus2:
+      // BtnA
+      return GPIO_NUM_37;
+    case m5::board_t::board_M5Stack:
+      // BtnB
+      return GPIO_NUM_38;
+    default:
+      // touch screen or unmapped, shutter stays on the polled UI path
+      return GPIO_NUM_NC;
+  }
+}
+
+void IRAM_ATTR Trigger::isr(void *param) {
+  auto *input = static_cast<input_t *>(param);
+  BaseType_t woken = pdFALSE;
+
+  edge_t edge = {input->source, esp_timer_get_time(), gpio_get_level(input->pin)};
+  xQueueSendFromISR(input->trigger->m_Queue, &edge, &woken);
+  portYIELD_FROM_ISR(woken);
+}
+
+bool Trigger::attach(input_t &input, gpio_num_t pin) {
+  if (!m_ServiceInstalled) {
+    esp_err_t err = gpio_install_isr_service(0);
+    if ((err != ESP_OK) && (err != ESP_ERR_INVALID_STATE)) {
+      ESP_LOGE(LOG_TAG, "Failed to install GPIO ISR service: %s", esp_err_to_name(err));
+      return false;
+    }
+    m_ServiceInstalled = true;
+  }
+
+  input.filter.reset(esp_timer_get_time(), gpio_get_level(pin));
+  input.pin = pin;
+  ESP_ERROR_CHECK(gpio_set_intr_type(pin, GPIO_INTR_ANYEDGE));
+  ESP_ERROR_CHECK(gpio_isr_handler_add(pin, isr, &input));
+
+  return true;
+}
+
+void Trigger::detach(input_t &input) {
+  if (input.pin == GPIO_NUM_NC) {
+    return;
+  }
+
+  gpio_isr_handler_remove(input.pin);
+  gpio_set_intr_type(input.pin, GPIO_INTR_DISABLE);
+  input.pin = GPIO_NUM_NC;
+}
+
+void Trigger::begin(void) {
+  gpio_num_t pin = getShutterPin();
+  if (pin == GPIO_NUM_NC) {
+    ESP_LOGI(LOG_TAG, "No hardware shutter path.");
+  } else if (attach(m_Input[SOURCE_BUTTON], pin)) {
+    // pin is already configured as an input by M5Unified
+    ESP_LOGI(LOG_TAG, "Hardware shutter on GPIO%d.", pin);
+  }
+
+  reloadSetting();
+}
+
+bool Trigger::isAvailable(void) const {
+  return m_Input[SOURCE_BUTTON].pin != GPIO_NUM_NC;
+}
+
+void Trigger::setArmed(bool armed) {
+  m_Armed = armed && isAvailable();
+}
+
+bool Trigger::isArmed(void) const {
+  return m_Armed;
+}
+
+void Trigger::reloadSetting(void) {
+  input_t &input = m_Input[SOURCE_INPUT];
+  bool enable = Settings::load<Settings::TRIGGER_INPUT>();
+
+  m_Delay = Settings::load<Settings::TRIGGER_DELAY>();
+
+  if (!enable) {
+    detach(input);
+    return;
+  }
+
+  if (input.pin != GPIO_NUM_NC) {
+    return;
+  }
+
+  // the GPS UART receive pin
+  const int8_t pin = M5.getPin(m5::port_a_pin1);
+  if (pin < 0) {
+    ESP_LOGW(LOG_TAG, "No trigger input pin.");
+    return;
+  }
+
+  // sync outputs are open collector or contact closure to ground
+  const gpio_config_t config = {
+      .pin_bit_mask = (1ULL << pin),
+      .mode = GPIO_MODE_INPUT,
+      .pull_up_en = GPIO_PULLUP_ENABLE,
+      .pull_down_en = GPIO_PULLDOWN_DISABLE,
+      .intr_type = GPIO_INTR_DISABLE,
+  };
+  ESP_ERROR_CHECK(gpio_config(&config));
+
+  if (attach(input, static_cast<gpio_num_t>(pin))) {
+    ESP_LOGI(LOG_TAG, "Trigger input on GPIO%d, delay = %luus.", pin, (uint32_t)m_Delay);
+  }
+}
+
+bool Trigger::isInputEnabled(void) const {
+  return m_Input[SOURCE_INPUT].pin != GPIO_NUM_NC;
+}
+
+bool Trigger::isPending(void) const {
+  return std::any_of(m_Input.begin(), m_Input.end(), [](const input_t &input) {
+    return (input.pin != GPIO_NUM_NC) && input.filter.isPending();
+  });
+}
+
+void Trigger::handle(input_t &input, int64_t time, int level) {
+  EdgeFilter::edge_t edge = input.filter.update(time, level);
+  if (edge == EdgeFilter::EDGE_NONE) {
+    return;
+  }
+
+  // the raw edge is the common trigger time for the cameras
+  int64_t base = input.filter.getEdgeTime();
+  auto &control = Control::getInstance();
+
+  switch (input.source) {
+    case SOURCE_BUTTON:
+      // the UI polls the button, do not wait for its next poll
+      UI::wake();
+      if (!m_Armed) {
+        return;
+      }
+      control.sendShutter(
+          (edge == EdgeFilter::EDGE_ASSERT) ? Control::CMD_SHUTTER_PRESS
+                                            : Control::CMD_SHUTTER_RELEASE,
+          base);
+      break;
+
+    case SOURCE_INPUT:
+      base += m_Delay;
+      if (edge == EdgeFilter::EDGE_ASSERT) {
+        m_InputPress = base;
+        uint32_t sent = control.sendShutter(Control::CMD_SHUTTER_PRESS, base);
+        // targets log their trigger to write latency against the delayed base
+        ESP_LOGI(LOG_TAG, "trigger input %lu: edge to dispatch = %ldus, sent = 0x%lx",
+                 ++m_InputCount, (int32_t)(esp_timer_get_time() - input.filter.getEdgeTime()),
+                 sent);
+      } else {
+        // sync pulses can be far shorter than a camera will register
+        control.sendShutter(Control::CMD_SHUTTER_RELEASE,
+                            std::max(base, m_InputPress + INPUT_HOLD_US));
+      }
+      break;
+
+    default:
+      return;
+  }
+
+#if FURBLE_TRIGGER_TRACE == 1
+  ESP_LOGI(LOG_TAG, "trace: source %d %s edge to dispatch %lldus", input.source,
+           (edge == EdgeFilter::EDGE_ASSERT) ? "assert" : "deassert",
+           esp_timer_get_time() - input.filter.getEdgeTime());
+#endif
+}
+
+void Trigger::task(void) {
+  while (true) {
+    edge_t edge;
+    // settle bounces rejected inside the debounce period by sampling
+    TickType_t wait = isPending() ? pdMS_TO_TICKS(DEBOUNCE_MS) : portMAX_DELAY;
+
+    if (xQueueReceive(m_Queue, &edge, wait) == pdTRUE) {
+      input_t &input = m_Input[edge.source];
+      if (input.pin != GPIO_NUM_NC) {
+        handle(input, edge.time, edge.level);
+      }
+    } else {
+      for (auto &input : m_Input) {
+        if ((input.pin != GPIO_NUM_NC) && input.filter.isPending()) {
+          handle(input, esp_timer_get_time(), gpio_get_level(input.pin));
+        }
+      }
+    }
+  }
+}
+
+}  // namespace Furble
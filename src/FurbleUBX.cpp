@@ -0,0 +1,224 @@
+#include <cstring>
+
+#include "FurbleUBX.h"
+
+namespace Furble {
+
+template <typename T>
+static T read(const uint8_t *payload, size_t offset) {
+  T value;
+  // UBX and the ESP32 are both little endian
+  std::memcpy(&value, &payload[offset], sizeof(T));
+  return value;
+}
+
+static bool isLeapYear(unsigned int year) {
+  return ((year % 4) == 0) && (((year % 100) != 0) || ((year % 400) == 0));
+}
+
+static uint8_t daysInMonth(unsigned int year, unsigned int month) {
+  static constexpr uint8_t days[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+
+  if ((month == 2) && isLeapYear(year)) {
+    return 29;
+  }
+  return days[(month - 1) % 12];
+}
+
+/** Step the date and time back one second. */
+static void previousSecond(UBXParser::pvt_t &pvt) {
+  if (pvt.second-- > 0) {
+    return;
+  }
+  pvt.second = 59;
+  if (pvt.minute-- > 0) {
+    return;
+  }
+  pvt.minute = 59;
+  if (pvt.hour-- > 0) {
+    return;
+  }
+  pvt.hour = 23;
+  if (--pvt.day > 0) {
+    return;
+  }
+  if (--pvt.month == 0) {
+    pvt.month = 12;
+    pvt.year--;
+  }
+  pvt.day = daysInMonth(pvt.year, pvt.month);
+}
+
+void UBXParser::checksum(uint8_t c) {
+  m_CkA += c;
+  m_CkB += m_CkA;
+}
+
+bool UBXParser::next(const uint8_t *&data, size_t &len, frame_t &frame) {
+  const uint8_t *end = data + len;
+  const uint8_t *p = data;
+  bool found = false;
+
+  while (!found && (p < end)) {
+    const uint8_t c = *p++;
+
+    switch (m_State) {
+      case STATE_SYNC1:
+        if (c == SYNC1) {
+          m_State = STATE_SYNC2;
+        }
+        break;
+      case STATE_SYNC2:
+        if (c == SYNC2) {
+          m_State = STATE_CLASS;
+        } else if (c != SYNC1) {
+          m_State = STATE_SYNC1;
+        }
+        break;
+      case STATE_CLASS:
+        m_CkA = 0;
+        m_CkB = 0;
+        checksum(c);
+        m_Class = c;
+        m_State = STATE_ID;
+        break;
+      case STATE_ID:
+        checksum(c);
+        m_ID = c;
+        m_State = STATE_LENGTH1;
+        break;
+      case STATE_LENGTH1:
+        checksum(c);
+        m_Length = c;
+        m_State = STATE_LENGTH2;
+        break;
+      case STATE_LENGTH2:
+        checksum(c);
+        m_Length |= (c << 8);
+        m_Offset = 0;
+        if (m_Length > MAX_PAYLOAD) {
+          m_Stats.oversize++;
+          m_State = STATE_SYNC1;
+        } else {
+          m_State = (m_Length == 0) ? STATE_CK_A : STATE_PAYLOAD;
+        }
+        break;
+      case STATE_PAYLOAD:
+        checksum(c);
+        m_Payload[m_Offset++] = c;
+        if (m_Offset == m_Length) {
+          m_State = STATE_CK_A;
+        }
+        break;
+      case STATE_CK_A:
+        if (c == m_CkA) {
+          m_State = STATE_CK_B;
+        } else {
+          m_Stats.checksum++;
+          m_State = STATE_SYNC1;
+        }
+        break;
+      case STATE_CK_B:
+        m_State = STATE_SYNC1;
+        if (c != m_CkB) {
+          m_Stats.checksum++;
+          break;
+        }
+        m_Stats.frames++;
+        frame.cls = m_Class;
+        frame.id = m_ID;
+        frame.length = m_Length;
+        frame.payload = m_Payload.data();
+        found = true;
+        break;
+    }
+  }
+
+  m_Stats.bytes += p - data;
+  len -= p - data;
+  data = p;
+
+  return found;
+}
+
+void UBXParser::resync(void) {
+  m_State = STATE_SYNC1;
+}
+
+const UBXParser::stats_t &UBXParser::getStats(void) const {
+  return m_Stats;
+}
+
+size_t UBXParser::encode(uint8_t *buffer,
+                         size_t size,
+                         uint8_t cls,
+                         uint8_t id,
+                         const uint8_t *payload,
+                         uint16_t length) {
+  const size_t total = length + OVERHEAD;
+  if (size < total) {
+    return 0;
+  }
+
+  buffer[0] = SYNC1;
+  buffer[1] = SYNC2;
+  buffer[2] = cls;
+  buffer[3] = id;
+  buffer[4] = length & 0xff;
+  buffer[5] = length >> 8;
+  if (length > 0) {
+    std::memcpy(&buffer[6], payload, length);
+  }
+
+  uint8_t ckA = 0;
+  uint8_t ckB = 0;
+  for (size_t i = 2; i < (total - 2); i++) {
+    ckA += buffer[i];
+    ckB += ckA;
+  }
+  buffer[total - 2] = ckA;
+  buffer[total - 1] = ckB;
+
+  return total;
+}
+
+bool UBXParser::decodePVT(const frame_t &frame, pvt_t &pvt) {
+  if ((frame.cls != CLASS_NAV) || (frame.id != ID_NAV_PVT) || (frame.length != PVT_LENGTH)) {
+    return false;
+  }
+
+  const uint8_t *payload = frame.payload;
+  pvt.iTOW = read<uint32_t>(payload, 0);
+  pvt.year = read<uint16_t>(payload, 4);
+  pvt.month = payload[6];
+  pvt.day = payload[7];
+  pvt.hour = payload[8];
+  pvt.minute = payload[9];
+  pvt.second = payload[10];
+  pvt.valid = payload[11];
+  pvt.tAcc = read<uint32_t>(payload, 12);
+  pvt.nano = read<int32_t>(payload, 16);
+  pvt.fixType = payload[20];
+  pvt.flags = payload[21];
+  pvt.numSV = payload[23];
+  pvt.lon = read<int32_t>(payload, 24);
+  pvt.lat = read<int32_t>(payload, 28);
+  pvt.hMSL = read<int32_t>(payload, 36);
+  pvt.hAcc = read<uint32_t>(payload, 40);
+  pvt.vAcc = read<uint32_t>(payload, 44);
+  pvt.pDOP = read<uint16_t>(payload, 76);
+
+  if ((pvt.nano < 0) && (pvt.valid & VALID_DATE) && (pvt.valid & VALID_TIME)) {
+    previousSecond(pvt);
+    pvt.nano += 1000000000;
+  }
+
+  return true;
+}
+
+bool UBXParser::hasFix(const pvt_t &pvt) {
+  return (pvt.flags & FLAGS_GNSS_FIX_OK)
+         && ((pvt.fixType == FIX_2D) || (pvt.fixType == FIX_3D) || (pvt.fixType == FIX_GNSS_DR));
+}
+
+}  // namespace Furble
@@ -4,6 +4,7 @@
 
 #include <M5Unified.h>
 #include <esp_sleep.h>
+#include <esp_timer.h>
 #include <lvgl.h>
 #include <src/themes/lv_theme_private.h>
 
@@ -12,11 +13,14 @@
 
 #include "icons.h"
 
+#include "FurbleBoot.h"
 #include "FurbleCalibrate.h"
 #include "FurbleControl.h"
 #include "FurbleGPS.h"
 #include "FurblePlatform.h"
+#include "FurbleSequencer.h"
 #include "FurbleSettings.h"
+#include "FurbleTrigger.h"
 #include "FurbleUI.h"
 #include "interval.h"
 
@@ -46,10 +50,17 @@ UI::ConnectContext_t UI::m_ConnectContext;
 lv_timer_t *UI::m_ConnectTimer;
 
 lv_timer_t *UI::m_IntervalPageRefresh;
-uint32_t UI::m_IntervalNext;
 
 UI::menu_t UI::m_MainMenu;
 
+TaskHandle_t UI::m_Task = NULL;
+
+std::atomic<uint32_t> UI::m_Events = 0;
+
+#if FURBLE_FLUSH_PROFILE == 1
+UI::flush_profile_t UI::m_FlushProfile;
+#endif
+
 std::unordered_map<const char *, UI::menu_t> UI::m_Menu = {
     {m_ConnectStr,           {nullptr, nullptr, nullptr, nullptr, {0, 0}}},
     {m_ScanStr,              {nullptr, nullptr, nullptr, nullptr, {1, 0}}},
@@ -65,6 +76,8 @@ std::unordered_map<const char *, UI::menu_t> UI::m_Menu = {
     {m_IntervalDelayStr,     {nullptr, nullptr, nullptr, nullptr, {0, 0}}},
     {m_IntervalShutterStr,   {nullptr, nullptr, nullptr, nullptr, {0, 0}}},
     {m_IntervalWaitStr,      {nullptr, nullptr, nullptr, nullptr, {0, 0}}},
+    {m_IntervalProgramStr,   {nullptr, nullptr, nullptr, nullptr, {0, 0}}},
+    {m_IntervalOffsetsStr,   {nullptr, nullptr, nullptr, nullptr, {0, 0}}},
     {m_DisplayStr,           {nullptr, nullptr, nullptr, nullptr, {0, 0}}},
     {m_ThemeStr,             {nullptr, nullptr, nullptr, nullptr, {0, 1}}},
     {m_TransmitPowerStr,     {nullptr, nullptr, nullptr, nullptr, {1, 1}}},
@@ -120,6 +133,11 @@ UI::UI(const interval_t &interval)
   m_Display = lv_display_create(m_Width, m_Height);
   lv_display_set_default(m_Display);
   lv_display_set_flush_cb(m_Display, displayFlush);
+  lv_display_set_color_format(m_Display, COLOR_FORMAT);
+#if FURBLE_FLUSH_PROFILE == 1
+  lv_display_add_event_cb(m_Display, profileRender, LV_EVENT_RENDER_START, NULL);
+  lv_display_add_event_cb(m_Display, profileRender, LV_EVENT_RENDER_READY, NULL);
+#endif
 
   // configure display buffers
   m_Buffer1 = heap_caps_aligned_alloc(64, BUFFER_SIZE, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
@@ -152,53 +170,14 @@ UI::UI(const interval_t &interval)
 
   m_GPS.setIcon(m_Status.gpsIcon);
 
-  // refresh icons every 250ms
+  // GPS and lock status are posted, only the battery is sampled
+  updateBattery(&m_Status);
   m_IconTimer = lv_timer_create(
       [](lv_timer_t *timer) {
-        status_t *status = static_cast<status_t *>(lv_timer_get_user_data(timer));
-
-#if FURBLE_BATTERY_DEBUG == 1
-        int32_t current = M5.Power.getBatteryCurrent();
-        static int32_t mean = current;
-
-        // exponentially weighted moving average with alpha = 0.33
-        mean = mean + (current - mean) / 3;
-
-        lv_label_set_text_fmt(status->batteryIcon, "%ld", mean);
-#else
-        const lv_image_dsc_t *symbol = NULL;
-        int32_t level = M5.Power.getBatteryLevel();
-        if (level >= 95) {
-          symbol = &icon_battery_android_frame_full;
-        } else if (level >= 66) {
-          symbol = &icon_battery_android_frame_6;
-        } else if (level >= 33) {
-          symbol = &icon_battery_android_frame_4;
-        } else if (level >= 5) {
-          symbol = &icon_battery_android_frame_2;
-        } else {
-          symbol = &icon_battery_android_0;
-        }
-        lv_image_set_src(status->batteryIcon, symbol);
-#endif
-
-        if (status->gps->isEnabled()) {
-          lv_obj_clear_flag(status->gpsIcon, LV_OBJ_FLAG_HIDDEN);
-        } else {
-          lv_obj_add_flag(status->gpsIcon, LV_OBJ_FLAG_HIDDEN);
-        }
-
-        static lv_obj_t *lockMsgBox = NULL;
-        if (status->screenLocked && (lockMsgBox == NULL)) {
-          lockMsgBox = lv_msgbox_create(NULL);
-          lv_msgbox_add_title(lockMsgBox, "Screen Locked");
-          lv_msgbox_add_text(lockMsgBox, "Double-click PWR button to unlock.");
-        } else if (!status->screenLocked && (lockMsgBox != NULL)) {
-          lv_msgbox_close_async(lockMsgBox);
-          lockMsgBox = NULL;
-        }
+        updateBattery(static_cast<status_t *>(lv_timer_get_user_data(timer)));
       },
-      250, &m_Status);
+      BATTERY_POLL_MS, &m_Status);
+  post(EVENT_GPS);
 
   lv_obj_update_layout(m_Header);
   lv_obj_set_height(m_Header, 1.2f * lv_font_get_line_height(LV_FONT_DEFAULT));
@@ -297,15 +276,16 @@ UI::UI(const interval_t &interval)
   configureControl(ControlMode::MENU);
 
   // create connection timer
-  m_ConnectContext = {this, NULL, NULL, NULL, NULL, NULL};
-  m_ConnectTimer = lv_timer_create(connectTimerHandler, 125, &m_ConnectContext);
+  m_ConnectContext = {this, NULL, NULL, NULL, NULL, NULL, false};
+  m_ConnectTimer = lv_timer_create(connectTimerHandler, CONNECT_PROGRESS_MS, &m_ConnectContext);
   lv_timer_pause(m_ConnectTimer);
 
-  // create intervalometer timer
-  m_IntervalTimer = lv_timer_create(intervalometer, 100, &m_Intervalometer);
-  lv_timer_pause(m_IntervalTimer);
-
+  // pages other than these are built on first use, see loadPage()
+  const int64_t start = esp_timer_get_time();
+  const size_t heap = heap_caps_get_free_size(MALLOC_CAP_8BIT);
   addMainMenu();
+  ESP_LOGI(LOG_TAG, "menu built in %lldus using %u bytes", esp_timer_get_time() - start,
+           heap - heap_caps_get_free_size(MALLOC_CAP_8BIT));
 
   m_GPS.startService();
 }
@@ -371,12 +351,56 @@ void UI::touchRead(lv_indev_t *drv, lv_indev_data_t *data) {
 void UI::displayFlush(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map) {
   uint32_t w = (area->x2 - area->x1 + 1);
   uint32_t h = (area->y2 - area->y1 + 1);
+#if FURBLE_FLUSH_PROFILE == 1
+  const int64_t start = esp_timer_get_time();
+#endif
 
-  lv_draw_sw_rgb565_swap(px_map, w * h);
+  if (COLOR_FORMAT == LV_COLOR_FORMAT_RGB565) {
+    lv_draw_sw_rgb565_swap(px_map, w * h);
+  }
   M5.Display.pushImageDMA<uint16_t>(area->x1, area->y1, w, h, (uint16_t *)px_map);
   lv_disp_flush_ready(disp);
+
+  static bool shown = false;
+  if (!shown && lv_display_flush_is_last(disp)) {
+    // the last area of the first frame is on its way to the panel
+    shown = true;
+    BootProfile::mark(BootProfile::FIRST_FRAME);
+  }
+
+#if FURBLE_FLUSH_PROFILE == 1
+  m_FlushProfile.flushUs += esp_timer_get_time() - start;
+  m_FlushProfile.pixels += w * h;
+#endif
 }
 
+#if FURBLE_FLUSH_PROFILE == 1
+void UI::profileRender(lv_event_t *e) {
+  auto &profile = m_FlushProfile;
+  const int64_t now = esp_timer_get_time();
+
+  if (lv_event_get_code(e) == LV_EVENT_RENDER_START) {
+    profile.renderStart = now;
+    return;
+  }
+
+  profile.renderUs += now - profile.renderStart;
+  profile.frames++;
+
+  if (((now - profile.reported) < FLUSH_PROFILE_US) || (profile.pixels == 0)) {
+    return;
+  }
+
+  // flush waits for the previous DMA, render excludes the flush
+  ESP_LOGI(LOG_TAG, "flush profile: %s, %lu frames, %llu px, render %lluns/px, flush %lluns/px",
+           (COLOR_FORMAT == LV_COLOR_FORMAT_RGB565) ? "swap" : "swapped", profile.frames,
+           profile.pixels, (profile.renderUs - profile.flushUs) * 1000 / profile.pixels,
+           profile.flushUs * 1000 / profile.pixels);
+  profile = {};
+  profile.reported = now;
+}
+#endif
+
 uint32_t UI::tick(void) {
   return Platform::getInstance().tick();
 }
@@ -507,6 +531,7 @@ void UI::shutterLock(Control &control) {
   if (!m_ShutterLock) {
     control.sendCommand(Control::CMD_SHUTTER_PRESS);
     m_ShutterLock = true;
+    updateTrigger(true);
     ESP_LOGI("ui", "SHUTTER LOCKED");
 
     if (M5.Touch.isEnabled()) {
@@ -524,6 +549,7 @@ void UI::shutterUnlock(Control &control) {
   if (m_ShutterLock) {
     control.sendCommand(Control::CMD_SHUTTER_RELEASE);
     m_ShutterLock = false;
+    updateTrigger(true);
     ESP_LOGI("ui", "SHUTTER UNLOCKED");
 
     if (M5.Touch.isEnabled()) {
@@ -545,7 +571,7 @@ void UI::handleShutter(lv_event_t *e) {
     case LV_EVENT_PRESSED:
       if (ui->m_FocusPressed) {
         ui->shutterLock(control);
-      } else if (!ui->m_ShutterLock) {
+      } else if (!ui->m_ShutterLock && !Trigger::getInstance().isArmed()) {
         control.sendCommand(Control::CMD_SHUTTER_PRESS);
       }
       break;
@@ -554,7 +580,7 @@ void UI::handleShutter(lv_event_t *e) {
         if (!ui->m_FocusPressed) {
           ui->shutterUnlock(control);
         }
-      } else {
+      } else if (!Trigger::getInstance().isArmed()) {
         control.sendCommand(Control::CMD_SHUTTER_RELEASE);
       }
       break;
@@ -570,6 +596,7 @@ void UI::handleFocus(lv_event_t *e) {
   switch (code) {
     case LV_EVENT_PRESSED:
       ui->m_FocusPressed = true;
+      ui->updateTrigger(true);
       if (ui->m_ShutterLock) {
         ui->shutterUnlock(control);
       } else {
@@ -578,6 +605,7 @@ void UI::handleFocus(lv_event_t *e) {
       break;
     case LV_EVENT_RELEASED:
       ui->m_FocusPressed = false;
+      ui->updateTrigger(true);
       if (!ui->m_ShutterLock) {
         control.sendCommand(Control::CMD_FOCUS_RELEASE);
       }
@@ -736,12 +764,54 @@ void UI::addSettingItem(lv_obj_t *page, const char *symbol, Settings::type_t set
         [](lv_event_t *e) {
           auto *status = static_cast<status_t *>(lv_event_get_user_data(e));
           status->gps->reloadSetting();
-          if (status->gps->isEnabled()) {
-            lv_obj_clear_flag(status->gpsBaud, LV_OBJ_FLAG_HIDDEN);
-            lv_obj_clear_flag(status->gpsData, LV_OBJ_FLAG_HIDDEN);
+          updateGPSItems(status);
+        },
+        LV_EVENT_VALUE_CHANGED, &m_Status);
+  }
+
+  if ((setting == Settings::GPS_UBX) || (setting == Settings::GPS_LAST_FIX)
+      || (setting == Settings::GPS_TRACK) || (setting == Settings::GPS_PPS)) {
+    if (setting == Settings::GPS_UBX) {
+      m_Status.gpsUBX = obj;
+    } else if (setting == Settings::GPS_LAST_FIX) {
+      m_Status.gpsLastFix = obj;
+    } else if (setting == Settings::GPS_TRACK) {
+      m_Status.gpsTrack = obj;
+    } else {
+      m_Status.gpsPPS = obj;
+    }
+    lv_obj_add_event_cb(
+        sw,
+        [](lv_event_t *e) {
+          auto *status = static_cast<status_t *>(lv_event_get_user_data(e));
+          status->gps->reloadSetting();
+        },
+        LV_EVENT_VALUE_CHANGED, &m_Status);
+  }
+
+  if (setting == Settings::TRIGGER_INPUT) {
+    lv_obj_add_event_cb(
+        sw,
+        [](lv_event_t *e) {
+          auto *status = static_cast<status_t *>(lv_event_get_user_data(e));
+          auto &trigger = Trigger::getInstance();
+
+          // release the shared pins before handing them over
+          if (lv_obj_has_state(static_cast<lv_obj_t *>(lv_event_get_target(e)),
+                               LV_STATE_CHECKED)) {
+            status->gps->reloadSetting();
+            trigger.reloadSetting();
+          } else {
+            trigger.reloadSetting();
+            status->gps->reloadSetting();
+          }
+
+          updateGPSItems(status);
+
+          if (trigger.isInputEnabled()) {
+            lv_obj_clear_flag(status->triggerDelay, LV_OBJ_FLAG_HIDDEN);
           } else {
-            lv_obj_add_flag(status->gpsBaud, LV_OBJ_FLAG_HIDDEN);
-            lv_obj_add_flag(status->gpsData, LV_OBJ_FLAG_HIDDEN);
+            lv_obj_add_flag(status->triggerDelay, LV_OBJ_FLAG_HIDDEN);
           }
         },
         LV_EVENT_VALUE_CHANGED, &m_Status);
@@ -828,6 +898,46 @@ UI::menu_t &UI::addMenu(const char *name,
   return menu;
 }
 
+void UI::setPageBuilder(menu_t &menu, void (UI::*build)(lv_obj_t *page), bool transient) {
+  menu.build = build;
+  menu.transient = transient;
+  menu.built = false;
+}
+
+void UI::loadPage(lv_obj_t *page) {
+  menu_t *load = nullptr;
+  const char *loadName = nullptr;
+
+  for (auto &[name, menu] : m_Menu) {
+    if (menu.build == nullptr) {
+      continue;
+    }
+
+    if (menu.page == page) {
+      load = &menu;
+      loadName = name;
+    } else if (menu.built && menu.transient) {
+      // free the objects of a page left behind, rebuilt on the next visit
+      lv_obj_clean(menu.page);
+      menu.built = false;
+      if (lv_obj_get_parent(menu.button) == page) {
+        lv_group_focus_obj(menu.button);
+      }
+    }
+  }
+
+  if ((load != nullptr) && !load->built) {
+    // LVGL allocates from the heap, pages left were freed above
+    const int64_t start = esp_timer_get_time();
+    const size_t heap = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    (this->*load->build)(page);
+    load->built = true;
+    ESP_LOGD(LOG_TAG, "%s built in %lldus using %d bytes", loadName,
+             esp_timer_get_time() - start,
+             (int)(heap - heap_caps_get_free_size(MALLOC_CAP_8BIT)));
+  }
+}
+
 void UI::addMainMenu(void) {
   lv_obj_update_layout(m_Content);
   lv_obj_set_scrollbar_mode(m_Content, LV_SCROLLBAR_MODE_OFF);
@@ -893,6 +1003,8 @@ void UI::addMainMenu(void) {
         auto *back = lv_menu_get_main_header_back_button(m_MainMenu.main);
         auto &scan = Scan::getInstance();
 
+        ui->loadPage(page);
+
         if (page == m_MainMenu.page) {
           size_t saveCount = CameraList::getSaveCount();
           ui->m_MainCount++;
@@ -1043,6 +1155,7 @@ void UI::configureControl(ControlMode mode, bool set) {
 }
 
 void UI::configShutterControl(void) {
+  updateTrigger(true);
   if (!M5.Touch.isEnabled()) {
     lv_obj_set_style_bg_image_src(m_Left, &icon_arrow_back_24, 0);
     lv_obj_set_style_bg_image_src(m_Right, &icon_center_focus_strong_24, 0);
@@ -1078,6 +1191,7 @@ void UI::configShutterControl(void) {
 }
 
 void UI::configMenuControl(void) {
+  updateTrigger(false);
   if (!M5.Touch.isEnabled()) {
     lv_obj_set_style_bg_image_src(m_Left, &icon_arrow_upward_24, 0);
     lv_obj_set_style_bg_image_src(m_OK, &icon_check_24, 0);
@@ -1090,6 +1204,7 @@ void UI::configMenuControl(void) {
 }
 
 void UI::configSliderControl(void) {
+  updateTrigger(false);
   if (!M5.Touch.isEnabled()) {
     lv_obj_set_style_bg_image_src(m_Left, &icon_arrow_back_24, 0);
     lv_obj_set_style_bg_image_src(m_OK, &icon_check_24, 0);
@@ -1097,17 +1212,41 @@ void UI::configSliderControl(void) {
   }
 }
 
+void UI::updateTrigger(bool active) {
+  // focus and shutter lock combinations stay on the polled path
+  Trigger::getInstance().setArmed(active && !m_FocusPressed && !m_ShutterLock);
+}
+
 void UI::showShutterIntervalometer(bool show) {
   if (show) {
     lv_obj_clear_flag(m_IntervalStart, LV_OBJ_FLAG_HIDDEN);
+    if (m_Intervalometer.m_ProgramStart != nullptr) {
+      lv_obj_clear_flag(m_Intervalometer.m_ProgramStart, LV_OBJ_FLAG_HIDDEN);
+    }
+    lv_obj_clear_flag(m_SyncShotButton, LV_OBJ_FLAG_HIDDEN);
+    if (Control::getInstance().getTargets().size() > 1) {
+      lv_obj_clear_flag(m_OffsetsButton, LV_OBJ_FLAG_HIDDEN);
+    }
     lv_group_focus_obj(m_IntervalStart);
   } else {
     lv_obj_add_flag(m_IntervalStart, LV_OBJ_FLAG_HIDDEN);
+    if (m_Intervalometer.m_ProgramStart != nullptr) {
+      lv_obj_add_flag(m_Intervalometer.m_ProgramStart, LV_OBJ_FLAG_HIDDEN);
+    }
+    lv_obj_add_flag(m_SyncShotButton, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_flag(m_OffsetsButton, LV_OBJ_FLAG_HIDDEN);
   }
 }
 
 void UI::connectTimerHandler(lv_timer_t *timer) {
-  auto *ctx = static_cast<ConnectContext_t *>(lv_timer_get_user_data(timer));
+  updateConnect(static_cast<ConnectContext_t *>(lv_timer_get_user_data(timer)));
+}
+
+void UI::updateConnect(ConnectContext_t *ctx) {
+  if (!ctx->active) {
+    return;
+  }
+
   auto &control = Control::getInstance();
   Camera *camera = nullptr;
   auto state = control.getState();
@@ -1164,66 +1303,52 @@ void UI::connectTimerHandler(lv_timer_t *timer) {
       // nothing to do
       break;
   }
+
+  // progress is only followed whilst connecting, state changes are posted
+  if (ctx->active && (state == Control::STATE_CONNECTING)) {
+    lv_timer_resume(m_ConnectTimer);
+  } else {
+    lv_timer_pause(m_ConnectTimer);
+  }
 }
 
 void UI::intervalometer(lv_timer_t *timer) {
-  auto &control = Control::getInstance();
+  auto &sequencer = Sequencer::getInstance();
   auto *interval = static_cast<Intervalometer *>(lv_timer_get_user_data(timer));
-  uint32_t next = 0;
-
-  static uint32_t count = 0;
+  uint32_t count = sequencer.getCount();
+  uint32_t total = sequencer.getTotal();
 
-  if (interval->m_Count.m_SpinValue.m_Unit == SpinValue::UNIT_INF) {
+  if (total == 0) {
     lv_label_set_text_fmt(interval->m_CountLabel, "%09lu", count);
   } else {
-    lv_label_set_text_fmt(interval->m_CountLabel, "%03lu/%03u", count,
-                          interval->m_Count.m_SpinValue.m_Value);
+    lv_label_set_text_fmt(interval->m_CountLabel, "%03lu/%03lu", count, total);
   }
 
-  switch (interval->m_State) {
-    case Intervalometer::STATE_IDLE:
-      count = 0;
+  switch (sequencer.getState()) {
+    case Sequencer::STATE_IDLE:
       lv_label_set_text(interval->m_StateLabel, "IDLE");
-      lv_timer_ready(timer);
-      interval->m_State = Intervalometer::STATE_WAIT;
       break;
-
-    case Intervalometer::STATE_WAIT:
+    case Sequencer::STATE_WAIT:
       lv_label_set_text(interval->m_StateLabel, "WAIT");
-      next = interval->m_Wait.m_SpinValue.toMilliseconds();
-      interval->m_State = Intervalometer::STATE_SHUTTER_OPEN;
       break;
-
-    case Intervalometer::STATE_SHUTTER_OPEN:
-      count++;
+    case Sequencer::STATE_SHUTTER_OPEN:
       lv_label_set_text(interval->m_StateLabel, "SHUTTER");
-      control.sendCommand(Control::CMD_SHUTTER_PRESS);
-      next = interval->m_Shutter.m_SpinValue.toMilliseconds();
-      interval->m_State = Intervalometer::STATE_DELAY;
       break;
-
-    case Intervalometer::STATE_DELAY:
+    case Sequencer::STATE_DELAY:
       lv_label_set_text(interval->m_StateLabel, "DELAY");
-      control.sendCommand(Control::CMD_SHUTTER_RELEASE);
-      next = interval->m_Delay.m_SpinValue.toMilliseconds();
-      if (count >= interval->m_Count.m_SpinValue.m_Value) {
-        interval->m_State = Intervalometer::STATE_FINISHED;
-      } else {
-        interval->m_State = Intervalometer::STATE_SHUTTER_OPEN;
-      }
       break;
-
-    case Intervalometer::STATE_FINISHED:
+    case Sequencer::STATE_FINISHED:
       lv_label_set_text(interval->m_StateLabel, "FINISHED");
-      next = 0;
-      lv_timer_pause(timer);
       break;
   }
 
-  if (next > 0) {
-    lv_timer_set_period(timer, next);
-    m_IntervalNext = tick() + next;
-  }
+  SpinValue::hms_t hms = SpinValue::toHMS(sequencer.getRemaining());
+  lv_label_set_text_fmt(interval->m_RemainingLabel, "%02lu:%02lu:%02lu", hms.hours, hms.minutes,
+                        hms.seconds);
+
+  ShotLog::header_t summary = sequencer.getSummary();
+  lv_label_set_text_fmt(interval->m_SummaryLabel, "Late %lu, Missed %lu, Max %ldms",
+                        summary.late, summary.missed, summary.max / 1000);
 }
 
 void UI::doConnect(lv_event_t *e) {
@@ -1240,16 +1365,19 @@ void UI::doConnect(lv_event_t *e) {
   lv_obj_add_event_cb(
       m_ConnectContext.cancel, [](lv_event_t *e) { doDisconnect(); }, LV_EVENT_CLICKED, NULL);
 
+  // state changes are posted by the control task
+  m_ConnectContext.active = true;
   control.connectAll(Settings::load<Settings::RECONNECT>());
-  lv_timer_reset(m_ConnectTimer);
-  lv_timer_resume(m_ConnectTimer);
 
   menu_t &menu = m_Menu.at(m_ConnectedStr);
   lv_menu_set_page(m_MainMenu.main, menu.page);
 }
 
 void UI::doDisconnect(void) {
+  m_ConnectContext.active = false;
   lv_timer_pause(m_ConnectTimer);
+  lv_timer_pause(m_IntervalPageRefresh);
+  Sequencer::getInstance().stop();
   Scan::getInstance().stop();
   Control::getInstance().disconnect();
 
@@ -1545,69 +1673,192 @@ void UI::addGPSMenu(const menu_t &parent) {
       },
       LV_EVENT_VALUE_CHANGED, &m_Status);
 
+  addGPSRateItem(menu.page);
+  addSettingItem(menu.page, NULL, Settings::GPS_UBX);
+  addSettingItem(menu.page, NULL, Settings::GPS_LAST_FIX);
+  addSettingItem(menu.page, NULL, Settings::GPS_TRACK);
+  if (GPS::isPPSAvailable()) {
+    addSettingItem(menu.page, NULL, Settings::GPS_PPS);
+  }
+
+  // the track is kept while GPS is off
+  lv_obj_t *exportTrack = lv_button_create(menu.page);
+  lv_obj_t *exportLabel = lv_label_create(exportTrack);
+  lv_label_set_text(exportLabel, "Export Track");
+  lv_obj_center(exportLabel);
+  lv_obj_add_event_cb(
+      exportTrack, [](lv_event_t *e) { GPS::getInstance().exportTrack(); }, LV_EVENT_CLICKED,
+      NULL);
+
   menu_t &gpsData = addMenu(m_GPSDataStr, NULL, true, menu);
   m_Status.gpsData = gpsData.button;
-  if (!m_Status.gps->isEnabled()) {
-    lv_obj_add_flag(m_Status.gpsBaud, LV_OBJ_FLAG_HIDDEN);
-    lv_obj_add_flag(m_Status.gpsData, LV_OBJ_FLAG_HIDDEN);
-  }
+  setPageBuilder(gpsData, &UI::buildGPSDataPage, true);
+  updateGPSItems(&m_Status);
 
-  static lv_timer_t *timer = lv_timer_create(
-      [](lv_timer_t *t) {
-        auto *gpsData = static_cast<menu_t *>(lv_timer_get_user_data(t));
-        auto &gps = GPS::getInstance().get();
+  // external trigger input shares the GPS port
+  addSettingItem(menu.page, NULL, Settings::TRIGGER_INPUT);
+  addTriggerDelayItem(menu.page);
 
-        static lv_obj_t *age = lv_label_create(gpsData->page);
-        lv_label_set_text_fmt(age, "%lus ago", gps.location.age() / 1000);
+  lv_menu_set_load_page_event(gpsData.main, gpsData.button, gpsData.page);
+}
+
+void UI::buildGPSDataPage(lv_obj_t *page) {
+  m_GPSData.age = lv_label_create(page);
+  m_GPSData.satellites = lv_label_create(page);
+  m_GPSData.latitude = lv_label_create(page);
+  m_GPSData.longitude = lv_label_create(page);
+  m_GPSData.altitude = lv_label_create(page);
+  m_GPSData.date = lv_label_create(page);
+#if !defined(FURBLE_M5COREX)
+  m_GPSData.time = lv_label_create(page);
+#endif
+  m_GPSData.rx = lv_label_create(page);
+  m_GPSData.errors = lv_label_create(page);
+  if (GPS::isPPSAvailable()) {
+    m_GPSData.pps = lv_label_create(page);
+  }
 
-        static lv_obj_t *satellites = lv_label_create(gpsData->page);
-        lv_label_set_text_fmt(satellites, "%lu satellites", gps.satellites.value());
+  // the labels are deleted when the page is left, stop the refresh with them
+  lv_obj_add_event_cb(
+      m_GPSData.age,
+      [](lv_event_t *e) {
+        auto *data = static_cast<gps_data_t *>(lv_event_get_user_data(e));
+        lv_timer_delete(data->timer);
+        *data = {};
+      },
+      LV_EVENT_DELETE, &m_GPSData);
 
-        static lv_obj_t *lat = lv_label_create(gpsData->page);
-        lv_label_set_text_fmt(lat, "%.2f°", gps.location.lat());
+  m_GPSData.timer = lv_timer_create(updateGPSData, 1000, &m_GPSData);
+  lv_timer_ready(m_GPSData.timer);
+}
 
-        static lv_obj_t *lon = lv_label_create(gpsData->page);
-        lv_label_set_text_fmt(lon, "%.2f°", gps.location.lng());
+void UI::updateGPSData(lv_timer_t *timer) {
+  const auto *data = static_cast<gps_data_t *>(lv_timer_get_user_data(timer));
+  const auto snapshot = GPS::getInstance().getSnapshot();
+  const auto &gps = snapshot.gps;
+  const auto &timesync = snapshot.timesync;
+
+  if (snapshot.stale) {
+    lv_label_set_text(data->age, "last fix");
+  } else if (snapshot.valid) {
+    uint32_t seconds = (esp_timer_get_time() - snapshot.time) / 1000000LL;
+    lv_label_set_text_fmt(data->age, "%lus ago", seconds);
+  } else {
+    lv_label_set_text(data->age, "no fix");
+  }
 
-        static lv_obj_t *alt = lv_label_create(gpsData->page);
-        lv_label_set_text_fmt(alt, "%.2f m", gps.altitude.meters());
+  lv_label_set_text_fmt(data->satellites, "%u satellites", gps.satellites);
+  lv_label_set_text_fmt(data->latitude, "%.2f°", gps.latitude);
+  lv_label_set_text_fmt(data->longitude, "%.2f°", gps.longitude);
+  lv_label_set_text_fmt(data->altitude, "%.2f m", gps.altitude);
 
 #if defined(FURBLE_M5COREX)
-        static lv_obj_t *datetime = lv_label_create(gpsData->page);
-        lv_label_set_text_fmt(datetime, "%4u-%02u-%02u %02u:%02u:%02u", gps.date.year(),
-                              gps.date.month(), gps.date.day(), gps.time.hour(), gps.time.minute(),
-                              gps.time.second());
+  lv_label_set_text_fmt(data->date, "%4u-%02u-%02u %02u:%02u:%02u", timesync.year, timesync.month,
+                        timesync.day, timesync.hour, timesync.minute, timesync.second);
 #else
-        static lv_obj_t *date = lv_label_create(gpsData->page);
-        lv_label_set_text_fmt(date, "%4u-%02u-%02u", gps.date.year(), gps.date.month(),
-                              gps.date.day());
-        static lv_obj_t *time = lv_label_create(gpsData->page);
-        lv_label_set_text_fmt(time, "%02u:%02u:%02u", gps.time.hour(), gps.time.minute(),
-                              gps.time.second());
+  lv_label_set_text_fmt(data->date, "%4u-%02u-%02u", timesync.year, timesync.month,
+                        timesync.day);
+  lv_label_set_text_fmt(data->time, "%02u:%02u:%02u", timesync.hour, timesync.minute,
+                        timesync.second);
 #endif
+
+  const auto stats = GPS::getInstance().getStats();
+  lv_label_set_text_fmt(data->rx, "%lu B/s, %lu/s", stats.bytes, stats.sentences);
+  lv_label_set_text_fmt(data->errors, "%lu bad, %lu ovf", stats.errors, stats.overflows);
+  if (data->pps != NULL) {
+    if (stats.ppsLocked) {
+      lv_label_set_text_fmt(data->pps, "PPS %luus", stats.ppsJitter);
+    } else {
+      lv_label_set_text(data->pps, "PPS unlocked");
+    }
+  }
+}
+
+void UI::addGPSRateItem(lv_obj_t *page) {
+  static constexpr uint32_t rates[] = {1000, 2000, 5000, 10000};
+
+  m_Status.gpsRate = lv_menu_cont_create(page);
+  lv_obj_set_flex_flow(m_Status.gpsRate, LV_FLEX_FLOW_ROW_WRAP);
+
+  lv_obj_t *label = lv_label_create(m_Status.gpsRate);
+  lv_label_set_text(label, Settings::get(Settings::GPS_RATE).name);
+  lv_label_set_long_mode(label, LV_LABEL_LONG_SCROLL_CIRCULAR);
+  lv_obj_set_flex_grow(label, 1);
+
+  // relies on the rates ordering
+  lv_obj_t *roller = lv_roller_create(m_Status.gpsRate);
+  lv_roller_set_options(roller, "1s\n2s\n5s\n10s", LV_ROLLER_MODE_NORMAL);
+  lv_roller_set_visible_row_count(roller, 1);
+  const uint32_t rate = Settings::load<Settings::GPS_RATE>();
+  for (size_t i = 0; i < std::size(rates); i++) {
+    if (rates[i] == rate) {
+      lv_roller_set_selected(roller, i, LV_ANIM_OFF);
+    }
+  }
+  lv_obj_add_event_cb(
+      roller,
+      [](lv_event_t *e) {
+        auto *status = static_cast<status_t *>(lv_event_get_user_data(e));
+        auto *roller = static_cast<lv_obj_t *>(lv_event_get_target(e));
+        Settings::save<Settings::GPS_RATE>(rates[lv_roller_get_selected(roller)]);
+        status->gps->reloadSetting();
       },
-      1000, &gpsData);
-  lv_timer_pause(timer);
+      LV_EVENT_VALUE_CHANGED, &m_Status);
+}
+
+void UI::addTriggerDelayItem(lv_obj_t *page) {
+  m_Status.triggerDelay = lv_menu_cont_create(page);
+  lv_obj_set_flex_flow(m_Status.triggerDelay, LV_FLEX_FLOW_ROW_WRAP);
 
-  // start the update timer on 'GPS Data' button press
+  lv_obj_t *label = lv_label_create(m_Status.triggerDelay);
+  lv_label_set_text(label, Settings::get(Settings::TRIGGER_DELAY).name);
+  lv_label_set_long_mode(label, LV_LABEL_LONG_SCROLL_CIRCULAR);
+  lv_obj_set_flex_grow(label, 1);
+
+  // milliseconds with microsecond resolution
+  lv_obj_t *spinbox = lv_spinbox_create(m_Status.triggerDelay);
+  lv_spinbox_set_digit_format(spinbox, 6, 3);
+  lv_spinbox_set_range(spinbox, 0, 999999);
+  lv_spinbox_set_step(spinbox, 1000);
+  lv_spinbox_set_value(spinbox, Settings::load<Settings::TRIGGER_DELAY>());
+  lv_obj_set_width(spinbox, LV_SIZE_CONTENT);
+  lv_group_add_obj(m_Group, spinbox);
   lv_obj_add_event_cb(
-      gpsData.button,
+      spinbox,
       [](lv_event_t *e) {
-        auto *timer = static_cast<lv_timer_t *>(lv_event_get_user_data(e));
-        lv_timer_resume(timer);
-        menu_t *menu = static_cast<menu_t *>(lv_timer_get_user_data(timer));
-        lv_obj_add_event_cb(menu->main, gpsDataStop, LV_EVENT_CLICKED, timer);
+        auto *spinbox = static_cast<lv_obj_t *>(lv_event_get_target(e));
+        Settings::save<Settings::TRIGGER_DELAY>(lv_spinbox_get_value(spinbox));
+        Trigger::getInstance().reloadSetting();
       },
-      LV_EVENT_CLICKED, timer);
+      LV_EVENT_VALUE_CHANGED, NULL);
 
-  lv_menu_set_load_page_event(gpsData.main, gpsData.button, gpsData.page);
+  if (!Trigger::getInstance().isInputEnabled()) {
+    lv_obj_add_flag(m_Status.triggerDelay, LV_OBJ_FLAG_HIDDEN);
+  }
 }
 
-void UI::gpsDataStop(lv_event_t *e) {
-  auto *timer = static_cast<lv_timer_t *>(lv_event_get_user_data(e));
-  auto *target = static_cast<lv_obj_t *>(lv_event_get_target(e));
-  lv_timer_pause(timer);
-  lv_obj_remove_event_cb(target, gpsDataStop);
+void UI::updateGPSItems(const status_t *status) {
+  lv_obj_t *items[] = {
+      status->gpsBaud,
+      status->gpsData,
+      status->gpsRate,
+      status->gpsUBX,
+      status->gpsLastFix,
+      status->gpsTrack,
+      status->gpsPPS,
+  };
+
+  for (auto *item : items) {
+    if (item == NULL) {
+      // not available on this board
+      continue;
+    }
+    if (status->gps->isEnabled()) {
+      lv_obj_clear_flag(item, LV_OBJ_FLAG_HIDDEN);
+    } else {
+      lv_obj_add_flag(item, LV_OBJ_FLAG_HIDDEN);
+    }
+  }
 }
 
 void UI::addFeaturesMenu(const menu_t &parent) {
@@ -1654,9 +1905,47 @@ void UI::addSpinnerPage(const menu_t &parent, const char *item, Intervalometer::
 
   lv_group_add_obj(m_Group, menu.button);
 
-  lv_obj_set_flex_flow(menu.page, LV_FLEX_FLOW_COLUMN);
-  lv_obj_set_scrollbar_mode(menu.page, LV_SCROLLBAR_MODE_OFF);
-  spinner.m_RowInfinite = lv_obj_create(menu.page);
+  // show the value, the page is built when opened and freed when left
+  spinner.updateLabels();
+  setPageBuilder(menu, &UI::buildSpinnerPage, true);
+
+  lv_menu_set_load_page_event(menu.main, menu.button, menu.page);
+}
+
+void UI::buildSpinnerPage(lv_obj_t *page) {
+  const std::array<std::pair<const char *, Intervalometer::Spinner *>, 4> spinners = {{
+      {m_IntervalCountStr, &m_Intervalometer.m_Count},
+      {m_IntervalDelayStr, &m_Intervalometer.m_Delay},
+      {m_IntervalShutterStr, &m_Intervalometer.m_Shutter},
+      {m_IntervalWaitStr, &m_Intervalometer.m_Wait},
+  }};
+  Intervalometer::Spinner *found = nullptr;
+  for (const auto &s : spinners) {
+    if (m_Menu.at(s.first).page == page) {
+      found = s.second;
+      break;
+    }
+  }
+  if (found == nullptr) {
+    return;
+  }
+  Intervalometer::Spinner &spinner = *found;
+
+  lv_obj_set_flex_flow(page, LV_FLEX_FLOW_COLUMN);
+  lv_obj_set_scrollbar_mode(page, LV_SCROLLBAR_MODE_OFF);
+  spinner.m_RowInfinite = lv_obj_create(page);
+  lv_obj_add_event_cb(
+      spinner.m_RowInfinite,
+      [](lv_event_t *e) {
+        // page cleaned, the value label in the parent page remains
+        auto *spinner = static_cast<Intervalometer::Spinner *>(lv_event_get_user_data(e));
+        spinner->m_RowInfinite = nullptr;
+        spinner->m_SwitchInfinite = nullptr;
+        spinner->m_RowSpinners = nullptr;
+        spinner->m_Spinbox = nullptr;
+        spinner->m_RollerUnit = nullptr;
+      },
+      LV_EVENT_DELETE, &spinner);
   lv_obj_set_size(spinner.m_RowInfinite, LV_PCT(100), LV_SIZE_CONTENT);
   lv_obj_set_layout(spinner.m_RowInfinite, LV_LAYOUT_FLEX);
   lv_obj_set_flex_flow(spinner.m_RowInfinite, LV_FLEX_FLOW_ROW);
@@ -1683,7 +1972,7 @@ void UI::addSpinnerPage(const menu_t &parent, const char *item, Intervalometer::
       },
       LV_EVENT_VALUE_CHANGED, &spinner);
 
-  spinner.m_RowSpinners = lv_obj_create(menu.page);
+  spinner.m_RowSpinners = lv_obj_create(page);
   lv_obj_set_size(spinner.m_RowSpinners, LV_PCT(100), LV_SIZE_CONTENT);
   lv_obj_set_layout(spinner.m_RowSpinners, LV_LAYOUT_FLEX);
   lv_obj_set_flex_flow(spinner.m_RowSpinners, LV_FLEX_FLOW_ROW);
@@ -1703,24 +1992,31 @@ void UI::addSpinnerPage(const menu_t &parent, const char *item, Intervalometer::
       break;
   }
 
-  for (auto &r : spinner.m_Roller) {
-    r = lv_roller_create(spinner.m_RowSpinners);
-    lv_obj_add_flag(r, LV_OBJ_FLAG_SCROLL_ON_FOCUS);
-    lv_roller_set_options(r, Intervalometer::Spinner::m_SpinDigitRoller, LV_ROLLER_MODE_INFINITE);
-
-    lv_roller_set_visible_row_count(r, 2);
-    lv_group_add_obj(m_Group, r);
-    lv_obj_add_event_cb(
-        r,
-        [](lv_event_t *e) {
-          auto *spinner = static_cast<Intervalometer::Spinner *>(lv_event_get_user_data(e));
-          lv_obj_send_event(spinner->m_Value, LV_EVENT_REFRESH, spinner);
-        },
-        LV_EVENT_VALUE_CHANGED, &spinner);
+  // single spinbox, the encoder edits one digit at a time
+  spinner.m_Spinbox = lv_spinbox_create(spinner.m_RowSpinners);
+  lv_obj_add_flag(spinner.m_Spinbox, LV_OBJ_FLAG_SCROLL_ON_FOCUS);
+  if (spinner.m_SpinValue.isTime()) {
+    lv_spinbox_set_digit_format(spinner.m_Spinbox, Intervalometer::Spinner::m_TimeDigits,
+                                Intervalometer::Spinner::m_TimeDigits - SpinValue::DECIMALS);
+    lv_spinbox_set_range(spinner.m_Spinbox, 0, 999999);
+    lv_spinbox_set_step(spinner.m_Spinbox, SpinValue::SCALE);
+  } else {
+    lv_spinbox_set_digit_format(spinner.m_Spinbox, Intervalometer::Spinner::m_CountDigits, 0);
+    lv_spinbox_set_range(spinner.m_Spinbox, 0, 9999);
+    lv_spinbox_set_step(spinner.m_Spinbox, 1);
   }
+  lv_spinbox_set_rollover(spinner.m_Spinbox, true);
+  lv_obj_set_width(spinner.m_Spinbox, LV_SIZE_CONTENT);
+  lv_group_add_obj(m_Group, spinner.m_Spinbox);
+  lv_obj_add_event_cb(
+      spinner.m_Spinbox,
+      [](lv_event_t *e) {
+        auto *spinner = static_cast<Intervalometer::Spinner *>(lv_event_get_user_data(e));
+        lv_obj_send_event(spinner->m_Value, LV_EVENT_REFRESH, spinner);
+      },
+      LV_EVENT_VALUE_CHANGED, &spinner);
 
-  if ((spinner.m_SpinValue.m_Unit != SpinValue::UNIT_NIL)
-      && (spinner.m_SpinValue.m_Unit != SpinValue::UNIT_INF)) {
+  if (spinner.m_SpinValue.isTime()) {
     spinner.m_RollerUnit = lv_roller_create(spinner.m_RowSpinners);
     lv_obj_add_flag(spinner.m_RollerUnit, LV_OBJ_FLAG_SCROLL_ON_FOCUS);
     lv_roller_set_options(spinner.m_RollerUnit, Intervalometer::Spinner::m_SpinUnitsRoller,
@@ -1749,13 +2045,10 @@ void UI::addSpinnerPage(const menu_t &parent, const char *item, Intervalometer::
     case m5::board_t::board_M5StickCPlus2:
     case m5::board_t::board_M5StickCPlus:
     case m5::board_t::board_M5StickS3:
-      for (auto &r : spinner.m_Roller) {
-        lv_obj_set_style_pad_left(r, 2, LV_STATE_DEFAULT);
-        lv_obj_set_style_pad_right(r, 2, LV_STATE_DEFAULT);
-      }
+      lv_obj_set_style_pad_left(spinner.m_Spinbox, 2, LV_STATE_DEFAULT);
+      lv_obj_set_style_pad_right(spinner.m_Spinbox, 2, LV_STATE_DEFAULT);
 
-      if ((spinner.m_SpinValue.m_Unit != SpinValue::UNIT_NIL)
-          && (spinner.m_SpinValue.m_Unit != SpinValue::UNIT_INF)) {
+      if (spinner.m_RollerUnit != nullptr) {
         lv_obj_set_style_pad_left(spinner.m_RollerUnit, 2, LV_STATE_DEFAULT);
         lv_obj_set_style_pad_right(spinner.m_RollerUnit, 2, LV_STATE_DEFAULT);
       }
@@ -1766,9 +2059,196 @@ void UI::addSpinnerPage(const menu_t &parent, const char *item, Intervalometer::
 
   spinner.updateLabels();
 
+  // reflect infinite or not
+  if (spinner.m_SpinValue.m_Unit == SpinValue::UNIT_INF) {
+    lv_obj_add_flag(spinner.m_RowSpinners, LV_OBJ_FLAG_HIDDEN);
+  }
+}
+
+void UI::addProgramPage(const menu_t &parent) {
+  menu_t &menu = addMenu(m_IntervalProgramStr, NULL, false, parent);
+
+  menu.button = lv_menu_cont_create(parent.page);
+  lv_obj_t *label = lv_label_create(menu.button);
+  lv_label_set_text(label, m_IntervalProgramStr);
+  lv_group_add_obj(m_Group, menu.button);
+
+  // built on first use but kept, Start leaves the page from inside its own click
+  setPageBuilder(menu, &UI::buildProgramPage, false);
+
+  lv_menu_set_load_page_event(menu.main, menu.button, menu.page);
+}
+
+void UI::buildProgramPage(lv_obj_t *page) {
+  const menu_t &run = m_Menu.at(m_IntervalometerRunStr);
+
+  lv_obj_t *cont = lv_menu_cont_create(page);
+  lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+
+  lv_obj_t *start = lv_button_create(cont);
+  m_Intervalometer.m_ProgramStart = start;
+  lv_obj_t *label = lv_label_create(start);
+  lv_label_set_text(label, "Start");
+  lv_obj_center(label);
+  // shown with the single interval Start whilst connected
+  if (lv_obj_has_flag(m_IntervalStart, LV_OBJ_FLAG_HIDDEN)) {
+    lv_obj_add_flag(start, LV_OBJ_FLAG_HIDDEN);
+  }
+  lv_obj_add_event_cb(
+      start,
+      [](lv_event_t *e) {
+        auto *interval = static_cast<Intervalometer *>(lv_event_get_user_data(e));
+
+        Sequencer::getInstance().start(interval->m_Program);
+
+        lv_timer_resume(m_IntervalPageRefresh);
+        lv_timer_ready(m_IntervalPageRefresh);
+      },
+      LV_EVENT_CLICKED, &m_Intervalometer);
+  lv_menu_set_load_page_event(run.main, start, run.page);
+
+  m_Intervalometer.m_ProgramLabel = lv_label_create(cont);
+  m_Intervalometer.updateProgramLabel();
+
+  // append the current Count/Delay/Shutter as a segment
+  const std::pair<const char *, ramp_t> actions[] = {
+      {"Add Step",        RAMP_NONE       },
+      {"Add Linear Ramp", RAMP_LINEAR     },
+      {"Add Exp Ramp",    RAMP_EXPONENTIAL},
+  };
+
+  for (const auto &action : actions) {
+    lv_obj_t *button = lv_button_create(cont);
+    label = lv_label_create(button);
+    lv_label_set_text(label, action.first);
+    lv_obj_center(label);
+    lv_obj_set_user_data(button, (void *)action.second);
+    lv_obj_add_event_cb(
+        button,
+        [](lv_event_t *e) {
+          auto *interval = static_cast<Intervalometer *>(lv_event_get_user_data(e));
+          auto *button = static_cast<lv_obj_t *>(lv_event_get_target(e));
+          auto ramp = static_cast<ramp_t>((uintptr_t)lv_obj_get_user_data(button));
+
+          if (!interval->appendSegment(ramp)) {
+            ESP_LOGW(LOG_TAG, "Unable to append program segment.");
+          }
+        },
+        LV_EVENT_CLICKED, &m_Intervalometer);
+  }
+
+  lv_obj_t *clear = lv_button_create(cont);
+  label = lv_label_create(clear);
+  lv_label_set_text(label, "Clear");
+  lv_obj_center(label);
+  lv_obj_add_event_cb(
+      clear,
+      [](lv_event_t *e) {
+        auto *interval = static_cast<Intervalometer *>(lv_event_get_user_data(e));
+        interval->clearProgram();
+      },
+      LV_EVENT_CLICKED, &m_Intervalometer);
+}
+
+void UI::addOffsetsPage(const menu_t &parent) {
+  menu_t &menu = addMenu(m_IntervalOffsetsStr, NULL, false, parent);
+
+  menu.button = lv_menu_cont_create(parent.page);
+  m_OffsetsButton = menu.button;
+  lv_obj_t *label = lv_label_create(menu.button);
+  lv_label_set_text(label, m_IntervalOffsetsStr);
+  lv_group_add_obj(m_Group, menu.button);
+  lv_obj_add_flag(menu.button, LV_OBJ_FLAG_HIDDEN);
+
+  // targets are only known once connected, rebuild every time
+  setPageBuilder(menu, &UI::buildOffsetsPage, true);
+
   lv_menu_set_load_page_event(menu.main, menu.button, menu.page);
 }
 
+void UI::buildOffsetsPage(lv_obj_t *page) {
+  const auto &targets = Control::getInstance().getTargets();
+
+  lv_obj_t *cont = lv_menu_cont_create(page);
+  lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+
+  for (size_t i = 0; i < targets.size(); i++) {
+    const auto &target = targets[i];
+
+    lv_obj_t *label = lv_label_create(cont);
+    lv_label_set_text_fmt(label, "%s (%ldus)", target->getCamera()->getName().c_str(),
+                          target->getAchievedOffset());
+    lv_label_set_long_mode(label, LV_LABEL_LONG_SCROLL_CIRCULAR);
+    lv_obj_set_width(label, LV_PCT(100));
+
+    // milliseconds with microsecond resolution
+    lv_obj_t *spinbox = lv_spinbox_create(cont);
+    lv_spinbox_set_digit_format(spinbox, 6, 3);
+    lv_spinbox_set_range(spinbox, 0, 999999);
+    lv_spinbox_set_step(spinbox, 1000);
+    lv_spinbox_set_value(spinbox, target->getOffset());
+    lv_obj_set_width(spinbox, LV_SIZE_CONTENT);
+    lv_obj_set_user_data(spinbox, (void *)i);
+    lv_group_add_obj(m_Group, spinbox);
+    lv_obj_add_event_cb(
+        spinbox,
+        [](lv_event_t *e) {
+          auto *spinbox = static_cast<lv_obj_t *>(lv_event_get_target(e));
+          auto index = (size_t)lv_obj_get_user_data(spinbox);
+
+          Control::getInstance().setOffset(index, lv_spinbox_get_value(spinbox));
+        },
+        LV_EVENT_VALUE_CHANGED, NULL);
+  }
+}
+
+void UI::addDropoutItem(lv_obj_t *page) {
+  lv_obj_t *obj = lv_menu_cont_create(page);
+  lv_obj_set_flex_flow(obj, LV_FLEX_FLOW_ROW_WRAP);
+
+  lv_obj_t *label = lv_label_create(obj);
+  lv_label_set_text(label, Settings::get(Settings::DROPOUT).name);
+  lv_label_set_long_mode(label, LV_LABEL_LONG_SCROLL_CIRCULAR);
+  lv_obj_set_flex_grow(label, 1);
+
+  // relies on the Sequencer::dropout_t ordering
+  lv_obj_t *roller = lv_roller_create(obj);
+  lv_roller_set_options(roller, "Skip\nCatch-up\nShift", LV_ROLLER_MODE_NORMAL);
+  lv_roller_set_visible_row_count(roller, 1);
+  lv_roller_set_selected(roller, Settings::load<Settings::DROPOUT>(), LV_ANIM_OFF);
+  lv_obj_add_event_cb(
+      roller,
+      [](lv_event_t *e) {
+        auto *roller = static_cast<lv_obj_t *>(lv_event_get_target(e));
+        Settings::save<Settings::DROPOUT>(lv_roller_get_selected(roller));
+      },
+      LV_EVENT_VALUE_CHANGED, NULL);
+}
+
+void UI::addSyncShotItem(lv_obj_t *page) {
+  m_SyncShotButton = lv_button_create(page);
+  lv_obj_t *label = lv_label_create(m_SyncShotButton);
+  lv_label_set_text(label, "Fire at Minute");
+  lv_obj_center(label);
+  lv_obj_add_flag(m_SyncShotButton, LV_OBJ_FLAG_HIDDEN);
+
+  lv_obj_add_event_cb(
+      m_SyncShotButton,
+      [](lv_event_t *e) {
+        static constexpr int64_t MINUTE_US = (60 * 1000 * 1000LL);
+        const int64_t utc = GPS::getInstance().getUTC();
+        if (utc == 0) {
+          ESP_LOGW(LOG_TAG, "Cannot fire at minute, UTC unknown");
+          return;
+        }
+
+        // next whole minute at least the lead away, units armed in the same minute fire together
+        Control::getInstance().scheduleShutter((((utc + SYNC_LEAD_US) / MINUTE_US) + 1)
+                                               * MINUTE_US);
+      },
+      LV_EVENT_CLICKED, NULL);
+}
+
 void UI::addIntervalometerMenu(const menu_t &parent) {
   menu_t &menu = addMenu(m_IntervalometerStr, &icon_timer, true, parent);
   menu_t &menuIntervalRun = addMenu(m_IntervalometerRunStr, NULL, false, menu);
@@ -1782,25 +2262,32 @@ void UI::addIntervalometerMenu(const menu_t &parent) {
   addSpinnerPage(menu, m_IntervalDelayStr, m_Intervalometer.m_Delay);
   addSpinnerPage(menu, m_IntervalShutterStr, m_Intervalometer.m_Shutter);
   addSpinnerPage(menu, m_IntervalWaitStr, m_Intervalometer.m_Wait);
-
-  // Reflect count infinite or not
-  m_Intervalometer.m_Count.update();
+  addProgramPage(menu);
+  addOffsetsPage(menu);
+  addSettingItem(menu.page, NULL, Settings::LOW_POWER);
+  addSettingItem(menu.page, NULL, Settings::WHEN_READY);
+  addDropoutItem(menu.page);
+  addSyncShotItem(menu.page);
+
+  lv_obj_t *exportLog = lv_button_create(menu.page);
+  lv_obj_t *exportLabel = lv_label_create(exportLog);
+  lv_label_set_text(exportLabel, "Export Log");
+  lv_obj_center(exportLabel);
+  lv_obj_add_event_cb(exportLog, [](lv_event_t *e) { ShotLog::dump(); }, LV_EVENT_CLICKED, NULL);
 
   lv_obj_add_flag(m_IntervalStart, LV_OBJ_FLAG_HIDDEN);
 
   lv_obj_add_event_cb(
       m_IntervalStart,
       [](lv_event_t *e) {
-        auto *timer = static_cast<lv_timer_t *>(lv_event_get_user_data(e));
-        auto *interval = static_cast<Intervalometer *>(lv_timer_get_user_data(timer));
+        auto *interval = static_cast<Intervalometer *>(lv_event_get_user_data(e));
 
-        interval->m_State = Intervalometer::STATE_IDLE;
-        lv_timer_resume(timer);
+        Sequencer::getInstance().start(interval->toInterval());
 
         lv_timer_resume(m_IntervalPageRefresh);
         lv_timer_ready(m_IntervalPageRefresh);
       },
-      LV_EVENT_CLICKED, m_IntervalTimer);
+      LV_EVENT_CLICKED, &m_Intervalometer);
 
   lv_obj_t *cont = lv_menu_cont_create(menuIntervalRun.page);
   lv_obj_set_height(cont, LV_PCT(100));
@@ -1811,6 +2298,7 @@ void UI::addIntervalometerMenu(const menu_t &parent) {
   m_Intervalometer.m_StateLabel = lv_label_create(cont);
   m_Intervalometer.m_CountLabel = lv_label_create(cont);
   m_Intervalometer.m_RemainingLabel = lv_label_create(cont);
+  m_Intervalometer.m_SummaryLabel = lv_label_create(cont);
 
   lv_obj_t *stop = lv_button_create(cont);
   lv_obj_t *stopLabel = lv_label_create(stop);
@@ -1818,29 +2306,17 @@ void UI::addIntervalometerMenu(const menu_t &parent) {
   lv_obj_add_event_cb(
       stop,
       [](lv_event_t *e) {
-        auto *timer = static_cast<lv_timer_t *>(lv_event_get_user_data(e));
-        auto &control = Control::getInstance();
-
-        // pause all interval timers
-        lv_timer_pause(timer);
+        // stop the sequence (releasing the shutter) and page refresh
+        Sequencer::getInstance().stop();
         lv_timer_pause(m_IntervalPageRefresh);
 
-        // release shutter and exit
-        control.sendCommand(Control::CMD_SHUTTER_RELEASE);
+        // exit
         lv_obj_t *back = lv_menu_get_main_header_back_button(m_MainMenu.main);
         lv_obj_send_event(back, LV_EVENT_CLICKED, m_MainMenu.main);
       },
-      LV_EVENT_CLICKED, m_IntervalTimer);
+      LV_EVENT_CLICKED, NULL);
 
-  m_IntervalPageRefresh = lv_timer_create(
-      [](lv_timer_t *timer) {
-        auto *label = static_cast<lv_obj_t *>(lv_timer_get_user_data(timer));
-        uint32_t now = tick();
-        uint32_t remaining = m_IntervalNext > now ? m_IntervalNext - now : 0;
-        SpinValue::hms_t hms = SpinValue::toHMS(remaining);
-        lv_label_set_text_fmt(label, "%02lu:%02lu:%02lu", hms.hours, hms.minutes, hms.seconds);
-      },
-      333, m_Intervalometer.m_RemainingLabel);
+  m_IntervalPageRefresh = lv_timer_create(intervalometer, 333, &m_Intervalometer);
   lv_timer_pause(m_IntervalPageRefresh);
 
   lv_menu_set_load_page_event(menuIntervalRun.main, m_IntervalStart, menuIntervalRun.page);
@@ -1850,7 +2326,13 @@ void UI::addIntervalometerMenu(const menu_t &parent) {
 
 void UI::addDisplayMenu(const menu_t &parent) {
   menu_t &menu = addMenu(m_DisplayStr, &icon_settings_brightness, true, parent);
-  lv_obj_t *cont = lv_menu_cont_create(menu.page);
+  setPageBuilder(menu, &UI::buildDisplayPage, true);
+
+  lv_menu_set_load_page_event(menu.main, menu.button, menu.page);
+}
+
+void UI::buildDisplayPage(lv_obj_t *page) {
+  lv_obj_t *cont = lv_menu_cont_create(page);
   lv_obj_set_height(cont, LV_PCT(100));
   lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
   lv_obj_set_flex_align(cont, LV_FLEX_ALIGN_SPACE_EVENLY, LV_FLEX_ALIGN_CENTER,
@@ -1945,16 +2427,19 @@ void UI::addDisplayMenu(const menu_t &parent) {
         },
         LV_EVENT_CLICKED, &m_CalibrationUI);
   }
-
-  lv_menu_set_load_page_event(menu.main, menu.button, menu.page);
 }
 
 void UI::addThemeMenu(const menu_t &parent) {
   menu_t &menu = addMenu(m_ThemeStr, &icon_palette, true, parent);
+  setPageBuilder(menu, &UI::buildThemePage, true);
 
+  lv_menu_set_load_page_event(menu.main, menu.button, menu.page);
+}
+
+void UI::buildThemePage(lv_obj_t *page) {
   static std::array<std::string, 3> themes = {"Dark", "Default", "Mono Furble"};
 
-  lv_obj_t *cont = lv_menu_cont_create(menu.page);
+  lv_obj_t *cont = lv_menu_cont_create(page);
   lv_obj_set_size(cont, LV_PCT(100), LV_PCT(100));
   lv_obj_set_layout(cont, LV_LAYOUT_FLEX);
   lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
@@ -1990,13 +2475,17 @@ void UI::addThemeMenu(const menu_t &parent) {
         esp_restart();
       },
       LV_EVENT_CLICKED, roller);
-
-  lv_menu_set_load_page_event(menu.main, menu.button, menu.page);
 }
 
 void UI::addTransmitPowerMenu(const menu_t &parent) {
   menu_t &menu = addMenu(m_TransmitPowerStr, &icon_settings_remote, true, parent);
-  lv_obj_t *cont = lv_menu_cont_create(menu.page);
+  setPageBuilder(menu, &UI::buildTransmitPowerPage, true);
+
+  lv_menu_set_load_page_event(menu.main, menu.button, menu.page);
+}
+
+void UI::buildTransmitPowerPage(lv_obj_t *page) {
+  lv_obj_t *cont = lv_menu_cont_create(page);
   lv_obj_set_size(cont, LV_PCT(100), LV_PCT(100));
   lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
   lv_obj_set_flex_align(cont, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
@@ -2035,13 +2524,17 @@ void UI::addTransmitPowerMenu(const menu_t &parent) {
         }
       },
       LV_EVENT_ALL, this);
-
-  lv_menu_set_load_page_event(menu.main, menu.button, menu.page);
 }
 
 void UI::addAboutMenu(const menu_t &parent) {
   menu_t &menu = addMenu(m_AboutStr, &icon_info, true, parent);
-  lv_obj_t *cont = lv_menu_cont_create(menu.page);
+  setPageBuilder(menu, &UI::buildAboutPage, true);
+
+  lv_menu_set_load_page_event(menu.main, menu.button, menu.page);
+}
+
+void UI::buildAboutPage(lv_obj_t *page) {
+  lv_obj_t *cont = lv_menu_cont_create(page);
   lv_obj_set_size(cont, LV_PCT(100), LV_PCT(100));
   lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
   lv_obj_set_flex_align(cont, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
@@ -2056,7 +2549,23 @@ void UI::addAboutMenu(const menu_t &parent) {
   lv_label_set_long_mode(id, LV_LABEL_LONG_WRAP);
   lv_label_set_text_fmt(id, "ID:\n%s", Device::getStringID().c_str());
 
-  lv_menu_set_load_page_event(menu.main, menu.button, menu.page);
+  // boot time with the slowest phase, the full timeline is logged
+  const auto &profile = BootProfile::getProfile();
+  auto slowest = BootProfile::STARTUP;
+  for (int i = BootProfile::STARTUP; i < BootProfile::PHASES; i++) {
+    auto phase = static_cast<BootProfile::phase_t>(i);
+    if (BootProfile::getPhaseMs(profile, phase) > BootProfile::getPhaseMs(profile, slowest)) {
+      slowest = phase;
+    }
+  }
+
+  lv_obj_t *boot = lv_label_create(cont);
+  lv_obj_set_width(boot, LV_PCT(100));
+  lv_label_set_long_mode(boot, LV_LABEL_LONG_WRAP);
+  lv_label_set_text_fmt(boot, "Boot:\n%lums, last %lums\n%s %lums",
+                        BootProfile::getTotalMs(profile),
+                        BootProfile::getTotalMs(BootProfile::getPrevious()),
+                        BootProfile::getName(slowest), BootProfile::getPhaseMs(profile, slowest));
 }
 
 void UI::addSettingsMenu(void) {
@@ -2092,45 +2601,187 @@ void UI::setInactivityTimeout(uint8_t timeout) {
 }
 
 void UI::processInactivity(void) {
-  static bool inactive = false;
-
   if (m_InactivityTimeout > 0) {
     if (lv_disp_get_inactive_time(m_Display) > m_InactivityTimeout) {
-      if (!inactive) {
+      if (!m_Inactive) {
         M5.Display.setBrightness(m_MinimumBrightness);
-        inactive = true;
+        setInputPeriod(INACTIVE_POLL_MS);
+        m_Inactive = true;
       }
     } else {
-      if (inactive) {
+      if (m_Inactive) {
         // restore brightness
         auto brightness = Settings::load<Settings::BRIGHTNESS>();
         M5.Display.setBrightness(brightness);
-        inactive = false;
+        setInputPeriod(LV_DEF_REFR_PERIOD);
+        m_Inactive = false;
       }
     }
   }
 }
 
+void UI::setInputPeriod(uint32_t period) {
+  for (lv_indev_t *indev = lv_indev_get_next(NULL); indev != NULL;
+       indev = lv_indev_get_next(indev)) {
+    lv_timer_set_period(lv_indev_get_read_timer(indev), period);
+  }
+}
+
 void UI::handleLockScreen(void) {
   // toggle screen lock on power button double click for touch screens
   if (M5.Touch.isEnabled()) {
     if (M5.BtnPWR.wasDoubleClicked()) {
       m_Status.screenLocked = !m_Status.screenLocked;
+      post(EVENT_LOCK);
     }
   }
 }
 
+bool UI::handleLowPower(void) {
+  bool input = M5.BtnA.isPressed() || M5.BtnB.isPressed() || M5.BtnC.isPressed()
+               || M5.BtnPWR.isPressed() || M5.BtnPWR.wasClicked()
+               || (M5.Touch.isEnabled() && (M5.Touch.getCount() > 0));
+
+  if (!m_Blanked) {
+    if (Sequencer::getInstance().isLowPower()
+        && (lv_display_get_inactive_time(m_Display) > LOW_POWER_BLANK_MS)) {
+      M5.Display.sleep();
+      m_Blanked = true;
+    }
+    return m_Blanked;
+  }
+
+  if (input || !Sequencer::getInstance().isLowPower()) {
+    M5.Display.wakeup();
+    // swallow the waking input, resume once released
+    if (input) {
+      return true;
+    }
+    (void)Platform::getInstance().getPWRClickCount();
+    lv_display_trigger_activity(m_Display);
+    lv_obj_invalidate(lv_screen_active());
+    m_Blanked = false;
+  }
+
+  return m_Blanked;
+}
+
 void UI::task(void) {
+  m_Task = xTaskGetCurrentTaskHandle();
+  m_WakeupTime = esp_timer_get_time();
+
   while (true) {
     Platform::getInstance().update();
 
     handleLockScreen();
 
+    // poll slowly whilst blanked so the SoC can light sleep between frames
+    uint32_t sleep = LOW_POWER_POLL_MS;
     m_Mutex.lock();
-    lv_task_handler();
+    const uint32_t events = m_Events.exchange(0);
+    if (events != 0) {
+      handleEvents(events);
+    }
+    bool blanked = handleLowPower();
+    if (!blanked) {
+      // buttons are polled, sleep no longer than the input poll period
+      sleep = std::min(lv_task_handler(), m_Inactive ? INACTIVE_POLL_MS : ACTIVE_POLL_MS);
+    }
     m_Mutex.unlock();
 
-    vTaskDelay(pdMS_TO_TICKS(5));
+    // first frame stamped by the flush, persist it outside of LVGL
+    BootProfile::complete();
+
+    reportWakeups(blanked);
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(std::max<uint32_t>(sleep, 1)));
   }
 }
+
+void UI::post(event_t event) {
+  m_Events.fetch_or(event);
+  wake();
+}
+
+void UI::handleEvents(uint32_t events) {
+  if (events & EVENT_CONNECT) {
+    updateConnect(&m_ConnectContext);
+  }
+
+  if (events & EVENT_GPS) {
+    if (m_GPS.isEnabled()) {
+      lv_obj_clear_flag(m_Status.gpsIcon, LV_OBJ_FLAG_HIDDEN);
+    } else {
+      lv_obj_add_flag(m_Status.gpsIcon, LV_OBJ_FLAG_HIDDEN);
+    }
+    m_GPS.updateIcon();
+  }
+
+  if (events & EVENT_LOCK) {
+    updateLockScreen(&m_Status);
+  }
+}
+
+void UI::updateBattery(status_t *status) {
+#if FURBLE_BATTERY_DEBUG == 1
+  int32_t current = M5.Power.getBatteryCurrent();
+  static int32_t mean = current;
+
+  // exponentially weighted moving average with alpha = 0.33
+  mean = mean + (current - mean) / 3;
+
+  lv_label_set_text_fmt(status->batteryIcon, "%ld", mean);
+#else
+  const lv_image_dsc_t *symbol = NULL;
+  int32_t level = M5.Power.getBatteryLevel();
+  if (level >= 95) {
+    symbol = &icon_battery_android_frame_full;
+  } else if (level >= 66) {
+    symbol = &icon_battery_android_frame_6;
+  } else if (level >= 33) {
+    symbol = &icon_battery_android_frame_4;
+  } else if (level >= 5) {
+    symbol = &icon_battery_android_frame_2;
+  } else {
+    symbol = &icon_battery_android_0;
+  }
+  // setting the same source drops it from the image cache
+  if (symbol != lv_image_get_src(status->batteryIcon)) {
+    lv_image_set_src(status->batteryIcon, symbol);
+  }
+#endif
+}
+
+void UI::updateLockScreen(status_t *status) {
+  static lv_obj_t *lockMsgBox = NULL;
+  if (status->screenLocked && (lockMsgBox == NULL)) {
+    lockMsgBox = lv_msgbox_create(NULL);
+    lv_msgbox_add_title(lockMsgBox, "Screen Locked");
+    lv_msgbox_add_text(lockMsgBox, "Double-click PWR button to unlock.");
+  } else if (!status->screenLocked && (lockMsgBox != NULL)) {
+    lv_msgbox_close_async(lockMsgBox);
+    lockMsgBox = NULL;
+  }
+}
+
+void UI::wake(void) {
+  if (m_Task != NULL) {
+    xTaskNotifyGive(m_Task);
+  }
+}
+
+void UI::reportWakeups(bool blanked) {
+  const int64_t now = esp_timer_get_time();
+  const int64_t elapsed = now - m_WakeupTime;
+
+  m_Wakeups++;
+  if (elapsed < WAKEUP_REPORT_US) {
+    return;
+  }
+
+  ESP_LOGD(LOG_TAG, "UI %s: %lu wakeups/s, %ldmA",
+           blanked ? "blanked" : (m_Inactive ? "dimmed" : "active"),
+           (uint32_t)(m_Wakeups * 1000000LL / elapsed), M5.Power.getBatteryCurrent());
+  m_Wakeups = 0;
+  m_WakeupTime = now;
+}
 }  // namespace Furble
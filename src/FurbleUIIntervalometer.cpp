@@ -1,20 +1,148 @@
+#include <cstdio>
+#include <string>
+
 #include <lvgl.h>
 
+#include "FurbleSequencer.h"
 #include "FurbleUI.h"
 
 namespace Furble {
 
+/** Format microseconds as milliseconds, trailing zero decimals removed. */
+static std::string toMs(uint64_t us) {
+  char buffer[24];
+  uint64_t fraction = us % 1000;
+  int digits = 3;
+
+  if (fraction == 0) {
+    snprintf(buffer, sizeof(buffer), "%llu", (unsigned long long)(us / 1000));
+    return buffer;
+  }
+
+  while ((fraction % 10) == 0) {
+    fraction /= 10;
+    digits--;
+  }
+  snprintf(buffer, sizeof(buffer), "%llu.%0*llu", (unsigned long long)(us / 1000), digits,
+           (unsigned long long)fraction);
+
+  return buffer;
+}
+
 UI::Intervalometer::Intervalometer(const interval_t &interval)
-    : m_State {STATE_IDLE},
-      m_Count(this, interval.count, true),
+    : m_Count(this, interval.count, true),
       m_Delay(this, interval.delay),
       m_Shutter(this, interval.shutter),
-      m_Wait(this, interval.wait) {}
+      m_Wait(this, interval.wait),
+      m_Program(Settings::load<Settings::PROGRAM>()) {
+  resetRamp();
+}
+
+interval_t UI::Intervalometer::toInterval(void) {
+  return (interval_t) {m_Count.m_SpinValue.toNVS(), m_Delay.m_SpinValue.toNVS(),
+                       m_Shutter.m_SpinValue.toNVS(), m_Wait.m_SpinValue.toNVS()};
+}
 
 void UI::Intervalometer::save(void) {
-  interval_t interval = {m_Count.m_SpinValue.toNVS(), m_Delay.m_SpinValue.toNVS(),
-                         m_Shutter.m_SpinValue.toNVS(), m_Wait.m_SpinValue.toNVS()};
-  Settings::save<Settings::INTERVAL>(interval);
+  Settings::save<Settings::INTERVAL>(toInterval());
+}
+
+bool UI::Intervalometer::appendSegment(ramp_t ramp) {
+  if ((m_Program.count >= PROGRAM_MAX_SEGMENTS)
+      || ((m_Program.count > 0) && (m_Program.segment[m_Program.count - 1].count == 0))) {
+    return false;
+  }
+
+  // the spinner values form a single segment program
+  program_t single = Sequencer::toProgram(toInterval());
+  segment_t segment = single.segment[0];
+
+  if ((ramp != RAMP_NONE) && (segment.count > 1)) {
+    segment.ramp = ramp;
+    segment.interval = m_RampFrom.intervalEnd;
+    segment.shutter = m_RampFrom.shutterEnd;
+    if (!Schedule::isValid(segment)) {
+      return false;
+    }
+  }
+
+  if (m_Program.count == 0) {
+    m_Program.wait = single.wait;
+  }
+  m_Program.segment[m_Program.count++] = segment;
+  m_RampFrom = segment;
+  Settings::save<Settings::PROGRAM>(m_Program);
+  updateProgramLabel();
+
+  return true;
+}
+
+void UI::Intervalometer::clearProgram(void) {
+  m_Program.count = 0;
+  resetRamp();
+  Settings::save<Settings::PROGRAM>(m_Program);
+  updateProgramLabel();
+}
+
+void UI::Intervalometer::resetRamp(void) {
+  if (m_Program.count > 0) {
+    m_RampFrom = m_Program.segment[m_Program.count - 1];
+  } else {
+    m_RampFrom = Sequencer::toProgram(toInterval()).segment[0];
+  }
+}
+
+void UI::Intervalometer::updateProgramLabel(void) {
+  if (m_ProgramLabel == nullptr) {
+    // page not built yet
+    return;
+  }
+
+  if (m_Program.count == 0) {
+    lv_obj_add_state(m_ProgramStart, LV_STATE_DISABLED);
+    lv_label_set_text(m_ProgramLabel, "Empty");
+    return;
+  }
+  lv_obj_remove_state(m_ProgramStart, LV_STATE_DISABLED);
+
+  std::string text;
+  for (uint8_t i = 0; i < m_Program.count; i++) {
+    const segment_t &segment = m_Program.segment[i];
+    const std::string interval = toMs(segment.interval);
+    const std::string shutter = toMs(segment.shutter);
+    char line[96];
+
+    const char *ramp = "";
+    switch (segment.ramp) {
+      case RAMP_LINEAR:
+        ramp = " lin";
+        break;
+      case RAMP_EXPONENTIAL:
+        ramp = " exp";
+        break;
+      default:
+        break;
+    }
+
+    if (segment.count == 0) {
+      snprintf(line, sizeof(line), "%u: inf x %sms/%sms", i + 1, interval.c_str(),
+               shutter.c_str());
+    } else if (segment.ramp == RAMP_NONE) {
+      snprintf(line, sizeof(line), "%u: %u x %sms/%sms", i + 1, segment.count, interval.c_str(),
+               shutter.c_str());
+    } else {
+      snprintf(line, sizeof(line), "%u: %u x %s>%sms/%s>%sms%s", i + 1, segment.count,
+               interval.c_str(), toMs(segment.intervalEnd).c_str(), shutter.c_str(),
+               toMs(segment.shutterEnd).c_str(), ramp);
+    }
+
+    if (!text.empty()) {
+      text += "\n";
+    }
+    text += line;
+  }
+
+  lv_label_set_text(m_ProgramLabel, text.c_str());
 }
 
 void UI::Intervalometer::Spinner::update(void) {
@@ -25,11 +153,7 @@ void UI::Intervalometer::Spinner::update(void) {
     m_SpinValue.m_Unit = SpinValue::UNIT_NIL;
     lv_obj_clear_flag(m_RowSpinners, LV_OBJ_FLAG_HIDDEN);
 
-    uint32_t h = lv_roller_get_selected(m_Roller[0]);
-    uint32_t t = lv_roller_get_selected(m_Roller[1]);
-    uint32_t u = lv_roller_get_selected(m_Roller[2]);
-
-    m_SpinValue.m_Value = (h * 100) + (t * 10) + u;
+    m_SpinValue.m_Value = lv_spinbox_get_value(m_Spinbox);
   }
 
   if (m_RollerUnit != nullptr) {
@@ -44,6 +168,9 @@ void UI::Intervalometer::Spinner::update(void) {
       case 2:
         m_SpinValue.m_Unit = SpinValue::UNIT_MIN;
         break;
+      case 3:
+        m_SpinValue.m_Unit = SpinValue::UNIT_HOUR;
+        break;
     }
   }
   updateLabels();
@@ -52,29 +179,29 @@ void UI::Intervalometer::Spinner::update(void) {
 }
 
 void UI::Intervalometer::Spinner::updateLabels(void) {
+  char value[16];
+  m_SpinValue.toString(value, sizeof(value));
+
   switch (m_SpinValue.m_Unit) {
     case SpinValue::UNIT_INF:
       lv_label_set_text_fmt(m_Value, "Infinite");
       break;
 
     case SpinValue::UNIT_NIL:
-      lv_label_set_text_fmt(m_Value, "%u", m_SpinValue.m_Value);
+      lv_label_set_text_fmt(m_Value, "%s", value);
       break;
 
     default:
-      lv_label_set_text_fmt(m_Value, "%u %s", m_SpinValue.m_Value, m_SpinValue.getUnitString());
+      lv_label_set_text_fmt(m_Value, "%s %s", value, m_SpinValue.getUnitString());
       break;
   }
 
-  if (m_SpinValue.m_Unit != SpinValue::UNIT_INF) {
-    // Update rollers
-    uint32_t h = m_SpinValue.m_Value / 100;
-    uint32_t t = (m_SpinValue.m_Value % 100) / 10;
-    uint32_t u = (m_SpinValue.m_Value % 10);
-
-    lv_roller_set_selected(m_Roller[0], h, LV_ANIM_ON);
-    lv_roller_set_selected(m_Roller[1], t, LV_ANIM_ON);
-    lv_roller_set_selected(m_Roller[2], u, LV_ANIM_ON);
+  // spinbox is only created when the page is first shown
+  if ((m_SpinValue.m_Unit != SpinValue::UNIT_INF) && (m_Spinbox != nullptr)) {
+    // Update spinbox
+    if (static_cast<uint32_t>(lv_spinbox_get_value(m_Spinbox)) != m_SpinValue.m_Value) {
+      lv_spinbox_set_value(m_Spinbox, m_SpinValue.m_Value);
+    }
 
     if (m_SpinValue.m_Unit != SpinValue::UNIT_NIL) {
       uint32_t i = 0;
@@ -88,6 +215,9 @@ void UI::Intervalometer::Spinner::updateLabels(void) {
         case SpinValue::UNIT_MIN:
           i = 2;
           break;
+        case SpinValue::UNIT_HOUR:
+          i = 3;
+          break;
         default:
           break;
       }
@@ -3,9 +3,11 @@
 #include "Device.h"
 #include "Scan.h"
 
+#include "FurbleBoot.h"
 #include "FurbleControl.h"
 #include "FurblePlatform.h"
 #include "FurbleSettings.h"
+#include "FurbleTrigger.h"
 #include "FurbleUI.h"
 
 extern "C" {
@@ -13,7 +15,10 @@ extern "C" {
 static void vUITask(void *param) {
   using namespace Furble;
   auto interval = Settings::load<Settings::INTERVAL>();
+  GPS::getInstance();
+  BootProfile::mark(BootProfile::GPS);
   auto ui = UI(interval);
+  BootProfile::mark(BootProfile::UI);
 
   ui.task();
 }
@@ -22,11 +27,16 @@ void app_main() {
   BaseType_t xRet;
   TaskHandle_t xControlHandle = NULL;
 
+  Furble::BootProfile::mark(Furble::BootProfile::STARTUP);
+
   ESP_LOGI(LOG_TAG, "furble version: '%s'", FURBLE_VERSION);
 
   Furble::Platform::init();
+  Furble::BootProfile::mark(Furble::BootProfile::PLATFORM);
   Furble::Settings::init();
+  Furble::BootProfile::mark(Furble::BootProfile::SETTINGS);
   Furble::Device::init(Furble::Settings::load<esp_power_level_t>(Furble::Settings::TX_POWER));
+  Furble::BootProfile::mark(Furble::BootProfile::DEVICE);
 
   auto &control = Furble::Control::getInstance();
   xRet = xTaskCreate(control_task, "control", 8192, &control, 4, &xControlHandle);
@@ -34,6 +44,10 @@ void app_main() {
     ESP_LOGE(LOG_TAG, "Failed to create control task.");
     abort();
   }
+  Furble::BootProfile::mark(Furble::BootProfile::CONTROL);
+
+  Furble::Trigger::getInstance().begin();
+  Furble::BootProfile::mark(Furble::BootProfile::TRIGGER);
 
   // Run UI in host task (here)
   vUITask(NULL);
@@ -0,0 +1,178 @@
+/**
+ * Replay simulated trigger input edges through the debounce filter on the host.
+ *
+ * The filter is driven as the trigger task drives it: every raw edge is fed
+ * in as it arrives from the interrupt, and whilst a change is pending the
+ * input is sampled again one debounce period after the last event. Checks
+ * contact bounce, glitch rejection, short sync pulses and that each accepted
+ * edge carries the time of the raw edge behind it, then replays randomised
+ * bouncing presses, eg.:
+ *
+ *   c++ -O2 -std=c++17 -Iinclude tools/edge_sim.cpp src/FurbleEdge.cpp -o edge_sim
+ *   ./edge_sim [presses] [bounce_us]
+ */
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "FurbleEdge.h"
+
+using Furble::EdgeFilter;
+
+// as the trigger task
+static constexpr int64_t DEBOUNCE_US = 5000;
+static constexpr int64_t NEVER = std::numeric_limits<int64_t>::max();
+
+typedef struct {
+  EdgeFilter::edge_t edge;
+  /** Time the edge was accepted. */
+  int64_t accepted;
+  /** Raw edge time reported by the filter. */
+  int64_t time;
+} result_t;
+
+typedef std::vector<std::pair<int64_t, int>> levels_t;
+
+/** Feed raw level changes, sampling pending changes as the trigger task does. */
+static std::vector<result_t> replay(const levels_t &levels, bool activeLow, int64_t end) {
+  EdgeFilter filter(DEBOUNCE_US, activeLow);
+  std::vector<result_t> results;
+  int level = activeLow ? 1 : 0;
+  int64_t wake = NEVER;
+  size_t i = 0;
+
+  filter.reset(0, level);
+  while (true) {
+    const int64_t next = (i < levels.size()) ? levels[i].first : NEVER;
+    int64_t now;
+
+    if ((wake < next) && (wake <= end)) {
+      // queue receive timed out, sample the pin
+      now = wake;
+    } else if (next <= end) {
+      // interrupt
+      now = next;
+      level = levels[i++].second;
+    } else {
+      break;
+    }
+
+    EdgeFilter::edge_t edge = filter.update(now, level);
+    if (edge != EdgeFilter::EDGE_NONE) {
+      results.push_back({edge, now, filter.getEdgeTime()});
+    }
+    wake = filter.isPending() ? (now + DEBOUNCE_US) : NEVER;
+  }
+
+  return results;
+}
+
+/** Bounce around a clean transition to level at time. */
+static void bounce(levels_t &levels, int64_t time, int level, int count, int64_t period) {
+  for (int i = 0; i < count; i++) {
+    levels.push_back({time + (2 * i * period), level});
+    levels.push_back({time + ((2 * i + 1) * period), !level});
+  }
+  levels.push_back({time + (2 * count * period), level});
+}
+
+static bool check(const char *name,
+                  const std::vector<result_t> &results,
+                  const std::vector<result_t> &expected) {
+  bool pass = results.size() == expected.size();
+
+  for (size_t i = 0; pass && (i < results.size()); i++) {
+    pass = (results[i].edge == expected[i].edge) && (results[i].accepted == expected[i].accepted)
+           && (results[i].time == expected[i].time);
+  }
+
+  std::printf("%-24s %s\n", name, pass ? "pass" : "FAIL");
+  if (!pass) {
+    for (const auto &result : results) {
+      std::printf("  %s accepted %lldus, edge %lldus\n",
+                  (result.edge == EdgeFilter::EDGE_ASSERT) ? "assert" : "deassert",
+                  (long long)result.accepted, (long long)result.time);
+    }
+  }
+
+  return pass;
+}
+
+int main(int argc, char **argv) {
+  const int presses = (argc > 1) ? std::atoi(argv[1]) : 10000;
+  const int64_t maxBounce = (argc > 2) ? std::atoll(argv[2]) : 2000;
+  const auto ASSERT = EdgeFilter::EDGE_ASSERT;
+  const auto DEASSERT = EdgeFilter::EDGE_DEASSERT;
+  bool pass = true;
+
+  // clean press and release, accepted on arrival
+  pass &= check("clean", replay({{1000, 0}, {100000, 1}}, true, 200000),
+                {{ASSERT, 1000, 1000}, {DEASSERT, 100000, 100000}});
+
+  // bounces inside the debounce period are swallowed
+  {
+    levels_t levels;
+    bounce(levels, 1000, 0, 5, 100);
+    bounce(levels, 100000, 1, 5, 100);
+    pass &= check("contact bounce", replay(levels, true, 200000),
+                  {{ASSERT, 1000, 1000}, {DEASSERT, 100000, 100000}});
+  }
+
+  // a dropout shorter than the debounce period after an edge is rejected
+  pass &= check("glitch rejected", replay({{1000, 0}, {3000, 1}, {3500, 0}}, true, 50000),
+                {{ASSERT, 1000, 1000}});
+
+  // bounce ending released inside the period, settled by the next sample
+  // and timestamped with the raw edge, not the sample
+  pass &= check("settled by sample", replay({{1000, 0}, {2000, 1}}, true, 50000),
+                {{ASSERT, 1000, 1000}, {DEASSERT, 7000, 2000}});
+
+  // strobe sync pulse far shorter than the debounce period
+  pass &= check("short sync pulse", replay({{1000, 0}, {1050, 1}}, true, 50000),
+                {{ASSERT, 1000, 1000}, {DEASSERT, 6050, 1050}});
+
+  // active high input
+  pass &= check("active high", replay({{1000, 1}, {100000, 0}}, false, 200000),
+                {{ASSERT, 1000, 1000}, {DEASSERT, 100000, 100000}});
+
+  // randomised bouncing presses, each must give one assert and one deassert
+  // timestamped at its first raw edge
+  std::mt19937 rng(1);
+  std::uniform_int_distribution<int> bounces(0, 8);
+  std::uniform_int_distribution<int64_t> period(10, maxBounce / 16);
+  std::uniform_int_distribution<int64_t> hold(DEBOUNCE_US * 2, 500000);
+  levels_t levels;
+  std::vector<result_t> expected;
+  int64_t time = 10000;
+
+  for (int i = 0; i < presses; i++) {
+    bounce(levels, time, 0, bounces(rng), period(rng));
+    expected.push_back({ASSERT, time, time});
+    time += hold(rng);
+
+    bounce(levels, time, 1, bounces(rng), period(rng));
+    expected.push_back({DEASSERT, time, time});
+    time += hold(rng);
+  }
+
+  const auto results = replay(levels, true, time);
+  uint64_t worst = 0;
+  size_t matched = 0;
+  for (size_t i = 0; (i < results.size()) && (i < expected.size()); i++) {
+    if ((results[i].edge == expected[i].edge) && (results[i].time == expected[i].time)) {
+      matched++;
+    }
+    worst = std::max<uint64_t>(worst, results[i].accepted - results[i].time);
+  }
+
+  const bool random = (results.size() == expected.size()) && (matched == expected.size());
+  std::printf("%-24s %s, %zu/%zu edges, worst edge to accept %lluus\n", "random bounce",
+              random ? "pass" : "FAIL", matched, expected.size(), (unsigned long long)worst);
+  pass &= random;
+
+  return pass ? 0 : 1;
+}
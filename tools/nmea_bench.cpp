@@ -0,0 +1,76 @@
+/**
+ * Replay recorded NMEA logs through the GPS sentence filter on the host.
+ *
+ * Reports filter throughput and what was accepted, skipped and rejected, in
+ * receive chunks of the given size. Capture a log from the GPS unit with any
+ * serial terminal, eg.:
+ *
+ *   c++ -O2 -std=c++17 -Iinclude tools/nmea_bench.cpp src/FurbleNMEA.cpp -o nmea_bench
+ *   ./nmea_bench capture.nmea [chunk] [repeat]
+ */
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include "FurbleNMEA.h"
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    std::fprintf(stderr, "usage: %s <log> [chunk] [repeat]\n", argv[0]);
+    return 1;
+  }
+
+  std::ifstream file(argv[1], std::ios::binary);
+  if (!file) {
+    std::fprintf(stderr, "failed to open %s\n", argv[1]);
+    return 1;
+  }
+  const std::vector<char> log((std::istreambuf_iterator<char>(file)),
+                              std::istreambuf_iterator<char>());
+  const size_t chunk = (argc > 2) ? std::strtoul(argv[2], NULL, 0) : 512;
+  const unsigned int repeat = (argc > 3) ? std::strtoul(argv[3], NULL, 0) : 100;
+
+  if (log.empty() || (chunk == 0) || (repeat == 0)) {
+    std::fprintf(stderr, "nothing to replay\n");
+    return 1;
+  }
+
+  Furble::NMEAFilter filter;
+  size_t accepted = 0;
+  // keep the accepted sentences live
+  uint32_t sum = 0;
+
+  const auto start = std::chrono::steady_clock::now();
+  for (unsigned int i = 0; i < repeat; i++) {
+    for (size_t offset = 0; offset < log.size(); offset += chunk) {
+      const char *data = &log[offset];
+      size_t len = std::min(chunk, log.size() - offset);
+      size_t length;
+
+      while (const char *sentence = filter.next(data, len, length)) {
+        accepted += length;
+        sum += sentence[length / 2];
+      }
+    }
+  }
+  const auto end = std::chrono::steady_clock::now();
+
+  const double seconds = std::chrono::duration<double>(end - start).count();
+  const auto &stats = filter.getStats();
+
+  std::printf("log:        %zu bytes, chunk %zu, repeat %u\n", log.size(), chunk, repeat);
+  std::printf("throughput: %.1f MB/s, %.0f sentences/s\n", stats.bytes / seconds / 1e6,
+              stats.sentences / seconds);
+  std::printf("per repeat: %.1f us\n", seconds * 1e6 / repeat);
+  std::printf("accepted:   %lu sentences, %zu bytes (%.1f%%)\n",
+              (unsigned long)(stats.sentences / repeat), accepted / repeat,
+              100.0 * accepted / stats.bytes);
+  std::printf("ignored:    %lu\n", (unsigned long)(stats.ignored / repeat));
+  std::printf("checksum:   %lu\n", (unsigned long)(stats.checksum / repeat));
+  std::printf("oversize:   %lu\n", (unsigned long)(stats.oversize / repeat));
+
+  return (sum == 0) ? 2 : 0;
+}
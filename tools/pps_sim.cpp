@@ -0,0 +1,85 @@
+/**
+ * Replay synthetic PPS edges through the clock discipline loop on the host.
+ *
+ * The local clock runs with the given frequency error and an initial offset,
+ * each edge is timestamped with uniform interrupt jitter and an occasional
+ * late edge. Reports the error of the disciplined clock against true UTC,
+ * at the edges and half way between them, once locked, eg.:
+ *
+ *   c++ -O2 -std=c++17 -Iinclude tools/pps_sim.cpp src/FurbleClock.cpp -o pps_sim
+ *   ./pps_sim [ppm] [jitter_us] [seconds]
+ */
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+#include "FurbleClock.h"
+
+using Furble::PPSDiscipline;
+
+int main(int argc, char **argv) {
+  const double ppm = (argc > 1) ? std::atof(argv[1]) : 40.0;
+  const int64_t jitter = (argc > 2) ? std::atoll(argv[2]) : 20;
+  const int seconds = (argc > 3) ? std::atoi(argv[3]) : 600;
+
+  // local = offset + utc_elapsed * (1 + ppm)
+  const int64_t epoch = 1760000000LL * PPSDiscipline::SECOND_US;
+  const int64_t offset = 12345678;
+  auto local = [&](int64_t utc) {
+    return offset + (int64_t)std::llround((utc - epoch) * (1.0 + ppm * 1e-6));
+  };
+
+  std::mt19937 rng(1);
+  std::uniform_int_distribution<int64_t> noise(0, jitter);
+  std::uniform_int_distribution<int> glitch(0, 99);
+
+  PPSDiscipline discipline;
+  int lockedAt = -1;
+  int64_t worst = 0;
+  int64_t worstMid = 0;
+  double sum = 0;
+  int samples = 0;
+
+  for (int s = 0; s < seconds; s++) {
+    const int64_t utc = epoch + (s * PPSDiscipline::SECOND_US);
+    int64_t edge = local(utc) + noise(rng);
+    // interrupt held off by a flash write or radio
+    if (glitch(rng) == 0) {
+      edge += 5000;
+    }
+    discipline.pulse(edge, utc);
+
+    const auto &model = discipline.getModel();
+    if (!PPSDiscipline::isLocked(model, edge)) {
+      continue;
+    }
+    if (lockedAt < 0) {
+      lockedAt = s;
+    }
+    // let the loop settle before scoring it
+    if (s < (lockedAt + 30)) {
+      continue;
+    }
+
+    const int64_t mid = utc + (PPSDiscipline::SECOND_US / 2);
+    const int64_t error = PPSDiscipline::toUTC(model, local(mid)) - mid;
+    const int64_t back = PPSDiscipline::toLocal(model, mid) - local(mid);
+    worstMid = std::max(worstMid, std::max(std::abs(error), std::abs(back)));
+    worst = std::max(worst, (int64_t)std::abs(discipline.getStats().error));
+    sum += std::fabs((double)error);
+    samples++;
+  }
+
+  const auto &model = discipline.getModel();
+  const auto &stats = discipline.getStats();
+  std::printf("clock %+.1fppm, jitter %lldus, %d edges\n", ppm, (long long)jitter, seconds);
+  std::printf("locked after %ds, estimated %+.2fppm\n", lockedAt, model.rate * 1e6);
+  std::printf("accepted %u, rejected %u, steps %u, average edge error %uus\n", stats.pulses,
+              stats.outliers, stats.steps, stats.jitter);
+  std::printf("worst edge error %lldus, worst mid second error %lldus, mean %.1fus\n",
+              (long long)worst, (long long)worstMid, samples ? (sum / samples) : 0.0);
+
+  return (lockedAt >= 0) && (worstMid <= (jitter + 10)) ? 0 : 1;
+}
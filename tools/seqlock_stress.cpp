@@ -0,0 +1,132 @@
+/**
+ * Stress the GPS snapshot seqlock on the host.
+ *
+ * One writer publishes a value whose every field is derived from a counter
+ * whilst several readers load it as fast as they can. A reader fails on a
+ * torn value (fields from different stores), a value that does not match
+ * the version returned with it, or a version going backwards, eg.:
+ *
+ *   c++ -O2 -std=c++17 -pthread -Iinclude tools/seqlock_stress.cpp -o seqlock_stress
+ *   ./seqlock_stress [stores] [readers]
+ */
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include "FurbleSeqLock.h"
+
+using Furble::SeqLock;
+
+// mixed field sizes, larger than a cache line, as the GPS snapshot
+typedef struct {
+  uint32_t counter;
+  double latitude;
+  double longitude;
+  uint8_t satellites;
+  uint16_t year;
+  uint64_t fill[8];
+  uint32_t check;
+} value_t;
+
+static value_t makeValue(uint32_t counter) {
+  value_t value = {};
+
+  value.counter = counter;
+  value.latitude = counter * 0.5;
+  value.longitude = -(counter * 0.25);
+  value.satellites = counter & 0xff;
+  value.year = counter & 0xffff;
+  for (size_t i = 0; i < 8; i++) {
+    value.fill[i] = ((uint64_t)counter << 32) | i;
+  }
+  value.check = ~counter;
+
+  return value;
+}
+
+static bool isConsistent(const value_t &value) {
+  const value_t expected = makeValue(value.counter);
+  bool consistent = (value.latitude == expected.latitude)
+                    && (value.longitude == expected.longitude)
+                    && (value.satellites == expected.satellites) && (value.year == expected.year)
+                    && (value.check == expected.check);
+
+  for (size_t i = 0; i < 8; i++) {
+    consistent &= (value.fill[i] == expected.fill[i]);
+  }
+
+  return consistent;
+}
+
+typedef struct {
+  uint64_t loads;
+  uint64_t torn;
+  uint64_t mismatched;
+  uint64_t backwards;
+} result_t;
+
+int main(int argc, char **argv) {
+  const uint32_t stores = (argc > 1) ? std::atoi(argv[1]) : 2000000;
+  const int readers = (argc > 2) ? std::atoi(argv[2]) : 4;
+
+  SeqLock<value_t> lock;
+  std::atomic<bool> done(false);
+  std::vector<result_t> results(readers, result_t {});
+  std::vector<std::thread> threads;
+
+  for (int i = 0; i < readers; i++) {
+    threads.emplace_back([&lock, &done, &result = results[i]]() {
+      uint32_t last = 0;
+
+      while (!done.load(std::memory_order_relaxed)) {
+        value_t value;
+        const uint32_t version = lock.load(value);
+
+        result.loads++;
+        if (version == 0) {
+          // initial all zero value, before the first store
+          continue;
+        }
+        if (!isConsistent(value)) {
+          result.torn++;
+        }
+        // the value stored at version n carries counter n
+        if (value.counter != version) {
+          result.mismatched++;
+        }
+        if (version < last) {
+          result.backwards++;
+        }
+        last = version;
+      }
+    });
+  }
+
+  for (uint32_t counter = 1; counter <= stores; counter++) {
+    lock.store(makeValue(counter));
+  }
+  done = true;
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  bool pass = (lock.getVersion() == stores) && isConsistent(lock.load())
+              && (lock.load().counter == stores);
+
+  for (int i = 0; i < readers; i++) {
+    const result_t &result = results[i];
+    const bool ok = (result.torn == 0) && (result.mismatched == 0) && (result.backwards == 0);
+
+    std::printf("reader %d: %llu loads, %llu torn, %llu mismatched, %llu backwards, %s\n", i,
+                (unsigned long long)result.loads, (unsigned long long)result.torn,
+                (unsigned long long)result.mismatched, (unsigned long long)result.backwards,
+                ok ? "pass" : "FAIL");
+    pass &= ok;
+  }
+  std::printf("%u stores, %s\n", stores, pass ? "pass" : "FAIL");
+
+  return pass ? 0 : 1;
+}
@@ -0,0 +1,123 @@
+/**
+ * Run intervalometer programs against a virtual clock on the host.
+ *
+ * Each frame the sequencer task wakes with uniform latency and an occasional
+ * long preemption, presses, and sleeps until the next deadline, as on the
+ * device. Reports the drift of the deadlines from the programmed timeline
+ * and the worst press error, for a constant program and each ramp type, eg.:
+ *
+ *   c++ -O2 -std=c++17 -Iinclude tools/sequencer_sim.cpp src/FurbleSchedule.cpp -o sequencer_sim
+ *   ./sequencer_sim [frames] [jitter_us]
+ */
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+#include "FurbleSchedule.h"
+
+using Furble::program_t;
+using Furble::Schedule;
+using Furble::segment_t;
+
+static program_t makeProgram(uint16_t frames, Furble::ramp_t ramp, uint64_t from, uint64_t to) {
+  program_t program = {};
+  program.version = Furble::PROGRAM_VERSION;
+  program.count = 1;
+  program.wait = 2000000;
+
+  segment_t &segment = program.segment[0];
+  segment.count = frames;
+  segment.ramp = ramp;
+  segment.interval = from;
+  segment.intervalEnd = to;
+  segment.shutter = 200000;
+  segment.shutterEnd = 200000;
+
+  return program;
+}
+
+/** Programmed press of a frame, microseconds from the start. */
+static long double expected(const segment_t &segment, uint64_t wait, uint32_t frame) {
+  const long double steps = segment.count - 1;
+  const long double from = segment.interval;
+  const long double to = segment.intervalEnd;
+  long double elapsed = wait;
+
+  for (uint32_t i = 0; i < frame; i++) {
+    switch (segment.ramp) {
+      case Furble::RAMP_LINEAR:
+        elapsed += from + ((to - from) * i / steps);
+        break;
+      case Furble::RAMP_EXPONENTIAL:
+        elapsed += from * std::pow(to / from, i / steps);
+        break;
+      default:
+        elapsed += from;
+        break;
+    }
+  }
+
+  return elapsed;
+}
+
+static bool run(const char *name, const program_t &program, int64_t jitter, std::mt19937 &rng) {
+  std::uniform_int_distribution<int64_t> latency(0, jitter);
+  std::uniform_int_distribution<int> glitch(0, 99);
+
+  // arbitrary boot time, the schedule is relative to the start
+  const int64_t start = 123456789;
+  Schedule schedule;
+  if (!schedule.begin(program, start)) {
+    std::printf("%s: rejected\n", name);
+    return false;
+  }
+
+  const segment_t &segment = program.segment[0];
+  int64_t now = start;
+  int64_t worstDrift = 0;
+  int64_t worstPress = 0;
+  uint32_t frames = 0;
+
+  do {
+    const int64_t deadline = schedule.getPress();
+    // a press never lands before its deadline
+    now = std::max(now, deadline) + latency(rng);
+    if (glitch(rng) == 0) {
+      // held off by the radio or a flash write
+      now += 5000;
+    }
+
+    const long double ideal = start + expected(segment, program.wait, frames);
+    worstDrift = std::max(worstDrift, (int64_t)std::llround(std::fabs(deadline - ideal)));
+    worstPress = std::max(worstPress, now - deadline);
+
+    // release, then sleep until the next press
+    now += schedule.getShutter() + latency(rng);
+    frames++;
+  } while (schedule.advance());
+
+  const bool pass = (frames == schedule.getTotal()) && (worstDrift <= 1);
+  std::printf("%s: %u frames over %.1fs, worst drift %lldus, worst press error %lldus, %s\n", name,
+              frames, (now - start) / 1e6, (long long)worstDrift, (long long)worstPress,
+              pass ? "pass" : "FAIL");
+
+  return pass;
+}
+
+int main(int argc, char **argv) {
+  const uint16_t frames = (argc > 1) ? std::atoi(argv[1]) : 1000;
+  const int64_t jitter = (argc > 2) ? std::atoll(argv[2]) : 2000;
+
+  std::mt19937 rng(1);
+  bool pass = true;
+
+  // microseconds, the constant interval below millisecond resolution
+  pass &= run("constant", makeProgram(frames, Furble::RAMP_NONE, 1500250, 1500250), jitter, rng);
+  pass &= run("linear", makeProgram(frames, Furble::RAMP_LINEAR, 1000000, 5000000), jitter, rng);
+  pass &= run("exponential", makeProgram(frames, Furble::RAMP_EXPONENTIAL, 1000000, 8000000),
+              jitter, rng);
+
+  return pass ? 0 : 1;
+}
@@ -0,0 +1,106 @@
+#!/usr/bin/env python3
+"""Decode a furble intervalometer shot log from a serial console capture.
+
+Select 'Export Log' in the Intervalometer menu while capturing the console,
+eg.:
+
+  pio device monitor | tee capture.txt
+  tools/shotlog.py capture.txt > shots.csv
+"""
+
+import argparse
+import datetime
+import struct
+import sys
+
+MAGIC_V1 = 0x314C5346  # 'FSL1'
+MAGIC_V2 = 0x324C5346  # 'FSL2'
+MAGIC_V3 = 0x334C5346  # 'FSL3'
+HEADER_V1 = struct.Struct("<IIIiiiHBB")
+HEADER_V2 = struct.Struct("<IIIIIiiiHBB")
+HEADER_V3 = struct.Struct("<IIIIIIiiiHBB")
+SHOT_V1 = struct.Struct("<IiiI")
+SHOT_V2 = struct.Struct("<IiiHH")
+SHOT_V3 = struct.Struct("<IiiHHq")
+PREFIX = "shotlog: "
+
+
+def extract(lines):
+  """Return the binary blob of the last exported log in the capture."""
+  blob = None
+  last = None
+  for line in lines:
+    idx = line.find(PREFIX)
+    if idx < 0:
+      continue
+    payload = line[idx + len(PREFIX):].strip()
+    if payload.startswith("begin"):
+      blob = bytearray()
+    elif payload == "end":
+      if blob is not None:
+        last = bytes(blob)
+    elif blob is not None:
+      blob += bytes.fromhex(payload)
+  if last is None:
+    sys.exit("No complete shot log found.")
+  return last
+
+
+def utc(micros):
+  """Format UTC microseconds since the epoch, empty if unknown."""
+  if micros == 0:
+    return ""
+  epoch = datetime.datetime(1970, 1, 1, tzinfo=datetime.timezone.utc)
+  stamp = epoch + datetime.timedelta(microseconds=micros)
+  return stamp.isoformat(timespec="microseconds").replace("+00:00", "Z")
+
+
+def main():
+  parser = argparse.ArgumentParser(description=__doc__,
+                                   formatter_class=argparse.RawDescriptionHelpFormatter)
+  parser.add_argument("capture", nargs="?", type=argparse.FileType("r"), default=sys.stdin)
+  args = parser.parse_args()
+
+  blob = extract(args.capture)
+  (magic,) = struct.unpack_from("<I", blob)
+  if magic == MAGIC_V1:
+    header, shot = HEADER_V1, SHOT_V1
+    (_, frames, late, mean, stddev, worst, count, targets, _) = header.unpack_from(blob)
+    missed = delayed = locked = 0
+  elif magic == MAGIC_V2:
+    header, shot = HEADER_V2, SHOT_V2
+    (_, frames, late, missed, delayed, mean, stddev, worst, count, targets,
+     _) = header.unpack_from(blob)
+    locked = 0
+  elif magic == MAGIC_V3:
+    header, shot = HEADER_V3, SHOT_V3
+    (_, frames, late, missed, delayed, locked, mean, stddev, worst, count, targets,
+     _) = header.unpack_from(blob)
+  else:
+    sys.exit("Unknown shot log format 0x{:08x}.".format(magic))
+  if len(blob) != header.size + count * shot.size:
+    sys.exit("Truncated shot log.")
+
+  print("# frames={} late={} missed={} delayed={} locked={} targets={} mean={}us sd={}us "
+        "max={}us".format(frames, late, missed, delayed, locked, targets, mean, stddev, worst),
+        file=sys.stderr)
+
+  width = max(targets, 1)
+  print("frame,scheduled_ms,press_us,release_us,sent,dispatched,utc")
+  first = frames + missed - count + 1
+  for i in range(count):
+    fields = shot.unpack_from(blob, header.size + i * shot.size)
+    stamp = 0
+    if magic == MAGIC_V1:
+      scheduled, press, release, dispatched = fields
+      sent = (1 << targets) - 1
+    elif magic == MAGIC_V2:
+      scheduled, press, release, sent, dispatched = fields
+    else:
+      scheduled, press, release, sent, dispatched, stamp = fields
+    print("{},{},{},{},{:0{}b},{:0{}b},{}".format(first + i, scheduled, press, release, sent,
+                                                  width, dispatched, width, utc(stamp)))
+
+
+if __name__ == "__main__":
+  main()
@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+"""Convert a furble GPS track log from a serial console capture to GPX.
+
+Select 'Export Track' in the GPS menu while capturing the console, eg.:
+
+  pio device monitor | tee capture.txt
+  tools/tracklog.py capture.txt > track.gpx
+"""
+
+import argparse
+import datetime
+import struct
+import sys
+from xml.sax.saxutils import escape
+
+MAGIC = 0x314B5446  # 'FTK1'
+HEADER = struct.Struct("<II")
+KEYFRAME = struct.Struct("<BIiih")
+PREFIX = "tracklog: "
+
+
+def extract(lines):
+  """Return the sectors of the last exported track, oldest first."""
+  sectors = None
+  last = None
+  for line in lines:
+    idx = line.find(PREFIX)
+    if idx < 0:
+      continue
+    payload = line[idx + len(PREFIX):].strip()
+    if payload == "begin":
+      sectors = []
+    elif payload == "end":
+      if sectors is not None:
+        last = sectors
+    elif sectors is None:
+      continue
+    elif payload.startswith("sector"):
+      sectors.append(bytearray())
+    elif sectors:
+      sectors[-1] += bytes.fromhex(payload)
+  if last is None:
+    sys.exit("no complete track log found")
+  return [bytes(s) for s in last]
+
+
+def varint(data, pos):
+  """Decode a zigzag varint, return (value, next position)."""
+  value = 0
+  shift = 0
+  while True:
+    byte = data[pos]
+    pos += 1
+    value |= (byte & 0x7F) << shift
+    shift += 7
+    if not byte & 0x80:
+      break
+  return (value >> 1) ^ -(value & 1), pos
+
+
+def decode(sector):
+  """Yield (time, latitude, longitude, altitude) from one sector."""
+  magic, _ = HEADER.unpack_from(sector)
+  if magic != MAGIC:
+    return
+  pos = HEADER.size
+  point = None
+  while pos < len(sector):
+    tag = sector[pos]
+    if tag == 0x00:
+      _, time, lat, lon, alt = KEYFRAME.unpack_from(sector, pos)
+      pos += KEYFRAME.size
+      point = [time, lat, lon, alt]
+    elif tag & 0x01 and not tag & 0x80 and point is not None:
+      pos += 1
+      point[0] += tag >> 1
+      for i in range(1, 4):
+        delta, pos = varint(sector, pos)
+        point[i] += delta
+    else:
+      break
+    yield tuple(point)
+
+
+def gpx(points, out):
+  out.write('<?xml version="1.0" encoding="UTF-8"?>\n')
+  out.write('<gpx version="1.1" creator="furble" xmlns="http://www.topografix.com/GPX/1/1">\n')
+  out.write("  <trk>\n    <name>%s</name>\n    <trkseg>\n" % escape("furble"))
+  for time, lat, lon, alt in points:
+    utc = datetime.datetime.fromtimestamp(time, datetime.timezone.utc)
+    out.write('      <trkpt lat="%.6f" lon="%.6f"><ele>%d</ele><time>%s</time></trkpt>\n' %
+              (lat / 1e6, lon / 1e6, alt, utc.strftime("%Y-%m-%dT%H:%M:%SZ")))
+  out.write("    </trkseg>\n  </trk>\n</gpx>\n")
+
+
+def main():
+  parser = argparse.ArgumentParser(description=__doc__,
+                                   formatter_class=argparse.RawDescriptionHelpFormatter)
+  parser.add_argument("capture", type=argparse.FileType("r"), help="console capture")
+  args = parser.parse_args()
+
+  points = []
+  for sector in extract(args.capture):
+    points.extend(decode(sector))
+  points.sort(key=lambda p: p[0])
+  gpx(points, sys.stdout)
+  print("%d points" % len(points), file=sys.stderr)
+
+
+if __name__ == "__main__":
+  main()
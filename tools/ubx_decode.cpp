@@ -0,0 +1,102 @@
+/**
+ * Decode captured u-blox UBX NAV-PVT frames on the host.
+ *
+ * Prints each solution as CSV, as furble would forward it to the cameras,
+ * and reports framing errors. Capture raw receiver output with GPS UBX
+ * enabled, eg.:
+ *
+ *   c++ -O2 -std=c++17 -Iinclude tools/ubx_decode.cpp src/FurbleUBX.cpp -o ubx_decode
+ *   ./ubx_decode capture.ubx > fixes.csv
+ *
+ * Given an expected CSV the output is compared against it instead, the
+ * capture in tools/testdata mixes NMEA, acknowledgements, a corrupt frame
+ * and solutions either side of a date rollover:
+ *
+ *   ./ubx_decode tools/testdata/nav_pvt.ubx tools/testdata/nav_pvt.csv
+ */
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "FurbleUBX.h"
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    std::fprintf(stderr, "usage: %s <capture> [expected.csv]\n", argv[0]);
+    return 1;
+  }
+
+  std::ifstream file(argv[1], std::ios::binary);
+  if (!file) {
+    std::fprintf(stderr, "failed to open %s\n", argv[1]);
+    return 1;
+  }
+  const std::vector<char> capture((std::istreambuf_iterator<char>(file)),
+                                  std::istreambuf_iterator<char>());
+
+  Furble::UBXParser parser;
+  Furble::UBXParser::frame_t frame;
+  const uint8_t *data = reinterpret_cast<const uint8_t *>(capture.data());
+  size_t len = capture.size();
+  unsigned int solutions = 0;
+  std::string csv = "itow,utc,fix,satellites,latitude,longitude,altitude,hacc,vacc,tacc,pdop\n";
+
+  while (parser.next(data, len, frame)) {
+    Furble::UBXParser::pvt_t pvt;
+    if (!Furble::UBXParser::decodePVT(frame, pvt)) {
+      continue;
+    }
+    solutions++;
+
+    char line[160];
+    std::snprintf(line, sizeof(line),
+                  "%u,%04u-%02u-%02uT%02u:%02u:%02u.%09ld,%d,%u,%.7f,%.7f,%.3f,%.3f,%.3f,%u,%.2f\n",
+                  (unsigned int)pvt.iTOW, pvt.year, pvt.month, pvt.day, pvt.hour, pvt.minute,
+                  pvt.second, (long)pvt.nano, Furble::UBXParser::hasFix(pvt), pvt.numSV,
+                  pvt.lat * 1e-7, pvt.lon * 1e-7, pvt.hMSL / 1000.0, pvt.hAcc / 1000.0,
+                  pvt.vAcc / 1000.0, (unsigned int)pvt.tAcc, pvt.pDOP * 0.01);
+    csv += line;
+  }
+
+  const auto &stats = parser.getStats();
+  std::fprintf(stderr, "%u bytes, %u frames, %u solutions, %u checksum, %u oversize\n",
+               (unsigned int)stats.bytes, (unsigned int)stats.frames, solutions,
+               (unsigned int)stats.checksum, (unsigned int)stats.oversize);
+
+  if (argc < 3) {
+    std::fputs(csv.c_str(), stdout);
+    return 0;
+  }
+
+  std::ifstream reference(argv[2]);
+  if (!reference) {
+    std::fprintf(stderr, "failed to open %s\n", argv[2]);
+    return 1;
+  }
+
+  std::istringstream decoded(csv);
+  std::string want;
+  std::string got;
+  unsigned int line = 0;
+  bool pass = true;
+
+  while (pass) {
+    const bool haveWant = static_cast<bool>(std::getline(reference, want));
+    const bool haveGot = static_cast<bool>(std::getline(decoded, got));
+    if (!haveWant && !haveGot) {
+      break;
+    }
+    line++;
+    if (!haveWant || !haveGot || (want != got)) {
+      std::printf("line %u differs\n  expected: %s\n  decoded:  %s\n", line,
+                  haveWant ? want.c_str() : "<end>", haveGot ? got.c_str() : "<end>");
+      pass = false;
+    }
+  }
+  std::printf("%u lines, %s\n", line, pass ? "pass" : "FAIL");
+
+  return pass ? 0 : 1;
+}